@@ -50,6 +50,30 @@ macro(configure_bullet)
     endif()
     set(BULLET_LIBRARY_DIRS ${BULLET_HOME}/lib)
     set(BULLET_LIBRARIES BulletDynamics BulletCollision LinearMath)
+    # The headers must see the same BT_THREADSAFE configuration as the library was built with. When possible, verify that
+    # the library is thread-safe: it creates a task scheduler only if built with BULLET2_MULTITHREADING.
+    set(BULLET_DEFINITIONS "")
+    if (BULLET_THREADSAFE AND NOT WIN32 AND NOT CMAKE_CROSSCOMPILING)
+        find_library(BULLET_LINEARMATH_LIBRARY LinearMath PATHS ${BULLET_LIBRARY_DIRS} NO_DEFAULT_PATH)
+        if (BULLET_LINEARMATH_LIBRARY)
+            include(CheckCXXSourceRuns)
+            set(CMAKE_REQUIRED_DEFINITIONS -DBT_THREADSAFE=1)
+            set(CMAKE_REQUIRED_INCLUDES ${BULLET_INCLUDE_DIRS})
+            set(CMAKE_REQUIRED_LIBRARIES ${BULLET_LINEARMATH_LIBRARY} pthread)
+            check_cxx_source_runs("#include <LinearMath/btThreads.h>
+                int main() { return btCreateDefaultTaskScheduler() ? 0 : 1; }" BULLET_LIBRARY_THREADSAFE)
+            unset(CMAKE_REQUIRED_DEFINITIONS)
+            unset(CMAKE_REQUIRED_INCLUDES)
+            unset(CMAKE_REQUIRED_LIBRARIES)
+            if (NOT BULLET_LIBRARY_THREADSAFE)
+                message(WARNING "Bullet in ${BULLET_HOME} is not built with BULLET2_MULTITHREADING, using single-threaded physics. Set BULLET_THREADSAFE to OFF to skip this check.")
+                set(BULLET_THREADSAFE OFF)
+            endif()
+        endif()
+    endif()
+    if (BULLET_THREADSAFE)
+        set(BULLET_DEFINITIONS -DBT_THREADSAFE=1)
+    endif()
     if (WIN32)
         set(BULLET_DEBUG_LIBRARIES BulletDynamics_d BulletCollision_d LinearMath_d)
     endif()
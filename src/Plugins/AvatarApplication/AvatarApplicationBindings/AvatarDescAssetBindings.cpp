@@ -44,14 +44,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -63,6 +57,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_AppearanceChanged_Finalizer(duk_c
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_AppearanceChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_AppearanceChanged* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_AppearanceChanged>(ctx, SignalWrapper_AvatarDescAsset_AppearanceChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -80,6 +75,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_AppearanceChanged_Connect(duk_con
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_AppearanceChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_AppearanceChanged* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_AppearanceChanged>(ctx, SignalWrapper_AvatarDescAsset_AppearanceChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -88,6 +84,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_AppearanceChanged_Disconnect(duk_
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_AppearanceChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_AppearanceChanged* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_AppearanceChanged>(ctx, SignalWrapper_AvatarDescAsset_AppearanceChanged_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -97,7 +94,8 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_AppearanceChanged_Emit(duk_contex
 static duk_ret_t AvatarDescAsset_Get_AppearanceChanged(duk_context* ctx)
 {
     AvatarDescAsset* thisObj = GetThisWeakObject<AvatarDescAsset>(ctx);
-    SignalWrapper_AvatarDescAsset_AppearanceChanged* wrapper = new SignalWrapper_AvatarDescAsset_AppearanceChanged(thisObj, &thisObj->AppearanceChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAppearanceChanged")) return 1;
+    SignalWrapper_AvatarDescAsset_AppearanceChanged* wrapper = new (ctx) SignalWrapper_AvatarDescAsset_AppearanceChanged(thisObj, &thisObj->AppearanceChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_AvatarDescAsset_AppearanceChanged_ID, SignalWrapper_AvatarDescAsset_AppearanceChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_AppearanceChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -107,8 +105,15 @@ static duk_ret_t AvatarDescAsset_Get_AppearanceChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_AppearanceChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_AppearanceChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_AppearanceChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_AppearanceChanged_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAppearanceChanged");
     return 1;
 }
 
@@ -133,14 +138,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -152,6 +151,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Finalize
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged>(ctx, SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -169,6 +169,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Connect(
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged>(ctx, SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -177,6 +178,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Disconne
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged>(ctx, SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -186,7 +188,8 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Emit(duk
 static duk_ret_t AvatarDescAsset_Get_DynamicAppearanceChanged(duk_context* ctx)
 {
     AvatarDescAsset* thisObj = GetThisWeakObject<AvatarDescAsset>(ctx);
-    SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged* wrapper = new SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged(thisObj, &thisObj->DynamicAppearanceChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalDynamicAppearanceChanged")) return 1;
+    SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged* wrapper = new (ctx) SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged(thisObj, &thisObj->DynamicAppearanceChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_ID, SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -196,8 +199,15 @@ static duk_ret_t AvatarDescAsset_Get_DynamicAppearanceChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_DynamicAppearanceChanged_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalDynamicAppearanceChanged");
     return 1;
 }
 
@@ -312,16 +322,10 @@ public:
     void OnSignal(IAsset * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -333,6 +337,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_Unloaded_Finalizer(duk_context* c
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_Unloaded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_Unloaded* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_Unloaded>(ctx, SignalWrapper_AvatarDescAsset_Unloaded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -350,6 +355,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_Unloaded_Connect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_Unloaded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_Unloaded* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_Unloaded>(ctx, SignalWrapper_AvatarDescAsset_Unloaded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -358,6 +364,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_Unloaded_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_Unloaded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_Unloaded* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_Unloaded>(ctx, SignalWrapper_AvatarDescAsset_Unloaded_ID);
     if (!wrapper->owner_) return 0;
     IAsset* param0 = GetWeakObject<IAsset>(ctx, 0);
@@ -368,7 +375,8 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_Unloaded_Emit(duk_context* ctx)
 static duk_ret_t AvatarDescAsset_Get_Unloaded(duk_context* ctx)
 {
     AvatarDescAsset* thisObj = GetThisWeakObject<AvatarDescAsset>(ctx);
-    SignalWrapper_AvatarDescAsset_Unloaded* wrapper = new SignalWrapper_AvatarDescAsset_Unloaded(thisObj, &thisObj->Unloaded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalUnloaded")) return 1;
+    SignalWrapper_AvatarDescAsset_Unloaded* wrapper = new (ctx) SignalWrapper_AvatarDescAsset_Unloaded(thisObj, &thisObj->Unloaded);
     PushValueObject(ctx, wrapper, SignalWrapper_AvatarDescAsset_Unloaded_ID, SignalWrapper_AvatarDescAsset_Unloaded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_Unloaded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -378,8 +386,15 @@ static duk_ret_t AvatarDescAsset_Get_Unloaded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_Unloaded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_Unloaded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_Unloaded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_Unloaded_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalUnloaded");
     return 1;
 }
 
@@ -404,16 +419,10 @@ public:
     void OnSignal(AssetPtr param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0.Get());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -425,6 +434,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_Loaded_Finalizer(duk_context* ctx
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_Loaded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_Loaded* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_Loaded>(ctx, SignalWrapper_AvatarDescAsset_Loaded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -442,6 +452,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_Loaded_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_Loaded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_Loaded* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_Loaded>(ctx, SignalWrapper_AvatarDescAsset_Loaded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -450,6 +461,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_Loaded_Disconnect(duk_context* ct
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_Loaded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_Loaded* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_Loaded>(ctx, SignalWrapper_AvatarDescAsset_Loaded_ID);
     if (!wrapper->owner_) return 0;
     SharedPtr<IAsset> param0(GetWeakObject<IAsset>(ctx, 0));
@@ -460,7 +472,8 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_Loaded_Emit(duk_context* ctx)
 static duk_ret_t AvatarDescAsset_Get_Loaded(duk_context* ctx)
 {
     AvatarDescAsset* thisObj = GetThisWeakObject<AvatarDescAsset>(ctx);
-    SignalWrapper_AvatarDescAsset_Loaded* wrapper = new SignalWrapper_AvatarDescAsset_Loaded(thisObj, &thisObj->Loaded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalLoaded")) return 1;
+    SignalWrapper_AvatarDescAsset_Loaded* wrapper = new (ctx) SignalWrapper_AvatarDescAsset_Loaded(thisObj, &thisObj->Loaded);
     PushValueObject(ctx, wrapper, SignalWrapper_AvatarDescAsset_Loaded_ID, SignalWrapper_AvatarDescAsset_Loaded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_Loaded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -470,8 +483,15 @@ static duk_ret_t AvatarDescAsset_Get_Loaded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_Loaded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_Loaded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_Loaded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_Loaded_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalLoaded");
     return 1;
 }
 
@@ -496,16 +516,10 @@ public:
     void OnSignal(IAsset * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -517,6 +531,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Finalizer(d
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_PropertyStatusChanged* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_PropertyStatusChanged>(ctx, SignalWrapper_AvatarDescAsset_PropertyStatusChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -534,6 +549,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Connect(duk
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_PropertyStatusChanged* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_PropertyStatusChanged>(ctx, SignalWrapper_AvatarDescAsset_PropertyStatusChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -542,6 +558,7 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Disconnect(
 
 static duk_ret_t SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AvatarDescAsset_PropertyStatusChanged* wrapper = GetThisValueObject<SignalWrapper_AvatarDescAsset_PropertyStatusChanged>(ctx, SignalWrapper_AvatarDescAsset_PropertyStatusChanged_ID);
     if (!wrapper->owner_) return 0;
     IAsset* param0 = GetWeakObject<IAsset>(ctx, 0);
@@ -552,7 +569,8 @@ static duk_ret_t SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Emit(duk_co
 static duk_ret_t AvatarDescAsset_Get_PropertyStatusChanged(duk_context* ctx)
 {
     AvatarDescAsset* thisObj = GetThisWeakObject<AvatarDescAsset>(ctx);
-    SignalWrapper_AvatarDescAsset_PropertyStatusChanged* wrapper = new SignalWrapper_AvatarDescAsset_PropertyStatusChanged(thisObj, &thisObj->PropertyStatusChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalPropertyStatusChanged")) return 1;
+    SignalWrapper_AvatarDescAsset_PropertyStatusChanged* wrapper = new (ctx) SignalWrapper_AvatarDescAsset_PropertyStatusChanged(thisObj, &thisObj->PropertyStatusChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_AvatarDescAsset_PropertyStatusChanged_ID, SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -562,8 +580,15 @@ static duk_ret_t AvatarDescAsset_Get_PropertyStatusChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AvatarDescAsset_PropertyStatusChanged_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalPropertyStatusChanged");
     return 1;
 }
 
@@ -49,7 +49,8 @@ namespace Tundra
 BulletPhysics::BulletPhysics(Framework* owner)
 :IModule("BulletPhysics", owner),
 defaultPhysicsUpdatePeriod_(1.0f / 60.0f),
-defaultMaxSubSteps_(6) // If fps is below 10, we start to slow down physics
+defaultMaxSubSteps_(6), // If fps is below 10, we start to slow down physics
+numThreads_(0)
 {
 }
 
@@ -82,6 +83,9 @@ void BulletPhysics::Initialize()
     framework->Console()->RegisterCommand("autoCollisionMesh",
         "Auto-assigns static rigid bodies with collision mesh to all visible meshes.",
         this, &BulletPhysics::AutoCollisionMesh);
+    framework->Console()->RegisterCommand("physicsBenchmark",
+        "Simulates a deterministic scene of box columns single-threaded and multithreaded. Usage: physicsBenchmark(numBodies,numSteps)")->ExecutedWith.Connect(
+        this, &BulletPhysics::RunBenchmarkCommand);
     
     // Check physics execution rate related command line parameters
     StringList params = framework->CommandLineParameters("--physicsRate");
@@ -99,6 +103,19 @@ void BulletPhysics::Initialize()
         if (steps > 0)
             SetDefaultMaxSubSteps(steps);
     }
+
+    // The task scheduler is shared by all physics worlds, and must be set up before creating them
+    params = framework->CommandLineParameters("--physicsThreads");
+    if (!params.Empty())
+    {
+        int threads = Urho3D::ToInt(params.Front());
+        if (threads > 0)
+        {
+            numThreads_ = PhysicsWorld::SetNumThreads(threads);
+            if (numThreads_ > 0)
+                LogInfo("BulletPhysics: Using multithreaded physics with " + String(numThreads_) + " threads.");
+        }
+    }
     
     // Connect to JavaScript module instance creation to be able to expose the physics classes to each instance
     JavaScript* javaScript = framework->Module<JavaScript>();
@@ -108,6 +125,11 @@ void BulletPhysics::Initialize()
 
 void BulletPhysics::Uninitialize()
 {
+    if (numThreads_ > 0)
+    {
+        numThreads_ = 0;
+        PhysicsWorld::SetNumThreads(0);
+    }
 }
 
 void BulletPhysics::ToggleDebugGeometry()
@@ -170,6 +192,39 @@ void BulletPhysics::AutoCollisionMesh()
     }
 }
 
+void BulletPhysics::RunBenchmarkCommand(const StringVector& params)
+{
+    uint numBodies = params.Size() > 0 ? Urho3D::ToUInt(params[0]) : 4096;
+    uint numSteps = params.Size() > 1 ? Urho3D::ToUInt(params[1]) : 300;
+    RunBenchmark(numBodies, numSteps);
+}
+
+void BulletPhysics::RunBenchmark(uint numBodies, uint numSteps)
+{
+    if (numBodies == 0 || numSteps == 0)
+    {
+        LogError("BulletPhysics::RunBenchmark: The number of bodies and steps must be positive.");
+        return;
+    }
+
+    PhysicsBenchmarkResult single = PhysicsWorld::RunBenchmark(false, numBodies, numSteps);
+    LogInfo("BulletPhysics: Benchmark of " + String(numBodies) + " bodies, " + String(numSteps) + " steps: single-threaded " +
+        String(single.msec / numSteps) + " ms per step");
+    if (numThreads_ == 0)
+    {
+        LogInfo("BulletPhysics: Run with --physicsThreads to compare the multithreaded world.");
+        return;
+    }
+
+    PhysicsBenchmarkResult multi = PhysicsWorld::RunBenchmark(true, numBodies, numSteps);
+    float maxDeviation = 0.0f;
+    for(uint i = 0; i < single.positions.Size() && i < multi.positions.Size(); ++i)
+        maxDeviation = Urho3D::Max(maxDeviation, single.positions[i].Distance(multi.positions[i]));
+    LogInfo("BulletPhysics: Benchmark multithreaded on " + String(numThreads_) + " threads " + String(multi.msec / numSteps) +
+        " ms per step, speedup " + String(single.msec / Urho3D::Max(multi.msec, 0.001f)) + "x, largest difference in final positions " +
+        String(maxDeviation));
+}
+
 void BulletPhysics::Update(float frametime)
 {
     URHO3D_PROFILE(BulletPhysics_Update);
@@ -184,7 +239,7 @@ void BulletPhysics::Update(float frametime)
 
 void BulletPhysics::CreatePhysicsWorld(Scene *scene, AttributeChange::Type /*change*/)
 {
-    SharedPtr<PhysicsWorld> newWorld(new PhysicsWorld(scene, !scene->IsAuthority()));
+    SharedPtr<PhysicsWorld> newWorld(new PhysicsWorld(scene, !scene->IsAuthority(), numThreads_ > 0));
     newWorld->SetGravity(scene->UpVector() * -9.81f);
     newWorld->SetPhysicsUpdatePeriod(defaultPhysicsUpdatePeriod_);
     newWorld->SetMaxSubSteps(defaultMaxSubSteps_);
@@ -22,6 +22,14 @@ class IMeshAsset;
 class JavaScriptInstance;
 
 /// Provides physics rendering by utilizing Bullet.
+/** Command line parameters:
+    <ul>
+    <li>--physicsRate [hz]: Physics update rate of new physics worlds.
+    <li>--physicsMaxSteps [num]: Maximum physics substeps per frame of new physics worlds.
+    <li>--physicsThreads [num]: Simulates the physics worlds with the multithreaded Bullet world on num threads.
+    Requires Bullet 2.88 or newer built with BULLET2_MULTITHREADING. Compare with the single-threaded world using the
+    physicsBenchmark console command.
+    </ul> */
 class BULLETPHYSICS_API BulletPhysics : public IModule
 {
     URHO3D_OBJECT(BulletPhysics, IModule);
@@ -74,6 +82,11 @@ public:
     /// Enable/disable physics simulation from all physics worlds
     void SetRunPhysics(bool enable);
 
+    /// Simulates the deterministic benchmark scene of PhysicsWorld::RunBenchmark single-threaded, and multithreaded if enabled, and logs the results.
+    /** @param numBodies Number of boxes
+        @param numSteps Number of simulation steps */
+    void RunBenchmark(uint numBodies, uint numSteps);
+
 private:
     void Load() override;
     void Initialize() override;
@@ -85,6 +98,8 @@ private:
     void RemovePhysicsWorld(Scene *scene, AttributeChange::Type change);
     /// Handles script engine creation (register BulletPhysics classes)
     void OnScriptInstanceCreated(JavaScriptInstance* instance);
+    /// Executes the "physicsBenchmark" console command
+    void RunBenchmarkCommand(const StringVector& params);
 
     /// All PhysicsWorlds created.
     Vector<PhysicsWorldPtr> physicsWorlds_;
@@ -99,6 +114,8 @@ private:
     
     float defaultPhysicsUpdatePeriod_;
     int defaultMaxSubSteps_;
+    /// Number of threads of multithreaded physics worlds, 0 if single-threaded
+    int numThreads_;
 };
 
 }
@@ -99,6 +99,15 @@ static duk_ret_t BulletPhysics_SetRunPhysics_bool(duk_context* ctx)
     return 0;
 }
 
+static duk_ret_t BulletPhysics_RunBenchmark_uint_uint(duk_context* ctx)
+{
+    BulletPhysics* thisObj = GetThisWeakObject<BulletPhysics>(ctx);
+    uint numBodies = (uint)duk_require_number(ctx, 0);
+    uint numSteps = (uint)duk_require_number(ctx, 1);
+    thisObj->RunBenchmark(numBodies, numSteps);
+    return 0;
+}
+
 static const duk_function_list_entry BulletPhysics_Functions[] = {
     {"ForgetUnusedCacheShapes", BulletPhysics_ForgetUnusedCacheShapes, 0}
     ,{"SetDefaultPhysicsUpdatePeriod", BulletPhysics_SetDefaultPhysicsUpdatePeriod_float, 1}
@@ -110,6 +119,7 @@ static const duk_function_list_entry BulletPhysics_Functions[] = {
     ,{"StartPhysics", BulletPhysics_StartPhysics, 0}
     ,{"AutoCollisionMesh", BulletPhysics_AutoCollisionMesh, 0}
     ,{"SetRunPhysics", BulletPhysics_SetRunPhysics_bool, 1}
+    ,{"RunBenchmark", BulletPhysics_RunBenchmark_uint_uint, 2}
     ,{nullptr, nullptr, 0}
 };
 
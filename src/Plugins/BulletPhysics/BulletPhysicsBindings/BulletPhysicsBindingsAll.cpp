@@ -8,6 +8,7 @@ namespace JSBindings
 
 void Expose_PhysicsConstraint(duk_context* ctx);
 void Expose_PhysicsMotor(duk_context* ctx);
+void Expose_PhysicsQueryBatchResult(duk_context* ctx);
 void Expose_PhysicsRaycastResult(duk_context* ctx);
 void Expose_PhysicsWorld(duk_context* ctx);
 void Expose_RigidBody(duk_context* ctx);
@@ -18,6 +19,7 @@ void ExposeBulletPhysicsClasses(duk_context* ctx)
 {
     Expose_PhysicsConstraint(ctx);
     Expose_PhysicsMotor(ctx);
+    Expose_PhysicsQueryBatchResult(ctx);
     Expose_PhysicsRaycastResult(ctx);
     Expose_PhysicsWorld(ctx);
     Expose_RigidBody(ctx);
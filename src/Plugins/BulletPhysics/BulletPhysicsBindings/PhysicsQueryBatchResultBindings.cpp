@@ -0,0 +1,96 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+// This file has been autogenerated with BindingsGenerator
+
+#include "StableHeaders.h"
+#include "CoreTypes.h"
+#include "JavaScriptInstance.h"
+#include "LoggingFunctions.h"
+#include "PhysicsWorld.h"
+
+#ifdef _MSC_VER
+#pragma warning(disable: 4800)
+#endif
+
+
+
+using namespace Tundra;
+using namespace std;
+
+namespace JSBindings
+{
+
+
+static const char* PhysicsQueryBatchResult_ID = "PhysicsQueryBatchResult";
+
+static duk_ret_t PhysicsQueryBatchResult_Finalizer(duk_context* ctx)
+{
+    FinalizeValueObject<PhysicsQueryBatchResult>(ctx, PhysicsQueryBatchResult_ID);
+    return 0;
+}
+
+static duk_ret_t PhysicsQueryBatchResult_Set_entityIds(duk_context* ctx)
+{
+    PhysicsQueryBatchResult* thisObj = GetThisValueObject<PhysicsQueryBatchResult>(ctx, PhysicsQueryBatchResult_ID);
+    PODVector<uint> entityIds = GetUIntArray(ctx, 0);
+    thisObj->entityIds = entityIds;
+    ClearCachedArray(ctx, "\xff""arrayentityIds");
+    return 0;
+}
+
+static duk_ret_t PhysicsQueryBatchResult_Get_entityIds(duk_context* ctx)
+{
+    PhysicsQueryBatchResult* thisObj = GetThisValueObject<PhysicsQueryBatchResult>(ctx, PhysicsQueryBatchResult_ID);
+    if (PushCachedArray(ctx, "\xff""arrayentityIds")) return 1;
+    PushUIntArray(ctx, thisObj->entityIds);
+    CacheArray(ctx, "\xff""arrayentityIds");
+    return 1;
+}
+
+static duk_ret_t PhysicsQueryBatchResult_Set_hits(duk_context* ctx)
+{
+    PhysicsQueryBatchResult* thisObj = GetThisValueObject<PhysicsQueryBatchResult>(ctx, PhysicsQueryBatchResult_ID);
+    PODVector<float> hits = GetFloatArray(ctx, 0);
+    thisObj->hits = hits;
+    ClearCachedArray(ctx, "\xff""arrayhits");
+    return 0;
+}
+
+static duk_ret_t PhysicsQueryBatchResult_Get_hits(duk_context* ctx)
+{
+    PhysicsQueryBatchResult* thisObj = GetThisValueObject<PhysicsQueryBatchResult>(ctx, PhysicsQueryBatchResult_ID);
+    if (PushCachedArray(ctx, "\xff""arrayhits")) return 1;
+    PushFloatArray(ctx, thisObj->hits);
+    CacheArray(ctx, "\xff""arrayhits");
+    return 1;
+}
+
+static duk_ret_t PhysicsQueryBatchResult_Set_offsets(duk_context* ctx)
+{
+    PhysicsQueryBatchResult* thisObj = GetThisValueObject<PhysicsQueryBatchResult>(ctx, PhysicsQueryBatchResult_ID);
+    PODVector<uint> offsets = GetUIntArray(ctx, 0);
+    thisObj->offsets = offsets;
+    ClearCachedArray(ctx, "\xff""arrayoffsets");
+    return 0;
+}
+
+static duk_ret_t PhysicsQueryBatchResult_Get_offsets(duk_context* ctx)
+{
+    PhysicsQueryBatchResult* thisObj = GetThisValueObject<PhysicsQueryBatchResult>(ctx, PhysicsQueryBatchResult_ID);
+    if (PushCachedArray(ctx, "\xff""arrayoffsets")) return 1;
+    PushUIntArray(ctx, thisObj->offsets);
+    CacheArray(ctx, "\xff""arrayoffsets");
+    return 1;
+}
+
+void Expose_PhysicsQueryBatchResult(duk_context* ctx)
+{
+    duk_push_object(ctx);
+    duk_push_object(ctx);
+    DefineProperty(ctx, "entityIds", PhysicsQueryBatchResult_Get_entityIds, PhysicsQueryBatchResult_Set_entityIds);
+    DefineProperty(ctx, "hits", PhysicsQueryBatchResult_Get_hits, PhysicsQueryBatchResult_Set_hits);
+    DefineProperty(ctx, "offsets", PhysicsQueryBatchResult_Get_offsets, PhysicsQueryBatchResult_Set_offsets);
+    duk_put_prop_string(ctx, -2, "prototype");
+    duk_put_global_string(ctx, PhysicsQueryBatchResult_ID);
+}
+
+}
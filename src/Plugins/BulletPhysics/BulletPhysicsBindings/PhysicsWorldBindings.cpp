@@ -22,6 +22,7 @@ namespace JSBindings
 {
 
 static const char* float3_ID = "float3";
+static const char* PhysicsQueryBatchResult_ID = "PhysicsQueryBatchResult";
 static const char* PhysicsRaycastResult_ID = "PhysicsRaycastResult";
 
 static duk_ret_t float3_Finalizer(duk_context* ctx)
@@ -30,6 +31,12 @@ static duk_ret_t float3_Finalizer(duk_context* ctx)
     return 0;
 }
 
+static duk_ret_t PhysicsQueryBatchResult_Finalizer(duk_context* ctx)
+{
+    FinalizeValueObject<PhysicsQueryBatchResult>(ctx, PhysicsQueryBatchResult_ID);
+    return 0;
+}
+
 static duk_ret_t PhysicsRaycastResult_Finalizer(duk_context* ctx)
 {
     FinalizeValueObject<PhysicsRaycastResult>(ctx, PhysicsRaycastResult_ID);
@@ -60,10 +67,6 @@ public:
     void OnSignal(Entity * param0, Entity * param1, const float3 & param2, const float3 & param3, float param4, float param5, bool param6)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -79,9 +82,7 @@ public:
         duk_put_prop_index(ctx, -2, 5);
         duk_push_boolean(ctx, param6);
         duk_put_prop_index(ctx, -2, 6);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -93,6 +94,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_PhysicsCollision_Finalizer(duk_conte
 
 static duk_ret_t SignalWrapper_PhysicsWorld_PhysicsCollision_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_PhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_PhysicsCollision>(ctx, SignalWrapper_PhysicsWorld_PhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -110,6 +112,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_PhysicsCollision_Connect(duk_context
 
 static duk_ret_t SignalWrapper_PhysicsWorld_PhysicsCollision_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_PhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_PhysicsCollision>(ctx, SignalWrapper_PhysicsWorld_PhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -118,6 +121,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_PhysicsCollision_Disconnect(duk_cont
 
 static duk_ret_t SignalWrapper_PhysicsWorld_PhysicsCollision_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_PhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_PhysicsCollision>(ctx, SignalWrapper_PhysicsWorld_PhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -134,7 +138,8 @@ static duk_ret_t SignalWrapper_PhysicsWorld_PhysicsCollision_Emit(duk_context* c
 static duk_ret_t PhysicsWorld_Get_PhysicsCollision(duk_context* ctx)
 {
     PhysicsWorld* thisObj = GetThisWeakObject<PhysicsWorld>(ctx);
-    SignalWrapper_PhysicsWorld_PhysicsCollision* wrapper = new SignalWrapper_PhysicsWorld_PhysicsCollision(thisObj, &thisObj->PhysicsCollision);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalPhysicsCollision")) return 1;
+    SignalWrapper_PhysicsWorld_PhysicsCollision* wrapper = new (ctx) SignalWrapper_PhysicsWorld_PhysicsCollision(thisObj, &thisObj->PhysicsCollision);
     PushValueObject(ctx, wrapper, SignalWrapper_PhysicsWorld_PhysicsCollision_ID, SignalWrapper_PhysicsWorld_PhysicsCollision_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_PhysicsCollision_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -144,8 +149,15 @@ static duk_ret_t PhysicsWorld_Get_PhysicsCollision(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_PhysicsCollision_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_PhysicsCollision_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_PhysicsCollision_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_PhysicsCollision_Emit, 7);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalPhysicsCollision");
     return 1;
 }
 
@@ -170,10 +182,6 @@ public:
     void OnSignal(Entity * param0, Entity * param1, const float3 & param2, const float3 & param3, float param4, float param5)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -187,9 +195,7 @@ public:
         duk_put_prop_index(ctx, -2, 4);
         duk_push_number(ctx, param5);
         duk_put_prop_index(ctx, -2, 5);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -201,6 +207,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_NewPhysicsCollision_Finalizer(duk_co
 
 static duk_ret_t SignalWrapper_PhysicsWorld_NewPhysicsCollision_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_NewPhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_NewPhysicsCollision>(ctx, SignalWrapper_PhysicsWorld_NewPhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -218,6 +225,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_NewPhysicsCollision_Connect(duk_cont
 
 static duk_ret_t SignalWrapper_PhysicsWorld_NewPhysicsCollision_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_NewPhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_NewPhysicsCollision>(ctx, SignalWrapper_PhysicsWorld_NewPhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -226,6 +234,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_NewPhysicsCollision_Disconnect(duk_c
 
 static duk_ret_t SignalWrapper_PhysicsWorld_NewPhysicsCollision_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_NewPhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_NewPhysicsCollision>(ctx, SignalWrapper_PhysicsWorld_NewPhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -241,7 +250,8 @@ static duk_ret_t SignalWrapper_PhysicsWorld_NewPhysicsCollision_Emit(duk_context
 static duk_ret_t PhysicsWorld_Get_NewPhysicsCollision(duk_context* ctx)
 {
     PhysicsWorld* thisObj = GetThisWeakObject<PhysicsWorld>(ctx);
-    SignalWrapper_PhysicsWorld_NewPhysicsCollision* wrapper = new SignalWrapper_PhysicsWorld_NewPhysicsCollision(thisObj, &thisObj->NewPhysicsCollision);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalNewPhysicsCollision")) return 1;
+    SignalWrapper_PhysicsWorld_NewPhysicsCollision* wrapper = new (ctx) SignalWrapper_PhysicsWorld_NewPhysicsCollision(thisObj, &thisObj->NewPhysicsCollision);
     PushValueObject(ctx, wrapper, SignalWrapper_PhysicsWorld_NewPhysicsCollision_ID, SignalWrapper_PhysicsWorld_NewPhysicsCollision_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_NewPhysicsCollision_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -251,8 +261,15 @@ static duk_ret_t PhysicsWorld_Get_NewPhysicsCollision(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_NewPhysicsCollision_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_NewPhysicsCollision_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_NewPhysicsCollision_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_NewPhysicsCollision_Emit, 6);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalNewPhysicsCollision");
     return 1;
 }
 
@@ -277,16 +294,10 @@ public:
     void OnSignal(float param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_number(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -298,6 +309,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_AboutToUpdate_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_PhysicsWorld_AboutToUpdate_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_AboutToUpdate* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_AboutToUpdate>(ctx, SignalWrapper_PhysicsWorld_AboutToUpdate_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -315,6 +327,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_AboutToUpdate_Connect(duk_context* c
 
 static duk_ret_t SignalWrapper_PhysicsWorld_AboutToUpdate_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_AboutToUpdate* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_AboutToUpdate>(ctx, SignalWrapper_PhysicsWorld_AboutToUpdate_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -323,6 +336,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_AboutToUpdate_Disconnect(duk_context
 
 static duk_ret_t SignalWrapper_PhysicsWorld_AboutToUpdate_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_AboutToUpdate* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_AboutToUpdate>(ctx, SignalWrapper_PhysicsWorld_AboutToUpdate_ID);
     if (!wrapper->owner_) return 0;
     float param0 = (float)duk_require_number(ctx, 0);
@@ -333,7 +347,8 @@ static duk_ret_t SignalWrapper_PhysicsWorld_AboutToUpdate_Emit(duk_context* ctx)
 static duk_ret_t PhysicsWorld_Get_AboutToUpdate(duk_context* ctx)
 {
     PhysicsWorld* thisObj = GetThisWeakObject<PhysicsWorld>(ctx);
-    SignalWrapper_PhysicsWorld_AboutToUpdate* wrapper = new SignalWrapper_PhysicsWorld_AboutToUpdate(thisObj, &thisObj->AboutToUpdate);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAboutToUpdate")) return 1;
+    SignalWrapper_PhysicsWorld_AboutToUpdate* wrapper = new (ctx) SignalWrapper_PhysicsWorld_AboutToUpdate(thisObj, &thisObj->AboutToUpdate);
     PushValueObject(ctx, wrapper, SignalWrapper_PhysicsWorld_AboutToUpdate_ID, SignalWrapper_PhysicsWorld_AboutToUpdate_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_AboutToUpdate_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -343,8 +358,15 @@ static duk_ret_t PhysicsWorld_Get_AboutToUpdate(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_AboutToUpdate_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_AboutToUpdate_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_AboutToUpdate_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_AboutToUpdate_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAboutToUpdate");
     return 1;
 }
 
@@ -369,16 +391,10 @@ public:
     void OnSignal(float param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_number(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -390,6 +406,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_Updated_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_PhysicsWorld_Updated_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_Updated* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_Updated>(ctx, SignalWrapper_PhysicsWorld_Updated_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -407,6 +424,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_Updated_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_PhysicsWorld_Updated_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_Updated* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_Updated>(ctx, SignalWrapper_PhysicsWorld_Updated_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -415,6 +433,7 @@ static duk_ret_t SignalWrapper_PhysicsWorld_Updated_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_PhysicsWorld_Updated_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_PhysicsWorld_Updated* wrapper = GetThisValueObject<SignalWrapper_PhysicsWorld_Updated>(ctx, SignalWrapper_PhysicsWorld_Updated_ID);
     if (!wrapper->owner_) return 0;
     float param0 = (float)duk_require_number(ctx, 0);
@@ -425,7 +444,8 @@ static duk_ret_t SignalWrapper_PhysicsWorld_Updated_Emit(duk_context* ctx)
 static duk_ret_t PhysicsWorld_Get_Updated(duk_context* ctx)
 {
     PhysicsWorld* thisObj = GetThisWeakObject<PhysicsWorld>(ctx);
-    SignalWrapper_PhysicsWorld_Updated* wrapper = new SignalWrapper_PhysicsWorld_Updated(thisObj, &thisObj->Updated);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalUpdated")) return 1;
+    SignalWrapper_PhysicsWorld_Updated* wrapper = new (ctx) SignalWrapper_PhysicsWorld_Updated(thisObj, &thisObj->Updated);
     PushValueObject(ctx, wrapper, SignalWrapper_PhysicsWorld_Updated_ID, SignalWrapper_PhysicsWorld_Updated_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_Updated_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -435,8 +455,15 @@ static duk_ret_t PhysicsWorld_Get_Updated(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_Updated_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_Updated_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_Updated_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_PhysicsWorld_Updated_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalUpdated");
     return 1;
 }
 
@@ -528,6 +555,14 @@ static duk_ret_t PhysicsWorld_IsClient(duk_context* ctx)
     return 1;
 }
 
+static duk_ret_t PhysicsWorld_IsMultithreaded(duk_context* ctx)
+{
+    PhysicsWorld* thisObj = GetThisWeakObject<PhysicsWorld>(ctx);
+    bool ret = thisObj->IsMultithreaded();
+    duk_push_boolean(ctx, ret);
+    return 1;
+}
+
 static duk_ret_t PhysicsWorld_Raycast_float3_float3_float_int_int(duk_context* ctx)
 {
     int numArgs = duk_get_top(ctx);
@@ -542,6 +577,69 @@ static duk_ret_t PhysicsWorld_Raycast_float3_float3_float_int_int(duk_context* c
     return 1;
 }
 
+static duk_ret_t PhysicsWorld_RaycastBatch_floatArray_float_int_int(duk_context* ctx)
+{
+    int numArgs = duk_get_top(ctx);
+    PhysicsWorld* thisObj = GetThisWeakObject<PhysicsWorld>(ctx);
+    PODVector<float> rays = GetFloatArray(ctx, 0);
+    float maxDistance = (float)duk_require_number(ctx, 1);
+    int collisionGroup = numArgs > 2 ? (int)duk_require_number(ctx, 2) : -1;
+    int collisionMask = numArgs > 3 ? (int)duk_require_number(ctx, 3) : -1;
+    PhysicsQueryBatchResult ret = thisObj->RaycastBatch(rays, maxDistance, collisionGroup, collisionMask);
+    PushValueObjectCopy<PhysicsQueryBatchResult>(ctx, ret, PhysicsQueryBatchResult_ID, PhysicsQueryBatchResult_Finalizer);
+    return 1;
+}
+
+static duk_ret_t PhysicsWorld_SphereSweepBatch_floatArray_float_int_int(duk_context* ctx)
+{
+    int numArgs = duk_get_top(ctx);
+    PhysicsWorld* thisObj = GetThisWeakObject<PhysicsWorld>(ctx);
+    PODVector<float> sweeps = GetFloatArray(ctx, 0);
+    float radius = (float)duk_require_number(ctx, 1);
+    int collisionGroup = numArgs > 2 ? (int)duk_require_number(ctx, 2) : -1;
+    int collisionMask = numArgs > 3 ? (int)duk_require_number(ctx, 3) : -1;
+    PhysicsQueryBatchResult ret = thisObj->SphereSweepBatch(sweeps, radius, collisionGroup, collisionMask);
+    PushValueObjectCopy<PhysicsQueryBatchResult>(ctx, ret, PhysicsQueryBatchResult_ID, PhysicsQueryBatchResult_Finalizer);
+    return 1;
+}
+
+static duk_ret_t PhysicsWorld_BoxSweepBatch_floatArray_float3_int_int(duk_context* ctx)
+{
+    int numArgs = duk_get_top(ctx);
+    PhysicsWorld* thisObj = GetThisWeakObject<PhysicsWorld>(ctx);
+    PODVector<float> sweeps = GetFloatArray(ctx, 0);
+    float3& halfSize = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
+    int collisionGroup = numArgs > 2 ? (int)duk_require_number(ctx, 2) : -1;
+    int collisionMask = numArgs > 3 ? (int)duk_require_number(ctx, 3) : -1;
+    PhysicsQueryBatchResult ret = thisObj->BoxSweepBatch(sweeps, halfSize, collisionGroup, collisionMask);
+    PushValueObjectCopy<PhysicsQueryBatchResult>(ctx, ret, PhysicsQueryBatchResult_ID, PhysicsQueryBatchResult_Finalizer);
+    return 1;
+}
+
+static duk_ret_t PhysicsWorld_SphereOverlapBatch_floatArray_int_int(duk_context* ctx)
+{
+    int numArgs = duk_get_top(ctx);
+    PhysicsWorld* thisObj = GetThisWeakObject<PhysicsWorld>(ctx);
+    PODVector<float> spheres = GetFloatArray(ctx, 0);
+    int collisionGroup = numArgs > 1 ? (int)duk_require_number(ctx, 1) : -1;
+    int collisionMask = numArgs > 2 ? (int)duk_require_number(ctx, 2) : -1;
+    PhysicsQueryBatchResult ret = thisObj->SphereOverlapBatch(spheres, collisionGroup, collisionMask);
+    PushValueObjectCopy<PhysicsQueryBatchResult>(ctx, ret, PhysicsQueryBatchResult_ID, PhysicsQueryBatchResult_Finalizer);
+    return 1;
+}
+
+static duk_ret_t PhysicsWorld_BoxOverlapBatch_floatArray_int_int(duk_context* ctx)
+{
+    int numArgs = duk_get_top(ctx);
+    PhysicsWorld* thisObj = GetThisWeakObject<PhysicsWorld>(ctx);
+    PODVector<float> boxes = GetFloatArray(ctx, 0);
+    int collisionGroup = numArgs > 1 ? (int)duk_require_number(ctx, 1) : -1;
+    int collisionMask = numArgs > 2 ? (int)duk_require_number(ctx, 2) : -1;
+    PhysicsQueryBatchResult ret = thisObj->BoxOverlapBatch(boxes, collisionGroup, collisionMask);
+    PushValueObjectCopy<PhysicsQueryBatchResult>(ctx, ret, PhysicsQueryBatchResult_ID, PhysicsQueryBatchResult_Finalizer);
+    return 1;
+}
+
 static const duk_function_list_entry PhysicsWorld_Functions[] = {
     {"SetPhysicsUpdatePeriod", PhysicsWorld_SetPhysicsUpdatePeriod_float, 1}
     ,{"PhysicsUpdatePeriod", PhysicsWorld_PhysicsUpdatePeriod, 0}
@@ -554,7 +652,13 @@ static const duk_function_list_entry PhysicsWorld_Functions[] = {
     ,{"SetRunning", PhysicsWorld_SetRunning_bool, 1}
     ,{"IsRunning", PhysicsWorld_IsRunning, 0}
     ,{"IsClient", PhysicsWorld_IsClient, 0}
+    ,{"IsMultithreaded", PhysicsWorld_IsMultithreaded, 0}
     ,{"Raycast", PhysicsWorld_Raycast_float3_float3_float_int_int, DUK_VARARGS}
+    ,{"RaycastBatch", PhysicsWorld_RaycastBatch_floatArray_float_int_int, DUK_VARARGS}
+    ,{"SphereSweepBatch", PhysicsWorld_SphereSweepBatch_floatArray_float_int_int, DUK_VARARGS}
+    ,{"BoxSweepBatch", PhysicsWorld_BoxSweepBatch_floatArray_float3_int_int, DUK_VARARGS}
+    ,{"SphereOverlapBatch", PhysicsWorld_SphereOverlapBatch_floatArray_int_int, DUK_VARARGS}
+    ,{"BoxOverlapBatch", PhysicsWorld_BoxOverlapBatch_floatArray_int_int, DUK_VARARGS}
     ,{nullptr, nullptr, 0}
 };
 
@@ -573,6 +677,7 @@ void Expose_PhysicsWorld(duk_context* ctx)
     DefineProperty(ctx, "debugGeometryEnabled", PhysicsWorld_IsDebugGeometryEnabled, PhysicsWorld_SetDebugGeometryEnabled_bool);
     DefineProperty(ctx, "running", PhysicsWorld_IsRunning, PhysicsWorld_SetRunning_bool);
     DefineProperty(ctx, "client", PhysicsWorld_IsClient, nullptr);
+    DefineProperty(ctx, "multithreaded", PhysicsWorld_IsMultithreaded, nullptr);
     duk_put_prop_string(ctx, -2, "prototype");
     duk_put_global_string(ctx, PhysicsWorld_ID);
 }
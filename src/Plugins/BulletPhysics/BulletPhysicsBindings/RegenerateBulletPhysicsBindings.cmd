@@ -2,4 +2,4 @@ setlocal EnableDelayedExpansion
 
 cd..
 doxygen BulletPhysicsBindings\BulletPhysicsBindings.doxyfile
-..\JavaScript\BindingsGenerator\bin\release\BindingsGenerator.exe BulletPhysicsBindings\BulletPhysicsDocs\xml BulletPhysicsBindings . PhysicsConstraint PhysicsMotor PhysicsWorld PhysicsRaycastResult RigidBody VolumeTrigger BulletPhysics
\ No newline at end of file
+..\JavaScript\BindingsGenerator\bin\release\BindingsGenerator.exe BulletPhysicsBindings\BulletPhysicsDocs\xml BulletPhysicsBindings . PhysicsConstraint PhysicsMotor PhysicsWorld PhysicsQueryBatchResult PhysicsRaycastResult RigidBody VolumeTrigger BulletPhysics
\ No newline at end of file
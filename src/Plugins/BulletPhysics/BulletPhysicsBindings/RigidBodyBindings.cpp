@@ -53,10 +53,6 @@ public:
     void OnSignal(Entity * param0, const float3 & param1, const float3 & param2, float param3, float param4, bool param5)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -70,9 +66,7 @@ public:
         duk_put_prop_index(ctx, -2, 4);
         duk_push_boolean(ctx, param5);
         duk_put_prop_index(ctx, -2, 5);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -84,6 +78,7 @@ static duk_ret_t SignalWrapper_RigidBody_PhysicsCollision_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_RigidBody_PhysicsCollision_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_PhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_RigidBody_PhysicsCollision>(ctx, SignalWrapper_RigidBody_PhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -101,6 +96,7 @@ static duk_ret_t SignalWrapper_RigidBody_PhysicsCollision_Connect(duk_context* c
 
 static duk_ret_t SignalWrapper_RigidBody_PhysicsCollision_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_PhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_RigidBody_PhysicsCollision>(ctx, SignalWrapper_RigidBody_PhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -109,6 +105,7 @@ static duk_ret_t SignalWrapper_RigidBody_PhysicsCollision_Disconnect(duk_context
 
 static duk_ret_t SignalWrapper_RigidBody_PhysicsCollision_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_PhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_RigidBody_PhysicsCollision>(ctx, SignalWrapper_RigidBody_PhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -124,7 +121,8 @@ static duk_ret_t SignalWrapper_RigidBody_PhysicsCollision_Emit(duk_context* ctx)
 static duk_ret_t RigidBody_Get_PhysicsCollision(duk_context* ctx)
 {
     RigidBody* thisObj = GetThisWeakObject<RigidBody>(ctx);
-    SignalWrapper_RigidBody_PhysicsCollision* wrapper = new SignalWrapper_RigidBody_PhysicsCollision(thisObj, &thisObj->PhysicsCollision);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalPhysicsCollision")) return 1;
+    SignalWrapper_RigidBody_PhysicsCollision* wrapper = new (ctx) SignalWrapper_RigidBody_PhysicsCollision(thisObj, &thisObj->PhysicsCollision);
     PushValueObject(ctx, wrapper, SignalWrapper_RigidBody_PhysicsCollision_ID, SignalWrapper_RigidBody_PhysicsCollision_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_RigidBody_PhysicsCollision_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -134,8 +132,15 @@ static duk_ret_t RigidBody_Get_PhysicsCollision(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_RigidBody_PhysicsCollision_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_RigidBody_PhysicsCollision_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_RigidBody_PhysicsCollision_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_RigidBody_PhysicsCollision_Emit, 6);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalPhysicsCollision");
     return 1;
 }
 
@@ -160,10 +165,6 @@ public:
     void OnSignal(Entity * param0, const float3 & param1, const float3 & param2, float param3, float param4)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -175,9 +176,7 @@ public:
         duk_put_prop_index(ctx, -2, 3);
         duk_push_number(ctx, param4);
         duk_put_prop_index(ctx, -2, 4);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -189,6 +188,7 @@ static duk_ret_t SignalWrapper_RigidBody_NewPhysicsCollision_Finalizer(duk_conte
 
 static duk_ret_t SignalWrapper_RigidBody_NewPhysicsCollision_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_NewPhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_RigidBody_NewPhysicsCollision>(ctx, SignalWrapper_RigidBody_NewPhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -206,6 +206,7 @@ static duk_ret_t SignalWrapper_RigidBody_NewPhysicsCollision_Connect(duk_context
 
 static duk_ret_t SignalWrapper_RigidBody_NewPhysicsCollision_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_NewPhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_RigidBody_NewPhysicsCollision>(ctx, SignalWrapper_RigidBody_NewPhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -214,6 +215,7 @@ static duk_ret_t SignalWrapper_RigidBody_NewPhysicsCollision_Disconnect(duk_cont
 
 static duk_ret_t SignalWrapper_RigidBody_NewPhysicsCollision_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_NewPhysicsCollision* wrapper = GetThisValueObject<SignalWrapper_RigidBody_NewPhysicsCollision>(ctx, SignalWrapper_RigidBody_NewPhysicsCollision_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -228,7 +230,8 @@ static duk_ret_t SignalWrapper_RigidBody_NewPhysicsCollision_Emit(duk_context* c
 static duk_ret_t RigidBody_Get_NewPhysicsCollision(duk_context* ctx)
 {
     RigidBody* thisObj = GetThisWeakObject<RigidBody>(ctx);
-    SignalWrapper_RigidBody_NewPhysicsCollision* wrapper = new SignalWrapper_RigidBody_NewPhysicsCollision(thisObj, &thisObj->NewPhysicsCollision);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalNewPhysicsCollision")) return 1;
+    SignalWrapper_RigidBody_NewPhysicsCollision* wrapper = new (ctx) SignalWrapper_RigidBody_NewPhysicsCollision(thisObj, &thisObj->NewPhysicsCollision);
     PushValueObject(ctx, wrapper, SignalWrapper_RigidBody_NewPhysicsCollision_ID, SignalWrapper_RigidBody_NewPhysicsCollision_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_RigidBody_NewPhysicsCollision_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -238,8 +241,15 @@ static duk_ret_t RigidBody_Get_NewPhysicsCollision(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_RigidBody_NewPhysicsCollision_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_RigidBody_NewPhysicsCollision_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_RigidBody_NewPhysicsCollision_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_RigidBody_NewPhysicsCollision_Emit, 5);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalNewPhysicsCollision");
     return 1;
 }
 
@@ -264,18 +274,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -287,6 +291,7 @@ static duk_ret_t SignalWrapper_RigidBody_ComponentNameChanged_Finalizer(duk_cont
 
 static duk_ret_t SignalWrapper_RigidBody_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_RigidBody_ComponentNameChanged>(ctx, SignalWrapper_RigidBody_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -304,6 +309,7 @@ static duk_ret_t SignalWrapper_RigidBody_ComponentNameChanged_Connect(duk_contex
 
 static duk_ret_t SignalWrapper_RigidBody_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_RigidBody_ComponentNameChanged>(ctx, SignalWrapper_RigidBody_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -312,6 +318,7 @@ static duk_ret_t SignalWrapper_RigidBody_ComponentNameChanged_Disconnect(duk_con
 
 static duk_ret_t SignalWrapper_RigidBody_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_RigidBody_ComponentNameChanged>(ctx, SignalWrapper_RigidBody_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -323,7 +330,8 @@ static duk_ret_t SignalWrapper_RigidBody_ComponentNameChanged_Emit(duk_context*
 static duk_ret_t RigidBody_Get_ComponentNameChanged(duk_context* ctx)
 {
     RigidBody* thisObj = GetThisWeakObject<RigidBody>(ctx);
-    SignalWrapper_RigidBody_ComponentNameChanged* wrapper = new SignalWrapper_RigidBody_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_RigidBody_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_RigidBody_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_RigidBody_ComponentNameChanged_ID, SignalWrapper_RigidBody_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_RigidBody_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -333,8 +341,15 @@ static duk_ret_t RigidBody_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_RigidBody_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_RigidBody_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_RigidBody_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_RigidBody_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -359,14 +374,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -378,6 +387,7 @@ static duk_ret_t SignalWrapper_RigidBody_ParentEntitySet_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_RigidBody_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_RigidBody_ParentEntitySet>(ctx, SignalWrapper_RigidBody_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -395,6 +405,7 @@ static duk_ret_t SignalWrapper_RigidBody_ParentEntitySet_Connect(duk_context* ct
 
 static duk_ret_t SignalWrapper_RigidBody_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_RigidBody_ParentEntitySet>(ctx, SignalWrapper_RigidBody_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -403,6 +414,7 @@ static duk_ret_t SignalWrapper_RigidBody_ParentEntitySet_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_RigidBody_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_RigidBody_ParentEntitySet>(ctx, SignalWrapper_RigidBody_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -412,7 +424,8 @@ static duk_ret_t SignalWrapper_RigidBody_ParentEntitySet_Emit(duk_context* ctx)
 static duk_ret_t RigidBody_Get_ParentEntitySet(duk_context* ctx)
 {
     RigidBody* thisObj = GetThisWeakObject<RigidBody>(ctx);
-    SignalWrapper_RigidBody_ParentEntitySet* wrapper = new SignalWrapper_RigidBody_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_RigidBody_ParentEntitySet* wrapper = new (ctx) SignalWrapper_RigidBody_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_RigidBody_ParentEntitySet_ID, SignalWrapper_RigidBody_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_RigidBody_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -422,8 +435,15 @@ static duk_ret_t RigidBody_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_RigidBody_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_RigidBody_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_RigidBody_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_RigidBody_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -448,14 +468,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -467,6 +481,7 @@ static duk_ret_t SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Finalizer
 
 static duk_ret_t SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_RigidBody_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -484,6 +499,7 @@ static duk_ret_t SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Connect(d
 
 static duk_ret_t SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_RigidBody_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -492,6 +508,7 @@ static duk_ret_t SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Disconnec
 
 static duk_ret_t SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_RigidBody_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_RigidBody_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -501,7 +518,8 @@ static duk_ret_t SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Emit(duk_
 static duk_ret_t RigidBody_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     RigidBody* thisObj = GetThisWeakObject<RigidBody>(ctx);
-    SignalWrapper_RigidBody_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_RigidBody_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_RigidBody_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_RigidBody_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_ID, SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -511,8 +529,15 @@ static duk_ret_t RigidBody_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_RigidBody_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
@@ -622,6 +647,22 @@ static duk_ret_t RigidBody_IsActive(duk_context* ctx)
     return 1;
 }
 
+static duk_ret_t RigidBody_SetCollisionReportingEnabled_bool(duk_context* ctx)
+{
+    RigidBody* thisObj = GetThisWeakObject<RigidBody>(ctx);
+    bool enable = duk_require_boolean(ctx, 0);
+    thisObj->SetCollisionReportingEnabled(enable);
+    return 0;
+}
+
+static duk_ret_t RigidBody_IsCollisionReportingEnabled(duk_context* ctx)
+{
+    RigidBody* thisObj = GetThisWeakObject<RigidBody>(ctx);
+    bool ret = thisObj->IsCollisionReportingEnabled();
+    duk_push_boolean(ctx, ret);
+    return 1;
+}
+
 static duk_ret_t RigidBody_ResetForces(duk_context* ctx)
 {
     RigidBody* thisObj = GetThisWeakObject<RigidBody>(ctx);
@@ -906,6 +947,8 @@ static const duk_function_list_entry RigidBody_Functions[] = {
     ,{"Activate", RigidBody_Activate, 0}
     ,{"KeepActive", RigidBody_KeepActive, 0}
     ,{"IsActive", RigidBody_IsActive, 0}
+    ,{"SetCollisionReportingEnabled", RigidBody_SetCollisionReportingEnabled_bool, 1}
+    ,{"IsCollisionReportingEnabled", RigidBody_IsCollisionReportingEnabled, 0}
     ,{"ResetForces", RigidBody_ResetForces, 0}
     ,{"SetRotation", RigidBody_SetRotation_float3, 1}
     ,{"Rotate", RigidBody_Rotate_float3, 1}
@@ -973,6 +1016,7 @@ void Expose_RigidBody(duk_context* ctx)
     DefineProperty(ctx, "ComponentNameChanged", RigidBody_Get_ComponentNameChanged, nullptr);
     DefineProperty(ctx, "ParentEntitySet", RigidBody_Get_ParentEntitySet, nullptr);
     DefineProperty(ctx, "ParentEntityAboutToBeDetached", RigidBody_Get_ParentEntityAboutToBeDetached, nullptr);
+    DefineProperty(ctx, "collisionReportingEnabled", RigidBody_IsCollisionReportingEnabled, RigidBody_SetCollisionReportingEnabled_bool);
     DefineProperty(ctx, "typeName", RigidBody_TypeName, nullptr);
     DefineProperty(ctx, "typeId", RigidBody_TypeId, nullptr);
     DefineProperty(ctx, "name", RigidBody_Name, RigidBody_SetName_String);
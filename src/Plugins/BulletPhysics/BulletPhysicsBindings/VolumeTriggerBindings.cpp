@@ -46,16 +46,10 @@ public:
     void OnSignal(Entity * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -67,6 +61,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_EntityEnter_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_VolumeTrigger_EntityEnter_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_EntityEnter* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_EntityEnter>(ctx, SignalWrapper_VolumeTrigger_EntityEnter_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -84,6 +79,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_EntityEnter_Connect(duk_context* ct
 
 static duk_ret_t SignalWrapper_VolumeTrigger_EntityEnter_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_EntityEnter* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_EntityEnter>(ctx, SignalWrapper_VolumeTrigger_EntityEnter_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -92,6 +88,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_EntityEnter_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_VolumeTrigger_EntityEnter_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_EntityEnter* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_EntityEnter>(ctx, SignalWrapper_VolumeTrigger_EntityEnter_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -102,7 +99,8 @@ static duk_ret_t SignalWrapper_VolumeTrigger_EntityEnter_Emit(duk_context* ctx)
 static duk_ret_t VolumeTrigger_Get_EntityEnter(duk_context* ctx)
 {
     VolumeTrigger* thisObj = GetThisWeakObject<VolumeTrigger>(ctx);
-    SignalWrapper_VolumeTrigger_EntityEnter* wrapper = new SignalWrapper_VolumeTrigger_EntityEnter(thisObj, &thisObj->EntityEnter);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityEnter")) return 1;
+    SignalWrapper_VolumeTrigger_EntityEnter* wrapper = new (ctx) SignalWrapper_VolumeTrigger_EntityEnter(thisObj, &thisObj->EntityEnter);
     PushValueObject(ctx, wrapper, SignalWrapper_VolumeTrigger_EntityEnter_ID, SignalWrapper_VolumeTrigger_EntityEnter_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_EntityEnter_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -112,8 +110,15 @@ static duk_ret_t VolumeTrigger_Get_EntityEnter(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_EntityEnter_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_EntityEnter_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_EntityEnter_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_EntityEnter_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityEnter");
     return 1;
 }
 
@@ -138,16 +143,10 @@ public:
     void OnSignal(Entity * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -159,6 +158,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_EntityLeave_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_VolumeTrigger_EntityLeave_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_EntityLeave* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_EntityLeave>(ctx, SignalWrapper_VolumeTrigger_EntityLeave_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -176,6 +176,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_EntityLeave_Connect(duk_context* ct
 
 static duk_ret_t SignalWrapper_VolumeTrigger_EntityLeave_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_EntityLeave* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_EntityLeave>(ctx, SignalWrapper_VolumeTrigger_EntityLeave_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -184,6 +185,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_EntityLeave_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_VolumeTrigger_EntityLeave_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_EntityLeave* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_EntityLeave>(ctx, SignalWrapper_VolumeTrigger_EntityLeave_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -194,7 +196,8 @@ static duk_ret_t SignalWrapper_VolumeTrigger_EntityLeave_Emit(duk_context* ctx)
 static duk_ret_t VolumeTrigger_Get_EntityLeave(duk_context* ctx)
 {
     VolumeTrigger* thisObj = GetThisWeakObject<VolumeTrigger>(ctx);
-    SignalWrapper_VolumeTrigger_EntityLeave* wrapper = new SignalWrapper_VolumeTrigger_EntityLeave(thisObj, &thisObj->EntityLeave);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityLeave")) return 1;
+    SignalWrapper_VolumeTrigger_EntityLeave* wrapper = new (ctx) SignalWrapper_VolumeTrigger_EntityLeave(thisObj, &thisObj->EntityLeave);
     PushValueObject(ctx, wrapper, SignalWrapper_VolumeTrigger_EntityLeave_ID, SignalWrapper_VolumeTrigger_EntityLeave_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_EntityLeave_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -204,8 +207,15 @@ static duk_ret_t VolumeTrigger_Get_EntityLeave(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_EntityLeave_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_EntityLeave_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_EntityLeave_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_EntityLeave_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityLeave");
     return 1;
 }
 
@@ -230,18 +240,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -253,6 +257,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ComponentNameChanged_Finalizer(duk_
 
 static duk_ret_t SignalWrapper_VolumeTrigger_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_ComponentNameChanged>(ctx, SignalWrapper_VolumeTrigger_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -270,6 +275,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ComponentNameChanged_Connect(duk_co
 
 static duk_ret_t SignalWrapper_VolumeTrigger_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_ComponentNameChanged>(ctx, SignalWrapper_VolumeTrigger_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -278,6 +284,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ComponentNameChanged_Disconnect(duk
 
 static duk_ret_t SignalWrapper_VolumeTrigger_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_ComponentNameChanged>(ctx, SignalWrapper_VolumeTrigger_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -289,7 +296,8 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ComponentNameChanged_Emit(duk_conte
 static duk_ret_t VolumeTrigger_Get_ComponentNameChanged(duk_context* ctx)
 {
     VolumeTrigger* thisObj = GetThisWeakObject<VolumeTrigger>(ctx);
-    SignalWrapper_VolumeTrigger_ComponentNameChanged* wrapper = new SignalWrapper_VolumeTrigger_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_VolumeTrigger_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_VolumeTrigger_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_VolumeTrigger_ComponentNameChanged_ID, SignalWrapper_VolumeTrigger_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -299,8 +307,15 @@ static duk_ret_t VolumeTrigger_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -325,14 +340,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -344,6 +353,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntitySet_Finalizer(duk_conte
 
 static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_ParentEntitySet>(ctx, SignalWrapper_VolumeTrigger_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -361,6 +371,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntitySet_Connect(duk_context
 
 static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_ParentEntitySet>(ctx, SignalWrapper_VolumeTrigger_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -369,6 +380,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntitySet_Disconnect(duk_cont
 
 static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_ParentEntitySet>(ctx, SignalWrapper_VolumeTrigger_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -378,7 +390,8 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntitySet_Emit(duk_context* c
 static duk_ret_t VolumeTrigger_Get_ParentEntitySet(duk_context* ctx)
 {
     VolumeTrigger* thisObj = GetThisWeakObject<VolumeTrigger>(ctx);
-    SignalWrapper_VolumeTrigger_ParentEntitySet* wrapper = new SignalWrapper_VolumeTrigger_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_VolumeTrigger_ParentEntitySet* wrapper = new (ctx) SignalWrapper_VolumeTrigger_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_VolumeTrigger_ParentEntitySet_ID, SignalWrapper_VolumeTrigger_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -388,8 +401,15 @@ static duk_ret_t VolumeTrigger_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -414,14 +434,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -433,6 +447,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Final
 
 static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -450,6 +465,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Conne
 
 static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -458,6 +474,7 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Disco
 
 static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -467,7 +484,8 @@ static duk_ret_t SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Emit(
 static duk_ret_t VolumeTrigger_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     VolumeTrigger* thisObj = GetThisWeakObject<VolumeTrigger>(ctx);
-    SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_ID, SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -477,8 +495,15 @@ static duk_ret_t VolumeTrigger_Get_ParentEntityAboutToBeDetached(duk_context* ct
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_VolumeTrigger_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
@@ -16,6 +16,8 @@ namespace Tundra
     class BulletPhysics;
     class PhysicsWorld;
     struct PhysicsRaycastResult;
+    struct PhysicsBenchmarkResult;
+    struct PhysicsQueryBatchResult;
     class RigidBody;
     class VolumeTrigger;
 
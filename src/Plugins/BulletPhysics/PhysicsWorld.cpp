@@ -29,12 +29,30 @@
 #pragma warning(disable : 4100)
 #endif
 #include <btBulletDynamicsCommon.h>
+#include <BulletCollision/CollisionShapes/btTriangleShape.h>
+#include <BulletCollision/NarrowPhaseCollision/btGjkPairDetector.h>
+#include <BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.h>
+#include <BulletCollision/NarrowPhaseCollision/btPointCollector.h>
+#include <BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.h>
+// The task scheduler based world is available in Bullet 2.88 and newer, built with BULLET2_MULTITHREADING
+#if defined(BT_THREADSAFE) && BT_THREADSAFE && BT_BULLET_VERSION >= 288
+#define TUNDRA_BULLET_MULTITHREADING
+#include <LinearMath/btThreads.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#endif
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
 
 #include <Urho3D/Core/Profiler.h>
+#include <Urho3D/Core/Thread.h>
 #include <Urho3D/Core/Timer.h>
+#include <Urho3D/Core/WorkQueue.h>
+#include <Urho3D/Math/MathDefs.h>
+
+#include <cmath>
 
 namespace Tundra
 {
@@ -48,6 +66,8 @@ struct CollisionSignal
     float distance;
     float impulse;
     bool newCollision;
+    bool signalBodyA; ///< Whether bodyA reports collisions and has listeners
+    bool signalBodyB; ///< Whether bodyB reports collisions and has listeners
 };
 
 struct ObbCallback : public btCollisionWorld::ContactResultCallback
@@ -64,6 +84,372 @@ struct ObbCallback : public btCollisionWorld::ContactResultCallback
     HashSet<btCollisionObjectWrapper*>& result_;
 };
 
+/// Kind of a PhysicsWorld batch query.
+enum QueryBatchType
+{
+    QueryRay,
+    QuerySweep,
+    QueryOverlap
+};
+
+/// A batch query shared by the work items that run it.
+/** The work items only read the input and write the hits of their own queries, so that no locking is needed. */
+struct QueryBatch
+{
+    QueryBatch(QueryBatchType type_, btCollisionWorld* world_, const PODVector<float>& input_, uint stride_, const char* functionName, int collisionGroup_, int collisionMask_) :
+        type(type_),
+        world(world_),
+        input(input_.Begin().ptr_),
+        stride(stride_),
+        numQueries(input_.Size() / stride_),
+        collisionGroup((short)collisionGroup_),
+        collisionMask((short)collisionMask_),
+        maxDistance(0.0f),
+        sweepShape(0),
+        boxOverlap(false),
+        result(0)
+    {
+        if (input_.Size() % stride_)
+            LogWarning("PhysicsWorld::" + String(functionName) + ": Input size " + String(input_.Size()) + " is not a multiple of " +
+                String(stride_) + ", ignoring the incomplete last query.");
+    }
+
+    QueryBatchType type;
+    btCollisionWorld* world;
+    const float* input;
+    uint stride; ///< Floats per query in input
+    uint numQueries;
+    int collisionGroup;
+    int collisionMask;
+    float maxDistance; ///< Length of the rays
+    const btConvexShape* sweepShape;
+    bool boxOverlap; ///< Whether the overlap queries are boxes instead of spheres
+    PhysicsQueryBatchResult* result; ///< Receives the hits of ray and sweep queries
+    PODVector<const btCollisionObject*> hitObjects; ///< Closest object of each ray and sweep query, converted to entity IDs afterwards
+};
+
+/// Range of queries run by one work item, with the objects found by its overlap queries.
+struct QueryChunk
+{
+    QueryBatch* batch;
+    uint begin;
+    uint end;
+    PODVector<const btCollisionObject*> overlaps; ///< Objects overlapping the queries of the chunk, in query order
+    PODVector<uint> numOverlaps; ///< Number of overlapping objects of each query of the chunk
+};
+
+/// Number of queries run by one work item.
+static const uint cQueriesPerWorkItem = 64;
+
+/// Returns whether two convex shapes overlap. Uses only local state unlike btCollisionWorld::contactTest, so that it can be called from several threads at once.
+static bool ConvexShapesOverlap(const btConvexShape* shapeA, const btTransform& transformA, const btConvexShape* shapeB, const btTransform& transformB)
+{
+    btVoronoiSimplexSolver simplexSolver;
+    btGjkEpaPenetrationDepthSolver penetrationSolver;
+    btGjkPairDetector detector(shapeA, shapeB, &simplexSolver, &penetrationSolver);
+    btGjkPairDetector::ClosestPointInput input;
+    input.m_transformA = transformA;
+    input.m_transformB = transformB;
+    btPointCollector collector;
+    detector.getClosestPoints(input, collector, 0);
+    return collector.m_hasResult && collector.m_distance <= 0.0f;
+}
+
+static bool ConvexOverlapsShape(const btConvexShape* convex, const btTransform& convexTransform, const btCollisionShape* shape, const btTransform& shapeTransform);
+
+/// Tests a convex shape against the triangles of a concave shape, in the space of the concave shape.
+struct TriangleOverlapCallback : public btTriangleCallback
+{
+    TriangleOverlapCallback(const btConvexShape* convex, const btTransform& convexTransform) :
+        convex_(convex),
+        convexTransform_(convexTransform),
+        overlap_(false)
+    {
+    }
+
+    virtual void processTriangle(btVector3* triangle, int /*partId*/, int /*triangleIndex*/)
+    {
+        if (overlap_)
+            return;
+        btTriangleShape triangleShape(triangle[0], triangle[1], triangle[2]);
+        overlap_ = ConvexShapesOverlap(convex_, convexTransform_, &triangleShape, btTransform::getIdentity());
+    }
+
+    const btConvexShape* convex_;
+    btTransform convexTransform_;
+    bool overlap_;
+};
+
+/// Returns whether a convex shape overlaps a shape of any type.
+static bool ConvexOverlapsShape(const btConvexShape* convex, const btTransform& convexTransform, const btCollisionShape* shape, const btTransform& shapeTransform)
+{
+    if (shape->isCompound())
+    {
+        const btCompoundShape* compound = static_cast<const btCompoundShape*>(shape);
+        for (int i = 0; i < compound->getNumChildShapes(); ++i)
+            if (ConvexOverlapsShape(convex, convexTransform, compound->getChildShape(i), shapeTransform * compound->getChildTransform(i)))
+                return true;
+        return false;
+    }
+    if (shape->isConvex())
+        return ConvexShapesOverlap(convex, convexTransform, static_cast<const btConvexShape*>(shape), shapeTransform);
+    if (shape->isConcave())
+    {
+        // Test in the space of the concave shape, against the triangles touching the AABB of the convex shape
+        btTransform localTransform = shapeTransform.inverse() * convexTransform;
+        btVector3 aabbMin, aabbMax;
+        convex->getAabb(localTransform, aabbMin, aabbMax);
+        TriangleOverlapCallback callback(convex, localTransform);
+        static_cast<const btConcaveShape*>(shape)->processAllTriangles(&callback, aabbMin, aabbMax);
+        return callback.overlap_;
+    }
+    return false;
+}
+
+/// Collects the objects overlapping a convex shape, filtered by the broadphase AABBs and collision filters first.
+struct OverlapCallback : public btBroadphaseAabbCallback
+{
+    OverlapCallback(const QueryBatch& batch, const btConvexShape* shape, const btTransform& transform, PODVector<const btCollisionObject*>& result) :
+        batch_(batch),
+        shape_(shape),
+        transform_(transform),
+        result_(result)
+    {
+    }
+
+    virtual bool process(const btBroadphaseProxy* proxy)
+    {
+        if ((proxy->m_collisionFilterGroup & batch_.collisionMask) && (batch_.collisionGroup & proxy->m_collisionFilterMask))
+        {
+            const btCollisionObject* object = static_cast<const btCollisionObject*>(proxy->m_clientObject);
+            if (ConvexOverlapsShape(shape_, transform_, object->getCollisionShape(), object->getWorldTransform()))
+                result_.Push(object);
+        }
+        return true;
+    }
+
+    const QueryBatch& batch_;
+    const btConvexShape* shape_;
+    btTransform transform_;
+    PODVector<const btCollisionObject*>& result_;
+};
+
+static void SetQueryHit(QueryBatch& batch, uint index, const btCollisionObject* object, float distance, const btVector3& position, const btVector3& normal)
+{
+    batch.hitObjects[index] = object;
+    float* hit = &batch.result->hits[index * PhysicsQueryBatchResult::cHitStride];
+    hit[0] = distance;
+    hit[1] = position.x();
+    hit[2] = position.y();
+    hit[3] = position.z();
+    hit[4] = normal.x();
+    hit[5] = normal.y();
+    hit[6] = normal.z();
+}
+
+static void RunRayQuery(QueryBatch& batch, uint index)
+{
+    const float* in = batch.input + index * batch.stride;
+    btVector3 origin(in[0], in[1], in[2]);
+    btVector3 direction(in[3], in[4], in[5]);
+    if (direction.fuzzyZero())
+        return;
+    direction.normalize();
+
+    btCollisionWorld::ClosestRayResultCallback rayCallback(origin, origin + batch.maxDistance * direction);
+    rayCallback.m_collisionFilterGroup = (short)batch.collisionGroup;
+    rayCallback.m_collisionFilterMask = (short)batch.collisionMask;
+    batch.world->rayTest(rayCallback.m_rayFromWorld, rayCallback.m_rayToWorld, rayCallback);
+    if (rayCallback.hasHit())
+        SetQueryHit(batch, index, rayCallback.m_collisionObject, (rayCallback.m_hitPointWorld - origin).length(), rayCallback.m_hitPointWorld, rayCallback.m_hitNormalWorld);
+}
+
+static void RunSweepQuery(QueryBatch& batch, uint index)
+{
+    const float* in = batch.input + index * batch.stride;
+    btVector3 start(in[0], in[1], in[2]);
+    btVector3 end(in[3], in[4], in[5]);
+
+    btCollisionWorld::ClosestConvexResultCallback sweepCallback(start, end);
+    sweepCallback.m_collisionFilterGroup = (short)batch.collisionGroup;
+    sweepCallback.m_collisionFilterMask = (short)batch.collisionMask;
+    batch.world->convexSweepTest(batch.sweepShape, btTransform(btQuaternion::getIdentity(), start), btTransform(btQuaternion::getIdentity(), end), sweepCallback);
+    if (sweepCallback.hasHit())
+        SetQueryHit(batch, index, sweepCallback.m_hitCollisionObject, (end - start).length() * sweepCallback.m_closestHitFraction, sweepCallback.m_hitPointWorld, sweepCallback.m_hitNormalWorld);
+}
+
+static void RunOverlapQuery(QueryChunk& chunk, uint index)
+{
+    const QueryBatch& batch = *chunk.batch;
+    const float* in = batch.input + index * batch.stride;
+    const uint numBefore = chunk.overlaps.Size();
+    btVector3 aabbMin, aabbMax;
+
+    if (batch.boxOverlap)
+    {
+        btBoxShape box(btVector3(in[3], in[4], in[5])); // Note: Bullet uses box halfsize
+        btQuaternion orientation(in[6], in[7], in[8], in[9]);
+        if (orientation.length2() < SIMD_EPSILON)
+            orientation = btQuaternion::getIdentity();
+        btTransform transform(orientation.normalized(), btVector3(in[0], in[1], in[2]));
+        box.getAabb(transform, aabbMin, aabbMax);
+        OverlapCallback callback(batch, &box, transform, chunk.overlaps);
+        batch.world->getBroadphase()->aabbTest(aabbMin, aabbMax, callback);
+    }
+    else
+    {
+        btSphereShape sphere(in[3]);
+        btTransform transform(btQuaternion::getIdentity(), btVector3(in[0], in[1], in[2]));
+        sphere.getAabb(transform, aabbMin, aabbMax);
+        OverlapCallback callback(batch, &sphere, transform, chunk.overlaps);
+        batch.world->getBroadphase()->aabbTest(aabbMin, aabbMax, callback);
+    }
+
+    chunk.numOverlaps.Push(chunk.overlaps.Size() - numBefore);
+}
+
+static void RunQueryChunk(QueryChunk& chunk)
+{
+    for (uint i = chunk.begin; i < chunk.end; ++i)
+    {
+        switch (chunk.batch->type)
+        {
+        case QueryRay:
+            RunRayQuery(*chunk.batch, i);
+            break;
+        case QuerySweep:
+            RunSweepQuery(*chunk.batch, i);
+            break;
+        case QueryOverlap:
+            RunOverlapQuery(chunk, i);
+            break;
+        }
+    }
+}
+
+#ifdef TUNDRA_BULLET_MULTITHREADING
+/// Task scheduler of the multithreaded worlds, set to Bullet by PhysicsWorld::SetNumThreads.
+static btITaskScheduler *taskScheduler = 0;
+
+/// WorkQueue priority of the batch queries. Completing it does not wait for lower priority background work.
+static const unsigned cQueryBatchPriority = Urho3D::M_MAX_UNSIGNED - 2;
+
+/// Returns whether the Bullet library has been built with BULLET2_MULTITHREADING.
+/** BT_THREADSAFE in the headers does not guarantee it. The library creates a task scheduler only if it is thread-safe itself. */
+static bool IsBulletThreadSafe()
+{
+    static int threadSafe = -1;
+    if (threadSafe < 0)
+    {
+        if (taskScheduler)
+            threadSafe = 1;
+        else
+        {
+            btITaskScheduler *scheduler = btCreateDefaultTaskScheduler();
+            threadSafe = scheduler ? 1 : 0;
+            delete scheduler;
+        }
+        if (!threadSafe)
+            LogWarning("PhysicsWorld: Bullet was built without BULLET2_MULTITHREADING, running the batch queries on the main thread.");
+    }
+    return threadSafe == 1;
+}
+
+static void RunQueryChunkWork(const Urho3D::WorkItem* item, unsigned /*threadIndex*/)
+{
+    RunQueryChunk(*static_cast<QueryChunk*>(item->aux_));
+}
+#endif
+
+static uint EntityIdOf(const btCollisionObject* object)
+{
+    RigidBody* body = object ? static_cast<RigidBody*>(object->getUserPointer()) : 0;
+    Entity* entity = body ? body->ParentEntity() : 0;
+    return entity ? entity->Id() : 0;
+}
+
+/// Runs a batch query in chunks of cQueriesPerWorkItem and converts the found objects to entity IDs.
+static PhysicsQueryBatchResult RunQueryBatch(Object* owner, QueryBatch& batch)
+{
+    PhysicsQueryBatchResult result;
+    const uint numQueries = batch.numQueries;
+    if (batch.type != QueryOverlap)
+    {
+        batch.result = &result;
+        batch.hitObjects.Resize(numQueries);
+        result.hits.Resize(numQueries * PhysicsQueryBatchResult::cHitStride);
+        for (uint i = 0; i < numQueries; ++i)
+            batch.hitObjects[i] = 0;
+        for (uint i = 0; i < result.hits.Size(); ++i)
+            result.hits[i] = 0.0f;
+    }
+
+    Vector<QueryChunk> chunks((numQueries + cQueriesPerWorkItem - 1) / cQueriesPerWorkItem);
+    for (uint i = 0; i < chunks.Size(); ++i)
+    {
+        chunks[i].batch = &batch;
+        chunks[i].begin = i * cQueriesPerWorkItem;
+        chunks[i].end = Urho3D::Min(chunks[i].begin + cQueriesPerWorkItem, numQueries);
+    }
+
+    bool ranOnWorkQueue = false;
+#ifdef TUNDRA_BULLET_MULTITHREADING
+    // Thread-safe Bullet keeps the broadphase ray test stacks per thread, so the queries can run concurrently
+    // Completing the work from a worker thread would deadlock, so the queries run serially there
+    Urho3D::WorkQueue* queue = owner->GetSubsystem<Urho3D::WorkQueue>();
+    if (queue && chunks.Size() > 1 && Urho3D::Thread::IsMainThread() && IsBulletThreadSafe())
+    {
+        for (uint i = 0; i < chunks.Size(); ++i)
+        {
+            SharedPtr<Urho3D::WorkItem> item(new Urho3D::WorkItem());
+            item->workFunction_ = RunQueryChunkWork;
+            item->aux_ = &chunks[i];
+            item->priority_ = cQueryBatchPriority;
+            queue->AddWorkItem(item);
+        }
+        queue->Complete(cQueryBatchPriority);
+        ranOnWorkQueue = true;
+    }
+#else
+    UNREFERENCED_PARAM(owner);
+#endif
+    if (!ranOnWorkQueue)
+    {
+        for (uint i = 0; i < chunks.Size(); ++i)
+            RunQueryChunk(chunks[i]);
+    }
+
+    // Entities can only be accessed from the main thread
+    if (batch.type == QueryOverlap)
+    {
+        result.offsets.Reserve(numQueries + 1);
+        result.offsets.Push(0);
+        for (uint i = 0; i < chunks.Size(); ++i)
+        {
+            const QueryChunk& chunk = chunks[i];
+            uint overlapIndex = 0;
+            for (uint j = 0; j < chunk.numOverlaps.Size(); ++j)
+            {
+                for (uint k = 0; k < chunk.numOverlaps[j]; ++k)
+                {
+                    uint id = EntityIdOf(chunk.overlaps[overlapIndex++]);
+                    if (id)
+                        result.entityIds.Push(id);
+                }
+                result.offsets.Push(result.entityIds.Size());
+            }
+        }
+    }
+    else
+    {
+        result.entityIds.Resize(numQueries);
+        for (uint i = 0; i < numQueries; ++i)
+            result.entityIds[i] = EntityIdOf(batch.hitObjects[i]);
+    }
+
+    return result;
+}
+
 void TickCallback(btDynamicsWorld *world, btScalar timeStep)
 {
     static_cast<PhysicsWorld*>(world->getWorldUserInfo())->ProcessPostTick(timeStep);
@@ -78,28 +464,46 @@ struct PhysicsWorld::Impl : public btIDebugDraw
         Color color;
     };
 
-    explicit Impl(PhysicsWorld *owner) :
+    /// @param owner Physics world receiving the post-tick callbacks, or null for a standalone Bullet world.
+    Impl(PhysicsWorld *owner, bool multithreaded) :
         debugDrawMode(0),
         collisionConfiguration(0),
         collisionDispatcher(0),
         broadphase(0),
         solver(0),
+        solverPool(0),
         world(0),
         cachedGraphicsWorld(0)
     {
         collisionConfiguration = new btDefaultCollisionConfiguration();
-        collisionDispatcher = new btCollisionDispatcher(collisionConfiguration);
         broadphase = new btDbvtBroadphase();
-        solver = new btSequentialImpulseConstraintSolver();
-        world = new btDiscreteDynamicsWorld(collisionDispatcher, broadphase, solver, collisionConfiguration);
+#ifdef TUNDRA_BULLET_MULTITHREADING
+        if (multithreaded)
+        {
+            // Islands are solved in parallel by a pool of sequential solvers, large islands by the parallel solver
+            btConstraintSolverPoolMt *pool = new btConstraintSolverPoolMt(btGetTaskScheduler()->getNumThreads());
+            solverPool = pool;
+            collisionDispatcher = new btCollisionDispatcherMt(collisionConfiguration);
+            solver = new btSequentialImpulseConstraintSolverMt();
+            world = new btDiscreteDynamicsWorldMt(collisionDispatcher, broadphase, pool, solver, collisionConfiguration);
+        }
+        else
+#endif
+        {
+            collisionDispatcher = new btCollisionDispatcher(collisionConfiguration);
+            solver = new btSequentialImpulseConstraintSolver();
+            world = new btDiscreteDynamicsWorld(collisionDispatcher, broadphase, solver, collisionConfiguration);
+        }
         world->setDebugDrawer(this);
-        world->setInternalTickCallback(TickCallback, (void*)owner, false);
+        if (owner)
+            world->setInternalTickCallback(TickCallback, (void*)owner, false);
     }
 
     ~Impl()
     {
         delete world;
         delete solver;
+        delete solverPool;
         delete broadphase;
         delete collisionDispatcher;
         delete collisionConfiguration;
@@ -214,12 +618,16 @@ struct PhysicsWorld::Impl : public btIDebugDraw
     btBroadphaseInterface* broadphase;
     /// Bullet constraint equation solver
     btConstraintSolver* solver;
+    /// Bullet per-island solver pool of the multithreaded world, null if single-threaded
+    btConstraintSolver* solverPool;
     /// Bullet physics world
     btDiscreteDynamicsWorld* world;
     /// Bullet debug draw / debug behaviour flags
     int debugDrawMode;
     /// Cached GraphicsWorld pointer for drawing debug geometry
     GraphicsWorld* cachedGraphicsWorld;
+    /// Collision signals of the substep being processed. Cleared, not freed, between substeps so that the records are reused
+    Vector<CollisionSignal> collisionSignals;
 
     /// Choking for debug rendering
     struct DebugDrawState
@@ -366,7 +774,7 @@ struct PhysicsWorld::Impl : public btIDebugDraw
     DebugDrawState debugDrawState;
 };
 
-PhysicsWorld::PhysicsWorld(Scene* scene, bool isClient) :
+PhysicsWorld::PhysicsWorld(Scene* scene, bool isClient, bool multithreaded) :
     Object(scene->GetContext()),
     scene_(scene),
     physicsUpdatePeriod_(1.0f / 60.0f),
@@ -374,10 +782,12 @@ PhysicsWorld::PhysicsWorld(Scene* scene, bool isClient) :
     debugDrawT_(0.0f),
     maxSubSteps_(6), // If fps is below 10, we start to slow down physics
     isClient_(isClient),
+    multithreaded_(multithreaded && NumThreads() > 0),
     runPhysics_(true),
     drawDebugManuallySet_(false),
     useVariableTimestep_(false),
-    impl(new Impl(this))
+    currentCollisionPairs_(0),
+    impl(new Impl(this, multithreaded && NumThreads() > 0))
 {
     if (scene->GetFramework()->HasCommandLineParameter("--variablephysicsstep"))
         useVariableTimestep_ = true;
@@ -388,6 +798,100 @@ PhysicsWorld::~PhysicsWorld()
     delete impl;
 }
 
+int PhysicsWorld::SetNumThreads(int numThreads)
+{
+#ifdef TUNDRA_BULLET_MULTITHREADING
+    if (numThreads <= 0)
+    {
+        if (taskScheduler)
+        {
+            btSetTaskScheduler(btGetSequentialTaskScheduler());
+            delete taskScheduler;
+            taskScheduler = 0;
+        }
+        return 0;
+    }
+
+    if (!taskScheduler)
+    {
+        taskScheduler = btCreateDefaultTaskScheduler();
+        if (!taskScheduler)
+        {
+            LogWarning("PhysicsWorld::SetNumThreads: Failed to create the Bullet task scheduler, using single-threaded physics.");
+            return 0;
+        }
+        btSetTaskScheduler(taskScheduler);
+    }
+    taskScheduler->setNumThreads(Urho3D::Min(numThreads, taskScheduler->getMaxNumThreads()));
+    return taskScheduler->getNumThreads();
+#else
+    if (numThreads > 0)
+        LogWarning("PhysicsWorld::SetNumThreads: Bullet was built without BULLET2_MULTITHREADING, using single-threaded physics.");
+    return 0;
+#endif
+}
+
+int PhysicsWorld::NumThreads()
+{
+#ifdef TUNDRA_BULLET_MULTITHREADING
+    return taskScheduler ? taskScheduler->getNumThreads() : 0;
+#else
+    return 0;
+#endif
+}
+
+PhysicsBenchmarkResult PhysicsWorld::RunBenchmark(bool multithreaded, uint numBodies, uint numSteps)
+{
+    const uint cColumnHeight = 4;
+    const float cTimeStep = 1.0f / 60.0f;
+
+    PhysicsBenchmarkResult result;
+    result.multithreaded = multithreaded && NumThreads() > 0;
+    result.numBodies = numBodies;
+    result.numSteps = numSteps;
+
+    Impl impl(0, result.multithreaded);
+    impl.world->setGravity(btVector3(0.0f, -9.81f, 0.0f));
+
+    btBoxShape groundShape(btVector3(1000.0f, 1.0f, 1000.0f));
+    btRigidBody ground(0.0f, 0, &groundShape);
+    ground.setWorldTransform(btTransform(btQuaternion::getIdentity(), btVector3(0.0f, -1.0f, 0.0f)));
+    impl.world->addRigidBody(&ground);
+
+    // Columns of boxes on a square grid, far enough apart to form an island each
+    btBoxShape boxShape(btVector3(0.5f, 0.5f, 0.5f));
+    btVector3 inertia(0.0f, 0.0f, 0.0f);
+    boxShape.calculateLocalInertia(1.0f, inertia);
+    const uint numColumns = (numBodies + cColumnHeight - 1) / cColumnHeight;
+    const uint gridSize = Urho3D::Max(static_cast<uint>(ceil(sqrt(static_cast<float>(numColumns)))), 1U);
+    PODVector<btRigidBody*> bodies;
+    bodies.Reserve(numBodies);
+    for(uint i = 0; i < numBodies; ++i)
+    {
+        const uint column = i / cColumnHeight;
+        btRigidBody *body = new btRigidBody(1.0f, 0, &boxShape, inertia);
+        body->setWorldTransform(btTransform(btQuaternion::getIdentity(),
+            btVector3((column % gridSize) * 2.0f, 0.55f + (i % cColumnHeight) * 1.05f, (column / gridSize) * 2.0f)));
+        impl.world->addRigidBody(body);
+        bodies.Push(body);
+    }
+
+    Urho3D::HiresTimer timer;
+    for(uint i = 0; i < numSteps; ++i)
+        impl.world->stepSimulation(cTimeStep, 1, cTimeStep);
+    result.msec = timer.GetUSec(false) / 1000.0f;
+
+    result.positions.Reserve(numBodies);
+    for(uint i = 0; i < bodies.Size(); ++i)
+    {
+        result.positions.Push(bodies[i]->getWorldTransform().getOrigin());
+        impl.world->removeRigidBody(bodies[i]);
+        delete bodies[i];
+    }
+    impl.world->removeRigidBody(&ground);
+    return result;
+}
+
 void PhysicsWorld::SetPhysicsUpdatePeriod(float updatePeriod)
 {
     // Allow max.1000 fps
@@ -442,6 +946,8 @@ void PhysicsWorld::Simulate(float frametime)
         else
             impl->world->stepSimulation(fFrametime, maxSubSteps_, physicsUpdatePeriod_);
     }
+
+    ApplyMovedBodies();
     
     if (!scene_.Expired() && !scene_.Lock()->GetFramework()->IsHeadless())
     {
@@ -476,13 +982,20 @@ void PhysicsWorld::ProcessPostTick(float substeptime)
     // Check contacts and send collision signals for them
     int numManifolds = impl->collisionDispatcher->getNumManifolds();
     
-    HashSet<Pair<const btCollisionObject*, const btCollisionObject*> > currentCollisions;
+    // The pairs of the last substep become the previous ones, and the set of the substep before them is reused for this one
+    const HashSet<Pair<const btCollisionObject*, const btCollisionObject*> > &previousCollisions = collisionPairs_[currentCollisionPairs_];
+    currentCollisionPairs_ = 1 - currentCollisionPairs_;
+    HashSet<Pair<const btCollisionObject*, const btCollisionObject*> > &currentCollisions = collisionPairs_[currentCollisionPairs_];
+    currentCollisions.Clear();
     
     // Collect all collision signals to a list before emitting any of them, in case a collision
     // handler changes physics state before the loop below is over (which would lead into catastrophic
     // consequences)
-    Vector<CollisionSignal> collisions;
-    collisions.Reserve(numManifolds * 3); // Guess some initial memory size for the collision list.
+    Vector<CollisionSignal> &collisions = impl->collisionSignals;
+    collisions.Clear();
+
+    // Contact records are only needed for signals that somebody listens to, C++ or script
+    const bool signalWorld = !PhysicsCollision.Empty() || !NewPhysicsCollision.Empty();
 
     if (numManifolds > 0)
     {
@@ -524,14 +1037,26 @@ void PhysicsWorld::ProcessPostTick(float substeptime)
             // Check that at least one of the bodies is active
             if (!objectA->isActive() && !objectB->isActive())
                 continue;
+            // Bodies that do not report collisions are not tracked at all, unless the other one reports
+            const bool reportA = bodyA->IsCollisionReportingEnabled();
+            const bool reportB = bodyB->IsCollisionReportingEnabled();
+            if (!reportA && !reportB)
+                continue;
             
-            bool newCollision = previousCollisions_.Find(objectPair) == previousCollisions_.End();
+            bool newCollision = previousCollisions.Find(objectPair) == previousCollisions.End();
+            currentCollisions.Insert(objectPair);
+
+            const bool signalBodyA = reportA && (!bodyA->PhysicsCollision.Empty() || !bodyA->NewPhysicsCollision.Empty());
+            const bool signalBodyB = reportB && (!bodyB->PhysicsCollision.Empty() || !bodyB->NewPhysicsCollision.Empty());
+            if (!signalWorld && !signalBodyA && !signalBodyB)
+                continue;
             
             for(int j = 0; j < numContacts; ++j)
             {
                 btManifoldPoint& point = contactManifold->getContactPoint(j);
                 
-                CollisionSignal s;
+                collisions.Resize(collisions.Size() + 1);
+                CollisionSignal &s = collisions.Back();
                 s.bodyA = bodyA;
                 s.bodyB = bodyB;
                 s.position = point.m_positionWorldOnB;
@@ -539,14 +1064,13 @@ void PhysicsWorld::ProcessPostTick(float substeptime)
                 s.distance = point.m_distance1;
                 s.impulse = point.m_appliedImpulse;
                 s.newCollision = newCollision;
-                collisions.Push(s);
+                s.signalBodyA = signalBodyA;
+                s.signalBodyB = signalBodyB;
                 
                 // Report newCollision = true only for the first contact, in case there are several contacts, and application does some logic depending on it
                 // (for example play a sound -> avoid multiple sounds being played)
                 newCollision = false;
             }
-            
-            currentCollisions.Insert(objectPair);
         }
     }
 
@@ -564,21 +1088,27 @@ void PhysicsWorld::ProcessPostTick(float substeptime)
 
             if (collision.bodyA.Expired() || collision.bodyB.Expired())
                 continue;
-            if (newCollision)
-                NewPhysicsCollision.Emit(collision.bodyA->ParentEntity(), collision.bodyB->ParentEntity(), pos, normal, distance, impulse);
-            PhysicsCollision.Emit(collision.bodyA->ParentEntity(), collision.bodyB->ParentEntity(), pos, normal, distance, impulse, newCollision);
+            if (signalWorld)
+            {
+                if (newCollision)
+                    NewPhysicsCollision.Emit(collision.bodyA->ParentEntity(), collision.bodyB->ParentEntity(), pos, normal, distance, impulse);
+                PhysicsCollision.Emit(collision.bodyA->ParentEntity(), collision.bodyB->ParentEntity(), pos, normal, distance, impulse, newCollision);
+            }
             
             if (collision.bodyA.Expired() || collision.bodyB.Expired())
                 continue;
-            collision.bodyA->EmitPhysicsCollision(collision.bodyB->ParentEntity(), pos, normal, distance, impulse, newCollision);
+            if (collision.signalBodyA)
+                collision.bodyA->EmitPhysicsCollision(collision.bodyB->ParentEntity(), pos, normal, distance, impulse, newCollision);
             
             if (collision.bodyA.Expired() || collision.bodyB.Expired())
                 continue;
-            collision.bodyB->EmitPhysicsCollision(collision.bodyA->ParentEntity(), pos, normal, distance, impulse, newCollision);
+            if (collision.signalBodyB)
+                collision.bodyB->EmitPhysicsCollision(collision.bodyA->ParentEntity(), pos, normal, distance, impulse, newCollision);
         }
     }
 
-    previousCollisions_ = currentCollisions;
+    // Drop the body references, the records themselves stay allocated for the next substep
+    collisions.Clear();
     
     {
         URHO3D_PROFILE(PhysicsWorld_ProcessPostTick_Updated);
@@ -586,6 +1116,42 @@ void PhysicsWorld::ProcessPostTick(float substeptime)
     }
 }
 
+void PhysicsWorld::ApplyMovedBodies()
+{
+    if (movedBodies_.Empty())
+        return;
+
+    URHO3D_PROFILE(PhysicsWorld_ApplyMovedBodies);
+
+    // A transform change handler may remove bodies, which nulls their entries
+    for(uint i = 0; i < movedBodies_.Size(); ++i)
+    {
+        if (movedBodies_[i])
+            movedBodies_[i]->ApplyMotionState();
+    }
+
+    uint numMoved = 0;
+    for(uint i = 0; i < movedBodies_.Size(); ++i)
+    {
+        if (movedBodies_[i])
+            movedBodies_[numMoved++] = movedBodies_[i];
+    }
+    movedBodies_.Resize(numMoved);
+
+    if (numMoved > 0)
+    {
+        URHO3D_PROFILE(PhysicsWorld_emit_BodiesMoved);
+        BodiesMoved.Emit(movedBodies_);
+    }
+
+    for(uint i = 0; i < movedBodies_.Size(); ++i)
+    {
+        if (movedBodies_[i])
+            movedBodies_[i]->ResetMotionState();
+    }
+    movedBodies_.Clear();
+}
+
 PhysicsRaycastResult PhysicsWorld::Raycast(const float3& origin, const float3& direction, float maxdistance, int collisiongroup, int collisionmask)
 {
     URHO3D_PROFILE(PhysicsWorld_Raycast);
@@ -650,6 +1216,52 @@ EntityVector PhysicsWorld::ObbCollisionQuery(const OBB &obb, int collisionGroup,
     return entities;
 }
 
+PhysicsQueryBatchResult PhysicsWorld::RaycastBatch(const PODVector<float>& rays, float maxDistance, int collisionGroup, int collisionMask)
+{
+    URHO3D_PROFILE(PhysicsWorld_RaycastBatch);
+
+    QueryBatch batch(QueryRay, impl->world, rays, 6, "RaycastBatch", collisionGroup, collisionMask);
+    batch.maxDistance = maxDistance;
+    return RunQueryBatch(this, batch);
+}
+
+PhysicsQueryBatchResult PhysicsWorld::SphereSweepBatch(const PODVector<float>& sweeps, float radius, int collisionGroup, int collisionMask)
+{
+    URHO3D_PROFILE(PhysicsWorld_SphereSweepBatch);
+
+    btSphereShape sphere(radius);
+    QueryBatch batch(QuerySweep, impl->world, sweeps, 6, "SphereSweepBatch", collisionGroup, collisionMask);
+    batch.sweepShape = &sphere;
+    return RunQueryBatch(this, batch);
+}
+
+PhysicsQueryBatchResult PhysicsWorld::BoxSweepBatch(const PODVector<float>& sweeps, const float3& halfSize, int collisionGroup, int collisionMask)
+{
+    URHO3D_PROFILE(PhysicsWorld_BoxSweepBatch);
+
+    btBoxShape box(halfSize); // Note: Bullet uses box halfsize
+    QueryBatch batch(QuerySweep, impl->world, sweeps, 6, "BoxSweepBatch", collisionGroup, collisionMask);
+    batch.sweepShape = &box;
+    return RunQueryBatch(this, batch);
+}
+
+PhysicsQueryBatchResult PhysicsWorld::SphereOverlapBatch(const PODVector<float>& spheres, int collisionGroup, int collisionMask)
+{
+    URHO3D_PROFILE(PhysicsWorld_SphereOverlapBatch);
+
+    QueryBatch batch(QueryOverlap, impl->world, spheres, 4, "SphereOverlapBatch", collisionGroup, collisionMask);
+    return RunQueryBatch(this, batch);
+}
+
+PhysicsQueryBatchResult PhysicsWorld::BoxOverlapBatch(const PODVector<float>& boxes, int collisionGroup, int collisionMask)
+{
+    URHO3D_PROFILE(PhysicsWorld_BoxOverlapBatch);
+
+    QueryBatch batch(QueryOverlap, impl->world, boxes, 10, "BoxOverlapBatch", collisionGroup, collisionMask);
+    batch.boxOverlap = true;
+    return RunQueryBatch(this, batch);
+}
+
 void PhysicsWorld::SetDebugGeometryEnabled(bool enable)
 {
     if (scene_.Expired() || !scene_->ViewEnabled() || IsDebugGeometryEnabled() == enable)
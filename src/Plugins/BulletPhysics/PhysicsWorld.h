@@ -28,6 +28,33 @@ struct PhysicsRaycastResult
     float distance; ///< Distance from ray origin to the hit point.
 };
 
+/// Result of PhysicsWorld::RunBenchmark.
+struct PhysicsBenchmarkResult
+{
+    bool multithreaded; ///< Whether the multithreaded world was used
+    uint numBodies; ///< Number of simulated boxes
+    uint numSteps; ///< Number of simulation steps
+    float msec; ///< Time spent stepping the simulation, in milliseconds
+    PODVector<float3> positions; ///< Final positions of the boxes in creation order
+};
+
+/// Result of the PhysicsWorld batch queries, as flat buffers.
+/** Ray and sweep batches return the closest hit of each query i: entityIds[i] is the ID of the entity that was hit,
+    0 if none, and hits[i * cHitStride] onwards holds the distance, the world hit position and the world face normal.
+    Overlap batches return the entities overlapping query i as entityIds[offsets[i]] ... entityIds[offsets[i + 1] - 1].
+    In script each member is copied to a typed array on its first read and the same array is returned afterward,
+    so it is cheap to index in a loop. Modifying the typed array does not change the result; assign the member instead.
+    @sa PhysicsWorld::RaycastBatch
+  */
+struct PhysicsQueryBatchResult
+{
+    static const uint cHitStride = 7; ///< Floats per query in hits
+
+    PODVector<uint> entityIds; ///< Hit or overlapping entity IDs
+    PODVector<float> hits; ///< Distance, position and normal of each hit. Empty for overlap batches
+    PODVector<uint> offsets; ///< Start of each overlap query in entityIds, followed by the total count. Empty for ray and sweep batches
+};
+
 /// A physics world that encapsulates a Bullet physics world
 class BULLETPHYSICS_API PhysicsWorld : public Object
 {
@@ -39,9 +66,24 @@ class BULLETPHYSICS_API PhysicsWorld : public Object
 public:
     /// Constructor.
     /** @param scene Scene of which this PhysicsWorld is physical representation of.
-        @param isClient Whether this physics world is for a client scene i.e. only simulates local entities' motion on their own.*/
-    PhysicsWorld(Scene* scene, bool isClient);
+        @param isClient Whether this physics world is for a client scene i.e. only simulates local entities' motion on their own.
+        @param multithreaded Whether to use the multithreaded Bullet world, see SetNumThreads. */
+    PhysicsWorld(Scene* scene, bool isClient, bool multithreaded = false);
     virtual ~PhysicsWorld();
+
+    /// Set up the Bullet task scheduler used by multithreaded physics worlds. Must be called before creating them. [noscript]
+    /** Collision pairs are dispatched, simulation islands solved and large islands split over the threads of the scheduler.
+        A zero thread count releases the scheduler, after which multithreaded worlds may not be stepped.
+        @return Number of threads in use, which may be less than requested, or 0 if Bullet was built without BULLET2_MULTITHREADING. */
+    static int SetNumThreads(int numThreads);
+
+    /// Return the number of threads used by multithreaded physics worlds, 0 if not set up. [noscript]
+    static int NumThreads();
+
+    /// Simulate a deterministic scene of box columns falling on a ground plane in a standalone Bullet world. [noscript]
+    /** Used to measure the multithreaded world against the single-threaded one. The boxes come to rest, so that
+        the final positions of both can be compared. Requires SetNumThreads for the multithreaded world. */
+    static PhysicsBenchmarkResult RunBenchmark(bool multithreaded, uint numBodies, uint numSteps);
     
     /// Step the physics world. May trigger several internal simulation substeps, according to the deltatime given. [noscript]
     void Simulate(float frametime);
@@ -51,7 +93,7 @@ public:
     
     /// Returns the set of collisions that occurred during the previous frame.
     /// \important Use this function only for debugging, the availability of this set data structure is not guaranteed in the future.
-    const HashSet<Pair<const btCollisionObject*, const btCollisionObject*> > &PreviousFrameCollisions() const { return previousCollisions_; }
+    const HashSet<Pair<const btCollisionObject*, const btCollisionObject*> > &PreviousFrameCollisions() const { return collisionPairs_[currentCollisionPairs_]; }
 
     /// Set physics update period (= length of each simulation step.) By default 1/60th of a second.
     /** @param updatePeriod Update period */
@@ -92,6 +134,9 @@ public:
     /// Return whether the physics world is for a client scene. Client scenes only simulate local entities' motion on their own. [property]
     bool IsClient() const { return isClient_; }
 
+    /// Return whether the physics world uses the multithreaded Bullet world. [property]
+    bool IsMultithreaded() const { return multithreaded_; }
+
     /// Raycast to the world. Returns only a single (the closest) result.
     /** @param origin World origin position
         @param direction Direction to raycast to. Will be normalized automatically
@@ -108,9 +153,49 @@ public:
         @return List of entities with RigidBody component intersecting the OBB */
     EntityVector ObbCollisionQuery(const OBB &obb, int collisionGroup = -1, int collisionMask = -1);
 
+    /// Raycasts a batch of rays to the world. Returns only the closest result of each ray.
+    /** The queries are run on the WorkQueue threads when called on the main thread and the Bullet library is built with BULLET2_MULTITHREADING.
+        @param rays Origin and direction of each ray, 6 floats per ray. Directions will be normalized automatically
+        @param maxDistance Length of the rays
+        @param collisionGroup Collision layer. Default has all bits set.
+        @param collisionMask Collision mask. Default has all bits set.
+        @return Closest hits, see PhysicsQueryBatchResult */
+    PhysicsQueryBatchResult RaycastBatch(const PODVector<float>& rays, float maxDistance, int collisionGroup = -1, int collisionMask = -1);
+
+    /// Sweeps a sphere along a batch of line segments. Returns only the closest result of each sweep.
+    /** @param sweeps Start and end position of each sweep, 6 floats per sweep
+        @param radius Radius of the sphere
+        @param collisionGroup Collision layer. Default has all bits set.
+        @param collisionMask Collision mask. Default has all bits set.
+        @return Closest hits, see PhysicsQueryBatchResult */
+    PhysicsQueryBatchResult SphereSweepBatch(const PODVector<float>& sweeps, float radius, int collisionGroup = -1, int collisionMask = -1);
+
+    /// Sweeps an axis-aligned box along a batch of line segments. Returns only the closest result of each sweep.
+    /** @param sweeps Start and end position of each sweep, 6 floats per sweep
+        @param halfSize Half size of the box
+        @param collisionGroup Collision layer. Default has all bits set.
+        @param collisionMask Collision mask. Default has all bits set.
+        @return Closest hits, see PhysicsQueryBatchResult */
+    PhysicsQueryBatchResult BoxSweepBatch(const PODVector<float>& sweeps, const float3& halfSize, int collisionGroup = -1, int collisionMask = -1);
+
+    /// Performs collision queries for a batch of spheres.
+    /** @param spheres Center and radius of each sphere, 4 floats per sphere
+        @param collisionGroup Collision layer of the spheres. Default has all bits set.
+        @param collisionMask Collision mask of the spheres. Default has all bits set.
+        @return Entities intersecting each sphere, see PhysicsQueryBatchResult */
+    PhysicsQueryBatchResult SphereOverlapBatch(const PODVector<float>& spheres, int collisionGroup = -1, int collisionMask = -1);
+
+    /// Performs collision queries for a batch of oriented boxes.
+    /** @param boxes Center, half size and orientation quaternion (x, y, z, w) of each box, 10 floats per box
+        @param collisionGroup Collision layer of the boxes. Default has all bits set.
+        @param collisionMask Collision mask of the boxes. Default has all bits set.
+        @return Entities intersecting each box, see PhysicsQueryBatchResult */
+    PhysicsQueryBatchResult BoxOverlapBatch(const PODVector<float>& boxes, int collisionGroup = -1, int collisionMask = -1);
+
     /// A physics collision has happened between two entities. 
     /** Note: both rigidbodies participating in the collision will also emit a signal separately. 
         Also, if there are several contact points, the signal will be sent multiple times for each contact.
+        Collisions between bodies that both have collision reporting disabled are not signalled, see RigidBody::SetCollisionReportingEnabled.
         @param entityA The first entity
         @param entityB The second entity
         @param position World position of collision
@@ -135,10 +220,21 @@ public:
     /** @param frametime Length of simulation step */
     Signal1<float ARG(frametime)> Updated;
 
+    /// Emitted once per frame after the simulation, with the rigid bodies whose motion was written back to their attributes. [noscript]
+    /** The Placeable transform and the changed linear and angular velocity attributes of each body are signalled with
+        AttributeChange::LocalOnly, so nothing is signalled for replication. Replicate the bodies here in one pass instead, as
+        SyncManager does; RigidBody::LinearVelocityMoved and RigidBody::AngularVelocityMoved tell which velocities changed.
+        Handlers must not remove rigid bodies.
+        @param bodies Moved rigid bodies, valid only during the signal */
+    Signal1<const PODVector<RigidBody*>& ARG(bodies)> BodiesMoved;
+
 private:
     /// Draw physics debug geometry, if debug drawing enabled
     void DrawDebugGeometry();
 
+    /// Write the motion of the bodies moved by the last simulation step to their attributes, and emit BodiesMoved
+    void ApplyMovedBodies();
+
     struct Impl;
     Impl *impl;
     /// Length of one physics simulation step
@@ -147,10 +243,15 @@ private:
     int maxSubSteps_;
     /// Client scene flag
     bool isClient_;
+    /// Multithreaded Bullet world flag
+    bool multithreaded_;
     /// Parent scene
     SceneWeakPtr scene_;
-    /// Previous frame's collisions. We store these to know whether the collision was new or "ongoing"
-    HashSet<Pair<const btCollisionObject*, const btCollisionObject*> > previousCollisions_;
+    /// Collision pairs of the last two substeps. We store the previous ones to know whether the collision was new or "ongoing".
+    /** The sets are swapped instead of copied, and cleared sets keep their memory, so that tracking the pairs does not allocate. */
+    HashSet<Pair<const btCollisionObject*, const btCollisionObject*> > collisionPairs_[2];
+    /// Index of the pairs of the last processed substep in collisionPairs_
+    uint currentCollisionPairs_;
     /// Debug geometry manually enabled/disabled (with physicsdebug console command). If true, do not automatically enable/disable debug geometry anymore
     bool drawDebugManuallySet_;
     /// Whether should run physics. Default true
@@ -161,6 +262,9 @@ private:
     /// Debug draw-enabled rigidbodies. Note: these pointers are never dereferenced, it is just used for counting
     HashSet<RigidBody*> debugRigidBodies_;
 
+    /// Bodies whose motion state Bullet has set during the current frame. Removed bodies are nulled, not erased
+    PODVector<RigidBody*> movedBodies_;
+
     float debugDrawUpdatePeriod_;
     float debugDrawT_;
 };
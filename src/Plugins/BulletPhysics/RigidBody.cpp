@@ -43,6 +43,10 @@ struct RigidBody::Impl : public btMotionState
         childShape(0),
         heightField(0),
         disconnected(false),
+        motionStatePending(false),
+        linearVelocityMoved(false),
+        angularVelocityMoved(false),
+        collisionReporting(true),
         cachedShapeType(-1),
         cachedSize(float3::zero),
         clientExtrapolating(false),
@@ -64,12 +68,25 @@ struct RigidBody::Impl : public btMotionState
     }
 
     /// btMotionState override. Called when Bullet wants to tell us the body's current transform
+    /** Only stores the transform and queues the body to PhysicsWorld, which applies the moved bodies in one pass after
+        the simulation step, see RigidBody::ApplyMotionState. */
     void setWorldTransform(const btTransform &worldTrans)
     {
-        /// \todo For a large scene, applying the changed transforms of rigid bodies is slow (slower than the physics simulation itself,
-        /// or handling collisions) due to the large number of signals being fired.
-    
         // Cannot modify server-authoritative physics object, rather get the transform changes through placeable attributes
+        if (!world || (!rigidBody->HasAuthority() && !clientExtrapolating))
+            return;
+
+        pendingTransform = worldTrans;
+        if (!motionStatePending)
+        {
+            motionStatePending = true;
+            world->movedBodies_.Push(rigidBody);
+        }
+    }
+
+    /// Write the pending transform to the placeable, and the current velocities to the rigid body attributes.
+    void ApplyMotionState()
+    {
         const bool hasAuthority = rigidBody->HasAuthority();
         if (!hasAuthority && !clientExtrapolating)
             return;
@@ -77,12 +94,12 @@ struct RigidBody::Impl : public btMotionState
         if (placeable.Expired())
             return;
         Placeable* p = placeable;
+        const btTransform &worldTrans = pendingTransform;
         // Important: disconnect our own response to attribute changes to not create an endless loop!
         disconnected = true;
     
-        AttributeChange::Type changeType = hasAuthority ? AttributeChange::Default : AttributeChange::LocalOnly;
-
-        // Set transform
+        // Set transform. The value is written directly and signalled only locally, so that the scene node follows the body.
+        // Replication of the moved bodies is done in one batch from PhysicsWorld::BodiesMoved
         float3 position = worldTrans.getOrigin();
         Quat orientation = worldTrans.getRotation();
     
@@ -92,7 +109,8 @@ struct RigidBody::Impl : public btMotionState
             Transform newTrans = p->transform.Get();
             newTrans.SetPos(position.x, position.y, position.z);
             newTrans.SetOrientation(orientation);
-            p->transform.Set(newTrans, changeType);
+            p->transform.Set(newTrans, AttributeChange::Disconnected);
+            p->EmitAttributeChanged(&p->transform, AttributeChange::LocalOnly);
         }
         else
         // The placeable has a parent itself
@@ -105,21 +123,23 @@ struct RigidBody::Impl : public btMotionState
                 Transform newTrans = p->transform.Get();
                 newTrans.SetPos(position);
                 newTrans.SetOrientation(orientation);
-                p->transform.Set(newTrans, changeType);
+                p->transform.Set(newTrans, AttributeChange::Disconnected);
+                p->EmitAttributeChanged(&p->transform, AttributeChange::LocalOnly);
             }
         }
-        // Set linear & angular velocity
+        // Set linear & angular velocity. Like the transform, these are signalled only locally.
+        // Performance optimization: do not set the velocities if they haven't changed, as each set fires signals, and the
+        // changed ones are also the only ones SyncManager marks dirty from PhysicsWorld::BodiesMoved
         if (body)
         {
-            // Performance optimization: because applying each attribute causes signals to be fired, which is slow in a large scene
-            // (and furthermore, on a server, causes each connection's sync state to be accessed), do not set the linear/angular
-            // velocities if they haven't changed
             float3 linearVel = body->getLinearVelocity();
             float3 angularVel = RadToDeg(body->getAngularVelocity());
-            if (!linearVel.Equals(rigidBody->linearVelocity.Get()))
-                rigidBody->linearVelocity.Set(linearVel, changeType);
-            if (!angularVel.Equals(rigidBody->angularVelocity.Get()))
-                rigidBody->angularVelocity.Set(angularVel, changeType);
+            linearVelocityMoved = !linearVel.Equals(rigidBody->linearVelocity.Get());
+            angularVelocityMoved = !angularVel.Equals(rigidBody->angularVelocity.Get());
+            if (linearVelocityMoved)
+                rigidBody->linearVelocity.Set(linearVel, AttributeChange::LocalOnly);
+            if (angularVelocityMoved)
+                rigidBody->angularVelocity.Set(angularVel, AttributeChange::LocalOnly);
         }
     
         disconnected = false;
@@ -163,6 +183,16 @@ struct RigidBody::Impl : public btMotionState
     WeakPtr<Terrain> terrain;
     /// Internal disconnection of attribute changes. True during the time we're setting attributes ourselves due to Bullet update, to prevent endless loop
     bool disconnected;
+    /// Whether the body is in PhysicsWorld's moved bodies, waiting for pendingTransform to be applied
+    bool motionStatePending;
+    /// Last transform given by Bullet through setWorldTransform
+    btTransform pendingTransform;
+    /// Whether ApplyMotionState changed the linear velocity attribute. Valid until ResetMotionState
+    bool linearVelocityMoved;
+    /// Whether ApplyMotionState changed the angular velocity attribute. Valid until ResetMotionState
+    bool angularVelocityMoved;
+    /// Whether PhysicsWorld should signal the collisions of this body
+    bool collisionReporting;
     /// On the client side, this field is used to track whether the rigid body is being interpolated from network input events (false), or extrapolated
     /// using local physics computations (true).
     /// On the server side, this flag is not used.
@@ -386,6 +416,16 @@ bool RigidBody::IsActive()
         return false;
 }
 
+void RigidBody::SetCollisionReportingEnabled(bool enable)
+{
+    impl->collisionReporting = enable;
+}
+
+bool RigidBody::IsCollisionReportingEnabled() const
+{
+    return impl->collisionReporting;
+}
+
 void RigidBody::ResetForces()
 {
     // Cannot modify server-authoritative physics object
@@ -575,11 +615,41 @@ void RigidBody::RemoveBody()
 {
     if (impl->body && impl->world)
     {
+        if (impl->motionStatePending)
+        {
+            // Null the entry instead of erasing it, as PhysicsWorld may be iterating the moved bodies
+            PODVector<RigidBody*>::Iterator it = impl->world->movedBodies_.Find(this);
+            if (it != impl->world->movedBodies_.End())
+                *it = 0;
+            impl->motionStatePending = false;
+        }
         impl->world->BulletWorld()->removeRigidBody(impl->body);
         SAFE_DELETE(impl->body);
     }
 }
 
+void RigidBody::ApplyMotionState()
+{
+    impl->ApplyMotionState();
+}
+
+void RigidBody::ResetMotionState()
+{
+    impl->motionStatePending = false;
+    impl->linearVelocityMoved = false;
+    impl->angularVelocityMoved = false;
+}
+
+bool RigidBody::LinearVelocityMoved() const
+{
+    return impl->linearVelocityMoved;
+}
+
+bool RigidBody::AngularVelocityMoved() const
+{
+    return impl->angularVelocityMoved;
+}
+
 void RigidBody::SetClientExtrapolating(bool isClientExtrapolating)
 {
     impl->clientExtrapolating = isClientExtrapolating;
@@ -144,6 +144,8 @@ public:
     Attribute<bool> drawDebug;
 
     /// Linear velocity
+    /** While the body is simulated, the changed velocities are written back after each frame with LocalOnly attribute
+        change signals, and replicated in one batch, see PhysicsWorld::BodiesMoved. */
     Attribute<float3> linearVelocity;
 
     /// Specifies the axes on which torques can act on the object, making it rotate.
@@ -166,6 +168,14 @@ public:
 
     btRigidBody* BulletRigidBody() const;
 
+    /// Return whether the physics simulation changed the linear velocity attribute this frame. [noscript]
+    /** Valid only during PhysicsWorld::BodiesMoved. */
+    bool LinearVelocityMoved() const;
+
+    /// Return whether the physics simulation changed the angular velocity attribute this frame. [noscript]
+    /** Valid only during PhysicsWorld::BodiesMoved. */
+    bool AngularVelocityMoved() const;
+
     /// A physics collision has happened between this rigid body and another entity.
     /** If there are several contact points, the signal will be sent multiple times for each contact.
         @param otherEntity The second entity
@@ -231,6 +241,15 @@ public:
     
     /// Check whether body is active
     bool IsActive();
+
+    /// Enable/disable collision signals of this body.
+    /** When disabled, the body does not emit PhysicsCollision or NewPhysicsCollision, and its collisions with bodies that do
+        not report collisions either are neither tracked nor signalled by PhysicsWorld. Enabled by default.
+        @note VolumeTrigger relies on the collision signals of its own body. */
+    void SetCollisionReportingEnabled(bool enable);
+
+    /// Return whether collision signals are enabled [property]
+    bool IsCollisionReportingEnabled() const;
     
     /// Reset accumulated force & torque
     void ResetForces();
@@ -330,6 +349,12 @@ private:
     /// Request mesh resource (for trimesh & convexhull shapes)
     void RequestMesh();
 
+    /// Write the transform and velocities stored by the motion state to the attributes. Called from PhysicsWorld
+    void ApplyMotionState();
+
+    /// Mark the stored motion state handled. Called from PhysicsWorld once the moved bodies have been signalled
+    void ResetMotionState();
+
     /// Emit a physics collision. Called from PhysicsWorld
     void EmitPhysicsCollision(Entity* otherEntity, const float3& position, const float3& normal, float distance, float impulse, bool newCollision);
 
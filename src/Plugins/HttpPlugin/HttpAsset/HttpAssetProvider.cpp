@@ -10,9 +10,15 @@
 
 #include "AssetAPI.h"
 #include "AssetCache.h"
+#include "CoreHashUtils.h"
+#include "IAsset.h"
 #include "IAssetTransfer.h" /// @todo HttpAssetTransfer
 
 #include "Framework.h"
+#include "LoggingFunctions.h"
+
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/IO/FileSystem.h>
 
 namespace Tundra
 {
@@ -20,15 +26,167 @@ namespace Tundra
 HttpAssetProvider::HttpAssetProvider(Framework *framework, const HttpClientPtr &client) :
     IAssetProvider(framework->GetContext()),
     framework_(framework),
-    client_(client)
+    client_(client),
+    staleWhileRevalidate_(false)
 {
+    if (framework_->HasCommandLineParameter("--httpStaleWhileRevalidate"))
+        SetStaleWhileRevalidate(true);
 }
 
 HttpAssetProvider::~HttpAssetProvider()
 {
+    // The client may outlive us, do not get called back by the background requests.
+    for(auto iter = revalidations_.Begin(); iter != revalidations_.End(); ++iter)
+        iter->second_->Finished.Disconnect(this, &HttpAssetProvider::OnRevalidated);
+    revalidations_.Clear();
+
     httpStorages_.Clear();
 }
 
+void HttpAssetProvider::SetStaleWhileRevalidate(bool enabled)
+{
+    staleWhileRevalidate_ = enabled;
+}
+
+void HttpAssetProvider::SetCacheValidators(HttpRequest *request, const String &assetRef, const String &stagingFile)
+{
+    AssetCache *cache = framework_->Asset()->Cache();
+    if (!cache)
+        return;
+
+    /* The response body is streamed to a staging file in the worker thread as it arrives and committed
+       to the cache on completion, it is never held in memory as a whole. The validators come from the cache
+       index instead of the file system. No read path is given: a '304 Not Modified' body is mapped from
+       the cache on completion. */
+    const bool cached = !cache->FindInCache(assetRef).Empty();
+    uint lastModified = (cached ? cache->LastModified(assetRef) : 0);
+    request->SetCacheFiles("", stagingFile, (lastModified > 0 ? Http::LocalEpochToHttpDate(static_cast<time_t>(lastModified)) : ""));
+    request->SetStreamBody(true);
+
+    // Servers prefer 'If-None-Match' over 'If-Modified-Since' when both are given.
+    String eTag = (cached ? cache->ETag(assetRef) : "");
+    if (!eTag.Empty())
+        request->SetHeader(Http::Header::IfNoneMatch, eTag);
+}
+
+void HttpAssetProvider::StoreCacheValidators(HttpRequest *request, const String &assetRef)
+{
+    AssetCache *cache = framework_->Asset()->Cache();
+    if (!cache || Http::CacheControlNoStore(request->ResponseHeader(Http::Header::CacheControl)))
+        return;
+
+    // A '304 Not Modified' response may omit the validators, keep the stored ones in that case.
+    const bool modified = (request->StatusCode() != 304);
+    String eTag = request->ResponseHeader(Http::Header::ETag);
+    if (modified || !eTag.Empty())
+        cache->SetETag(assetRef, eTag);
+    time_t lastModified = Http::HttpDateToUtcEpoch(request->ResponseHeader(Http::Header::LastModified));
+    if (modified || lastModified > 0)
+        cache->SetLastModified(assetRef, static_cast<uint>(lastModified));
+
+    int maxAge = Http::CacheControlMaxAge(request->ResponseHeader(Http::Header::CacheControl));
+    cache->SetExpires(assetRef, (maxAge > 0 ? Urho3D::Time::GetTimeSinceEpoch() + static_cast<uint>(maxAge) : 0));
+}
+
+String HttpAssetProvider::StoreResponse(HttpRequest *request, const String &assetRef, const String &stagingFile)
+{
+    AssetCache *cache = framework_->Asset()->Cache();
+    if (!cache || !GetSubsystem<Urho3D::FileSystem>()->FileExists(stagingFile))
+        return "";
+    if (Http::CacheControlNoStore(request->ResponseHeader(Http::Header::CacheControl)))
+    {
+        cache->DeleteAsset(assetRef);
+        return "";
+    }
+
+    // A streamed body was hashed while it was written.
+    u64 contentHash = request->ResponseBodyHash();
+    if (!request->ResponseBodyStreamed())
+    {
+        const Vector<u8> &body = request->ResponseBody();
+        contentHash = HashData(body.Size() > 0 ? &body[0] : 0, body.Size());
+    }
+    String cacheFile = cache->StoreFile(assetRef, stagingFile, contentHash);
+    if (!cacheFile.Empty())
+        StoreCacheValidators(request, assetRef);
+    return cacheFile;
+}
+
+void HttpAssetProvider::Revalidate(const String &assetRef)
+{
+    AssetCache *cache = framework_->Asset()->Cache();
+    if (!cache || revalidations_.Contains(assetRef))
+        return;
+
+    HttpRequestPtr request = client_->Create(Http::Method::Get, assetRef);
+    if (!request)
+        return;
+
+    // Use a separate staging file so that a forced reload of the asset does not write to the same file.
+    SetCacheValidators(request, assetRef, cache->StagingPath(assetRef) + ".revalidate");
+    request->Finished.Connect(this, &HttpAssetProvider::OnRevalidated);
+    revalidations_[assetRef] = request;
+    client_->Schedule(request);
+}
+
+void HttpAssetProvider::OnRevalidated(HttpRequestPtr &request, int status, const String &error)
+{
+    String assetRef;
+    for(auto iter = revalidations_.Begin(); iter != revalidations_.End(); ++iter)
+    {
+        if (iter->second_ == request)
+        {
+            assetRef = iter->first_;
+            revalidations_.Erase(iter);
+            break;
+        }
+    }
+    AssetCache *cache = framework_->Asset()->Cache();
+    if (assetRef.Empty() || !cache)
+        return;
+
+    if (status == 304 && error.Empty())
+    {
+        StoreCacheValidators(request, assetRef);
+        return;
+    }
+    if (status != 200 || !error.Empty())
+    {
+        LogWarning("HttpAssetProvider: Failed to revalidate cached asset " + assetRef + ", keeping the cached copy: " +
+            (!error.Empty() ? error : Urho3D::ToString("%d %s", status, request->Status().CString())));
+        return;
+    }
+
+    // The cache is content addressed: if the stored file did not change, neither did the content.
+    String previousFile = cache->FindInCache(assetRef);
+    String stagingFile = cache->StagingPath(assetRef) + ".revalidate";
+    String cacheFile = StoreResponse(request, assetRef, stagingFile);
+    AssetPtr asset = framework_->Asset()->FindAsset(assetRef);
+    if (cacheFile.Empty() && Http::CacheControlNoStore(request->ResponseHeader(Http::Header::CacheControl)))
+    {
+        // The cached copy was deleted, reload the asset straight from the response body instead.
+        if (asset)
+        {
+            asset->SetDiskSource("");
+            if (asset->IsLoaded())
+                asset->LoadFromFile(stagingFile);
+        }
+        GetSubsystem<Urho3D::FileSystem>()->Delete(stagingFile);
+        return;
+    }
+    if (cacheFile.Empty() || cacheFile == previousFile)
+        return;
+
+    if (!asset)
+        return;
+    asset->SetDiskSource(cacheFile);
+    if (asset->IsLoaded())
+    {
+        LogDebug("HttpAssetProvider: Cached asset " + assetRef + " has changed on the server, reloading.");
+        asset->LoadFromCache();
+    }
+}
+
 AssetStoragePtr HttpAssetProvider::StorageForBaseURL(const String &url) const
 {
     foreach(const AssetStoragePtr &httpStorage, httpStorages_)
@@ -93,8 +251,26 @@ AssetTransferPtr HttpAssetProvider::CreateTransfer(String assetRef, String asset
 void HttpAssetProvider::ExecuteTransfer(AssetTransferPtr transfer)
 {
     HttpAssetTransfer *httpTransfer = dynamic_cast<HttpAssetTransfer*>(transfer.Get());
-    if (httpTransfer)
-        client_->Schedule(httpTransfer->Request());
+    if (!httpTransfer)
+        return;
+
+    /* Complete from the cache without a round trip to the server if the cached copy is fresh,
+       or if stale copies are revalidated in the background. A loaded asset is only transferred
+       again when its reload is forced, always ask the server in that case. */
+    AssetCache *cache = framework_->Asset()->Cache();
+    if (cache && !(transfer->asset && transfer->asset->IsLoaded()))
+    {
+        const String assetRef = httpTransfer->source.ref;
+        const bool fresh = (cache->Expires(assetRef) > Urho3D::Time::GetTimeSinceEpoch());
+        if ((fresh || staleWhileRevalidate_) && httpTransfer->CompleteFromCache())
+        {
+            framework_->Asset()->AssetTransferReady(transfer);
+            if (!fresh)
+                Revalidate(assetRef);
+            return;
+        }
+    }
+    client_->Schedule(httpTransfer->Request());
 }
 
 bool HttpAssetProvider::AbortTransfer(IAssetTransfer *transfer)
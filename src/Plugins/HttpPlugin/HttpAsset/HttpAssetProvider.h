@@ -11,6 +11,13 @@ namespace Tundra
 {
 
 /// HTTP asset provider.
+/** Downloaded assets are stored to the AssetCache along with their 'ETag', 'Last-Modified' and 'Cache-Control: max-age'
+    response headers. A cached asset is loaded without contacting the server while it is fresh according to max-age.
+    Otherwise a conditional request is sent and the cached copy is used if the server responds '304 Not Modified'.
+
+    In stale-while-revalidate mode a cached asset is loaded right away even if it is no longer fresh, and revalidated
+    in the background. The asset is reloaded only if the server returns changed content. The mode is enabled with
+    SetStaleWhileRevalidate() or the '--httpStaleWhileRevalidate' command line parameter. */
 class TUNDRA_HTTP_API HttpAssetProvider : public IAssetProvider
 {
     URHO3D_OBJECT(HttpAssetProvider, IAssetProvider);
@@ -21,6 +28,12 @@ public:
 
     Framework *Fw() { return framework_; }
 
+    /// Sets if stale cached assets are loaded right away and revalidated in the background.
+    void SetStaleWhileRevalidate(bool enabled);
+
+    /// Returns if stale cached assets are loaded right away and revalidated in the background.
+    bool StaleWhileRevalidate() const { return staleWhileRevalidate_; }
+
     /// IAssetProvider override.
     String Name() const override;
     /// IAssetProvider override.
@@ -46,6 +59,25 @@ public:
         AssetStoragePtr destination, const String &assetName) override;
 
 private:
+    friend class HttpAssetTransfer;
+
+    /// Sets the cache files and conditional request headers of @c request from the cache entry of @c assetRef.
+    /** @param stagingFile File the body of a '200 OK' response is streamed to. */
+    void SetCacheValidators(HttpRequest *request, const String &assetRef, const String &stagingFile);
+
+    /// Stores the 'ETag', 'Last-Modified' and 'Cache-Control' max-age response headers of @c request to the cache entry of @c assetRef.
+    /** Nothing is stored for a 'Cache-Control: no-store' response. */
+    void StoreCacheValidators(HttpRequest *request, const String &assetRef);
+
+    /// Commits a '200 OK' response body written to @c stagingFile as the cache entry of @c assetRef.
+    /** A 'Cache-Control: no-store' response is not stored, and the previously cached copy of @c assetRef is deleted.
+        @return The cache file, or empty string if the response was not stored. */
+    String StoreResponse(HttpRequest *request, const String &assetRef, const String &stagingFile);
+
+    /// Sends a conditional request for the cached @c assetRef in the background.
+    void Revalidate(const String &assetRef);
+    void OnRevalidated(HttpRequestPtr &request, int status, const String &error);
+
     /// IAssetProvider override.
     AssetStoragePtr TryCreateStorage(HashMap<String, String> &storageParams, bool fromNetwork) override;
 
@@ -59,6 +91,10 @@ private:
     HttpClientPtr client_;
 
     Vector<AssetStoragePtr> httpStorages_;
+
+    /// Ongoing background revalidations by asset reference.
+    HashMap<String, HttpRequestPtr> revalidations_;
+    bool staleWhileRevalidate_;
 };
 
 }
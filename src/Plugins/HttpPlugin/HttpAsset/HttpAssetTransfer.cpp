@@ -11,6 +11,8 @@
 #include "Framework.h"
 #include "LoggingFunctions.h"
 
+#include <Urho3D/IO/FileSystem.h>
+
 namespace Tundra
 {
 
@@ -27,11 +29,12 @@ HttpAssetTransfer::HttpAssetTransfer(HttpAssetProvider *provider, HttpRequestPtr
        Once 304 response is detected, this will be changed to Cached. */
     diskSourceType = IAsset::Original; 
 
-    // Cache destination path and source for 'If-Modified-Since' for a '304 Not Modified' response.
-    if (provider_->Fw()->Asset()->Cache())
+    // Cache destination path and validators for a '304 Not Modified' response.
+    AssetCache *cache = provider_->Fw()->Asset()->Cache();
+    if (cache)
     {
-        String cacheFile = provider_->Fw()->Asset()->Cache()->DiskSourceByRef(source.ref);
-        request->SetCacheFile(cacheFile, true);
+        String cacheFile = cache->FindInCache(source.ref);
+        provider_->SetCacheValidators(request_, source.ref, cache->StagingPath(source.ref));
         /* Indicated so AssetAPI that we will take care of writing the cache, but it can find
            the source file from this path. */
         SetCachingBehavior(false, cacheFile);
@@ -45,6 +48,27 @@ HttpAssetTransfer::~HttpAssetTransfer()
 {
 }
 
+bool HttpAssetTransfer::CompleteFromCache()
+{
+    AssetCache *cache = provider_->Fw()->Asset()->Cache();
+    String cacheFile = (cache ? cache->FindInCache(source.ref) : "");
+    if (cacheFile.Empty())
+        return false;
+
+    // The request is never executed.
+    if (request_)
+    {
+        request_->Finished.Disconnect(this, &HttpAssetTransfer::OnFinished);
+        request_.Reset();
+    }
+
+    // Same as for a '304 Not Modified' response.
+    diskSourceType = IAsset::Cached;
+    SetCachingBehavior(false, cacheFile);
+    mappedAssetData = cache->MapFile(source.ref);
+    return true;
+}
+
 void HttpAssetTransfer::OnFinished(HttpRequestPtr &request, int status, const String &error)
 {
     // Clear out reference.
@@ -55,18 +79,57 @@ void HttpAssetTransfer::OnFinished(HttpRequestPtr &request, int status, const St
     if ((status == 200 || status == 304) && error.Empty())
     {
         /* 304 Not Modified
-           1) HttpRequest has already written file to asset cache file set with HttpRequest::SetCacheFile()
-           2) Mark disk source as cached. Previous SetCachingBehavior already marked so that AssetAPI wont
+           1) Mark disk source as cached. Previous SetCachingBehavior already marked so that AssetAPI wont
               rewrite the disk file even if we provide rawAssetData.
-           3) If we do not load 'rawAssetData' with a valid disk source. AssetAPI will do the right thing and load
-              bytes from disk. This was desirable with Ogre as its threading mechanisms let us pass a filepath.
-              If it was a certain type of Ogre asset, the disk read was skipped and path was used. With Urho it is more efficient 
-              to do a memcpy here and not re-read from disk, which is slower as we already have the file in memory here.
-              @todo In other works for above: AssetAPI and its 'data shuffling' could be re-thinked with Urho. */
+           2) Hand AssetAPI a read-only memory mapping of the cache file, the decoders read it without
+              an intermediate copy. If mapping fails AssetAPI will do the right thing and load bytes from disk. */
+        AssetCache *cache = provider_->Fw()->Asset()->Cache();
         if (status == 304)
+        {
             diskSourceType = IAsset::Cached;
-
-        request->CopyResponseBodyTo(rawAssetData);
+            if (cache)
+            {
+                mappedAssetData = cache->MapFile(source.ref);
+                provider_->StoreCacheValidators(request, source.ref);
+            }
+        }
+        /* 200 OK
+           Commit the written staging file to the cache and store the validators for the next request.
+           A streamed body was never buffered, decoders read the committed cache file through a mapping
+           the same way as for a 304 response. */
+        else
+        {
+            if (!request->ResponseBodyStreamed())
+                request->CopyResponseBodyTo(rawAssetData);
+            String cacheFile = (cache ? provider_->StoreResponse(request, source.ref, cache->StagingPath(source.ref)) : "");
+            if (!cacheFile.Empty())
+            {
+                SetCachingBehavior(false, cacheFile);
+                if (request->ResponseBodyStreamed())
+                    mappedAssetData = cache->MapFile(source.ref);
+            }
+            else if (cache && Http::CacheControlNoStore(request->ResponseHeader(Http::Header::CacheControl)))
+            {
+                // Not cached, the asset is loaded from the response body only.
+                SetCachingBehavior(false, "");
+                if (request->ResponseBodyStreamed())
+                {
+                    String stagingFile = cache->StagingPath(source.ref);
+                    bool loaded = LoadFileToVector(stagingFile, rawAssetData);
+                    GetSubsystem<Urho3D::FileSystem>()->Delete(stagingFile);
+                    if (!loaded)
+                    {
+                        provider_->Fw()->Asset()->AssetTransferFailed(this, "Failed to read the downloaded data");
+                        return;
+                    }
+                }
+            }
+            else if (request->ResponseBodyStreamed())
+            {
+                provider_->Fw()->Asset()->AssetTransferFailed(this, "Failed to store the downloaded data to the asset cache");
+                return;
+            }
+        }
 
         provider_->Fw()->Asset()->AssetTransferCompleted(this);
     }
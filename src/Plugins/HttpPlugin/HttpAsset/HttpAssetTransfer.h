@@ -22,6 +22,12 @@ public:
     HttpRequestPtr Request() const { return request_; }
 
 private:
+    friend class HttpAssetProvider;
+
+    /// Prepares the transfer to be completed from the asset cache instead of executing the request.
+    /** @return False if the asset is not in the cache. */
+    bool CompleteFromCache();
+
     void OnFinished(HttpRequestPtr &request, int status, const String &error);
 
     HttpAssetProvider *provider_;
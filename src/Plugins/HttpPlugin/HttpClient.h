@@ -57,6 +57,10 @@ public:
     /// HTTP client stats.
     Http::Stats *Stats() const;
 
+    /// Signals completed requests and hands newly created ones to the I/O thread.
+    /** Called by HttpPlugin every frame. Call this yourself if you use a HttpClient outside of the plugin, eg. in tests. */
+    void Update(float frametime);
+
 private:
     friend class HttpPlugin;
     friend class HttpAssetProvider;
@@ -71,7 +75,6 @@ private:
     bool Schedule(HttpRequestPtr request);
 
     void Initialize();
-    void Update(float frametime);
     void DumpStats() const;
 
     SharedPtr<HttpHudPanel> httpHudPanel_;
@@ -18,6 +18,7 @@ namespace Tundra
     {
         const String Url    = "Url";
         const String Method = "Method";
+        const String HttpVersion = "HttpVersion";
     }
 
     namespace Curl
@@ -6,6 +6,7 @@
 #include "LoggingFunctions.h"
 
 #include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Math/MathDefs.h>
 
 namespace Tundra
 {
@@ -266,6 +267,32 @@ time_t HttpDateToUtcEpoch(const String &date)
 #endif
 }
 
+int CacheControlMaxAge(const String &cacheControl)
+{
+    int maxAge = -1;
+    StringVector directives = cacheControl.Split(',');
+    foreach(String directive, directives)
+    {
+        directive = directive.Trimmed().ToLower();
+        if (directive == "no-cache" || directive == "no-store")
+            return 0;
+        if (directive.StartsWith("max-age="))
+            maxAge = Urho3D::Max(Urho3D::ToInt(directive.Substring(8).Trimmed()), 0);
+    }
+    return maxAge;
+}
+
+bool CacheControlNoStore(const String &cacheControl)
+{
+    StringVector directives = cacheControl.Split(',');
+    foreach(const String &directive, directives)
+    {
+        if (directive.Trimmed().Compare("no-store", false) == 0)
+            return true;
+    }
+    return false;
+}
+
 // RequestData
 
 RequestData::RequestData() :
@@ -275,7 +302,8 @@ RequestData::RequestData() :
     msecDiskRead(-1),
     msecDiskWrite(-1),
     bodyWritePos(0),
-    method(-1)
+    method(-1),
+    streamBody(false)
 {
 }
 
@@ -320,7 +348,11 @@ ResponseData::ResponseData() :
     status(-1),
     downloadBytesPerSec(-1.0),
     uploadBytesPerSec(-1.0),
-    headersParsed(false)
+    numConnects(0),
+    headersParsed(false),
+    bodyStreamed(false),
+    streamedBytes(0),
+    streamedHash(0)
 {
 }
 
@@ -329,6 +361,8 @@ ResponseData::ResponseData() :
 Stats::Stats() :
     requests(0),
     errors(0),
+    connections(0),
+    http2Requests(0),
     downloads(0),
     uploads(0),
     diskReads(0),
@@ -416,6 +450,8 @@ String Stats::GetData(bool averages_, bool current_)
             PadString("", 12).CString()
         );
     }
+    str.AppendWithFormat("\n%s %d new for %d requests, %d over HTTP/2\n",
+        PadString("Connections", 12).CString(), connections, requests, http2Requests);
     if (current_)
     {
         str.AppendWithFormat("\n%s %d\n%s %d\n",
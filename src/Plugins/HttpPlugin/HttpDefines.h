@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "HttpPluginApi.h"
 #include "HttpPluginFwd.h"
 
 #include <Urho3D/Core/Timer.h>
@@ -108,6 +109,15 @@ namespace Http
     /** @see http://tools.ietf.org/html/rfc2616#page-134 */
     time_t HttpDateToUtcEpoch(const String &date);
 
+    /// Returns the freshness lifetime in seconds from a 'Cache-Control' header value.
+    /** @return The 'max-age' directive, 0 if 'no-cache' or 'no-store' is present, or -1 if neither is present.
+        @see CacheControlNoStore and http://tools.ietf.org/html/rfc7234#section-5.2 */
+    TUNDRA_HTTP_API int CacheControlMaxAge(const String &cacheControl);
+
+    /// Returns if a 'Cache-Control' header value has the 'no-store' directive, the response must not be cached at all.
+    /** @see http://tools.ietf.org/html/rfc7234#section-5.2.2.3 */
+    TUNDRA_HTTP_API bool CacheControlNoStore(const String &cacheControl);
+
     /// @cond PRIVATE
     // Everything below is an implementation detail.
 
@@ -147,8 +157,12 @@ namespace Http
         Vector<u8> bodyBytes;
         uint bodyWritePos;
 
-        // File to read and write cache entry to
+        // File to read a '304 Not Modified' response body from
         String cacheFile;
+        // File to write a '200 OK' response body to
+        String cacheWriteFile;
+        // Write the '200 OK' response body to cacheWriteFile as it arrives instead of buffering it
+        bool streamBody;
 
         // Error occurred during threaded run.
         String error;
@@ -189,10 +203,22 @@ namespace Http
         Vector<u8> headersBytes;
         bool headersParsed;
 
+        // Set if the body was written to RequestData::cacheWriteFile as it arrived instead of to bodyBytes
+        bool bodyStreamed;
+        uint streamedBytes;
+        // HashData hash of the streamed body
+        u64 streamedHash;
+
+        // Returns the received body size regardless if it was streamed
+        uint BodySize() const { return (bodyStreamed ? streamedBytes : bodyBytes.Size()); }
+
         // Response download speed
         double downloadBytesPerSec;
         double uploadBytesPerSec;
 
+        // Number of new connections curl had to open for the request. 0 if an existing connection was reused.
+        long numConnects;
+
         // Default ctor
         ResponseData();
     };
@@ -240,6 +266,9 @@ namespace Http
         uint requests;
         uint errors;
 
+        uint connections;
+        uint http2Requests;
+
         uint downloads;
         uint uploads;
         uint diskReads;
@@ -39,12 +39,14 @@ namespace Tundra
         typedef HashMap<String, Option> OptionMap;
         typedef void RequestHandle;
         typedef void EngineHandle;
+        typedef void ShareHandle;
     }
 
     /// @cond PRIVATE
     namespace Http
     {
         struct Stats;
+        struct Share;
     }
     class HttpWorkThread;
     typedef Vector<HttpWorkThread*> HttpWorkThreadList;
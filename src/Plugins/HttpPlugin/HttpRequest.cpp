@@ -5,6 +5,7 @@
 
 #include "Framework.h"
 #include "JSON.h"
+#include "CoreHashUtils.h"
 
 #include <Urho3D/Core/WorkQueue.h>
 #include <Urho3D/Core/StringUtils.h>
@@ -225,6 +226,7 @@ bool HttpRequest::SetCacheFile(const String &filepath, bool useLastModified)
         return false;
     }
     requestData_.cacheFile = Urho3D::GetInternalPath(filepath);
+    requestData_.cacheWriteFile = requestData_.cacheFile;
 
     // Read 'If-Modified-Since' from cache file
     if (useLastModified && framework_->GetSubsystem<Urho3D::FileSystem>()->FileExists(requestData_.cacheFile))
@@ -246,12 +248,62 @@ bool HttpRequest::SetCacheFile(const String &filepath, const String &lastModifie
         return false;
     }
     requestData_.cacheFile = Urho3D::GetInternalPath(filepath);
+    requestData_.cacheWriteFile = requestData_.cacheFile;
 
     if (!lastModifiedHttpDate.Empty())
         SetHeaderInternal(Http::Header::IfModifiedSince, lastModifiedHttpDate, false, false); // Do not lock inside SetHeaderInternal, already aquired above.
     return true;
 }
 
+bool HttpRequest::SetCacheFiles(const String &readFilepath, const String &writeFilepath, const String &lastModifiedHttpDate)
+{
+    Urho3D::MutexLock m(mutexExecute_);
+    if (executing_)
+    {
+        log.Error("SetCacheFiles: Cannot set cache files to a running request.");
+        return false;
+    }
+    requestData_.cacheFile = (!readFilepath.Empty() ? Urho3D::GetInternalPath(readFilepath) : "");
+    requestData_.cacheWriteFile = (!writeFilepath.Empty() ? Urho3D::GetInternalPath(writeFilepath) : "");
+
+    if (!lastModifiedHttpDate.Empty())
+        SetHeaderInternal(Http::Header::IfModifiedSince, lastModifiedHttpDate, false, false); // Do not lock inside SetHeaderInternal, already aquired above.
+    return true;
+}
+
+bool HttpRequest::SetStreamBody(bool enabled)
+{
+    Urho3D::MutexLock m(mutexExecute_);
+    if (executing_)
+    {
+        log.Error("SetStreamBody: Cannot change body streaming of a running request.");
+        return false;
+    }
+    requestData_.streamBody = enabled;
+    return true;
+}
+
+bool HttpRequest::SetHttp2PriorKnowledge(bool enabled)
+{
+    Urho3D::MutexLock m(mutexExecute_);
+    if (executing_)
+    {
+        log.Error("SetHttp2PriorKnowledge: Cannot change the HTTP version of a running request.");
+        return false;
+    }
+#if LIBCURL_VERSION_NUM >= 0x073100 // 7.49.0
+    if (enabled)
+        requestData_.options[Options::HttpVersion] = Curl::Option(CURLOPT_HTTP_VERSION, Variant(static_cast<int>(CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE)));
+    else
+        requestData_.options.Erase(Options::HttpVersion);
+    return true;
+#else
+    if (enabled)
+        log.Error("SetHttp2PriorKnowledge: Not supported by this libcurl version.");
+    return !enabled;
+#endif
+}
+
 // Response API
 
 int HttpRequest::StatusCode()
@@ -268,6 +320,13 @@ String HttpRequest::Status()
     return responseData_.statusText;
 }
 
+String HttpRequest::ResponseHttpVersion()
+{
+    if (!HasCompleted() || responseData_.httpVersionMajor < 0)
+        return "";
+    return Urho3D::ToString("%d.%d", responseData_.httpVersionMajor, responseData_.httpVersionMinor);
+}
+
 int HttpRequest::DurationMSec()
 {
     if (!HasCompleted())
@@ -302,7 +361,21 @@ uint HttpRequest::ResponseBodySize()
 {
     if (!HasCompleted())
         return 0;
-    return responseData_.bodyBytes.Size();
+    return responseData_.BodySize();
+}
+
+bool HttpRequest::ResponseBodyStreamed()
+{
+    if (!HasCompleted())
+        return false;
+    return responseData_.bodyStreamed;
+}
+
+u64 HttpRequest::ResponseBodyHash()
+{
+    if (!HasCompleted() || !responseData_.bodyStreamed)
+        return 0;
+    return responseData_.streamedHash;
 }
 
 bool HttpRequest::CopyResponseBodyTo(Vector<u8> &dest)
@@ -531,31 +604,48 @@ uint HttpRequest::HeaderUIntInternal(const String &name, uint defaultValue, bool
     return value;
 }
 
-void HttpRequest::Perform()
+bool HttpRequest::Start(Curl::RequestHandle *handle)
 {
     // @note Invoked in worker thread context
+    Urho3D::MutexLock m(mutexExecute_);
+    requestData_.curlHandle = handle;
+    executing_ = Prepare();
+    completed_ = !executing_;
+    if (!executing_)
     {
-        Urho3D::MutexLock m(mutexExecute_);
-        executing_ = Prepare();
-        completed_ = !executing_;
+        // Caller keeps ownership of the handle
+        requestData_.curlHandle = 0;
+        Cleanup();
+        return false;
     }
-    if (!executing_)
-        return;
+    timer_.Reset();
+    return true;
+}
 
-    Urho3D::Timer timer;
-    CURLcode res = curl_easy_perform(requestData_.curlHandle);
+void HttpRequest::Finish(CURLcode res)
+{
+    // @note Invoked in worker thread context
     if (res != CURLE_OK)
     {
         requestData_.error = curl_easy_strerror(res);
-        log.ErrorF("Failed to initialze request: %s", requestData_.error.CString());
+        log.ErrorF("Request failed: %s", requestData_.error.CString());
     }
-    requestData_.msecNetwork = timer.GetMSec(false);
+    requestData_.msecNetwork = timer_.GetMSec(false);
 
     /* Compact unused bytes from input buffers. bodyBytes should not have any free
        capacity if Content-Lenght header was provided by the server and correct. */
     responseData_.headersBytes.Compact();
     responseData_.bodyBytes.Compact();
 
+    // Close a streamed body file. An incomplete file is removed so that it is never mistaken for the full body.
+    if (bodyFile_)
+    {
+        bodyFile_->Close();
+        bodyFile_.Reset();
+        if (res != CURLE_OK)
+            framework_->GetSubsystem<Urho3D::FileSystem>()->Delete(requestData_.cacheWriteFile);
+    }
+
     /// @todo Don't run if request was aborted. Does this error check suffice?
     if (res == CURLE_OK)
     {
@@ -566,6 +656,24 @@ void HttpRequest::Perform()
             log.ErrorF("Failed to read response download speed");
         if (curl_easy_getinfo(requestData_.curlHandle, CURLINFO_SPEED_UPLOAD, &responseData_.uploadBytesPerSec) != CURLE_OK)
             log.ErrorF("Failed to read response upload speed");
+        if (curl_easy_getinfo(requestData_.curlHandle, CURLINFO_NUM_CONNECTS, &responseData_.numConnects) != CURLE_OK)
+            responseData_.numConnects = 0;
+#if LIBCURL_VERSION_NUM >= 0x073200 // 7.50.0
+        long httpVersion = 0;
+        if (curl_easy_getinfo(requestData_.curlHandle, CURLINFO_HTTP_VERSION, &httpVersion) == CURLE_OK)
+        {
+            if (httpVersion == CURL_HTTP_VERSION_2_0)
+            {
+                responseData_.httpVersionMajor = 2;
+                responseData_.httpVersionMinor = 0;
+            }
+            else if (httpVersion == CURL_HTTP_VERSION_1_1 || httpVersion == CURL_HTTP_VERSION_1_0)
+            {
+                responseData_.httpVersionMajor = 1;
+                responseData_.httpVersionMinor = (httpVersion == CURL_HTTP_VERSION_1_1 ? 1 : 0);
+            }
+        }
+#endif
 
         // Parse headers if not done yet.
         ParseHeaders();
@@ -574,11 +682,18 @@ void HttpRequest::Perform()
         if (responseData_.status == 200)
         {
             uint contentLenght = HeaderUIntInternal(Http::Header::ContentLength, 0, true, false);
-            if (contentLenght > 0 && responseData_.bodyBytes.Size() != contentLenght)
-                log.WarningF("Content-Lenght %d header does not match size of %d read bytes for %s. Data might be incomplete.", contentLenght, responseData_.bodyBytes.Size(), requestData_.options[Options::Url].value.GetString().CString());
+            if (contentLenght > 0 && responseData_.BodySize() != contentLenght)
+                log.WarningF("Content-Lenght %d header does not match size of %d read bytes for %s. Data might be incomplete.", contentLenght, responseData_.BodySize(), requestData_.options[Options::Url].value.GetString().CString());
 
+            // A streamed body has already been written, only apply the 'Last-Modified' timestamp.
+            if (responseData_.bodyStreamed)
+            {
+                time_t epoch = Http::HttpDateToUtcEpoch(HeaderInternal(Http::Header::LastModified, true, false));
+                if (epoch > 0)
+                    framework_->GetSubsystem<Urho3D::FileSystem>()->SetLastModifiedTime(requestData_.cacheWriteFile, static_cast<uint>(epoch));
+            }
             // Write cache file if designated. File will be written regardless if server sent a 'Last-Modified' header.
-            if (!requestData_.cacheFile.Empty())
+            else if (!requestData_.cacheWriteFile.Empty())
             {
                 String lastModified = HeaderInternal(Http::Header::LastModified, true, false);
 
@@ -586,7 +701,7 @@ void HttpRequest::Perform()
                     one request is ongoing at a time to a unique URL. The URL designates the filepath where we are writing. Framework and Urho3D
                     Engine and its subsystem are guaranteed to be up while any worker thread is running (exit blocks waiting for workers to finish).
                     Still this is dicy, it would be nice to execute the disk write in thread but if not safe it can be moved to main thread. */
-                Urho3D::File file(framework_->GetContext(), requestData_.cacheFile, Urho3D::FILE_WRITE);
+                Urho3D::File file(framework_->GetContext(), requestData_.cacheWriteFile, Urho3D::FILE_WRITE);
                 if (file.IsOpen())
                 {
                     Urho3D::Timer t;
@@ -598,14 +713,14 @@ void HttpRequest::Perform()
                         {
                             time_t epoch = Http::HttpDateToUtcEpoch(lastModified);
                             if (epoch > 0) // SetLastModifiedTime converts utc epoch correctly to local
-                                framework_->GetSubsystem<Urho3D::FileSystem>()->SetLastModifiedTime(requestData_.cacheFile, static_cast<uint>(epoch));
+                                framework_->GetSubsystem<Urho3D::FileSystem>()->SetLastModifiedTime(requestData_.cacheWriteFile, static_cast<uint>(epoch));
                         }
                     }
                     requestData_.msecDiskWrite = t.GetMSec(false);
                 }
             }
         }
-        else if (responseData_.status == 304)
+        else if (responseData_.status == 304 && !requestData_.cacheFile.Empty())
         {
             /// See above 200 OK file access comment
             Urho3D::File file(framework_->GetContext(), requestData_.cacheFile, Urho3D::FILE_READ);
@@ -624,6 +739,8 @@ void HttpRequest::Perform()
         }
     }
 
+    // The curl handle is owned by the worker thread, it will be reused for other requests.
+    requestData_.curlHandle = 0;
     Cleanup();
 
     {
@@ -637,9 +754,7 @@ bool HttpRequest::Prepare()
 {
     // @note Invoked in worker thread context
 
-    /* @todo If we want to reuse the curl handle, its possible,
-       but not within the same HttpRequest. They would need to be pooled somewhere.
-       Research if this would make a perf difference. */
+    // Handles are pooled by HttpWorkThread, create one only if none was given.
     if (!requestData_.curlHandle)
         requestData_.curlHandle = curl_easy_init();
     if (!requestData_.curlHandle)
@@ -657,6 +772,9 @@ bool HttpRequest::Prepare()
     if (verbose_ && IsLogLevelEnabled(LogLevelDebug))
         curl_easy_setopt(requestData_.curlHandle, CURLOPT_VERBOSE, 1L);
 
+    // Lets HttpWorkThread find the request of a finished curl multi transfer
+    curl_easy_setopt(requestData_.curlHandle, CURLOPT_PRIVATE, this);
+
     // Reading from response
     curl_easy_setopt(requestData_.curlHandle, CURLOPT_WRITEFUNCTION, CurlReadBody);
     curl_easy_setopt(requestData_.curlHandle, CURLOPT_WRITEDATA, this);
@@ -698,7 +816,8 @@ bool HttpRequest::Prepare()
         }
         else if (value.GetType() == Urho3D::VAR_INT)
         {
-            CURLcode res = curl_easy_setopt(requestData_.curlHandle, option.option, value.GetInt());
+            // Curl reads integer options as long
+            CURLcode res = curl_easy_setopt(requestData_.curlHandle, option.option, static_cast<long>(value.GetInt()));
             if (res != CURLE_OK)
             {
                 requestData_.error = curl_easy_strerror(res);
@@ -756,11 +875,16 @@ void HttpRequest::WriteStats(Http::Stats *stats)
         if (requestData_.msecNetwork > -1)
             stats->requests++;
 
+        // Connection reuse
+        stats->connections += static_cast<uint>(responseData_.numConnects);
+        if (responseData_.httpVersionMajor == 2)
+            stats->http2Requests++;
+
         // Disk write
         if (requestData_.msecDiskWrite > -1)
         {
             stats->diskWrites += 1;
-            stats->totals.diskWriteBytes += responseData_.bodyBytes.Size();
+            stats->totals.diskWriteBytes += responseData_.BodySize();
             stats->totals.msecDiskWrite += requestData_.msecDiskWrite;
             if (stats->averages.msecDiskWrite < 0.0)
                 stats->averages.msecDiskWrite = static_cast<double>(requestData_.msecDiskWrite);
@@ -783,7 +907,7 @@ void HttpRequest::WriteStats(Http::Stats *stats)
         else
         {
             stats->downloads += 1;
-            stats->totals.downloadBytes += responseData_.bodyBytes.Size();
+            stats->totals.downloadBytes += responseData_.BodySize();
             if (responseData_.downloadBytesPerSec > -1.0)
             {
                 if (stats->averages.bestDownloadBytesPerSec < responseData_.downloadBytesPerSec)
@@ -919,17 +1043,55 @@ size_t HttpRequest::ReadBody(void *buffer, uint size)
 {
     /* First body bytes are being received. Parse headers to determine exact size of
        incoming data. This way we don't have to resize the body buffer mid flight. */
-    if (responseData_.bodyBytes.Empty() && !responseData_.headersBytes.Empty())
+    if (!responseData_.headersParsed && !responseData_.headersBytes.Empty())
     {
         if (!ParseHeaders())
             return 0; // Propagates a CURLE_WRITE_ERROR and aborts transfer
 
+        // Stream a '200 OK' body to the cache write file if requested. Other responses are buffered as usual.
+        long status = 0;
+        if (requestData_.streamBody && !requestData_.cacheWriteFile.Empty() &&
+            curl_easy_getinfo(requestData_.curlHandle, CURLINFO_RESPONSE_CODE, &status) == CURLE_OK && status == 200)
+        {
+            // See the thread safety note on cache file writing in Finish.
+            bodyFile_ = new Urho3D::File(framework_->GetContext(), requestData_.cacheWriteFile, Urho3D::FILE_WRITE);
+            if (bodyFile_->IsOpen())
+            {
+                responseData_.bodyStreamed = true;
+                responseData_.streamedHash = cHashSeed;
+                requestData_.msecDiskWrite = 0;
+            }
+            else
+            {
+                log.WarningF("Failed to open %s for streaming the response body, buffering it instead.", requestData_.cacheWriteFile.CString());
+                bodyFile_.Reset();
+            }
+        }
+
         // Headers have been parsed. Reserve bodyBytes_ to "Content-Length" size.
-        responseData_.bodyBytes.Reserve(HeaderUIntInternal(Http::Header::ContentLength, HTTP_INITIAL_BODY_SIZE, true, false));
+        if (!responseData_.bodyStreamed)
+            responseData_.bodyBytes.Reserve(HeaderUIntInternal(Http::Header::ContentLength, HTTP_INITIAL_BODY_SIZE, true, false));
+    }
+
+    if (bodyFile_)
+    {
+        Urho3D::Timer t;
+        if (bodyFile_->Write(buffer, size) != size)
+        {
+            log.ErrorF("Failed to write response body to %s", requestData_.cacheWriteFile.CString());
+            return 0; // Propagates a CURLE_WRITE_ERROR and aborts transfer
+        }
+        // Hash while writing so that the cache does not need to re-read the file.
+        responseData_.streamedHash = HashData(static_cast<const u8*>(buffer), size, responseData_.streamedHash);
+        responseData_.streamedBytes += size;
+        requestData_.msecDiskWrite += t.GetMSec(false);
+        return size;
     }
 
-    Vector<u8> data(static_cast<u8*>(buffer), size);
-    responseData_.bodyBytes.Push(data);
+    // Append straight to the reserved buffer without a temporary copy.
+    uint offset = responseData_.bodyBytes.Size();
+    responseData_.bodyBytes.Resize(offset + size);
+    memcpy(&responseData_.bodyBytes[offset], buffer, size);
     return size;
 }
 
@@ -963,8 +1125,17 @@ size_t HttpRequest::ReadHeaders(void *buffer, uint size)
     if (responseData_.headersBytes.Empty())
         responseData_.headersBytes.Reserve(HTTP_MAX_HEADER_SIZE);
 
-    Vector<u8> data(static_cast<u8*>(buffer), size);
-    responseData_.headersBytes.Push(data);
+    // libcurl writes the HTTP/2 status line as "HTTP/2 200", but http_parser only accepts "HTTP/<major>.<minor>".
+    // Curl passes the headers one complete line at a time, so the status line is always at the start of the buffer.
+    const char *data = static_cast<const char*>(buffer);
+    uint skip = 0;
+    if (size > 7 && memcmp(data, "HTTP/2 ", 7) == 0)
+    {
+        const char *version = "HTTP/2.0";
+        responseData_.headersBytes.Push(Vector<u8>(reinterpret_cast<const u8*>(version), 8));
+        skip = 6;
+    }
+    responseData_.headersBytes.Push(Vector<u8>(reinterpret_cast<const u8*>(data + skip), size - skip));
     return size;
 }
 
@@ -9,9 +9,11 @@
 #include "LoggingFunctions.h"
 
 #include <Urho3D/Core/Mutex.h>
+#include <Urho3D/Core/Timer.h>
 #include <Urho3D/Container/Str.h>
 #include <Urho3D/Container/HashMap.h>
 #include <Urho3D/Container/RefCounted.h>
+#include <Urho3D/IO/File.h>
 
 #include "HttpCurlInterop.h"
 
@@ -116,6 +118,24 @@ public:
     /** @param 'If-Modified-Since' header will be written to the provided @c lastModifiedHttpDate if non empty string. */
     bool SetCacheFile(const String &filepath, const String &lastModifiedHttpDate);
 
+    /// Sets separate source and destination files for HTTP cache mechanisms.
+    /** @param readFilepath File used as the response data for a '304 Not Modified' response. Can be empty if nothing is cached yet.
+        @param writeFilepath File the body of a '200 OK' response is written to prior to completion signals.
+        @param lastModifiedHttpDate 'If-Modified-Since' header value, not set if empty string.
+        @note Useful when the cache commits written files to a different location, like AssetCache::StagingPath. */
+    bool SetCacheFiles(const String &readFilepath, const String &writeFilepath, const String &lastModifiedHttpDate);
+
+    /// Sets if a '200 OK' response body is written to the cache write file as it arrives.
+    /** The body is then never held in memory as a whole: ResponseBody() is empty and the data must be read from the written file.
+        Requires a write file set with SetCacheFile or SetCacheFiles. If the file cannot be opened the body is buffered as usual.
+        @see ResponseBodyStreamed and ResponseBodyHash. */
+    bool SetStreamBody(bool enabled);
+
+    /// Sets if HTTP/2 is used for a plain text "http://" URL right away, instead of HTTP/1.1.
+    /** The server must support HTTP/2 without TLS. "https://" URLs negotiate HTTP/2 during the TLS handshake regardless.
+        The request fails if libcurl is built without HTTP/2 support. */
+    bool SetHttp2PriorKnowledge(bool enabled);
+
     ///////////////////////// RESPONSE API
 
     /// Returns status code eg, 200 if request has completed successfully, otherwise -1.
@@ -124,6 +144,9 @@ public:
     /// Returns status text eg. "OK" if request has completed, otherwise empty string.
     String Status();
 
+    /// Returns the HTTP version of the response eg. "1.1" or "2.0" if request has completed, otherwise empty string.
+    String ResponseHttpVersion();
+
     /// Returns time spent in networking in milliseconds.
     /** @return -1 if request not completed yet or did not perform any networking. */
     int DurationMSec();
@@ -138,9 +161,17 @@ public:
 
     /// Returns the response body size in bytes if request has completed.
     /** @return Returns 0 if body is empty or if request has not completed yet.
-        Verify completion before calling this function with HasCompleted(). */
+        Verify completion before calling this function with HasCompleted(). Includes a streamed body. */
     uint ResponseBodySize();
 
+    /// Returns if the response body was written to the cache write file instead of ResponseBody().
+    /** @see SetStreamBody. */
+    bool ResponseBodyStreamed();
+
+    /// Returns the HashData hash of a streamed response body, calculated while it was written.
+    /** @return 0 if the body was not streamed or if request has not completed yet. */
+    u64 ResponseBodyHash();
+
     /// Returns the response body by reference if request has completed.
     /** This function should be preferred to avoid copies of large data chunks.
         @return Body if request has completed, otherwise an empty vector.*/
@@ -195,7 +226,13 @@ private:
     uint HeaderUIntInternal(const String &name, uint defaultValue, bool respose, bool lock = true);
 
     /// Called by HttpWorkThread in worker thread context.
-    void Perform();
+    /** Prepares the request for execution with the curl easy @c handle, which the caller then adds to its multi handle.
+        Returns false if the request could not be prepared, in which case it is completed and does not keep the handle. */
+    bool Start(Curl::RequestHandle *handle);
+    /// Called by HttpWorkThread in worker thread context when curl has finished the transfer with @c result.
+    /** Reads the response information, handles the cache file and completes the request.
+        The curl handle is detached from the request and can be reused by the caller. */
+    void Finish(CURLcode result);
     /// Invoked in worker thread context.
     bool Prepare();
     /// Invoked in worker thread context.
@@ -232,6 +269,9 @@ private:
     Http::ResponseData responseData_;
 
     Urho3D::Mutex mutexExecute_;
+    Urho3D::Timer timer_;
+    /// Open cache write file while a streamed body is being received.
+    SharedPtr<Urho3D::File> bodyFile_;
     bool executing_;
     bool completed_;
     bool verbose_;
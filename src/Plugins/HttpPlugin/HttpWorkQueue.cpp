@@ -9,23 +9,79 @@
 
 #include <Urho3D/Core/ProcessUtils.h>
 #include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Math/MathDefs.h>
+
+#include <curl/curl.h>
 
 namespace Tundra
 {
 
+#define HTTP_MAX_CONCURRENT_TRANSFERS 256   // Per thread
+#define HTTP_MAX_POLL_MSEC 100              // Max time to block in curl while transfers are active
+#define HTTP_MAX_HOST_CONNECTIONS 6         // Per host, further requests queue or multiplex on the open ones
+#define HTTP_MAX_CACHED_CONNECTIONS 64      // Idle connections kept open for reuse
+
+// Http::Share
+
+namespace Http
+{
+
+static void ShareLock(CURL * /*handle*/, curl_lock_data data, curl_lock_access /*access*/, void *userptr);
+static void ShareUnlock(CURL * /*handle*/, curl_lock_data data, void *userptr);
+
+/// @cond PRIVATE
+struct Share
+{
+    Share() :
+        handle(curl_share_init())
+    {
+        if (!handle)
+            return;
+        curl_share_setopt(handle, CURLSHOPT_LOCKFUNC, ShareLock);
+        curl_share_setopt(handle, CURLSHOPT_UNLOCKFUNC, ShareUnlock);
+        curl_share_setopt(handle, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900 // 7.57.0
+        curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+    }
+
+    ~Share()
+    {
+        if (handle)
+            curl_share_cleanup(handle);
+    }
+
+    Curl::ShareHandle *handle;
+    Urho3D::Mutex locks[CURL_LOCK_DATA_LAST];
+};
+/// @endcond
+
+static void ShareLock(CURL * /*handle*/, curl_lock_data data, curl_lock_access /*access*/, void *userptr)
+{
+    if (data < CURL_LOCK_DATA_LAST)
+        static_cast<Share*>(userptr)->locks[data].Acquire();
+}
+
+static void ShareUnlock(CURL * /*handle*/, curl_lock_data data, void *userptr)
+{
+    if (data < CURL_LOCK_DATA_LAST)
+        static_cast<Share*>(userptr)->locks[data].Release();
+}
+
+}
+
 // HttpWorkQueue
 
-const float DurationKeepAliveThreads = 10.f;
 const Logger HttpWorkQueue::log = Logger("HttpRequest");
 
 HttpWorkQueue::HttpWorkQueue() :
     durationNoWork_(0.f),
-    stats_(new Http::Stats())
+    numMaxThreads_(1), // One I/O thread can drive hundreds of concurrent transfers
+    stats_(new Http::Stats()),
+    share_(new Http::Share())
 {
-    numMaxThreads_ = Urho3D::GetNumLogicalCPUs();
-    if (numMaxThreads_ < 1) numMaxThreads_ = 1;         // Need at least one worker
-    else if (numMaxThreads_ > 32) numMaxThreads_ = 32;  // Cap to something sensible
-    log.DebugF("Maximum number of threads %d detected from %d physical and %d logical CPUs", numMaxThreads_, Urho3D::GetNumPhysicalCPUs(), Urho3D::GetNumLogicalCPUs());
 }
 
 HttpWorkQueue::~HttpWorkQueue()
@@ -43,6 +99,7 @@ HttpWorkQueue::~HttpWorkQueue()
         executing_.Clear();
     }
     SAFE_DELETE(stats_);
+    SAFE_DELETE(share_);
 }
 
 void HttpWorkQueue::Schedule(const HttpRequestPtr &request)
@@ -79,12 +136,14 @@ void HttpWorkQueue::Update(float frametime)
        This is done so that main thread can prepare the created request
        witin the creation frame update without threading conflicts. */
     uint numPending = 0;
+    bool scheduled = false;
     {
         Urho3D::MutexLock m2(mutexRequests_);
         if (created_.Size() > 0)
         {
             requests_.Insert(requests_.End(), created_.Begin(), created_.End());
             created_.Clear();
+            scheduled = true;
         }
         numPending = requests_.Size();
     }
@@ -94,19 +153,22 @@ void HttpWorkQueue::Update(float frametime)
 
     if (numPending + numExecuting == 0)
     {
-        /* Don't stop workers immediately. Wait for some time
-           if new work will come in. Spinning up threads is not free. */
+        /* The threads are kept running while idle. They block without using CPU
+           and keep the connection cache of their curl multi handle alive. */
         durationNoWork_ += frametime;
-        if (durationNoWork_ > DurationKeepAliveThreads && threads_.Size() > 0)
-            StopThreads();
         stats_->current.idle = (threads_.Size() > 0 ? durationNoWork_ : -1.f);
         return;
     }
     durationNoWork_ = 0.f;
 
-    // Start new threads
-    if (threads_.Size() < numPending)
-        StartThreads(numPending);
+    // Start threads on first use and wake them up for the new work
+    if (threads_.Empty())
+        StartThreads(numMaxThreads_);
+    if (scheduled)
+    {
+        for (uint i = 0; i < threads_.Size(); ++i)
+            threads_[i]->Wakeup();
+    }
 
     stats_->current.idle = -1.f;
     stats_->current.threads = threads_.Size();
@@ -141,32 +203,39 @@ void HttpWorkQueue::StopThreads()
         threads_.Pop();
 
         log.DebugF("Stopping thread %d", threads_.Size()+1);
+        thread->RequestStop();
         thread->Stop();
         delete thread;
     }
     stats_->current.threads = threads_.Size();
 }
 
-HttpRequest* HttpWorkQueue::Next()
+uint HttpWorkQueue::NumWaiting()
 {
-    mutexRequests_.Acquire();
-    if (requests_.Size() > 0)
+    Urho3D::MutexLock m(mutexRequests_);
+    return requests_.Size();
+}
+
+uint HttpWorkQueue::Take(Vector<HttpRequest*> &dest, uint max)
+{
+    HttpRequestPtrList taken;
     {
-        // Remove from pending
-        HttpRequestPtrList::Iterator iter = requests_.Begin();
-        HttpRequestPtr next = *iter;
-        requests_.Erase(iter);
-        mutexRequests_.Release();
+        Urho3D::MutexLock m(mutexRequests_);
+        uint num = Urho3D::Min(max, requests_.Size());
+        if (num == 0)
+            return 0;
+        taken.Insert(taken.End(), requests_.Begin(), requests_.Begin() + num);
+        requests_.Erase(requests_.Begin(), requests_.Begin() + num);
+    }
 
-        // Add to executing
-        {
-            Urho3D::MutexLock m(mutexCompleted_);
-            executing_.Push(next);
-        }
-        return next;
+    // Add to executing
+    {
+        Urho3D::MutexLock m(mutexCompleted_);
+        executing_.Insert(executing_.End(), taken.Begin(), taken.End());
     }
-    mutexRequests_.Release();
-    return nullptr;
+    for (uint i = 0; i < taken.Size(); ++i)
+        dest.Push(taken[i].Get());
+    return taken.Size();
 }
 
 HttpRequestPtrList::Iterator HttpWorkQueue::FindExecuting(HttpRequest *request)
@@ -198,27 +267,202 @@ void HttpWorkQueue::Completed(HttpRequest *request)
 // HttpWorkThread
 
 HttpWorkThread::HttpWorkThread(HttpWorkQueue *queue) :
-    queue_(queue)
+    queue_(queue),
+    multi_(curl_multi_init()),
+    wakeRequested_(false)
+{
+    if (!multi_)
+    {
+        LogError("[HttpWorkThread] Failed to create curl multi handle");
+        return;
+    }
+    curl_multi_setopt(multi_, CURLMOPT_MAXCONNECTS, static_cast<long>(HTTP_MAX_CACHED_CONNECTIONS));
+#if LIBCURL_VERSION_NUM >= 0x071E00 // 7.30.0
+    curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(HTTP_MAX_HOST_CONNECTIONS));
+#endif
+#if LIBCURL_VERSION_NUM >= 0x072B00 // 7.43.0
+    curl_multi_setopt(multi_, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+}
+
+HttpWorkThread::~HttpWorkThread()
+{
+    // Thread has been stopped, AbortActive has removed all easy handles from multi_.
+    foreach(Curl::RequestHandle *handle, freeHandles_)
+        curl_easy_cleanup(handle);
+    freeHandles_.Clear();
+    if (multi_)
+        curl_multi_cleanup(multi_);
+    multi_ = 0;
+}
+
+void HttpWorkThread::Wakeup()
+{
+    {
+        std::lock_guard<std::mutex> lock(wakeupMutex_);
+        wakeRequested_ = true;
+    }
+    wakeup_.notify_one();
+#if LIBCURL_VERSION_NUM >= 0x074400 // 7.68.0
+    // Interrupts curl_multi_poll if transfers are active.
+    if (multi_)
+        curl_multi_wakeup(multi_);
+#endif
+}
+
+void HttpWorkThread::RequestStop()
 {
+    shouldRun_ = false;
+    Wakeup();
 }
 
 void HttpWorkThread::ThreadFunction()
 {
     LogDebug("[HttpWorkThread] Starting " + String(GetCurrentThreadID()));
 
-    while(shouldRun_)
+    while(shouldRun_ && multi_)
     {
-        HttpRequest  *request = queue_->Next();
+        StartRequests();
+
+        int running = 0;
+        CURLMcode res = curl_multi_perform(multi_, &running);
+        if (res != CURLM_OK)
+            LogErrorF("[HttpWorkThread] curl_multi_perform failed: %s", curl_multi_strerror(res));
+
+        ProcessCompleted();
+
+        if (active_.Empty())
+        {
+            // Nothing in flight. Sleep until HttpWorkQueue wakes us up with new work or asks us to stop.
+            std::unique_lock<std::mutex> lock(wakeupMutex_);
+            if (queue_->NumWaiting() == 0)
+                wakeup_.wait(lock, [this] { return wakeRequested_ || !shouldRun_; });
+            wakeRequested_ = false;
+            continue;
+        }
+
+        /* Block until there is socket activity or curls own timeout expires.
+           With curl_multi_wakeup new requests interrupt the wait immediately,
+           without it they are picked up within the poll time. */
+#if LIBCURL_VERSION_NUM >= 0x074400 // 7.68.0
+        res = curl_multi_poll(multi_, 0, 0, HTTP_MAX_POLL_MSEC, 0);
+#else
+        res = curl_multi_wait(multi_, 0, 0, 5, 0);
+#endif
+        if (res != CURLM_OK)
+            LogErrorF("[HttpWorkThread] Waiting for curl activity failed: %s", curl_multi_strerror(res));
+    }
+
+    AbortActive();
+
+    LogDebug("[HttpWorkThread] Stopping " + String(GetCurrentThreadID()));
+}
+
+void HttpWorkThread::StartRequests()
+{
+    if (active_.Size() >= HTTP_MAX_CONCURRENT_TRANSFERS)
+        return;
+
+    started_.Clear();
+    if (queue_->Take(started_, HTTP_MAX_CONCURRENT_TRANSFERS - active_.Size()) == 0)
+        return;
+
+    foreach(HttpRequest *request, started_)
+    {
+        Curl::RequestHandle *handle = AcquireHandle();
+        if (handle)
+            ConfigureHandle(handle);
+        if (handle && request->Start(handle))
+        {
+            CURLMcode res = curl_multi_add_handle(multi_, handle);
+            if (res == CURLM_OK)
+            {
+                active_.Push(handle);
+                continue;
+            }
+            request->Finish(CURLE_FAILED_INIT);
+        }
+        // Could not start, request has its error set. Report as completed.
+        if (handle)
+            ReleaseHandle(handle);
+        queue_->Completed(request);
+    }
+    started_.Clear();
+}
+
+void HttpWorkThread::ProcessCompleted()
+{
+    int numMessages = 0;
+    CURLMsg *msg = 0;
+    while((msg = curl_multi_info_read(multi_, &numMessages)) != 0)
+    {
+        if (msg->msg != CURLMSG_DONE)
+            continue;
+
+        CURL *handle = msg->easy_handle;
+        CURLcode result = msg->data.result;
+        HttpRequest *request = 0;
+        curl_easy_getinfo(handle, CURLINFO_PRIVATE, reinterpret_cast<char**>(&request));
+        curl_multi_remove_handle(multi_, handle);
+        active_.Remove(handle);
+
         if (request)
         {
-            request->Perform();
+            request->Finish(result);
             queue_->Completed(request);
         }
-        else
-            Urho3D::Time::Sleep(16);
+        ReleaseHandle(handle);
     }
+}
 
-    LogDebug("[HttpWorkThread] Stopping " + String(GetCurrentThreadID()));
+void HttpWorkThread::AbortActive()
+{
+    // Requests will not be signaled anymore, HttpWorkQueue is being destroyed.
+    foreach(Curl::RequestHandle *handle, active_)
+    {
+        HttpRequest *request = 0;
+        curl_easy_getinfo(handle, CURLINFO_PRIVATE, reinterpret_cast<char**>(&request));
+        curl_multi_remove_handle(multi_, handle);
+        if (request)
+        {
+            request->Finish(CURLE_ABORTED_BY_CALLBACK);
+            queue_->Completed(request);
+        }
+        ReleaseHandle(handle);
+    }
+    active_.Clear();
+}
+
+Curl::RequestHandle *HttpWorkThread::AcquireHandle()
+{
+    if (freeHandles_.Empty())
+        return curl_easy_init();
+    Curl::RequestHandle *handle = freeHandles_.Back();
+    freeHandles_.Pop();
+    return handle;
+}
+
+void HttpWorkThread::ConfigureHandle(Curl::RequestHandle *handle)
+{
+    // Set before the request options, so that a request can override these.
+    if (queue_->share_ && queue_->share_->handle)
+        curl_easy_setopt(handle, CURLOPT_SHARE, queue_->share_->handle);
+#if LIBCURL_VERSION_NUM >= 0x072F00 // 7.47.0
+    // HTTP/2 over TLS when the server supports it, HTTP/1.1 for plain text connections.
+    curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2TLS));
+#endif
+#if LIBCURL_VERSION_NUM >= 0x072B00 // 7.43.0
+    // Prefer waiting for a connection that can multiplex over opening a new one.
+    curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+#endif
+}
+
+void HttpWorkThread::ReleaseHandle(Curl::RequestHandle *handle)
+{
+    /* Reset clears the options of the previous request but keeps the
+       handles DNS and TLS session caches for the next request. */
+    curl_easy_reset(handle);
+    freeHandles_.Push(handle);
 }
 
 }
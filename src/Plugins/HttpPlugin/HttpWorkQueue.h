@@ -12,10 +12,19 @@
 #include <Urho3D/Core/Thread.h>
 #include <Urho3D/Core/Mutex.h>
 
+#include <condition_variable>
+#include <mutex>
+
 namespace Tundra
 {
 
 /// HttpWorkQueue request
+/** Requests are executed concurrently by a curl multi handle driven I/O thread.
+    The thread sleeps while there is no work and is woken up when requests are scheduled.
+
+    Connections are pooled per host and HTTP/2 is negotiated over TLS where the server supports it,
+    in which case concurrent requests to the same host are multiplexed on a single connection.
+    The DNS, TLS session and connection caches are shared by all requests of the queue. */
 class HttpWorkQueue : public Urho3D::RefCounted
 {
     /// @cond PRIVATE
@@ -43,7 +52,9 @@ private:
     void Update(float frametime);
 
     /// Called by HttpWorkThread
-    HttpRequest *Next();
+    uint NumWaiting();
+    /// Moves at most @c max waiting requests to @c dest and marks them executing. Returns the number of requests moved.
+    uint Take(Vector<HttpRequest*> &dest, uint max);
     void Completed(HttpRequest *request);
 
     float durationNoWork_;
@@ -76,6 +87,9 @@ private:
     /// Stats
     Http::Stats *stats_;
 
+    /// Caches shared between all curl handles.
+    Http::Share *share_;
+
     static const Logger log;
 };
 
@@ -85,12 +99,45 @@ class HttpWorkThread : public Urho3D::Thread
 {
 public:
     HttpWorkThread(HttpWorkQueue *queue);
+    ~HttpWorkThread();
 
     /// Urho3D::Thread
     void ThreadFunction() override;
 
+    /// Wakes up the thread to pick up new requests. Can be called from any thread.
+    void Wakeup();
+
+    /// Asks the thread to exit and wakes it up. Call Stop() afterwards to wait for it.
+    void RequestStop();
+
 private:
+    /// Starts waiting requests from the queue.
+    void StartRequests();
+    /// Finishes transfers that curl reports done.
+    void ProcessCompleted();
+    /// Aborts all active transfers on exit.
+    void AbortActive();
+
+    /// Returns a curl easy handle from the free list or a new one.
+    Curl::RequestHandle *AcquireHandle();
+    /// Resets @c handle and returns it to the free list.
+    void ReleaseHandle(Curl::RequestHandle *handle);
+    /// Sets the connection reuse and HTTP/2 options to @c handle.
+    void ConfigureHandle(Curl::RequestHandle *handle);
+
     HttpWorkQueue *queue_;
+    Curl::EngineHandle *multi_;
+
+    /// Wakes up the idle thread. wakeRequested_ is set under wakeupMutex_, so that a Wakeup() just before the wait is not lost.
+    std::mutex wakeupMutex_;
+    std::condition_variable wakeup_;
+    bool wakeRequested_;
+
+    /// Transfers currently added to multi_.
+    Vector<Curl::RequestHandle*> active_;
+    /// Easy handles kept for reuse across requests.
+    Vector<Curl::RequestHandle*> freeHandles_;
+    Vector<HttpRequest*> started_;
 };
 
 /// @endcond
@@ -12,12 +12,49 @@
 #include "HttpServerBindings/HttpServerBindings.h"
 
 #include <Urho3D/Core/Profiler.h>
+#include <Urho3D/Core/Timer.h>
 
 using namespace JSBindings;
 
+/// Main thread time in microseconds that is spent handling queued requests per frame.
+#define HTTP_SERVER_FRAME_BUDGET_USEC 4000
+#define HTTP_SERVER_DEFAULT_THREADS 2
+
 namespace Tundra
 {
 
+namespace
+{
+    void SendDeferredResponse(HttpServer::ConnectionPtr connection)
+    {
+        connection->send_http_response();
+    }
+}
+
+// HttpServerThread
+
+void HttpServerThread::ThreadFunction()
+{
+    // Keep running if a request handler throws, run() only returns for good once the server is stopped.
+    while (shouldRun_ && !server_->stopped())
+    {
+        try
+        {
+            server_->run();
+        }
+        catch (const std::exception &e)
+        {
+            LogError("Exception while running HTTP server: " + String(e.what()));
+        }
+        catch (...)
+        {
+            LogError("Exception while running HTTP server: other exception");
+        }
+    }
+}
+
+// HttpServer
+
 HttpServer::HttpServer(Framework* framework) :
     IModule("HttpServer", framework)
 {
@@ -53,13 +90,83 @@ void HttpServer::Uninitialize()
 void HttpServer::Update(float frametime)
 {
     if (server_)
+        ProcessRequests();
+}
+
+void HttpServer::ProcessRequests()
+{
+    {
+        Urho3D::MutexLock lock(mutexQueued_);
+        if (!queued_.Empty())
+        {
+            processing_.Push(queued_);
+            queued_.Clear();
+        }
+    }
+    if (processing_.Empty())
+        return;
+
+    // Handle requests in the main thread so that scenes can be accessed safely.
+    URHO3D_PROFILE(HttpServer_ProcessRequests);
+    Urho3D::HiresTimer timer;
+    uint num = 0;
+    while (num < processing_.Size())
+    {
+        ConnectionPtr connection = processing_[num++];
+        {
+            SharedPtr<HttpRequest> request(new HttpRequest(context_, connection.get()));
+            HttpRequestReceived.Emit(request.Get());
+        }
+        // The response is written by the I/O threads, the socket is never accessed from here.
+        server_->get_io_service().post(boost::bind(&SendDeferredResponse, connection));
+
+        if (timer.GetUSec(false) >= HTTP_SERVER_FRAME_BUDGET_USEC)
+            break;
+    }
+    processing_.Erase(0, num);
+}
+
+void HttpServer::RegisterThreadedHandler(const String &pathPrefix, ThreadedHandler handler)
+{
+    Urho3D::MutexLock lock(mutexHandlers_);
+    for (uint i = 0; i < threadedHandlers_.Size(); ++i)
+    {
+        if (threadedHandlers_[i].first_ == pathPrefix)
+        {
+            threadedHandlers_[i].second_ = handler;
+            return;
+        }
+    }
+    threadedHandlers_.Push(MakePair(pathPrefix, handler));
+}
+
+void HttpServer::UnregisterThreadedHandler(const String &pathPrefix)
+{
+    Urho3D::MutexLock lock(mutexHandlers_);
+    for (uint i = 0; i < threadedHandlers_.Size(); ++i)
     {
-        // Update server in main thread so that scenes can be accessed safely in HTTP requests
-        URHO3D_PROFILE(PollHTTPServer);
-        server_->get_io_service().poll_one();
+        if (threadedHandlers_[i].first_ == pathPrefix)
+        {
+            threadedHandlers_.Erase(i);
+            return;
+        }
     }
 }
 
+bool HttpServer::FindThreadedHandler(const String &path, ThreadedHandler &handler)
+{
+    Urho3D::MutexLock lock(mutexHandlers_);
+    for (uint i = 0; i < threadedHandlers_.Size(); ++i)
+    {
+        if (path.StartsWith(threadedHandlers_[i].first_))
+        {
+            handler = threadedHandlers_[i].second_;
+            return true;
+        }
+    }
+    return false;
+}
+
 void HttpServer::StartServer()
 {
     int port = 0;
@@ -100,8 +207,32 @@ void HttpServer::StartServer()
         LogError(String(e.what()));
         return;
     }
-    
-    LogInfo("HTTP server started on port " + String(port));
+
+    // Start the I/O threads
+    uint numThreads = HTTP_SERVER_DEFAULT_THREADS;
+    StringList threadsParam = framework->CommandLineParameters("--httpThreads");
+    if (!threadsParam.Empty())
+    {
+        numThreads = ToUInt(threadsParam.Front());
+        if (!numThreads)
+        {
+            LogWarning("Invalid --httpThreads parameter given; using " + String(HTTP_SERVER_DEFAULT_THREADS) + " HTTP server threads");
+            numThreads = HTTP_SERVER_DEFAULT_THREADS;
+        }
+    }
+    for (uint i = 0; i < numThreads; ++i)
+    {
+        HttpServerThread *thread = new HttpServerThread(server_);
+        if (thread->Run())
+            threads_.Push(thread);
+        else
+        {
+            LogError("Failed to start HTTP server thread");
+            delete thread;
+        }
+    }
+
+    LogInfo("HTTP server started on port " + String(port) + " with " + String(threads_.Size()) + " threads");
     ServerStarted.Emit();
 }
 
@@ -111,7 +242,20 @@ void HttpServer::StopServer()
     {
         if (server_)
         {
+            // Stopping the I/O service makes the threads return. Queued requests are dropped with their connections.
             server_->stop();
+            for (uint i = 0; i < threads_.Size(); ++i)
+            {
+                threads_[i]->Stop();
+                delete threads_[i];
+            }
+            threads_.Clear();
+            {
+                Urho3D::MutexLock lock(mutexQueued_);
+                queued_.Clear();
+            }
+            processing_.Clear();
+
             ServerStopped.Emit();
             server_.reset();
         }
@@ -124,11 +268,29 @@ void HttpServer::StopServer()
 
 void HttpServer::OnHttpRequest(ConnectionHandle connection)
 {
-    URHO3D_PROFILE(OnHttpRequest);
-    
     ConnectionPtr connectionPtr = server_->get_con_from_hdl(connection);
-    SharedPtr<HttpRequest> request(new HttpRequest(context_, connectionPtr.get()));
-    HttpRequestReceived.Emit(request.Get());
+    if (!connectionPtr)
+        return;
+
+    // Read-only endpoints are answered right away in this I/O thread.
+    ThreadedHandler handler;
+    if (FindThreadedHandler(String(connectionPtr->get_resource().c_str()), handler))
+    {
+        SharedPtr<HttpRequest> request(new HttpRequest(context_, connectionPtr.get()));
+        handler(request.Get());
+        return;
+    }
+
+    // Other requests may access the scene. Defer the response until the request has been handled in the main thread.
+    websocketpp::lib::error_code ec = connectionPtr->defer_http_response();
+    if (ec)
+    {
+        LogError("Failed to defer HTTP response: " + String(ec.message().c_str()));
+        connectionPtr->set_status(websocketpp::http::status_code::internal_server_error);
+        return;
+    }
+    Urho3D::MutexLock lock(mutexQueued_);
+    queued_.Push(connectionPtr);
 }
 
 void HttpServer::OnScriptInstanceCreated(JavaScriptInstance* instance)
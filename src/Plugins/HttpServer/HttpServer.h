@@ -18,11 +18,20 @@
 #include <websocketpp/config/asio_no_tls.hpp>
 #include <websocketpp/server.hpp>
 
+#include <Urho3D/Core/Mutex.h>
+#include <Urho3D/Core/Thread.h>
+
 namespace Tundra
 {
 
 class JavaScriptInstance;
+class HttpServerThread;
 
+/// Embedded HTTP server, started with the '--httpPort <port>' command line parameter.
+/** Network I/O runs in a pool of threads, '--httpThreads <count>' (default 2). Requests are passed to HttpRequestReceived
+    in the main thread so that handlers can access the scene. They are queued by the I/O threads and handled in batches
+    every frame until the queue is empty or the frame budget is used, the rest are handled on the next frame.
+    Read-only endpoints that do not need the main thread can be answered directly in the I/O threads with RegisterThreadedHandler. */
 class HTTPSERVER_API HttpServer : public IModule
 {
     URHO3D_OBJECT(HttpServer, IModule);
@@ -34,6 +43,7 @@ public:
     typedef boost::weak_ptr<websocketpp::server<websocketpp::config::asio>::connection_type> ConnectionWeakPtr;
     typedef websocketpp::connection_hdl ConnectionHandle;
     typedef websocketpp::server<websocketpp::config::asio>::message_ptr MessagePtr;
+    typedef Delegate1<HttpRequest*> ThreadedHandler;
 
     HttpServer(Framework* framework);
     virtual ~HttpServer();
@@ -51,17 +61,63 @@ public:
     /// A request was received. Handle this signal to set response headers, body and status code. Do not hold on to the HTTP request object; it will be invalid after the signal handling is complete.
     Signal1<HttpRequest*> HttpRequestReceived;
 
+    /// Registers @c handler to answer requests whose path starts with @c pathPrefix directly in an I/O thread. [noscript]
+    /** Use this for read-only endpoints that do not touch the scene or other main thread state, eg. status or metrics.
+        The handler is called concurrently from several I/O threads and must be thread-safe. These requests are not
+        passed to HttpRequestReceived. */
+    void RegisterThreadedHandler(const String &pathPrefix, ThreadedHandler handler);
+    template <class X, class Y>
+    void RegisterThreadedHandler(const String &pathPrefix, Y *obj, void (X::*func)(HttpRequest*)) ///< @overload [noscript]
+    {
+        RegisterThreadedHandler(pathPrefix, MakeDelegate(obj, func));
+    }
+
+    /// Removes the threaded handler of @c pathPrefix. [noscript]
+    void UnregisterThreadedHandler(const String &pathPrefix);
+
 private:
-    /// Handle http request from websocketpp internally.
+    /// Handle http request from websocketpp internally. Called in an I/O thread.
     void OnHttpRequest(ConnectionHandle connection);
     void StartServer();
     void StopServer();
+
+    /// Returns the threaded handler for @c path. Called in an I/O thread.
+    bool FindThreadedHandler(const String &path, ThreadedHandler &handler);
+    /// Handles queued requests in the main thread until the queue is empty or the frame budget is used.
+    void ProcessRequests();
     
     /// Handles script engine creation (register HttpServer classes)
     void OnScriptInstanceCreated(JavaScriptInstance* instance);
 
     bool isServer_;
     ServerPtr server_;
+    Vector<HttpServerThread*> threads_;
+
+    /// Requests whose response is deferred until handled in the main thread. Pushed by the I/O threads.
+    Urho3D::Mutex mutexQueued_;
+    Vector<ConnectionPtr> queued_;
+    /// Requests taken from queued_ that did not fit to the budget of the last frame. Main thread only.
+    Vector<ConnectionPtr> processing_;
+
+    Urho3D::Mutex mutexHandlers_;
+    Vector<Pair<String, ThreadedHandler> > threadedHandlers_;
 };
 
+/// @cond PRIVATE
+
+/// Runs the I/O service of the HttpServer.
+class HttpServerThread : public Urho3D::Thread
+{
+public:
+    explicit HttpServerThread(const HttpServer::ServerPtr &server) : server_(server) {}
+
+    /// Urho3D::Thread override.
+    void ThreadFunction() override;
+
+private:
+    HttpServer::ServerPtr server_;
+};
+
+/// @endcond
+
 }
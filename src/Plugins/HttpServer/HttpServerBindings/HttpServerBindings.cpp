@@ -44,14 +44,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -63,6 +57,7 @@ static duk_ret_t SignalWrapper_HttpServer_ServerStarted_Finalizer(duk_context* c
 
 static duk_ret_t SignalWrapper_HttpServer_ServerStarted_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_HttpServer_ServerStarted* wrapper = GetThisValueObject<SignalWrapper_HttpServer_ServerStarted>(ctx, SignalWrapper_HttpServer_ServerStarted_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -80,6 +75,7 @@ static duk_ret_t SignalWrapper_HttpServer_ServerStarted_Connect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_HttpServer_ServerStarted_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_HttpServer_ServerStarted* wrapper = GetThisValueObject<SignalWrapper_HttpServer_ServerStarted>(ctx, SignalWrapper_HttpServer_ServerStarted_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -88,6 +84,7 @@ static duk_ret_t SignalWrapper_HttpServer_ServerStarted_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_HttpServer_ServerStarted_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_HttpServer_ServerStarted* wrapper = GetThisValueObject<SignalWrapper_HttpServer_ServerStarted>(ctx, SignalWrapper_HttpServer_ServerStarted_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -97,7 +94,8 @@ static duk_ret_t SignalWrapper_HttpServer_ServerStarted_Emit(duk_context* ctx)
 static duk_ret_t HttpServer_Get_ServerStarted(duk_context* ctx)
 {
     HttpServer* thisObj = GetThisWeakObject<HttpServer>(ctx);
-    SignalWrapper_HttpServer_ServerStarted* wrapper = new SignalWrapper_HttpServer_ServerStarted(thisObj, &thisObj->ServerStarted);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalServerStarted")) return 1;
+    SignalWrapper_HttpServer_ServerStarted* wrapper = new (ctx) SignalWrapper_HttpServer_ServerStarted(thisObj, &thisObj->ServerStarted);
     PushValueObject(ctx, wrapper, SignalWrapper_HttpServer_ServerStarted_ID, SignalWrapper_HttpServer_ServerStarted_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_HttpServer_ServerStarted_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -107,8 +105,15 @@ static duk_ret_t HttpServer_Get_ServerStarted(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_HttpServer_ServerStarted_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_HttpServer_ServerStarted_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_HttpServer_ServerStarted_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_HttpServer_ServerStarted_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalServerStarted");
     return 1;
 }
 
@@ -133,14 +138,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -152,6 +151,7 @@ static duk_ret_t SignalWrapper_HttpServer_ServerStopped_Finalizer(duk_context* c
 
 static duk_ret_t SignalWrapper_HttpServer_ServerStopped_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_HttpServer_ServerStopped* wrapper = GetThisValueObject<SignalWrapper_HttpServer_ServerStopped>(ctx, SignalWrapper_HttpServer_ServerStopped_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -169,6 +169,7 @@ static duk_ret_t SignalWrapper_HttpServer_ServerStopped_Connect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_HttpServer_ServerStopped_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_HttpServer_ServerStopped* wrapper = GetThisValueObject<SignalWrapper_HttpServer_ServerStopped>(ctx, SignalWrapper_HttpServer_ServerStopped_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -177,6 +178,7 @@ static duk_ret_t SignalWrapper_HttpServer_ServerStopped_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_HttpServer_ServerStopped_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_HttpServer_ServerStopped* wrapper = GetThisValueObject<SignalWrapper_HttpServer_ServerStopped>(ctx, SignalWrapper_HttpServer_ServerStopped_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -186,7 +188,8 @@ static duk_ret_t SignalWrapper_HttpServer_ServerStopped_Emit(duk_context* ctx)
 static duk_ret_t HttpServer_Get_ServerStopped(duk_context* ctx)
 {
     HttpServer* thisObj = GetThisWeakObject<HttpServer>(ctx);
-    SignalWrapper_HttpServer_ServerStopped* wrapper = new SignalWrapper_HttpServer_ServerStopped(thisObj, &thisObj->ServerStopped);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalServerStopped")) return 1;
+    SignalWrapper_HttpServer_ServerStopped* wrapper = new (ctx) SignalWrapper_HttpServer_ServerStopped(thisObj, &thisObj->ServerStopped);
     PushValueObject(ctx, wrapper, SignalWrapper_HttpServer_ServerStopped_ID, SignalWrapper_HttpServer_ServerStopped_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_HttpServer_ServerStopped_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -196,8 +199,15 @@ static duk_ret_t HttpServer_Get_ServerStopped(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_HttpServer_ServerStopped_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_HttpServer_ServerStopped_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_HttpServer_ServerStopped_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_HttpServer_ServerStopped_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalServerStopped");
     return 1;
 }
 
@@ -222,16 +232,10 @@ public:
     void OnSignal(HttpRequest * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -243,6 +247,7 @@ static duk_ret_t SignalWrapper_HttpServer_HttpRequestReceived_Finalizer(duk_cont
 
 static duk_ret_t SignalWrapper_HttpServer_HttpRequestReceived_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_HttpServer_HttpRequestReceived* wrapper = GetThisValueObject<SignalWrapper_HttpServer_HttpRequestReceived>(ctx, SignalWrapper_HttpServer_HttpRequestReceived_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -260,6 +265,7 @@ static duk_ret_t SignalWrapper_HttpServer_HttpRequestReceived_Connect(duk_contex
 
 static duk_ret_t SignalWrapper_HttpServer_HttpRequestReceived_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_HttpServer_HttpRequestReceived* wrapper = GetThisValueObject<SignalWrapper_HttpServer_HttpRequestReceived>(ctx, SignalWrapper_HttpServer_HttpRequestReceived_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -268,6 +274,7 @@ static duk_ret_t SignalWrapper_HttpServer_HttpRequestReceived_Disconnect(duk_con
 
 static duk_ret_t SignalWrapper_HttpServer_HttpRequestReceived_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_HttpServer_HttpRequestReceived* wrapper = GetThisValueObject<SignalWrapper_HttpServer_HttpRequestReceived>(ctx, SignalWrapper_HttpServer_HttpRequestReceived_ID);
     if (!wrapper->owner_) return 0;
     HttpRequest* param0 = GetWeakObject<HttpRequest>(ctx, 0);
@@ -278,7 +285,8 @@ static duk_ret_t SignalWrapper_HttpServer_HttpRequestReceived_Emit(duk_context*
 static duk_ret_t HttpServer_Get_HttpRequestReceived(duk_context* ctx)
 {
     HttpServer* thisObj = GetThisWeakObject<HttpServer>(ctx);
-    SignalWrapper_HttpServer_HttpRequestReceived* wrapper = new SignalWrapper_HttpServer_HttpRequestReceived(thisObj, &thisObj->HttpRequestReceived);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalHttpRequestReceived")) return 1;
+    SignalWrapper_HttpServer_HttpRequestReceived* wrapper = new (ctx) SignalWrapper_HttpServer_HttpRequestReceived(thisObj, &thisObj->HttpRequestReceived);
     PushValueObject(ctx, wrapper, SignalWrapper_HttpServer_HttpRequestReceived_ID, SignalWrapper_HttpServer_HttpRequestReceived_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_HttpServer_HttpRequestReceived_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -288,8 +296,15 @@ static duk_ret_t HttpServer_Get_HttpRequestReceived(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_HttpServer_HttpRequestReceived_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_HttpServer_HttpRequestReceived_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_HttpServer_HttpRequestReceived_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_HttpServer_HttpRequestReceived_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalHttpRequestReceived");
     return 1;
 }
 
@@ -288,6 +288,10 @@ namespace BindingsGenerator
                 return typeName + " " + varName + " = duk_require_string(ctx, " + stackIndex + ");";
             else if (typeName == "Variant")
                 return typeName + " " + varName + " = GetVariant(ctx, " + stackIndex + ");";
+            else if (typeName == "floatArray")
+                return "PODVector<float> " + varName + " = GetFloatArray(ctx, " + stackIndex + ");";
+            else if (typeName == "uintArray")
+                return "PODVector<uint> " + varName + " = GetUIntArray(ctx, " + stackIndex + ");";
             else if (!Symbol.IsPODType(typeName))
             {
                 if (typeName.EndsWith("Vector"))
@@ -393,6 +397,10 @@ namespace BindingsGenerator
                 return "duk_push_string(ctx, " + source + ".CString());";
             else if (typeName == "Variant")
                 return "PushVariant(ctx, " + source + ");";
+            else if (typeName == "floatArray")
+                return "PushFloatArray(ctx, " + source + ");";
+            else if (typeName == "uintArray")
+                return "PushUIntArray(ctx, " + source + ");";
             else if (typeName.EndsWith("Vector"))
             {
                 string templateType = typeName.Substring(0, typeName.Length - 6);
@@ -484,6 +492,8 @@ namespace BindingsGenerator
                 return "duk_is_boolean(ctx, " + stackIndex + ")";
             else if (typeName == "string" || typeName == "String")
                 return "duk_is_string(ctx, " + stackIndex + ")";
+            else if (typeName == "floatArray" || typeName == "uintArray")
+                return "duk_is_object(ctx, " + stackIndex + ")";
             if (!Symbol.IsPODType(typeName))
             {
                 // Refcounted object parameters could also be legally null
@@ -594,19 +604,13 @@ namespace BindingsGenerator
                     tw.WriteLine(Indent(1) + signatureLine);
                     tw.WriteLine(Indent(1) + "{");
                     tw.WriteLine(Indent(2) + "duk_context* ctx = ctx_;");
-                    tw.WriteLine(Indent(2) + "duk_push_global_object(ctx);");
-                    tw.WriteLine(Indent(2) + "duk_get_prop_string(ctx, -1, \"_OnSignal\");");
-                    tw.WriteLine(Indent(2) + "duk_remove(ctx, -2);"); // Global object
-                    tw.WriteLine(Indent(2) + "duk_push_number(ctx, (size_t)key_);"); // Signal identifier for looking up receiver(s)
                     tw.WriteLine(Indent(2) + "duk_push_array(ctx);"); // Parameter array
                     for (int i = 0; i < firstBadParameter && i < parameters.Count(); ++i)
                     {
                         tw.WriteLine(Indent(2) + GeneratePushToStack(parameters[i], "param" + i));
                         tw.WriteLine(Indent(2) + "duk_put_prop_index(ctx, -2, " + i + ");");
                     }
-                    tw.WriteLine(Indent(2) + "bool success = duk_pcall(ctx, 2) == 0;");
-                    tw.WriteLine(Indent(2) + "if (!success) LogError(\"[JavaScript] OnSignal: \" + GetErrorString(ctx));");
-                    tw.WriteLine(Indent(2) + "duk_pop(ctx);"); // Result
+                    tw.WriteLine(Indent(2) + "DispatchSignal(this);"); // Calls or batches the script connections
                     tw.WriteLine(Indent(1) + "}");
                     tw.WriteLine("};");
                     tw.WriteLine("");
@@ -617,6 +621,7 @@ namespace BindingsGenerator
                     // Connect wrapper function
                     tw.WriteLine("static duk_ret_t " + wrapperClassName + "_Connect" + DukSignature());
                     tw.WriteLine("{");
+                    tw.WriteLine(Indent(1) + "RequireMainThread(ctx);"); // Not allowed in isolated frame updates
                     tw.WriteLine(Indent(1) + wrapperClassName + "* wrapper = GetThisValueObject<" + wrapperClassName + ">(ctx, " + ClassIdentifier(wrapperClassName) + ");");
                     tw.WriteLine(Indent(1) + "if (!wrapper->owner_) return 0;"); // Check signal owner expiration
                     tw.WriteLine(Indent(1) + "HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();");
@@ -636,6 +641,7 @@ namespace BindingsGenerator
                     // Disconnect wrapper function
                     tw.WriteLine("static duk_ret_t " + wrapperClassName + "_Disconnect" + DukSignature());
                     tw.WriteLine("{");
+                    tw.WriteLine(Indent(1) + "RequireMainThread(ctx);"); // Not allowed in isolated frame updates
                     tw.WriteLine(Indent(1) + wrapperClassName + "* wrapper = GetThisValueObject<" + wrapperClassName + ">(ctx, " + ClassIdentifier(wrapperClassName) + ");");
                     tw.WriteLine(Indent(1) + "if (!wrapper->owner_) return 0;"); // Check signal owner expiration
                     tw.WriteLine(Indent(1) + "CallDisconnectSignal(ctx, wrapper->signal_);");
@@ -648,6 +654,7 @@ namespace BindingsGenerator
                         // Emit wrapper function
                         tw.WriteLine("static duk_ret_t " + wrapperClassName + "_Emit" + DukSignature());
                         tw.WriteLine("{");
+                        tw.WriteLine(Indent(1) + "RequireMainThread(ctx);"); // Not allowed in isolated frame updates
                         tw.WriteLine(Indent(1) + wrapperClassName + "* wrapper = GetThisValueObject<" + wrapperClassName + ">(ctx, " + ClassIdentifier(wrapperClassName) + ");");
                         tw.WriteLine(Indent(1) + "if (!wrapper->owner_) return 0;"); // Check signal owner expiration
                         for (int i = 0; i < parameters.Count; ++i)
@@ -670,8 +677,10 @@ namespace BindingsGenerator
 
                     tw.WriteLine("static duk_ret_t " + className + "_Get_" + child.name + DukSignature());
                     tw.WriteLine("{");
+                    string cacheKey = "\"\\xff\"\"signal" + child.name + "\"";
                     tw.WriteLine(Indent(1) + GenerateGetThis(classSymbol));
-                    tw.WriteLine(Indent(1) + wrapperClassName + "* wrapper = new " + wrapperClassName + "(thisObj, &thisObj->" + child.name + ");");
+                    tw.WriteLine(Indent(1) + "if (PushCachedSignalWrapper(ctx, " + cacheKey + ")) return 1;");
+                    tw.WriteLine(Indent(1) + wrapperClassName + "* wrapper = new (ctx) " + wrapperClassName + "(thisObj, &thisObj->" + child.name + ");");
                     tw.WriteLine(Indent(1) + "PushValueObject(ctx, wrapper, " + ClassIdentifier(wrapperClassName) + ", " + wrapperClassName + "_Finalizer, false);");
                     tw.WriteLine(Indent(1) + "duk_push_c_function(ctx, " + wrapperClassName + "_Connect" + ", DUK_VARARGS);");
                     tw.WriteLine(Indent(1) + "duk_put_prop_string(ctx, -2, \"Connect\");");
@@ -681,12 +690,20 @@ namespace BindingsGenerator
                     tw.WriteLine(Indent(1) + "duk_put_prop_string(ctx, -2, \"Disconnect\");");
                     tw.WriteLine(Indent(1) + "duk_push_c_function(ctx, " + wrapperClassName + "_Disconnect" + ", DUK_VARARGS);");
                     tw.WriteLine(Indent(1) + "duk_put_prop_string(ctx, -2, \"disconnect\");");
+                    // Batched variants are the same functions with magic 1
+                    tw.WriteLine(Indent(1) + "duk_push_c_function(ctx, " + wrapperClassName + "_Connect" + ", DUK_VARARGS);");
+                    tw.WriteLine(Indent(1) + "duk_set_magic(ctx, -1, 1);");
+                    tw.WriteLine(Indent(1) + "duk_put_prop_string(ctx, -2, \"ConnectBatched\");");
+                    tw.WriteLine(Indent(1) + "duk_push_c_function(ctx, " + wrapperClassName + "_Disconnect" + ", DUK_VARARGS);");
+                    tw.WriteLine(Indent(1) + "duk_set_magic(ctx, -1, 1);");
+                    tw.WriteLine(Indent(1) + "duk_put_prop_string(ctx, -2, \"DisconnectBatched\");");
                     // Can only Emit() the signal from script if all parameters are supported
                     if (!hasBadParameters)
                     {
                         tw.WriteLine(Indent(1) + "duk_push_c_function(ctx, " + wrapperClassName + "_Emit" + ", " + parameters.Count + ");");
                         tw.WriteLine(Indent(1) + "duk_put_prop_string(ctx, -2, \"Emit\");");
                     }
+                    tw.WriteLine(Indent(1) + "CacheSignalWrapper(ctx, " + cacheKey + ");");
                     tw.WriteLine(Indent(1) + "return 1;");
                     tw.WriteLine("}");
                     tw.WriteLine("");
@@ -708,6 +725,8 @@ namespace BindingsGenerator
                         tw.WriteLine(Indent(1) + GenerateGetThis(classSymbol));
                         tw.WriteLine(Indent(1) + GenerateGetFromStack(child, 0, child.name));
                         tw.WriteLine(Indent(1) + "thisObj->" + child.name + " = " + child.name + ";");
+                        if (IsTypedArray(child.type))
+                            tw.WriteLine(Indent(1) + "ClearCachedArray(ctx, " + ArrayCacheKey(child.name) + ");");
                         tw.WriteLine(Indent(1) + "return 0;");
                         tw.WriteLine("}");
                         tw.WriteLine("");
@@ -723,7 +742,17 @@ namespace BindingsGenerator
                             typeName = SanitateTemplateType(typeName);
                         }
 
-                        if (Symbol.IsPODType(typeName) || IsRefCounted(typeName) || typeName == "String" || typeName == "string" || typeName.Contains("Vector"))
+                        if (IsTypedArray(child.type))
+                        {
+                            // Typed arrays are copies, create them once per object instead of on every access
+                            tw.WriteLine("static duk_ret_t " + className + "_Get_" + newProperty.name + DukSignature());
+                            tw.WriteLine("{");
+                            tw.WriteLine(Indent(1) + GenerateGetThis(classSymbol));
+                            tw.WriteLine(Indent(1) + "if (PushCachedArray(ctx, " + ArrayCacheKey(child.name) + ")) return 1;");
+                            tw.WriteLine(Indent(1) + GeneratePushToStack(child, "thisObj->" + child.name));
+                            tw.WriteLine(Indent(1) + "CacheArray(ctx, " + ArrayCacheKey(child.name) + ");");
+                        }
+                        else if (Symbol.IsPODType(typeName) || IsRefCounted(typeName) || typeName == "String" || typeName == "string" || typeName.Contains("Vector"))
                         {
                             if (typeName.Contains("Vector"))
                             {
@@ -901,7 +930,7 @@ namespace BindingsGenerator
                                 args += ", ";
                             args += child.parameters[i].name;
                         }
-                        tw.WriteLine(Indent(1) + className + "* newObj = new " + className + "(" + args + ");");
+                        tw.WriteLine(Indent(1) + className + "* newObj = new (ctx) " + className + "(" + args + ");");
                         tw.WriteLine(Indent(1) + GeneratePushConstructorResultToStack(className, "newObj"));
                         tw.WriteLine(Indent(1) + "return 0;");
                         tw.WriteLine("}");
@@ -1279,6 +1308,9 @@ namespace BindingsGenerator
                 t = "float3";
             if (t.StartsWith("Vector<"))
                 t = t.Substring(7).Replace(">", "") + "Vector";
+            // PODVectors of numbers are exposed as typed arrays
+            if (t.StartsWith("PODVector<"))
+                t = t.Substring(10).Replace(">", "") + "Array";
 
             t = StripNamespace(t);
             if (t == "Key" || t == "KeySequence")
@@ -1294,6 +1326,8 @@ namespace BindingsGenerator
                 t = "float3";
             if (t.StartsWith("Vector<"))
                 t = t.Substring(7).Replace(">", "") + "Vector";
+            if (t.StartsWith("PODVector<"))
+                t = t.Substring(10).Replace(">", "") + "Array";
 
             return StripNamespace(t);
         }
@@ -1388,9 +1422,22 @@ namespace BindingsGenerator
             }
         }
 
+        static bool IsTypedArray(string typeName)
+        {
+            string t = SanitateTypeName(typeName);
+            return t == "floatArray" || t == "uintArray";
+        }
+
+        static string ArrayCacheKey(string variableName)
+        {
+            return "\"\\xff\"\"array" + variableName + "\"";
+        }
+
         static bool IsSupportedType(string typeName)
         {
             string t = SanitateTypeName(typeName);
+            if (t == "floatArray" || t == "uintArray")
+                return true;
             if (t.EndsWith("Vector"))
             {
                 string templateType = t.Substring(0, t.Length - 6);
@@ -14,7 +14,9 @@
 #include "Asset/AssetReference.h"
 #include "Scene/EntityReference.h"
 
+#include <Urho3D/Core/Mutex.h>
 #include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Core/Thread.h>
 #include <cstring>
 
 using namespace Tundra;
@@ -31,6 +33,70 @@ static const char* AssetReference_ID = "AssetReference";
 static const char* AssetReferenceList_ID = "AssetReferenceList";
 static const char* EntityReference_ID = "EntityReference";
 
+static const char* isolatedAccessError = "Scene access outside the main thread, use engine.QueueMainThreadCall in an isolated frame update";
+
+/// Taken by AutoIsolatedLock during the isolated frame updates.
+static Urho3D::Mutex isolatedMutex;
+
+/// Return whether the object may be accessed from the calling thread.
+/** An isolated frame update may call the functions of its own instance. Through the proxies it may also read and assign
+    the attributes of the script entity, which nothing else modifies until the isolated frame updates have finished. */
+static bool IsObjectAccessAllowed(duk_context* ctx, Object* object, bool proxy)
+{
+    if (!JavaScriptInstance::IsolatedUpdatesRunning())
+        return Urho3D::Thread::IsMainThread();
+    if (!object)
+        return true;
+
+    JavaScriptInstance* instance = JavaScriptInstance::InstanceFromContext(ctx);
+    if (!instance)
+        return false;
+    if (object == instance)
+        return true;
+    Entity* entity = instance->IsolatedEntity();
+    if (!proxy || !entity)
+        return false;
+    if (object == entity)
+        return true;
+    IComponent* comp = dynamic_cast<IComponent*>(object);
+    return comp && comp->ParentEntity() == entity;
+}
+
+/// Get the target object of a proxy handler call. Raise JS error if it may not be accessed from the calling thread.
+template<class T> static T* GetProxyTarget(duk_context* ctx)
+{
+    WeakPtr<Object>* ptr = GetWeakPtr(ctx, 0);
+    Object* object = ptr ? ptr->Get() : nullptr;
+    if (!IsObjectAccessAllowed(ctx, object, true))
+        duk_error(ctx, DUK_ERR_ERROR, isolatedAccessError);
+    return dynamic_cast<T*>(object);
+}
+
+void RequireMainThread(duk_context* ctx)
+{
+    if (JavaScriptInstance::IsolatedUpdatesRunning() || !Urho3D::Thread::IsMainThread())
+        duk_error(ctx, DUK_ERR_ERROR, isolatedAccessError);
+}
+
+void RequireObjectAccess(duk_context* ctx, Object* object)
+{
+    if (!IsObjectAccessAllowed(ctx, object, false))
+        duk_error(ctx, DUK_ERR_ERROR, isolatedAccessError);
+}
+
+AutoIsolatedLock::AutoIsolatedLock() :
+    locked_(JavaScriptInstance::IsolatedUpdatesRunning())
+{
+    if (locked_)
+        isolatedMutex.Acquire();
+}
+
+AutoIsolatedLock::~AutoIsolatedLock()
+{
+    if (locked_)
+        isolatedMutex.Release();
+}
+
 static duk_ret_t float2_Finalizer(duk_context* ctx)
 {
     FinalizeValueObject<float2>(ctx, float2_ID);
@@ -140,7 +206,7 @@ static duk_ret_t Scene_GetProperty(duk_context* ctx)
     // Subsystem properties must be lowercase to optimize speed, as this is called for every property access.
     if (subsystemTypeName && subsystemTypeName[0] >= 'a' && subsystemTypeName[0] <= 'z')
     {
-        Scene* scene = GetWeakObject<Scene>(ctx, 0);
+        Scene* scene = GetProxyTarget<Scene>(ctx);
         if (scene)
         {
             SharedPtr<Object> ptr = scene->Subsystem(String(subsystemTypeName));
@@ -170,11 +236,22 @@ static duk_ret_t Entity_GetProperty(duk_context* ctx)
     // Exception: do not look up Name component, as Entity also has its own "name" property
     if (compTypeName && compTypeName[0] >= 'a' && compTypeName[0] <= 'z' && strcmp(compTypeName, "name"))
     {
-        Entity* entity = GetWeakObject<Entity>(ctx, 0);
+        Entity* entity = GetProxyTarget<Entity>(ctx);
         if (entity)
         {
-            String compTypeStr(compTypeName);
-            IComponent* comp = entity->Component(compTypeStr);
+            // Entity::Component would return a temporary ComponentPtr. Look up the raw pointer instead, as the refcount
+            // may not be modified from the isolated frame updates running in parallel.
+            const String compTypeStr = IComponent::EnsureTypeNameWithoutPrefix(String(compTypeName));
+            IComponent* comp = nullptr;
+            const Entity::ComponentMap& components = entity->Components();
+            for (Entity::ComponentMap::ConstIterator i = components.Begin(); i != components.End(); ++i)
+            {
+                if (i->second_->TypeName().Compare(compTypeStr, false) == 0)
+                {
+                    comp = i->second_.Get();
+                    break;
+                }
+            }
             if (comp)
             {
                 PushWeakObject(ctx, comp);
@@ -199,7 +276,7 @@ static duk_ret_t Component_GetProperty(duk_context* ctx)
     const char* attrName = duk_to_string(ctx, 1);
     if (attrName && attrName[0] >= 'a' && attrName[0] <= 'z')
     {
-        IComponent* comp = GetWeakObject<IComponent>(ctx, 0);
+        IComponent* comp = GetProxyTarget<IComponent>(ctx);
         if (comp)
         {
             IAttribute* attr = comp->AttributeById(String(attrName));
@@ -225,7 +302,7 @@ static duk_ret_t Component_SetProperty(duk_context* ctx)
     const char* attrName = duk_to_string(ctx, 1);
     if (attrName && attrName[0] >= 'a' && attrName[0] <= 'z')
     {
-        IComponent* comp = GetWeakObject<IComponent>(ctx, 0);
+        IComponent* comp = GetProxyTarget<IComponent>(ctx);
         if (comp)
         {
             IAttribute* attr = comp->AttributeById(String(attrName));
@@ -265,8 +342,11 @@ void PushWeakObject(duk_context* ctx, Object* object)
         duk_push_null(ctx);
         return;
     }
+    if (!IsObjectAccessAllowed(ctx, object, true))
+        duk_error(ctx, DUK_ERR_ERROR, isolatedAccessError);
 
-    duk_push_heap_stash(ctx);
+    // Use the global stash, so that instances sharing a heap have wrappers of their own
+    duk_push_global_stash(ctx);
 
     // Check if the wrapper for the object already exists in stash
     // This is required so that comparisons of object references (e.g. against the me property) work properly
@@ -284,7 +364,11 @@ void PushWeakObject(duk_context* ctx, Object* object)
     }
 
     duk_push_object(ctx);
-    WeakPtr<Object>* ptr = new WeakPtr<Object>(object);
+    WeakPtr<Object>* ptr;
+    {
+        AutoIsolatedLock lock;
+        ptr = new WeakPtr<Object>(object);
+    }
     duk_push_pointer(ctx, ptr);
     duk_put_prop_string(ctx, -2, "\xff""weak");
     duk_push_c_function(ctx, WeakPtr_Finalizer, 1);
@@ -332,7 +416,10 @@ duk_ret_t WeakPtr_Finalizer(duk_context* ctx)
     WeakPtr<Object>* ptr = GetWeakPtr(ctx, 0);
     if (ptr)
     {
-        delete ptr;
+        {
+            AutoIsolatedLock lock;
+            delete ptr;
+        }
         duk_push_pointer(ctx, nullptr);
         duk_put_prop_string(ctx, 0, "\xff""weak");
     }
@@ -369,6 +456,71 @@ void PushStringVector(duk_context* ctx, const Vector<String>& vector)
     }
 }
 
+template<class T> static PODVector<T> GetTypedArray(duk_context* ctx, duk_idx_t stackIndex, const char* arrayType)
+{
+    PODVector<T> ret;
+    if (!duk_is_object(ctx, stackIndex))
+        duk_error(ctx, DUK_ERR_TYPE_ERROR, "%s or array of numbers expected", arrayType);
+    stackIndex = duk_normalize_index(ctx, stackIndex);
+
+    bool typed = false;
+    if (duk_get_global_string(ctx, arrayType))
+        typed = duk_instanceof(ctx, stackIndex, -1) != 0;
+    duk_pop(ctx);
+
+    if (typed)
+    {
+        duk_size_t size = 0;
+        const void* data = duk_get_buffer_data(ctx, stackIndex, &size);
+        ret.Resize((unsigned)(size / sizeof(T)));
+        if (data && ret.Size())
+            memcpy(&ret[0], data, ret.Size() * sizeof(T));
+    }
+    else
+    {
+        duk_size_t len = duk_get_length(ctx, stackIndex);
+        ret.Resize((unsigned)len);
+        for (duk_size_t i = 0; i < len; ++i)
+        {
+            duk_get_prop_index(ctx, stackIndex, i);
+            ret[i] = (T)duk_get_number(ctx, -1);
+            duk_pop(ctx);
+        }
+    }
+
+    return ret;
+}
+
+template<class T> static void PushTypedArray(duk_context* ctx, const PODVector<T>& vector, duk_uint_t arrayType)
+{
+    duk_size_t size = vector.Size() * sizeof(T);
+    void* data = duk_push_fixed_buffer(ctx, size);
+    if (size)
+        memcpy(data, &vector[0], size);
+    duk_push_buffer_object(ctx, -1, 0, size, arrayType);
+    duk_remove(ctx, -2);
+}
+
+PODVector<float> GetFloatArray(duk_context* ctx, duk_idx_t stackIndex)
+{
+    return GetTypedArray<float>(ctx, stackIndex, "Float32Array");
+}
+
+void PushFloatArray(duk_context* ctx, const PODVector<float>& vector)
+{
+    PushTypedArray(ctx, vector, DUK_BUFOBJ_FLOAT32ARRAY);
+}
+
+PODVector<unsigned> GetUIntArray(duk_context* ctx, duk_idx_t stackIndex)
+{
+    return GetTypedArray<unsigned>(ctx, stackIndex, "Uint32Array");
+}
+
+void PushUIntArray(duk_context* ctx, const PODVector<unsigned>& vector)
+{
+    PushTypedArray(ctx, vector, DUK_BUFOBJ_UINT32ARRAY);
+}
+
 void PushVariant(duk_context* ctx, const Variant& variant)
 {
     switch (variant.GetType())
@@ -446,6 +598,19 @@ void AssignAttributeValue(duk_context* ctx, duk_idx_t stackIndex, IAttribute* de
     if (!destAttr)
         return;
 
+    // Frame update handlers of isolated instances run in parallel, queue their changes to be applied once all have finished
+    if (destAttr->Owner() && JavaScriptInstance::IsolatedUpdatesRunning())
+    {
+        JavaScriptInstance* instance = JavaScriptInstance::InstanceFromContext(ctx);
+        if (instance)
+        {
+            IAttribute* value = destAttr->Clone();
+            AssignAttributeValue(ctx, stackIndex, value, AttributeChange::Disconnected);
+            instance->QueueAttributeChange(destAttr, value, change);
+        }
+        return;
+    }
+
     switch (destAttr->TypeId())
     {
     case IAttribute::BoolId:
@@ -583,35 +748,121 @@ void PushAttributeValue(duk_context* ctx, IAttribute* attr)
     duk_push_null(ctx);
 }
 
-void CallConnectSignal(duk_context* ctx, void* signal)
+/// Call _ConnectSignal or _DisconnectSignal with the key and batched flag prepended to the arguments in JS stack.
+/** Updates the connection count of the receiver from the result, and erases the receiver when it has no connections left. */
+static void CallSignalConnection(duk_context* ctx, void* signal, const char* functionName)
 {
+    // ConnectBatched & DisconnectBatched are the Connect & Disconnect functions with magic 1
+    bool batched = duk_get_current_magic(ctx) == 1;
     int numArgs = duk_get_top(ctx);
+    duk_push_boolean(ctx, batched);
+    duk_insert(ctx, 0);
     duk_push_number(ctx, (size_t)signal);
     duk_insert(ctx, 0);
     duk_push_global_object(ctx);
-    duk_get_prop_string(ctx, -1, "_ConnectSignal");
+    duk_get_prop_string(ctx, -1, functionName);
     duk_remove(ctx, -2); // Global object
     duk_insert(ctx, 0);
-    duk_pcall(ctx, numArgs + 1);
-    duk_pop(ctx);
+    duk_pcall(ctx, numArgs + 2);
+    if (duk_is_number(ctx, -1)) // Remaining connections
+    {
+        HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
+        HashMap<void*, SharedPtr<SignalReceiver> >::Iterator i = signalReceivers.Find(signal);
+        if (i != signalReceivers.End())
+        {
+            if (batched)
+                i->second_->numBatchedConnections_ = duk_get_int(ctx, -1);
+            else
+                i->second_->numConnections_ = duk_get_int(ctx, -1);
+            if (!i->second_->numConnections_ && !i->second_->numBatchedConnections_)
+                signalReceivers.Erase(i);
+        }
+    }
+    duk_pop(ctx); // Result
+}
+
+void CallConnectSignal(duk_context* ctx, void* signal)
+{
+    CallSignalConnection(ctx, signal, "_ConnectSignal");
 }
 
 void CallDisconnectSignal(duk_context* ctx, void* signal)
 {
-    int numArgs = duk_get_top(ctx);
-    duk_push_number(ctx, (size_t)signal);
-    duk_insert(ctx, 0);
-    duk_push_global_object(ctx);
-    duk_get_prop_string(ctx, -1, "_DisconnectSignal");
-    duk_remove(ctx, -2); // Global object
-    duk_insert(ctx, 0);
-    duk_pcall(ctx, numArgs + 1);
-    if (duk_get_boolean(ctx, -1)) // Last receiver disconnected
+    CallSignalConnection(ctx, signal, "_DisconnectSignal");
+}
+
+void DispatchSignal(SignalReceiver* receiver)
+{
+    // The receiver may be erased by the script disconnecting from the signal
+    duk_context* ctx = receiver->ctx_;
+    void* key = receiver->key_;
+    JavaScriptInstance* instance = JavaScriptInstance::InstanceFromContext(ctx);
+
+    if (receiver->numBatchedConnections_ && instance)
+        instance->QueueSignalEvent(key);
+    if (receiver->numConnections_ && !(instance && instance->QueueIsolatedUpdate(key)))
     {
-        HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
-        signalReceivers.Erase(signal);
+        AutoExecutionBlock block(instance);
+        duk_push_global_object(ctx);
+        duk_get_prop_string(ctx, -1, "_OnSignal");
+        duk_remove(ctx, -2); // Global object
+        duk_push_number(ctx, (size_t)key);
+        duk_dup(ctx, -3); // Parameter array
+        bool success = duk_pcall(ctx, 2) == 0;
+        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
+        duk_pop(ctx); // Result
     }
-    duk_pop(ctx); // Result
+    duk_pop(ctx); // Parameter array
+}
+
+bool PushCachedSignalWrapper(duk_context* ctx, const char* propertyName)
+{
+    duk_push_this(ctx);
+    duk_get_prop_string(ctx, -1, propertyName);
+    if (duk_is_object(ctx, -1))
+    {
+        duk_remove(ctx, -2); // This object
+        return true;
+    }
+    duk_pop_2(ctx);
+    return false;
+}
+
+void CacheSignalWrapper(duk_context* ctx, const char* propertyName)
+{
+    // Internal properties bypass the proxy traps of scene, entity & component, and are not enumerable
+    duk_push_this(ctx);
+    duk_dup(ctx, -2);
+    duk_put_prop_string(ctx, -2, propertyName);
+    duk_pop(ctx);
+}
+
+bool PushCachedArray(duk_context* ctx, const char* propertyName)
+{
+    duk_push_this(ctx);
+    duk_get_prop_string(ctx, -1, propertyName);
+    if (duk_is_object(ctx, -1))
+    {
+        duk_remove(ctx, -2); // This object
+        return true;
+    }
+    duk_pop_2(ctx);
+    return false;
+}
+
+void CacheArray(duk_context* ctx, const char* propertyName)
+{
+    duk_push_this(ctx);
+    duk_dup(ctx, -2);
+    duk_put_prop_string(ctx, -2, propertyName);
+    duk_pop(ctx);
+}
+
+void ClearCachedArray(duk_context* ctx, const char* propertyName)
+{
+    duk_push_this(ctx);
+    duk_del_prop_string(ctx, -1, propertyName);
+    duk_pop(ctx);
 }
 
 static int GetStackRaw(duk_context *ctx)
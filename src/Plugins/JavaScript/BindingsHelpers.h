@@ -12,9 +12,27 @@
 #include <cstring>
 #include <map>
 
+/// Allocate a value object from the Duktape heap of ctx, eg. new (ctx) float3(). Must be released with JSBindings::DeleteValueObject.
+/** Heaps created with JavaScriptHeapAllocator serve these from their free lists, so that script temporaries do not allocate. */
+inline void* operator new(size_t size, duk_context* ctx)
+{
+    void* ptr = duk_alloc(ctx, size);
+    if (!ptr)
+        duk_error(ctx, DUK_ERR_ALLOC_ERROR, "Failed to allocate value object");
+    return ptr;
+}
+
+/// Release memory of a value object whose constructor threw.
+inline void operator delete(void* ptr, duk_context* ctx)
+{
+    duk_free(ctx, ptr);
+}
+
 namespace JSBindings
 {
 
+class SignalReceiver;
+
 /// Return type of a value object at stack index, or null if not valid
 JAVASCRIPT_API const char* GetValueObjectType(duk_context* ctx, duk_idx_t stackIndex);
 
@@ -28,6 +46,26 @@ JAVASCRIPT_API void DefineProperty(duk_context* ctx, const char* propertyName, d
 /// Get a WeakPtr<Object> from a JS object.
 JAVASCRIPT_API Tundra::WeakPtr<Tundra::Object>* GetWeakPtr(duk_context* ctx, duk_idx_t stackIndex);
 
+/// Raise a JS error if called from the frame update of an isolated JavaScriptInstance, see JavaScriptInstance::SetIsolated.
+/** Guards the bindings that modify the scene or the signals, which may only be used on the main thread. */
+JAVASCRIPT_API void RequireMainThread(duk_context* ctx);
+
+/// Raise a JS error if the object may not be accessed from the frame update of an isolated JavaScriptInstance.
+/** An isolated frame update may only call the functions of its own instance. */
+JAVASCRIPT_API void RequireObjectAccess(duk_context* ctx, Tundra::Object* object);
+
+/// Serializes the reference count changes of the isolated frame updates running in parallel on the worker threads.
+/** Does nothing outside JavaScript::RunIsolatedUpdates, so the main thread does not pay for it otherwise. */
+class JAVASCRIPT_API AutoIsolatedLock
+{
+public:
+    AutoIsolatedLock();
+    ~AutoIsolatedLock();
+
+private:
+    bool locked_;
+};
+
 /// Common WeakPtr<Object> finalizer.
 JAVASCRIPT_API duk_ret_t WeakPtr_Finalizer(duk_context* ctx);
 
@@ -43,6 +81,18 @@ JAVASCRIPT_API Tundra::Vector<Tundra::String> GetStringVector(duk_context* ctx,
 /// Push a string vector to JS array.
 JAVASCRIPT_API void PushStringVector(duk_context* ctx, const Tundra::Vector<Tundra::String>& vector);
 
+/// Get a float array from a Float32Array, which is copied in one go, or from a JS array of numbers. Raise JS error if not an object.
+JAVASCRIPT_API Tundra::PODVector<float> GetFloatArray(duk_context* ctx, duk_idx_t stackIndex);
+
+/// Push a float array as a Float32Array.
+JAVASCRIPT_API void PushFloatArray(duk_context* ctx, const Tundra::PODVector<float>& vector);
+
+/// Get an unsigned integer array from a Uint32Array, which is copied in one go, or from a JS array of numbers. Raise JS error if not an object.
+JAVASCRIPT_API Tundra::PODVector<unsigned> GetUIntArray(duk_context* ctx, duk_idx_t stackIndex);
+
+/// Push an unsigned integer array as a Uint32Array.
+JAVASCRIPT_API void PushUIntArray(duk_context* ctx, const Tundra::PODVector<unsigned>& vector);
+
 /// Convert and push a variant.
 JAVASCRIPT_API void PushVariant(duk_context* ctx, const Tundra::Variant& variant);
 
@@ -53,14 +103,37 @@ JAVASCRIPT_API Tundra::Variant GetVariant(duk_context* ctx, duk_idx_t stackIndex
 JAVASCRIPT_API void PushAttributeValue(duk_context* ctx, Tundra::IAttribute* attr);
 
 /// Get an attribute value from JS stack and set it into the provided attribute.
+/** During an isolated frame update the assignment is queued to the JavaScriptInstance instead, see JavaScriptInstance::SetIsolated. */
 JAVASCRIPT_API void AssignAttributeValue(duk_context* ctx, duk_idx_t stackIndex, Tundra::IAttribute* destAttr, Tundra::AttributeChange::Type change);
 
 /// Call signal connect on the JS side (this object and receiver in JS stack)
+/** When called from a function with magic 1 (ConnectBatched), the connection receives the emits of a frame as one call with an array of events. */
 JAVASCRIPT_API void CallConnectSignal(duk_context* ctx, void* signal);
 
 /// Call signal disconnect on the JS side (this object and receiver in JS stack). The C++ side receiver is erased if this was the last connection.
+/** When called from a function with magic 1 (DisconnectBatched), a batched connection is removed. */
 JAVASCRIPT_API void CallDisconnectSignal(duk_context* ctx, void* signal);
 
+/// Deliver a signal emit to the script connections of a receiver. The signal parameter array must be at the top of the JS stack, and is popped.
+/** Connections called on each emit are called immediately, for batched connections the parameters are queued to the JavaScriptInstance.
+    Frame updates of an isolated JavaScriptInstance are deferred to a worker thread. */
+JAVASCRIPT_API void DispatchSignal(SignalReceiver* receiver);
+
+/// Push the typed array cached to the this object under an internal property. Return false without pushing if not cached yet.
+JAVASCRIPT_API bool PushCachedArray(duk_context* ctx, const char* propertyName);
+
+/// Cache the typed array at stack top to the this object under an internal property, so that an array member is copied once per object instead of on each read.
+JAVASCRIPT_API void CacheArray(duk_context* ctx, const char* propertyName);
+
+/// Remove the cached typed array from the this object, so that the next read copies the array member again. Call after assigning the member.
+JAVASCRIPT_API void ClearCachedArray(duk_context* ctx, const char* propertyName);
+
+/// Push the signal wrapper cached to the this object under an internal property. Return false without pushing if not cached yet.
+JAVASCRIPT_API bool PushCachedSignalWrapper(duk_context* ctx, const char* propertyName);
+
+/// Cache the signal wrapper at stack top to the this object under an internal property, so that it is created once per object and signal.
+JAVASCRIPT_API void CacheSignalWrapper(duk_context* ctx, const char* propertyName);
+
 /// Get call error + backtrace if available. Does not pop the object from JS stack.
 JAVASCRIPT_API Tundra::String GetErrorString(duk_context* ctx);
 
@@ -88,7 +161,10 @@ template<class T> T* GetValueObject(duk_context* ctx, duk_idx_t stackIndex, cons
         objTypeName = (const char*)duk_to_pointer(ctx, -1);
     duk_pop(ctx);
 
-    return (strcmp(objTypeName, typeName) == 0) ? obj : nullptr;
+    // The type names are static strings, so compare the pointers first. They differ only for objects created by another plugin.
+    if (objTypeName == typeName)
+        return obj;
+    return (objTypeName && strcmp(objTypeName, typeName) == 0) ? obj : nullptr;
 }
 
 /// Get an object of type and raise a JS error if null or invalid.
@@ -115,7 +191,7 @@ template<class T> T* GetThisValueObject(duk_context* ctx, const char* typeName)
 template<class T> void PushValueObjectCopy(duk_context* ctx, const T& source, const char* typeName, duk_c_function finalizer)
 {
     duk_push_object(ctx);
-    SetValueObject(ctx, -1, new T(source), typeName);
+    SetValueObject(ctx, -1, new (ctx) T(source), typeName);
     if (finalizer)
     {
         duk_push_c_function(ctx, finalizer, 1);
@@ -128,7 +204,7 @@ template<class T> void PushValueObjectCopy(duk_context* ctx, const T& source, co
     duk_pop(ctx);
 }
 
-/// Push a value object on the stack. The object must have been heap-allocated and its lifetime will be managed by the JS context from this point on. Finalizer function for the object needs to be specified. Optionally set prototype.
+/// Push a value object on the stack. The object must have been allocated with new (ctx) and its lifetime will be managed by the JS context from this point on. Finalizer function for the object needs to be specified. Optionally set prototype.
 template<class T> void PushValueObject(duk_context* ctx, T* source, const char* typeName, duk_c_function finalizer, bool setPrototype)
 {
     duk_push_object(ctx);
@@ -160,13 +236,21 @@ template<class T> void PushConstructorResult(duk_context* ctx, T* source, const
     }
 }
 
+/// Destroy a value object allocated with new (ctx).
+template<class T> void DeleteValueObject(duk_context* ctx, T* obj)
+{
+    obj->~T();
+    duk_free(ctx, obj);
+}
+
 /// Finalizer implementation
 template<class T> void FinalizeValueObject(duk_context* ctx, const char* typeName)
 {
     T* obj = GetValueObject<T>(ctx, 0, typeName);
     if (obj)
     {
-        delete obj;
+        AutoIsolatedLock lock; // Signal wrappers release a weak reference to their owner
+        DeleteValueObject(ctx, obj);
         SetValueObject(ctx, 0, 0, typeName);
     }
 }
@@ -189,7 +273,10 @@ template<class T> T* GetWeakObject(duk_context* ctx, duk_idx_t stackIndex)
     T* obj = nullptr;
     Tundra::WeakPtr<Tundra::Object>* ptr = GetWeakPtr(ctx, stackIndex);
     if (ptr)
+    {
+        RequireObjectAccess(ctx, ptr->Get());
         obj = dynamic_cast<T*>(ptr->Get());
+    }
     return obj;
 }
 
@@ -381,10 +468,22 @@ template<class T, class U> void PushWeakObjectMap(duk_context* ctx, const Tundra
 class JAVASCRIPT_API SignalReceiver : public Tundra::RefCounted
 {
 public:
+    SignalReceiver() :
+        ctx_(0),
+        key_(0),
+        numConnections_(0),
+        numBatchedConnections_(0)
+    {
+    }
+
     /// Duktape context pointer.
     duk_context* ctx_;
     /// Key (signal pointer) which is used to lookup the receiver on the JS side.
     void* key_;
+    /// Number of script connections called on each emit.
+    int numConnections_;
+    /// Number of script connections called once per frame with the events emitted during the frame.
+    int numBatchedConnections_;
 };
 
 }
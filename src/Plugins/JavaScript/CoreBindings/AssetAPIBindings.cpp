@@ -50,16 +50,10 @@ public:
     void OnSignal(AssetPtr param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0.Get());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -71,6 +65,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetCreated_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetCreated_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetCreated* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetCreated>(ctx, SignalWrapper_AssetAPI_AssetCreated_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -88,6 +83,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetCreated_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetCreated_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetCreated* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetCreated>(ctx, SignalWrapper_AssetAPI_AssetCreated_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -96,6 +92,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetCreated_Disconnect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetCreated_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetCreated* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetCreated>(ctx, SignalWrapper_AssetAPI_AssetCreated_ID);
     if (!wrapper->owner_) return 0;
     SharedPtr<IAsset> param0(GetWeakObject<IAsset>(ctx, 0));
@@ -106,7 +103,8 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetCreated_Emit(duk_context* ctx)
 static duk_ret_t AssetAPI_Get_AssetCreated(duk_context* ctx)
 {
     AssetAPI* thisObj = GetThisWeakObject<AssetAPI>(ctx);
-    SignalWrapper_AssetAPI_AssetCreated* wrapper = new SignalWrapper_AssetAPI_AssetCreated(thisObj, &thisObj->AssetCreated);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAssetCreated")) return 1;
+    SignalWrapper_AssetAPI_AssetCreated* wrapper = new (ctx) SignalWrapper_AssetAPI_AssetCreated(thisObj, &thisObj->AssetCreated);
     PushValueObject(ctx, wrapper, SignalWrapper_AssetAPI_AssetCreated_ID, SignalWrapper_AssetAPI_AssetCreated_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetCreated_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -116,8 +114,15 @@ static duk_ret_t AssetAPI_Get_AssetCreated(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetCreated_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetCreated_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetCreated_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetCreated_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAssetCreated");
     return 1;
 }
 
@@ -142,16 +147,10 @@ public:
     void OnSignal(AssetPtr param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0.Get());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -163,6 +162,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Finalizer(duk_cont
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_AssetAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -180,6 +180,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Connect(duk_contex
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_AssetAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -188,6 +189,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Disconnect(duk_con
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_AssetAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     SharedPtr<IAsset> param0(GetWeakObject<IAsset>(ctx, 0));
@@ -198,7 +200,8 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Emit(duk_context*
 static duk_ret_t AssetAPI_Get_AssetAboutToBeRemoved(duk_context* ctx)
 {
     AssetAPI* thisObj = GetThisWeakObject<AssetAPI>(ctx);
-    SignalWrapper_AssetAPI_AssetAboutToBeRemoved* wrapper = new SignalWrapper_AssetAPI_AssetAboutToBeRemoved(thisObj, &thisObj->AssetAboutToBeRemoved);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAssetAboutToBeRemoved")) return 1;
+    SignalWrapper_AssetAPI_AssetAboutToBeRemoved* wrapper = new (ctx) SignalWrapper_AssetAPI_AssetAboutToBeRemoved(thisObj, &thisObj->AssetAboutToBeRemoved);
     PushValueObject(ctx, wrapper, SignalWrapper_AssetAPI_AssetAboutToBeRemoved_ID, SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -208,8 +211,15 @@ static duk_ret_t AssetAPI_Get_AssetAboutToBeRemoved(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetAboutToBeRemoved_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAssetAboutToBeRemoved");
     return 1;
 }
 
@@ -234,16 +244,10 @@ public:
     void OnSignal(AssetBundlePtr param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0.Get());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -255,6 +259,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Finalizer(du
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -272,6 +277,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Connect(duk_
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -280,6 +286,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Disconnect(d
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     SharedPtr<IAssetBundle> param0(GetWeakObject<IAssetBundle>(ctx, 0));
@@ -290,7 +297,8 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Emit(duk_con
 static duk_ret_t AssetAPI_Get_AssetBundleAboutToBeRemoved(duk_context* ctx)
 {
     AssetAPI* thisObj = GetThisWeakObject<AssetAPI>(ctx);
-    SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved* wrapper = new SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved(thisObj, &thisObj->AssetBundleAboutToBeRemoved);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAssetBundleAboutToBeRemoved")) return 1;
+    SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved* wrapper = new (ctx) SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved(thisObj, &thisObj->AssetBundleAboutToBeRemoved);
     PushValueObject(ctx, wrapper, SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_ID, SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -300,8 +308,15 @@ static duk_ret_t AssetAPI_Get_AssetBundleAboutToBeRemoved(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetBundleAboutToBeRemoved_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAssetBundleAboutToBeRemoved");
     return 1;
 }
 
@@ -326,16 +341,10 @@ public:
     void OnSignal(AssetPtr param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0.Get());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -347,6 +356,7 @@ static duk_ret_t SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Finalizer(duk
 
 static duk_ret_t SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -364,6 +374,7 @@ static duk_ret_t SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Connect(duk_c
 
 static duk_ret_t SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -372,6 +383,7 @@ static duk_ret_t SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Disconnect(du
 
 static duk_ret_t SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     SharedPtr<IAsset> param0(GetWeakObject<IAsset>(ctx, 0));
@@ -382,7 +394,8 @@ static duk_ret_t SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Emit(duk_cont
 static duk_ret_t AssetAPI_Get_DiskSourceAboutToBeRemoved(duk_context* ctx)
 {
     AssetAPI* thisObj = GetThisWeakObject<AssetAPI>(ctx);
-    SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved* wrapper = new SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved(thisObj, &thisObj->DiskSourceAboutToBeRemoved);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalDiskSourceAboutToBeRemoved")) return 1;
+    SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved* wrapper = new (ctx) SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved(thisObj, &thisObj->DiskSourceAboutToBeRemoved);
     PushValueObject(ctx, wrapper, SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_ID, SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -392,8 +405,15 @@ static duk_ret_t AssetAPI_Get_DiskSourceAboutToBeRemoved(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_DiskSourceAboutToBeRemoved_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalDiskSourceAboutToBeRemoved");
     return 1;
 }
 
@@ -418,16 +438,10 @@ public:
     void OnSignal(AssetBundlePtr param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0.Get());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -439,6 +453,7 @@ static duk_ret_t SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Finaliz
 
 static duk_ret_t SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -456,6 +471,7 @@ static duk_ret_t SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Connect
 
 static duk_ret_t SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -464,6 +480,7 @@ static duk_ret_t SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Disconn
 
 static duk_ret_t SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved>(ctx, SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     SharedPtr<IAssetBundle> param0(GetWeakObject<IAssetBundle>(ctx, 0));
@@ -474,7 +491,8 @@ static duk_ret_t SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Emit(du
 static duk_ret_t AssetAPI_Get_BundleDiskSourceAboutToBeRemoved(duk_context* ctx)
 {
     AssetAPI* thisObj = GetThisWeakObject<AssetAPI>(ctx);
-    SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved* wrapper = new SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved(thisObj, &thisObj->BundleDiskSourceAboutToBeRemoved);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalBundleDiskSourceAboutToBeRemoved")) return 1;
+    SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved* wrapper = new (ctx) SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved(thisObj, &thisObj->BundleDiskSourceAboutToBeRemoved);
     PushValueObject(ctx, wrapper, SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_ID, SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -484,8 +502,15 @@ static duk_ret_t AssetAPI_Get_BundleDiskSourceAboutToBeRemoved(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_BundleDiskSourceAboutToBeRemoved_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalBundleDiskSourceAboutToBeRemoved");
     return 1;
 }
 
@@ -510,16 +535,10 @@ public:
     void OnSignal(AssetPtr param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0.Get());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -531,6 +550,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetDiskSourceChanged_Finalizer(duk_con
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetDiskSourceChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetDiskSourceChanged* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetDiskSourceChanged>(ctx, SignalWrapper_AssetAPI_AssetDiskSourceChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -548,6 +568,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetDiskSourceChanged_Connect(duk_conte
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetDiskSourceChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetDiskSourceChanged* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetDiskSourceChanged>(ctx, SignalWrapper_AssetAPI_AssetDiskSourceChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -556,6 +577,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetDiskSourceChanged_Disconnect(duk_co
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetDiskSourceChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetDiskSourceChanged* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetDiskSourceChanged>(ctx, SignalWrapper_AssetAPI_AssetDiskSourceChanged_ID);
     if (!wrapper->owner_) return 0;
     SharedPtr<IAsset> param0(GetWeakObject<IAsset>(ctx, 0));
@@ -566,7 +588,8 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetDiskSourceChanged_Emit(duk_context*
 static duk_ret_t AssetAPI_Get_AssetDiskSourceChanged(duk_context* ctx)
 {
     AssetAPI* thisObj = GetThisWeakObject<AssetAPI>(ctx);
-    SignalWrapper_AssetAPI_AssetDiskSourceChanged* wrapper = new SignalWrapper_AssetAPI_AssetDiskSourceChanged(thisObj, &thisObj->AssetDiskSourceChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAssetDiskSourceChanged")) return 1;
+    SignalWrapper_AssetAPI_AssetDiskSourceChanged* wrapper = new (ctx) SignalWrapper_AssetAPI_AssetDiskSourceChanged(thisObj, &thisObj->AssetDiskSourceChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_AssetAPI_AssetDiskSourceChanged_ID, SignalWrapper_AssetAPI_AssetDiskSourceChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetDiskSourceChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -576,8 +599,15 @@ static duk_ret_t AssetAPI_Get_AssetDiskSourceChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetDiskSourceChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetDiskSourceChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetDiskSourceChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetDiskSourceChanged_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAssetDiskSourceChanged");
     return 1;
 }
 
@@ -602,16 +632,10 @@ public:
     void OnSignal(const String & param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -623,6 +647,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetUploaded_Finalizer(duk_context* ctx
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetUploaded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetUploaded* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetUploaded>(ctx, SignalWrapper_AssetAPI_AssetUploaded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -640,6 +665,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetUploaded_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetUploaded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetUploaded* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetUploaded>(ctx, SignalWrapper_AssetAPI_AssetUploaded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -648,6 +674,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetUploaded_Disconnect(duk_context* ct
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetUploaded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetUploaded* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetUploaded>(ctx, SignalWrapper_AssetAPI_AssetUploaded_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -658,7 +685,8 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetUploaded_Emit(duk_context* ctx)
 static duk_ret_t AssetAPI_Get_AssetUploaded(duk_context* ctx)
 {
     AssetAPI* thisObj = GetThisWeakObject<AssetAPI>(ctx);
-    SignalWrapper_AssetAPI_AssetUploaded* wrapper = new SignalWrapper_AssetAPI_AssetUploaded(thisObj, &thisObj->AssetUploaded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAssetUploaded")) return 1;
+    SignalWrapper_AssetAPI_AssetUploaded* wrapper = new (ctx) SignalWrapper_AssetAPI_AssetUploaded(thisObj, &thisObj->AssetUploaded);
     PushValueObject(ctx, wrapper, SignalWrapper_AssetAPI_AssetUploaded_ID, SignalWrapper_AssetAPI_AssetUploaded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetUploaded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -668,8 +696,15 @@ static duk_ret_t AssetAPI_Get_AssetUploaded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetUploaded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetUploaded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetUploaded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetUploaded_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAssetUploaded");
     return 1;
 }
 
@@ -694,16 +729,10 @@ public:
     void OnSignal(const String & param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -715,6 +744,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetDeletedFromStorage_Finalizer(duk_co
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetDeletedFromStorage_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetDeletedFromStorage* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetDeletedFromStorage>(ctx, SignalWrapper_AssetAPI_AssetDeletedFromStorage_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -732,6 +762,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetDeletedFromStorage_Connect(duk_cont
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetDeletedFromStorage_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetDeletedFromStorage* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetDeletedFromStorage>(ctx, SignalWrapper_AssetAPI_AssetDeletedFromStorage_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -740,6 +771,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetDeletedFromStorage_Disconnect(duk_c
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetDeletedFromStorage_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetDeletedFromStorage* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetDeletedFromStorage>(ctx, SignalWrapper_AssetAPI_AssetDeletedFromStorage_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -750,7 +782,8 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetDeletedFromStorage_Emit(duk_context
 static duk_ret_t AssetAPI_Get_AssetDeletedFromStorage(duk_context* ctx)
 {
     AssetAPI* thisObj = GetThisWeakObject<AssetAPI>(ctx);
-    SignalWrapper_AssetAPI_AssetDeletedFromStorage* wrapper = new SignalWrapper_AssetAPI_AssetDeletedFromStorage(thisObj, &thisObj->AssetDeletedFromStorage);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAssetDeletedFromStorage")) return 1;
+    SignalWrapper_AssetAPI_AssetDeletedFromStorage* wrapper = new (ctx) SignalWrapper_AssetAPI_AssetDeletedFromStorage(thisObj, &thisObj->AssetDeletedFromStorage);
     PushValueObject(ctx, wrapper, SignalWrapper_AssetAPI_AssetDeletedFromStorage_ID, SignalWrapper_AssetAPI_AssetDeletedFromStorage_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetDeletedFromStorage_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -760,8 +793,15 @@ static duk_ret_t AssetAPI_Get_AssetDeletedFromStorage(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetDeletedFromStorage_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetDeletedFromStorage_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetDeletedFromStorage_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetDeletedFromStorage_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAssetDeletedFromStorage");
     return 1;
 }
 
@@ -786,16 +826,10 @@ public:
     void OnSignal(AssetStoragePtr param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0.Get());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -807,6 +841,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetStorageAdded_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetStorageAdded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetStorageAdded* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetStorageAdded>(ctx, SignalWrapper_AssetAPI_AssetStorageAdded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -824,6 +859,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetStorageAdded_Connect(duk_context* c
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetStorageAdded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetStorageAdded* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetStorageAdded>(ctx, SignalWrapper_AssetAPI_AssetStorageAdded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -832,6 +868,7 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetStorageAdded_Disconnect(duk_context
 
 static duk_ret_t SignalWrapper_AssetAPI_AssetStorageAdded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AssetAPI_AssetStorageAdded* wrapper = GetThisValueObject<SignalWrapper_AssetAPI_AssetStorageAdded>(ctx, SignalWrapper_AssetAPI_AssetStorageAdded_ID);
     if (!wrapper->owner_) return 0;
     SharedPtr<IAssetStorage> param0(GetWeakObject<IAssetStorage>(ctx, 0));
@@ -842,7 +879,8 @@ static duk_ret_t SignalWrapper_AssetAPI_AssetStorageAdded_Emit(duk_context* ctx)
 static duk_ret_t AssetAPI_Get_AssetStorageAdded(duk_context* ctx)
 {
     AssetAPI* thisObj = GetThisWeakObject<AssetAPI>(ctx);
-    SignalWrapper_AssetAPI_AssetStorageAdded* wrapper = new SignalWrapper_AssetAPI_AssetStorageAdded(thisObj, &thisObj->AssetStorageAdded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAssetStorageAdded")) return 1;
+    SignalWrapper_AssetAPI_AssetStorageAdded* wrapper = new (ctx) SignalWrapper_AssetAPI_AssetStorageAdded(thisObj, &thisObj->AssetStorageAdded);
     PushValueObject(ctx, wrapper, SignalWrapper_AssetAPI_AssetStorageAdded_ID, SignalWrapper_AssetAPI_AssetStorageAdded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetStorageAdded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -852,8 +890,15 @@ static duk_ret_t AssetAPI_Get_AssetStorageAdded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetStorageAdded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetStorageAdded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetStorageAdded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AssetAPI_AssetStorageAdded_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAssetStorageAdded");
     return 1;
 }
 
@@ -61,7 +61,7 @@ static duk_ret_t AssetReference_Get_type(duk_context* ctx)
 
 static duk_ret_t AssetReference_Ctor(duk_context* ctx)
 {
-    AssetReference* newObj = new AssetReference();
+    AssetReference* newObj = new (ctx) AssetReference();
     PushConstructorResult<AssetReference>(ctx, newObj, AssetReference_ID, AssetReference_Finalizer);
     return 0;
 }
@@ -69,7 +69,7 @@ static duk_ret_t AssetReference_Ctor(duk_context* ctx)
 static duk_ret_t AssetReference_Ctor_String(duk_context* ctx)
 {
     String reference = duk_require_string(ctx, 0);
-    AssetReference* newObj = new AssetReference(reference);
+    AssetReference* newObj = new (ctx) AssetReference(reference);
     PushConstructorResult<AssetReference>(ctx, newObj, AssetReference_ID, AssetReference_Finalizer);
     return 0;
 }
@@ -78,7 +78,7 @@ static duk_ret_t AssetReference_Ctor_String_String(duk_context* ctx)
 {
     String reference = duk_require_string(ctx, 0);
     String type_ = duk_require_string(ctx, 1);
-    AssetReference* newObj = new AssetReference(reference, type_);
+    AssetReference* newObj = new (ctx) AssetReference(reference, type_);
     PushConstructorResult<AssetReference>(ctx, newObj, AssetReference_ID, AssetReference_Finalizer);
     return 0;
 }
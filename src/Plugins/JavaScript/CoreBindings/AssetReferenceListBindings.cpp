@@ -69,7 +69,7 @@ static duk_ret_t AssetReferenceList_Get_type(duk_context* ctx)
 
 static duk_ret_t AssetReferenceList_Ctor(duk_context* ctx)
 {
-    AssetReferenceList* newObj = new AssetReferenceList();
+    AssetReferenceList* newObj = new (ctx) AssetReferenceList();
     PushConstructorResult<AssetReferenceList>(ctx, newObj, AssetReferenceList_ID, AssetReferenceList_Finalizer);
     return 0;
 }
@@ -77,7 +77,7 @@ static duk_ret_t AssetReferenceList_Ctor(duk_context* ctx)
 static duk_ret_t AssetReferenceList_Ctor_String(duk_context* ctx)
 {
     String preferredType = duk_require_string(ctx, 0);
-    AssetReferenceList* newObj = new AssetReferenceList(preferredType);
+    AssetReferenceList* newObj = new (ctx) AssetReferenceList(preferredType);
     PushConstructorResult<AssetReferenceList>(ctx, newObj, AssetReferenceList_ID, AssetReferenceList_Finalizer);
     return 0;
 }
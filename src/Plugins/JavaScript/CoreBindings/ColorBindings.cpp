@@ -98,7 +98,7 @@ static duk_ret_t Color_Get_a(duk_context* ctx)
 
 static duk_ret_t Color_Ctor(duk_context* ctx)
 {
-    Color* newObj = new Color();
+    Color* newObj = new (ctx) Color();
     PushConstructorResult<Color>(ctx, newObj, Color_ID, Color_Finalizer);
     return 0;
 }
@@ -108,7 +108,7 @@ static duk_ret_t Color_Ctor_float_float_float(duk_context* ctx)
     float nr = (float)duk_require_number(ctx, 0);
     float ng = (float)duk_require_number(ctx, 1);
     float nb = (float)duk_require_number(ctx, 2);
-    Color* newObj = new Color(nr, ng, nb);
+    Color* newObj = new (ctx) Color(nr, ng, nb);
     PushConstructorResult<Color>(ctx, newObj, Color_ID, Color_Finalizer);
     return 0;
 }
@@ -119,7 +119,7 @@ static duk_ret_t Color_Ctor_float_float_float_float(duk_context* ctx)
     float ng = (float)duk_require_number(ctx, 1);
     float nb = (float)duk_require_number(ctx, 2);
     float na = (float)duk_require_number(ctx, 3);
-    Color* newObj = new Color(nr, ng, nb, na);
+    Color* newObj = new (ctx) Color(nr, ng, nb, na);
     PushConstructorResult<Color>(ctx, newObj, Color_ID, Color_Finalizer);
     return 0;
 }
@@ -127,7 +127,7 @@ static duk_ret_t Color_Ctor_float_float_float_float(duk_context* ctx)
 static duk_ret_t Color_Ctor_Color(duk_context* ctx)
 {
     Color& c = *GetCheckedValueObject<Color>(ctx, 0, Color_ID);
-    Color* newObj = new Color(c);
+    Color* newObj = new (ctx) Color(c);
     PushConstructorResult<Color>(ctx, newObj, Color_ID, Color_Finalizer);
     return 0;
 }
@@ -135,7 +135,7 @@ static duk_ret_t Color_Ctor_Color(duk_context* ctx)
 static duk_ret_t Color_Ctor_float4(duk_context* ctx)
 {
     float4& c = *GetCheckedValueObject<float4>(ctx, 0, float4_ID);
-    Color* newObj = new Color(c);
+    Color* newObj = new (ctx) Color(c);
     PushConstructorResult<Color>(ctx, newObj, Color_ID, Color_Finalizer);
     return 0;
 }
@@ -44,16 +44,10 @@ public:
     void OnSignal(const StringVector & param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushStringVector(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -65,6 +59,7 @@ static duk_ret_t SignalWrapper_EntityAction_Triggered_Finalizer(duk_context* ctx
 
 static duk_ret_t SignalWrapper_EntityAction_Triggered_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_EntityAction_Triggered* wrapper = GetThisValueObject<SignalWrapper_EntityAction_Triggered>(ctx, SignalWrapper_EntityAction_Triggered_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -82,6 +77,7 @@ static duk_ret_t SignalWrapper_EntityAction_Triggered_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_EntityAction_Triggered_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_EntityAction_Triggered* wrapper = GetThisValueObject<SignalWrapper_EntityAction_Triggered>(ctx, SignalWrapper_EntityAction_Triggered_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -90,6 +86,7 @@ static duk_ret_t SignalWrapper_EntityAction_Triggered_Disconnect(duk_context* ct
 
 static duk_ret_t SignalWrapper_EntityAction_Triggered_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_EntityAction_Triggered* wrapper = GetThisValueObject<SignalWrapper_EntityAction_Triggered>(ctx, SignalWrapper_EntityAction_Triggered_ID);
     if (!wrapper->owner_) return 0;
     StringVector param0 = GetStringVector(ctx, 0);
@@ -100,7 +97,8 @@ static duk_ret_t SignalWrapper_EntityAction_Triggered_Emit(duk_context* ctx)
 static duk_ret_t EntityAction_Get_Triggered(duk_context* ctx)
 {
     EntityAction* thisObj = GetThisWeakObject<EntityAction>(ctx);
-    SignalWrapper_EntityAction_Triggered* wrapper = new SignalWrapper_EntityAction_Triggered(thisObj, &thisObj->Triggered);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalTriggered")) return 1;
+    SignalWrapper_EntityAction_Triggered* wrapper = new (ctx) SignalWrapper_EntityAction_Triggered(thisObj, &thisObj->Triggered);
     PushValueObject(ctx, wrapper, SignalWrapper_EntityAction_Triggered_ID, SignalWrapper_EntityAction_Triggered_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_EntityAction_Triggered_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -110,8 +108,15 @@ static duk_ret_t EntityAction_Get_Triggered(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_EntityAction_Triggered_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_EntityAction_Triggered_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_EntityAction_Triggered_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_EntityAction_Triggered_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalTriggered");
     return 1;
 }
 
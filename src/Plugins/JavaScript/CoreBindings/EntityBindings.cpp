@@ -49,18 +49,12 @@ public:
     void OnSignal(IComponent * param0, AttributeChange::Type param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -72,6 +66,7 @@ static duk_ret_t SignalWrapper_Entity_ComponentAdded_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_ComponentAdded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_ComponentAdded* wrapper = GetThisValueObject<SignalWrapper_Entity_ComponentAdded>(ctx, SignalWrapper_Entity_ComponentAdded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -89,6 +84,7 @@ static duk_ret_t SignalWrapper_Entity_ComponentAdded_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_ComponentAdded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_ComponentAdded* wrapper = GetThisValueObject<SignalWrapper_Entity_ComponentAdded>(ctx, SignalWrapper_Entity_ComponentAdded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -97,6 +93,7 @@ static duk_ret_t SignalWrapper_Entity_ComponentAdded_Disconnect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_Entity_ComponentAdded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_ComponentAdded* wrapper = GetThisValueObject<SignalWrapper_Entity_ComponentAdded>(ctx, SignalWrapper_Entity_ComponentAdded_ID);
     if (!wrapper->owner_) return 0;
     IComponent* param0 = GetWeakObject<IComponent>(ctx, 0);
@@ -108,7 +105,8 @@ static duk_ret_t SignalWrapper_Entity_ComponentAdded_Emit(duk_context* ctx)
 static duk_ret_t Entity_Get_ComponentAdded(duk_context* ctx)
 {
     Entity* thisObj = GetThisWeakObject<Entity>(ctx);
-    SignalWrapper_Entity_ComponentAdded* wrapper = new SignalWrapper_Entity_ComponentAdded(thisObj, &thisObj->ComponentAdded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentAdded")) return 1;
+    SignalWrapper_Entity_ComponentAdded* wrapper = new (ctx) SignalWrapper_Entity_ComponentAdded(thisObj, &thisObj->ComponentAdded);
     PushValueObject(ctx, wrapper, SignalWrapper_Entity_ComponentAdded_ID, SignalWrapper_Entity_ComponentAdded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Entity_ComponentAdded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -118,8 +116,15 @@ static duk_ret_t Entity_Get_ComponentAdded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Entity_ComponentAdded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Entity_ComponentAdded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Entity_ComponentAdded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Entity_ComponentAdded_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentAdded");
     return 1;
 }
 
@@ -144,18 +149,12 @@ public:
     void OnSignal(IComponent * param0, AttributeChange::Type param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -167,6 +166,7 @@ static duk_ret_t SignalWrapper_Entity_ComponentRemoved_Finalizer(duk_context* ct
 
 static duk_ret_t SignalWrapper_Entity_ComponentRemoved_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_ComponentRemoved* wrapper = GetThisValueObject<SignalWrapper_Entity_ComponentRemoved>(ctx, SignalWrapper_Entity_ComponentRemoved_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -184,6 +184,7 @@ static duk_ret_t SignalWrapper_Entity_ComponentRemoved_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_ComponentRemoved_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_ComponentRemoved* wrapper = GetThisValueObject<SignalWrapper_Entity_ComponentRemoved>(ctx, SignalWrapper_Entity_ComponentRemoved_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -192,6 +193,7 @@ static duk_ret_t SignalWrapper_Entity_ComponentRemoved_Disconnect(duk_context* c
 
 static duk_ret_t SignalWrapper_Entity_ComponentRemoved_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_ComponentRemoved* wrapper = GetThisValueObject<SignalWrapper_Entity_ComponentRemoved>(ctx, SignalWrapper_Entity_ComponentRemoved_ID);
     if (!wrapper->owner_) return 0;
     IComponent* param0 = GetWeakObject<IComponent>(ctx, 0);
@@ -203,7 +205,8 @@ static duk_ret_t SignalWrapper_Entity_ComponentRemoved_Emit(duk_context* ctx)
 static duk_ret_t Entity_Get_ComponentRemoved(duk_context* ctx)
 {
     Entity* thisObj = GetThisWeakObject<Entity>(ctx);
-    SignalWrapper_Entity_ComponentRemoved* wrapper = new SignalWrapper_Entity_ComponentRemoved(thisObj, &thisObj->ComponentRemoved);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentRemoved")) return 1;
+    SignalWrapper_Entity_ComponentRemoved* wrapper = new (ctx) SignalWrapper_Entity_ComponentRemoved(thisObj, &thisObj->ComponentRemoved);
     PushValueObject(ctx, wrapper, SignalWrapper_Entity_ComponentRemoved_ID, SignalWrapper_Entity_ComponentRemoved_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Entity_ComponentRemoved_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -213,8 +216,15 @@ static duk_ret_t Entity_Get_ComponentRemoved(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Entity_ComponentRemoved_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Entity_ComponentRemoved_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Entity_ComponentRemoved_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Entity_ComponentRemoved_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentRemoved");
     return 1;
 }
 
@@ -239,18 +249,12 @@ public:
     void OnSignal(Entity * param0, AttributeChange::Type param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -262,6 +266,7 @@ static duk_ret_t SignalWrapper_Entity_EntityRemoved_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_EntityRemoved_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_EntityRemoved* wrapper = GetThisValueObject<SignalWrapper_Entity_EntityRemoved>(ctx, SignalWrapper_Entity_EntityRemoved_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -279,6 +284,7 @@ static duk_ret_t SignalWrapper_Entity_EntityRemoved_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_EntityRemoved_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_EntityRemoved* wrapper = GetThisValueObject<SignalWrapper_Entity_EntityRemoved>(ctx, SignalWrapper_Entity_EntityRemoved_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -287,6 +293,7 @@ static duk_ret_t SignalWrapper_Entity_EntityRemoved_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_EntityRemoved_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_EntityRemoved* wrapper = GetThisValueObject<SignalWrapper_Entity_EntityRemoved>(ctx, SignalWrapper_Entity_EntityRemoved_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -298,7 +305,8 @@ static duk_ret_t SignalWrapper_Entity_EntityRemoved_Emit(duk_context* ctx)
 static duk_ret_t Entity_Get_EntityRemoved(duk_context* ctx)
 {
     Entity* thisObj = GetThisWeakObject<Entity>(ctx);
-    SignalWrapper_Entity_EntityRemoved* wrapper = new SignalWrapper_Entity_EntityRemoved(thisObj, &thisObj->EntityRemoved);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityRemoved")) return 1;
+    SignalWrapper_Entity_EntityRemoved* wrapper = new (ctx) SignalWrapper_Entity_EntityRemoved(thisObj, &thisObj->EntityRemoved);
     PushValueObject(ctx, wrapper, SignalWrapper_Entity_EntityRemoved_ID, SignalWrapper_Entity_EntityRemoved_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Entity_EntityRemoved_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -308,8 +316,15 @@ static duk_ret_t Entity_Get_EntityRemoved(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Entity_EntityRemoved_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Entity_EntityRemoved_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Entity_EntityRemoved_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Entity_EntityRemoved_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityRemoved");
     return 1;
 }
 
@@ -334,18 +349,12 @@ public:
     void OnSignal(Entity * param0, AttributeChange::Type param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -357,6 +366,7 @@ static duk_ret_t SignalWrapper_Entity_TemporaryStateToggled_Finalizer(duk_contex
 
 static duk_ret_t SignalWrapper_Entity_TemporaryStateToggled_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_TemporaryStateToggled* wrapper = GetThisValueObject<SignalWrapper_Entity_TemporaryStateToggled>(ctx, SignalWrapper_Entity_TemporaryStateToggled_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -374,6 +384,7 @@ static duk_ret_t SignalWrapper_Entity_TemporaryStateToggled_Connect(duk_context*
 
 static duk_ret_t SignalWrapper_Entity_TemporaryStateToggled_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_TemporaryStateToggled* wrapper = GetThisValueObject<SignalWrapper_Entity_TemporaryStateToggled>(ctx, SignalWrapper_Entity_TemporaryStateToggled_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -382,6 +393,7 @@ static duk_ret_t SignalWrapper_Entity_TemporaryStateToggled_Disconnect(duk_conte
 
 static duk_ret_t SignalWrapper_Entity_TemporaryStateToggled_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_TemporaryStateToggled* wrapper = GetThisValueObject<SignalWrapper_Entity_TemporaryStateToggled>(ctx, SignalWrapper_Entity_TemporaryStateToggled_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -393,7 +405,8 @@ static duk_ret_t SignalWrapper_Entity_TemporaryStateToggled_Emit(duk_context* ct
 static duk_ret_t Entity_Get_TemporaryStateToggled(duk_context* ctx)
 {
     Entity* thisObj = GetThisWeakObject<Entity>(ctx);
-    SignalWrapper_Entity_TemporaryStateToggled* wrapper = new SignalWrapper_Entity_TemporaryStateToggled(thisObj, &thisObj->TemporaryStateToggled);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalTemporaryStateToggled")) return 1;
+    SignalWrapper_Entity_TemporaryStateToggled* wrapper = new (ctx) SignalWrapper_Entity_TemporaryStateToggled(thisObj, &thisObj->TemporaryStateToggled);
     PushValueObject(ctx, wrapper, SignalWrapper_Entity_TemporaryStateToggled_ID, SignalWrapper_Entity_TemporaryStateToggled_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Entity_TemporaryStateToggled_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -403,8 +416,15 @@ static duk_ret_t Entity_Get_TemporaryStateToggled(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Entity_TemporaryStateToggled_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Entity_TemporaryStateToggled_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Entity_TemporaryStateToggled_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Entity_TemporaryStateToggled_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalTemporaryStateToggled");
     return 1;
 }
 
@@ -429,16 +449,10 @@ public:
     void OnSignal(IComponent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -450,6 +464,7 @@ static duk_ret_t SignalWrapper_Entity_EnterView_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_EnterView_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_EnterView* wrapper = GetThisValueObject<SignalWrapper_Entity_EnterView>(ctx, SignalWrapper_Entity_EnterView_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -467,6 +482,7 @@ static duk_ret_t SignalWrapper_Entity_EnterView_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_EnterView_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_EnterView* wrapper = GetThisValueObject<SignalWrapper_Entity_EnterView>(ctx, SignalWrapper_Entity_EnterView_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -475,6 +491,7 @@ static duk_ret_t SignalWrapper_Entity_EnterView_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_EnterView_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_EnterView* wrapper = GetThisValueObject<SignalWrapper_Entity_EnterView>(ctx, SignalWrapper_Entity_EnterView_ID);
     if (!wrapper->owner_) return 0;
     IComponent* param0 = GetWeakObject<IComponent>(ctx, 0);
@@ -485,7 +502,8 @@ static duk_ret_t SignalWrapper_Entity_EnterView_Emit(duk_context* ctx)
 static duk_ret_t Entity_Get_EnterView(duk_context* ctx)
 {
     Entity* thisObj = GetThisWeakObject<Entity>(ctx);
-    SignalWrapper_Entity_EnterView* wrapper = new SignalWrapper_Entity_EnterView(thisObj, &thisObj->EnterView);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEnterView")) return 1;
+    SignalWrapper_Entity_EnterView* wrapper = new (ctx) SignalWrapper_Entity_EnterView(thisObj, &thisObj->EnterView);
     PushValueObject(ctx, wrapper, SignalWrapper_Entity_EnterView_ID, SignalWrapper_Entity_EnterView_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Entity_EnterView_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -495,8 +513,15 @@ static duk_ret_t Entity_Get_EnterView(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Entity_EnterView_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Entity_EnterView_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Entity_EnterView_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Entity_EnterView_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEnterView");
     return 1;
 }
 
@@ -521,16 +546,10 @@ public:
     void OnSignal(IComponent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -542,6 +561,7 @@ static duk_ret_t SignalWrapper_Entity_LeaveView_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_LeaveView_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_LeaveView* wrapper = GetThisValueObject<SignalWrapper_Entity_LeaveView>(ctx, SignalWrapper_Entity_LeaveView_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -559,6 +579,7 @@ static duk_ret_t SignalWrapper_Entity_LeaveView_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_LeaveView_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_LeaveView* wrapper = GetThisValueObject<SignalWrapper_Entity_LeaveView>(ctx, SignalWrapper_Entity_LeaveView_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -567,6 +588,7 @@ static duk_ret_t SignalWrapper_Entity_LeaveView_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_LeaveView_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_LeaveView* wrapper = GetThisValueObject<SignalWrapper_Entity_LeaveView>(ctx, SignalWrapper_Entity_LeaveView_ID);
     if (!wrapper->owner_) return 0;
     IComponent* param0 = GetWeakObject<IComponent>(ctx, 0);
@@ -577,7 +599,8 @@ static duk_ret_t SignalWrapper_Entity_LeaveView_Emit(duk_context* ctx)
 static duk_ret_t Entity_Get_LeaveView(duk_context* ctx)
 {
     Entity* thisObj = GetThisWeakObject<Entity>(ctx);
-    SignalWrapper_Entity_LeaveView* wrapper = new SignalWrapper_Entity_LeaveView(thisObj, &thisObj->LeaveView);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalLeaveView")) return 1;
+    SignalWrapper_Entity_LeaveView* wrapper = new (ctx) SignalWrapper_Entity_LeaveView(thisObj, &thisObj->LeaveView);
     PushValueObject(ctx, wrapper, SignalWrapper_Entity_LeaveView_ID, SignalWrapper_Entity_LeaveView_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Entity_LeaveView_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -587,8 +610,15 @@ static duk_ret_t Entity_Get_LeaveView(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Entity_LeaveView_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Entity_LeaveView_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Entity_LeaveView_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Entity_LeaveView_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalLeaveView");
     return 1;
 }
 
@@ -613,10 +643,6 @@ public:
     void OnSignal(Entity * param0, Entity * param1, AttributeChange::Type param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -624,9 +650,7 @@ public:
         duk_put_prop_index(ctx, -2, 1);
         duk_push_number(ctx, param2);
         duk_put_prop_index(ctx, -2, 2);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -638,6 +662,7 @@ static duk_ret_t SignalWrapper_Entity_ParentChanged_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_ParentChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_ParentChanged* wrapper = GetThisValueObject<SignalWrapper_Entity_ParentChanged>(ctx, SignalWrapper_Entity_ParentChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -655,6 +680,7 @@ static duk_ret_t SignalWrapper_Entity_ParentChanged_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_ParentChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_ParentChanged* wrapper = GetThisValueObject<SignalWrapper_Entity_ParentChanged>(ctx, SignalWrapper_Entity_ParentChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -663,6 +689,7 @@ static duk_ret_t SignalWrapper_Entity_ParentChanged_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Entity_ParentChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Entity_ParentChanged* wrapper = GetThisValueObject<SignalWrapper_Entity_ParentChanged>(ctx, SignalWrapper_Entity_ParentChanged_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -675,7 +702,8 @@ static duk_ret_t SignalWrapper_Entity_ParentChanged_Emit(duk_context* ctx)
 static duk_ret_t Entity_Get_ParentChanged(duk_context* ctx)
 {
     Entity* thisObj = GetThisWeakObject<Entity>(ctx);
-    SignalWrapper_Entity_ParentChanged* wrapper = new SignalWrapper_Entity_ParentChanged(thisObj, &thisObj->ParentChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentChanged")) return 1;
+    SignalWrapper_Entity_ParentChanged* wrapper = new (ctx) SignalWrapper_Entity_ParentChanged(thisObj, &thisObj->ParentChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Entity_ParentChanged_ID, SignalWrapper_Entity_ParentChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Entity_ParentChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -685,8 +713,15 @@ static duk_ret_t Entity_Get_ParentChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Entity_ParentChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Entity_ParentChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Entity_ParentChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Entity_ParentChanged_Emit, 3);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentChanged");
     return 1;
 }
 
@@ -48,7 +48,7 @@ static duk_ret_t EntityReference_Get_ref(duk_context* ctx)
 
 static duk_ret_t EntityReference_Ctor(duk_context* ctx)
 {
-    EntityReference* newObj = new EntityReference();
+    EntityReference* newObj = new (ctx) EntityReference();
     PushConstructorResult<EntityReference>(ctx, newObj, EntityReference_ID, EntityReference_Finalizer);
     return 0;
 }
@@ -56,7 +56,7 @@ static duk_ret_t EntityReference_Ctor(duk_context* ctx)
 static duk_ret_t EntityReference_Ctor_String(duk_context* ctx)
 {
     String entityName = duk_require_string(ctx, 0);
-    EntityReference* newObj = new EntityReference(entityName);
+    EntityReference* newObj = new (ctx) EntityReference(entityName);
     PushConstructorResult<EntityReference>(ctx, newObj, EntityReference_ID, EntityReference_Finalizer);
     return 0;
 }
@@ -64,7 +64,7 @@ static duk_ret_t EntityReference_Ctor_String(duk_context* ctx)
 static duk_ret_t EntityReference_Ctor_entity_id_t(duk_context* ctx)
 {
     entity_id_t id = (entity_id_t)duk_require_number(ctx, 0);
-    EntityReference* newObj = new EntityReference(id);
+    EntityReference* newObj = new (ctx) EntityReference(id);
     PushConstructorResult<EntityReference>(ctx, newObj, EntityReference_ID, EntityReference_Finalizer);
     return 0;
 }
@@ -45,16 +45,10 @@ public:
     void OnSignal(float param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_number(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -66,6 +60,7 @@ static duk_ret_t SignalWrapper_FrameAPI_Updated_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_FrameAPI_Updated_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_FrameAPI_Updated* wrapper = GetThisValueObject<SignalWrapper_FrameAPI_Updated>(ctx, SignalWrapper_FrameAPI_Updated_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -83,6 +78,7 @@ static duk_ret_t SignalWrapper_FrameAPI_Updated_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_FrameAPI_Updated_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_FrameAPI_Updated* wrapper = GetThisValueObject<SignalWrapper_FrameAPI_Updated>(ctx, SignalWrapper_FrameAPI_Updated_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -91,6 +87,7 @@ static duk_ret_t SignalWrapper_FrameAPI_Updated_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_FrameAPI_Updated_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_FrameAPI_Updated* wrapper = GetThisValueObject<SignalWrapper_FrameAPI_Updated>(ctx, SignalWrapper_FrameAPI_Updated_ID);
     if (!wrapper->owner_) return 0;
     float param0 = (float)duk_require_number(ctx, 0);
@@ -101,7 +98,8 @@ static duk_ret_t SignalWrapper_FrameAPI_Updated_Emit(duk_context* ctx)
 static duk_ret_t FrameAPI_Get_Updated(duk_context* ctx)
 {
     FrameAPI* thisObj = GetThisWeakObject<FrameAPI>(ctx);
-    SignalWrapper_FrameAPI_Updated* wrapper = new SignalWrapper_FrameAPI_Updated(thisObj, &thisObj->Updated);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalUpdated")) return 1;
+    SignalWrapper_FrameAPI_Updated* wrapper = new (ctx) SignalWrapper_FrameAPI_Updated(thisObj, &thisObj->Updated);
     PushValueObject(ctx, wrapper, SignalWrapper_FrameAPI_Updated_ID, SignalWrapper_FrameAPI_Updated_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_FrameAPI_Updated_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -111,8 +109,15 @@ static duk_ret_t FrameAPI_Get_Updated(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_FrameAPI_Updated_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_FrameAPI_Updated_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_FrameAPI_Updated_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_FrameAPI_Updated_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalUpdated");
     return 1;
 }
 
@@ -137,16 +142,10 @@ public:
     void OnSignal(float param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_number(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -158,6 +157,7 @@ static duk_ret_t SignalWrapper_FrameAPI_PostFrameUpdate_Finalizer(duk_context* c
 
 static duk_ret_t SignalWrapper_FrameAPI_PostFrameUpdate_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_FrameAPI_PostFrameUpdate* wrapper = GetThisValueObject<SignalWrapper_FrameAPI_PostFrameUpdate>(ctx, SignalWrapper_FrameAPI_PostFrameUpdate_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -175,6 +175,7 @@ static duk_ret_t SignalWrapper_FrameAPI_PostFrameUpdate_Connect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_FrameAPI_PostFrameUpdate_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_FrameAPI_PostFrameUpdate* wrapper = GetThisValueObject<SignalWrapper_FrameAPI_PostFrameUpdate>(ctx, SignalWrapper_FrameAPI_PostFrameUpdate_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -183,6 +184,7 @@ static duk_ret_t SignalWrapper_FrameAPI_PostFrameUpdate_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_FrameAPI_PostFrameUpdate_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_FrameAPI_PostFrameUpdate* wrapper = GetThisValueObject<SignalWrapper_FrameAPI_PostFrameUpdate>(ctx, SignalWrapper_FrameAPI_PostFrameUpdate_ID);
     if (!wrapper->owner_) return 0;
     float param0 = (float)duk_require_number(ctx, 0);
@@ -193,7 +195,8 @@ static duk_ret_t SignalWrapper_FrameAPI_PostFrameUpdate_Emit(duk_context* ctx)
 static duk_ret_t FrameAPI_Get_PostFrameUpdate(duk_context* ctx)
 {
     FrameAPI* thisObj = GetThisWeakObject<FrameAPI>(ctx);
-    SignalWrapper_FrameAPI_PostFrameUpdate* wrapper = new SignalWrapper_FrameAPI_PostFrameUpdate(thisObj, &thisObj->PostFrameUpdate);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalPostFrameUpdate")) return 1;
+    SignalWrapper_FrameAPI_PostFrameUpdate* wrapper = new (ctx) SignalWrapper_FrameAPI_PostFrameUpdate(thisObj, &thisObj->PostFrameUpdate);
     PushValueObject(ctx, wrapper, SignalWrapper_FrameAPI_PostFrameUpdate_ID, SignalWrapper_FrameAPI_PostFrameUpdate_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_FrameAPI_PostFrameUpdate_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -203,8 +206,15 @@ static duk_ret_t FrameAPI_Get_PostFrameUpdate(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_FrameAPI_PostFrameUpdate_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_FrameAPI_PostFrameUpdate_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_FrameAPI_PostFrameUpdate_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_FrameAPI_PostFrameUpdate_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalPostFrameUpdate");
     return 1;
 }
 
@@ -50,14 +50,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -69,6 +63,7 @@ static duk_ret_t SignalWrapper_Framework_ExitRequested_Finalizer(duk_context* ct
 
 static duk_ret_t SignalWrapper_Framework_ExitRequested_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Framework_ExitRequested* wrapper = GetThisValueObject<SignalWrapper_Framework_ExitRequested>(ctx, SignalWrapper_Framework_ExitRequested_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -86,6 +81,7 @@ static duk_ret_t SignalWrapper_Framework_ExitRequested_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Framework_ExitRequested_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Framework_ExitRequested* wrapper = GetThisValueObject<SignalWrapper_Framework_ExitRequested>(ctx, SignalWrapper_Framework_ExitRequested_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -94,6 +90,7 @@ static duk_ret_t SignalWrapper_Framework_ExitRequested_Disconnect(duk_context* c
 
 static duk_ret_t SignalWrapper_Framework_ExitRequested_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Framework_ExitRequested* wrapper = GetThisValueObject<SignalWrapper_Framework_ExitRequested>(ctx, SignalWrapper_Framework_ExitRequested_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -103,7 +100,8 @@ static duk_ret_t SignalWrapper_Framework_ExitRequested_Emit(duk_context* ctx)
 static duk_ret_t Framework_Get_ExitRequested(duk_context* ctx)
 {
     Framework* thisObj = GetThisWeakObject<Framework>(ctx);
-    SignalWrapper_Framework_ExitRequested* wrapper = new SignalWrapper_Framework_ExitRequested(thisObj, &thisObj->ExitRequested);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalExitRequested")) return 1;
+    SignalWrapper_Framework_ExitRequested* wrapper = new (ctx) SignalWrapper_Framework_ExitRequested(thisObj, &thisObj->ExitRequested);
     PushValueObject(ctx, wrapper, SignalWrapper_Framework_ExitRequested_ID, SignalWrapper_Framework_ExitRequested_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Framework_ExitRequested_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -113,8 +111,15 @@ static duk_ret_t Framework_Get_ExitRequested(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Framework_ExitRequested_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Framework_ExitRequested_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Framework_ExitRequested_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Framework_ExitRequested_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalExitRequested");
     return 1;
 }
 
@@ -53,16 +53,10 @@ public:
     void OnSignal(IAsset * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -74,6 +68,7 @@ static duk_ret_t SignalWrapper_IAsset_Unloaded_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAsset_Unloaded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAsset_Unloaded* wrapper = GetThisValueObject<SignalWrapper_IAsset_Unloaded>(ctx, SignalWrapper_IAsset_Unloaded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -91,6 +86,7 @@ static duk_ret_t SignalWrapper_IAsset_Unloaded_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAsset_Unloaded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAsset_Unloaded* wrapper = GetThisValueObject<SignalWrapper_IAsset_Unloaded>(ctx, SignalWrapper_IAsset_Unloaded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -99,6 +95,7 @@ static duk_ret_t SignalWrapper_IAsset_Unloaded_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAsset_Unloaded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAsset_Unloaded* wrapper = GetThisValueObject<SignalWrapper_IAsset_Unloaded>(ctx, SignalWrapper_IAsset_Unloaded_ID);
     if (!wrapper->owner_) return 0;
     IAsset* param0 = GetWeakObject<IAsset>(ctx, 0);
@@ -109,7 +106,8 @@ static duk_ret_t SignalWrapper_IAsset_Unloaded_Emit(duk_context* ctx)
 static duk_ret_t IAsset_Get_Unloaded(duk_context* ctx)
 {
     IAsset* thisObj = GetThisWeakObject<IAsset>(ctx);
-    SignalWrapper_IAsset_Unloaded* wrapper = new SignalWrapper_IAsset_Unloaded(thisObj, &thisObj->Unloaded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalUnloaded")) return 1;
+    SignalWrapper_IAsset_Unloaded* wrapper = new (ctx) SignalWrapper_IAsset_Unloaded(thisObj, &thisObj->Unloaded);
     PushValueObject(ctx, wrapper, SignalWrapper_IAsset_Unloaded_ID, SignalWrapper_IAsset_Unloaded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_IAsset_Unloaded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -119,8 +117,15 @@ static duk_ret_t IAsset_Get_Unloaded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_IAsset_Unloaded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_IAsset_Unloaded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_IAsset_Unloaded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_IAsset_Unloaded_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalUnloaded");
     return 1;
 }
 
@@ -145,16 +150,10 @@ public:
     void OnSignal(AssetPtr param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0.Get());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -166,6 +165,7 @@ static duk_ret_t SignalWrapper_IAsset_Loaded_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAsset_Loaded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAsset_Loaded* wrapper = GetThisValueObject<SignalWrapper_IAsset_Loaded>(ctx, SignalWrapper_IAsset_Loaded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -183,6 +183,7 @@ static duk_ret_t SignalWrapper_IAsset_Loaded_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAsset_Loaded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAsset_Loaded* wrapper = GetThisValueObject<SignalWrapper_IAsset_Loaded>(ctx, SignalWrapper_IAsset_Loaded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -191,6 +192,7 @@ static duk_ret_t SignalWrapper_IAsset_Loaded_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAsset_Loaded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAsset_Loaded* wrapper = GetThisValueObject<SignalWrapper_IAsset_Loaded>(ctx, SignalWrapper_IAsset_Loaded_ID);
     if (!wrapper->owner_) return 0;
     SharedPtr<IAsset> param0(GetWeakObject<IAsset>(ctx, 0));
@@ -201,7 +203,8 @@ static duk_ret_t SignalWrapper_IAsset_Loaded_Emit(duk_context* ctx)
 static duk_ret_t IAsset_Get_Loaded(duk_context* ctx)
 {
     IAsset* thisObj = GetThisWeakObject<IAsset>(ctx);
-    SignalWrapper_IAsset_Loaded* wrapper = new SignalWrapper_IAsset_Loaded(thisObj, &thisObj->Loaded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalLoaded")) return 1;
+    SignalWrapper_IAsset_Loaded* wrapper = new (ctx) SignalWrapper_IAsset_Loaded(thisObj, &thisObj->Loaded);
     PushValueObject(ctx, wrapper, SignalWrapper_IAsset_Loaded_ID, SignalWrapper_IAsset_Loaded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_IAsset_Loaded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -211,8 +214,15 @@ static duk_ret_t IAsset_Get_Loaded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_IAsset_Loaded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_IAsset_Loaded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_IAsset_Loaded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_IAsset_Loaded_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalLoaded");
     return 1;
 }
 
@@ -237,16 +247,10 @@ public:
     void OnSignal(IAsset * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -258,6 +262,7 @@ static duk_ret_t SignalWrapper_IAsset_PropertyStatusChanged_Finalizer(duk_contex
 
 static duk_ret_t SignalWrapper_IAsset_PropertyStatusChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAsset_PropertyStatusChanged* wrapper = GetThisValueObject<SignalWrapper_IAsset_PropertyStatusChanged>(ctx, SignalWrapper_IAsset_PropertyStatusChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -275,6 +280,7 @@ static duk_ret_t SignalWrapper_IAsset_PropertyStatusChanged_Connect(duk_context*
 
 static duk_ret_t SignalWrapper_IAsset_PropertyStatusChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAsset_PropertyStatusChanged* wrapper = GetThisValueObject<SignalWrapper_IAsset_PropertyStatusChanged>(ctx, SignalWrapper_IAsset_PropertyStatusChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -283,6 +289,7 @@ static duk_ret_t SignalWrapper_IAsset_PropertyStatusChanged_Disconnect(duk_conte
 
 static duk_ret_t SignalWrapper_IAsset_PropertyStatusChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAsset_PropertyStatusChanged* wrapper = GetThisValueObject<SignalWrapper_IAsset_PropertyStatusChanged>(ctx, SignalWrapper_IAsset_PropertyStatusChanged_ID);
     if (!wrapper->owner_) return 0;
     IAsset* param0 = GetWeakObject<IAsset>(ctx, 0);
@@ -293,7 +300,8 @@ static duk_ret_t SignalWrapper_IAsset_PropertyStatusChanged_Emit(duk_context* ct
 static duk_ret_t IAsset_Get_PropertyStatusChanged(duk_context* ctx)
 {
     IAsset* thisObj = GetThisWeakObject<IAsset>(ctx);
-    SignalWrapper_IAsset_PropertyStatusChanged* wrapper = new SignalWrapper_IAsset_PropertyStatusChanged(thisObj, &thisObj->PropertyStatusChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalPropertyStatusChanged")) return 1;
+    SignalWrapper_IAsset_PropertyStatusChanged* wrapper = new (ctx) SignalWrapper_IAsset_PropertyStatusChanged(thisObj, &thisObj->PropertyStatusChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_IAsset_PropertyStatusChanged_ID, SignalWrapper_IAsset_PropertyStatusChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_IAsset_PropertyStatusChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -303,8 +311,15 @@ static duk_ret_t IAsset_Get_PropertyStatusChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_IAsset_PropertyStatusChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_IAsset_PropertyStatusChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_IAsset_PropertyStatusChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_IAsset_PropertyStatusChanged_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalPropertyStatusChanged");
     return 1;
 }
 
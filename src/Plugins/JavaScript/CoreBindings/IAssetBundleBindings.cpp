@@ -45,16 +45,10 @@ public:
     void OnSignal(IAssetBundle * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -66,6 +60,7 @@ static duk_ret_t SignalWrapper_IAssetBundle_Loaded_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAssetBundle_Loaded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetBundle_Loaded* wrapper = GetThisValueObject<SignalWrapper_IAssetBundle_Loaded>(ctx, SignalWrapper_IAssetBundle_Loaded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -83,6 +78,7 @@ static duk_ret_t SignalWrapper_IAssetBundle_Loaded_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAssetBundle_Loaded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetBundle_Loaded* wrapper = GetThisValueObject<SignalWrapper_IAssetBundle_Loaded>(ctx, SignalWrapper_IAssetBundle_Loaded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -91,6 +87,7 @@ static duk_ret_t SignalWrapper_IAssetBundle_Loaded_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAssetBundle_Loaded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetBundle_Loaded* wrapper = GetThisValueObject<SignalWrapper_IAssetBundle_Loaded>(ctx, SignalWrapper_IAssetBundle_Loaded_ID);
     if (!wrapper->owner_) return 0;
     IAssetBundle* param0 = GetWeakObject<IAssetBundle>(ctx, 0);
@@ -101,7 +98,8 @@ static duk_ret_t SignalWrapper_IAssetBundle_Loaded_Emit(duk_context* ctx)
 static duk_ret_t IAssetBundle_Get_Loaded(duk_context* ctx)
 {
     IAssetBundle* thisObj = GetThisWeakObject<IAssetBundle>(ctx);
-    SignalWrapper_IAssetBundle_Loaded* wrapper = new SignalWrapper_IAssetBundle_Loaded(thisObj, &thisObj->Loaded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalLoaded")) return 1;
+    SignalWrapper_IAssetBundle_Loaded* wrapper = new (ctx) SignalWrapper_IAssetBundle_Loaded(thisObj, &thisObj->Loaded);
     PushValueObject(ctx, wrapper, SignalWrapper_IAssetBundle_Loaded_ID, SignalWrapper_IAssetBundle_Loaded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Loaded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -111,8 +109,15 @@ static duk_ret_t IAssetBundle_Get_Loaded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Loaded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Loaded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Loaded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Loaded_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalLoaded");
     return 1;
 }
 
@@ -137,16 +142,10 @@ public:
     void OnSignal(IAssetBundle * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -158,6 +157,7 @@ static duk_ret_t SignalWrapper_IAssetBundle_Unloaded_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAssetBundle_Unloaded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetBundle_Unloaded* wrapper = GetThisValueObject<SignalWrapper_IAssetBundle_Unloaded>(ctx, SignalWrapper_IAssetBundle_Unloaded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -175,6 +175,7 @@ static duk_ret_t SignalWrapper_IAssetBundle_Unloaded_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAssetBundle_Unloaded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetBundle_Unloaded* wrapper = GetThisValueObject<SignalWrapper_IAssetBundle_Unloaded>(ctx, SignalWrapper_IAssetBundle_Unloaded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -183,6 +184,7 @@ static duk_ret_t SignalWrapper_IAssetBundle_Unloaded_Disconnect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_IAssetBundle_Unloaded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetBundle_Unloaded* wrapper = GetThisValueObject<SignalWrapper_IAssetBundle_Unloaded>(ctx, SignalWrapper_IAssetBundle_Unloaded_ID);
     if (!wrapper->owner_) return 0;
     IAssetBundle* param0 = GetWeakObject<IAssetBundle>(ctx, 0);
@@ -193,7 +195,8 @@ static duk_ret_t SignalWrapper_IAssetBundle_Unloaded_Emit(duk_context* ctx)
 static duk_ret_t IAssetBundle_Get_Unloaded(duk_context* ctx)
 {
     IAssetBundle* thisObj = GetThisWeakObject<IAssetBundle>(ctx);
-    SignalWrapper_IAssetBundle_Unloaded* wrapper = new SignalWrapper_IAssetBundle_Unloaded(thisObj, &thisObj->Unloaded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalUnloaded")) return 1;
+    SignalWrapper_IAssetBundle_Unloaded* wrapper = new (ctx) SignalWrapper_IAssetBundle_Unloaded(thisObj, &thisObj->Unloaded);
     PushValueObject(ctx, wrapper, SignalWrapper_IAssetBundle_Unloaded_ID, SignalWrapper_IAssetBundle_Unloaded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Unloaded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -203,8 +206,15 @@ static duk_ret_t IAssetBundle_Get_Unloaded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Unloaded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Unloaded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Unloaded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Unloaded_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalUnloaded");
     return 1;
 }
 
@@ -229,16 +239,10 @@ public:
     void OnSignal(IAssetBundle * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -250,6 +254,7 @@ static duk_ret_t SignalWrapper_IAssetBundle_Failed_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAssetBundle_Failed_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetBundle_Failed* wrapper = GetThisValueObject<SignalWrapper_IAssetBundle_Failed>(ctx, SignalWrapper_IAssetBundle_Failed_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -267,6 +272,7 @@ static duk_ret_t SignalWrapper_IAssetBundle_Failed_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAssetBundle_Failed_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetBundle_Failed* wrapper = GetThisValueObject<SignalWrapper_IAssetBundle_Failed>(ctx, SignalWrapper_IAssetBundle_Failed_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -275,6 +281,7 @@ static duk_ret_t SignalWrapper_IAssetBundle_Failed_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAssetBundle_Failed_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetBundle_Failed* wrapper = GetThisValueObject<SignalWrapper_IAssetBundle_Failed>(ctx, SignalWrapper_IAssetBundle_Failed_ID);
     if (!wrapper->owner_) return 0;
     IAssetBundle* param0 = GetWeakObject<IAssetBundle>(ctx, 0);
@@ -285,7 +292,8 @@ static duk_ret_t SignalWrapper_IAssetBundle_Failed_Emit(duk_context* ctx)
 static duk_ret_t IAssetBundle_Get_Failed(duk_context* ctx)
 {
     IAssetBundle* thisObj = GetThisWeakObject<IAssetBundle>(ctx);
-    SignalWrapper_IAssetBundle_Failed* wrapper = new SignalWrapper_IAssetBundle_Failed(thisObj, &thisObj->Failed);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalFailed")) return 1;
+    SignalWrapper_IAssetBundle_Failed* wrapper = new (ctx) SignalWrapper_IAssetBundle_Failed(thisObj, &thisObj->Failed);
     PushValueObject(ctx, wrapper, SignalWrapper_IAssetBundle_Failed_ID, SignalWrapper_IAssetBundle_Failed_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Failed_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -295,8 +303,15 @@ static duk_ret_t IAssetBundle_Get_Failed(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Failed_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Failed_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Failed_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_IAssetBundle_Failed_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalFailed");
     return 1;
 }
 
@@ -44,10 +44,6 @@ public:
     void OnSignal(IAssetStorage * param0, String param1, String param2, IAssetStorage::ChangeType param3)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -57,9 +53,7 @@ public:
         duk_put_prop_index(ctx, -2, 2);
         duk_push_number(ctx, param3);
         duk_put_prop_index(ctx, -2, 3);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -71,6 +65,7 @@ static duk_ret_t SignalWrapper_IAssetStorage_AssetChanged_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_IAssetStorage_AssetChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetStorage_AssetChanged* wrapper = GetThisValueObject<SignalWrapper_IAssetStorage_AssetChanged>(ctx, SignalWrapper_IAssetStorage_AssetChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -88,6 +83,7 @@ static duk_ret_t SignalWrapper_IAssetStorage_AssetChanged_Connect(duk_context* c
 
 static duk_ret_t SignalWrapper_IAssetStorage_AssetChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetStorage_AssetChanged* wrapper = GetThisValueObject<SignalWrapper_IAssetStorage_AssetChanged>(ctx, SignalWrapper_IAssetStorage_AssetChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -96,6 +92,7 @@ static duk_ret_t SignalWrapper_IAssetStorage_AssetChanged_Disconnect(duk_context
 
 static duk_ret_t SignalWrapper_IAssetStorage_AssetChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetStorage_AssetChanged* wrapper = GetThisValueObject<SignalWrapper_IAssetStorage_AssetChanged>(ctx, SignalWrapper_IAssetStorage_AssetChanged_ID);
     if (!wrapper->owner_) return 0;
     IAssetStorage* param0 = GetWeakObject<IAssetStorage>(ctx, 0);
@@ -109,7 +106,8 @@ static duk_ret_t SignalWrapper_IAssetStorage_AssetChanged_Emit(duk_context* ctx)
 static duk_ret_t IAssetStorage_Get_AssetChanged(duk_context* ctx)
 {
     IAssetStorage* thisObj = GetThisWeakObject<IAssetStorage>(ctx);
-    SignalWrapper_IAssetStorage_AssetChanged* wrapper = new SignalWrapper_IAssetStorage_AssetChanged(thisObj, &thisObj->AssetChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAssetChanged")) return 1;
+    SignalWrapper_IAssetStorage_AssetChanged* wrapper = new (ctx) SignalWrapper_IAssetStorage_AssetChanged(thisObj, &thisObj->AssetChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_IAssetStorage_AssetChanged_ID, SignalWrapper_IAssetStorage_AssetChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_IAssetStorage_AssetChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -119,8 +117,15 @@ static duk_ret_t IAssetStorage_Get_AssetChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_IAssetStorage_AssetChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_IAssetStorage_AssetChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_IAssetStorage_AssetChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_IAssetStorage_AssetChanged_Emit, 4);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAssetChanged");
     return 1;
 }
 
@@ -112,16 +112,10 @@ public:
     void OnSignal(IAssetTransfer * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -133,6 +127,7 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Downloaded_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_IAssetTransfer_Downloaded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetTransfer_Downloaded* wrapper = GetThisValueObject<SignalWrapper_IAssetTransfer_Downloaded>(ctx, SignalWrapper_IAssetTransfer_Downloaded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -150,6 +145,7 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Downloaded_Connect(duk_context* ct
 
 static duk_ret_t SignalWrapper_IAssetTransfer_Downloaded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetTransfer_Downloaded* wrapper = GetThisValueObject<SignalWrapper_IAssetTransfer_Downloaded>(ctx, SignalWrapper_IAssetTransfer_Downloaded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -158,6 +154,7 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Downloaded_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_IAssetTransfer_Downloaded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetTransfer_Downloaded* wrapper = GetThisValueObject<SignalWrapper_IAssetTransfer_Downloaded>(ctx, SignalWrapper_IAssetTransfer_Downloaded_ID);
     if (!wrapper->owner_) return 0;
     IAssetTransfer* param0 = GetWeakObject<IAssetTransfer>(ctx, 0);
@@ -168,7 +165,8 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Downloaded_Emit(duk_context* ctx)
 static duk_ret_t IAssetTransfer_Get_Downloaded(duk_context* ctx)
 {
     IAssetTransfer* thisObj = GetThisWeakObject<IAssetTransfer>(ctx);
-    SignalWrapper_IAssetTransfer_Downloaded* wrapper = new SignalWrapper_IAssetTransfer_Downloaded(thisObj, &thisObj->Downloaded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalDownloaded")) return 1;
+    SignalWrapper_IAssetTransfer_Downloaded* wrapper = new (ctx) SignalWrapper_IAssetTransfer_Downloaded(thisObj, &thisObj->Downloaded);
     PushValueObject(ctx, wrapper, SignalWrapper_IAssetTransfer_Downloaded_ID, SignalWrapper_IAssetTransfer_Downloaded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Downloaded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -178,8 +176,15 @@ static duk_ret_t IAssetTransfer_Get_Downloaded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Downloaded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Downloaded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Downloaded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Downloaded_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalDownloaded");
     return 1;
 }
 
@@ -204,16 +209,10 @@ public:
     void OnSignal(AssetPtr param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0.Get());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -225,6 +224,7 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Succeeded_Finalizer(duk_context* c
 
 static duk_ret_t SignalWrapper_IAssetTransfer_Succeeded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetTransfer_Succeeded* wrapper = GetThisValueObject<SignalWrapper_IAssetTransfer_Succeeded>(ctx, SignalWrapper_IAssetTransfer_Succeeded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -242,6 +242,7 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Succeeded_Connect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_IAssetTransfer_Succeeded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetTransfer_Succeeded* wrapper = GetThisValueObject<SignalWrapper_IAssetTransfer_Succeeded>(ctx, SignalWrapper_IAssetTransfer_Succeeded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -250,6 +251,7 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Succeeded_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_IAssetTransfer_Succeeded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetTransfer_Succeeded* wrapper = GetThisValueObject<SignalWrapper_IAssetTransfer_Succeeded>(ctx, SignalWrapper_IAssetTransfer_Succeeded_ID);
     if (!wrapper->owner_) return 0;
     SharedPtr<IAsset> param0(GetWeakObject<IAsset>(ctx, 0));
@@ -260,7 +262,8 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Succeeded_Emit(duk_context* ctx)
 static duk_ret_t IAssetTransfer_Get_Succeeded(duk_context* ctx)
 {
     IAssetTransfer* thisObj = GetThisWeakObject<IAssetTransfer>(ctx);
-    SignalWrapper_IAssetTransfer_Succeeded* wrapper = new SignalWrapper_IAssetTransfer_Succeeded(thisObj, &thisObj->Succeeded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalSucceeded")) return 1;
+    SignalWrapper_IAssetTransfer_Succeeded* wrapper = new (ctx) SignalWrapper_IAssetTransfer_Succeeded(thisObj, &thisObj->Succeeded);
     PushValueObject(ctx, wrapper, SignalWrapper_IAssetTransfer_Succeeded_ID, SignalWrapper_IAssetTransfer_Succeeded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Succeeded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -270,8 +273,15 @@ static duk_ret_t IAssetTransfer_Get_Succeeded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Succeeded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Succeeded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Succeeded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Succeeded_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalSucceeded");
     return 1;
 }
 
@@ -296,18 +306,12 @@ public:
     void OnSignal(IAssetTransfer * param0, String param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -319,6 +323,7 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Failed_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAssetTransfer_Failed_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetTransfer_Failed* wrapper = GetThisValueObject<SignalWrapper_IAssetTransfer_Failed>(ctx, SignalWrapper_IAssetTransfer_Failed_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -336,6 +341,7 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Failed_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_IAssetTransfer_Failed_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetTransfer_Failed* wrapper = GetThisValueObject<SignalWrapper_IAssetTransfer_Failed>(ctx, SignalWrapper_IAssetTransfer_Failed_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -344,6 +350,7 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Failed_Disconnect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_IAssetTransfer_Failed_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_IAssetTransfer_Failed* wrapper = GetThisValueObject<SignalWrapper_IAssetTransfer_Failed>(ctx, SignalWrapper_IAssetTransfer_Failed_ID);
     if (!wrapper->owner_) return 0;
     IAssetTransfer* param0 = GetWeakObject<IAssetTransfer>(ctx, 0);
@@ -355,7 +362,8 @@ static duk_ret_t SignalWrapper_IAssetTransfer_Failed_Emit(duk_context* ctx)
 static duk_ret_t IAssetTransfer_Get_Failed(duk_context* ctx)
 {
     IAssetTransfer* thisObj = GetThisWeakObject<IAssetTransfer>(ctx);
-    SignalWrapper_IAssetTransfer_Failed* wrapper = new SignalWrapper_IAssetTransfer_Failed(thisObj, &thisObj->Failed);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalFailed")) return 1;
+    SignalWrapper_IAssetTransfer_Failed* wrapper = new (ctx) SignalWrapper_IAssetTransfer_Failed(thisObj, &thisObj->Failed);
     PushValueObject(ctx, wrapper, SignalWrapper_IAssetTransfer_Failed_ID, SignalWrapper_IAssetTransfer_Failed_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Failed_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -365,8 +373,15 @@ static duk_ret_t IAssetTransfer_Get_Failed(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Failed_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Failed_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Failed_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_IAssetTransfer_Failed_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalFailed");
     return 1;
 }
 
@@ -46,16 +46,10 @@ public:
     void OnSignal(KeyEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -67,6 +61,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyEventReceived_Finalizer(duk_conte
 
 static duk_ret_t SignalWrapper_InputContext_KeyEventReceived_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyEventReceived* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyEventReceived>(ctx, SignalWrapper_InputContext_KeyEventReceived_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -84,6 +79,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyEventReceived_Connect(duk_context
 
 static duk_ret_t SignalWrapper_InputContext_KeyEventReceived_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyEventReceived* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyEventReceived>(ctx, SignalWrapper_InputContext_KeyEventReceived_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -92,6 +88,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyEventReceived_Disconnect(duk_cont
 
 static duk_ret_t SignalWrapper_InputContext_KeyEventReceived_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyEventReceived* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyEventReceived>(ctx, SignalWrapper_InputContext_KeyEventReceived_ID);
     if (!wrapper->owner_) return 0;
     KeyEvent* param0 = GetWeakObject<KeyEvent>(ctx, 0);
@@ -102,7 +99,8 @@ static duk_ret_t SignalWrapper_InputContext_KeyEventReceived_Emit(duk_context* c
 static duk_ret_t InputContext_Get_KeyEventReceived(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_KeyEventReceived* wrapper = new SignalWrapper_InputContext_KeyEventReceived(thisObj, &thisObj->KeyEventReceived);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalKeyEventReceived")) return 1;
+    SignalWrapper_InputContext_KeyEventReceived* wrapper = new (ctx) SignalWrapper_InputContext_KeyEventReceived(thisObj, &thisObj->KeyEventReceived);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_KeyEventReceived_ID, SignalWrapper_InputContext_KeyEventReceived_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyEventReceived_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -112,8 +110,15 @@ static duk_ret_t InputContext_Get_KeyEventReceived(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyEventReceived_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_KeyEventReceived_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_KeyEventReceived_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyEventReceived_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalKeyEventReceived");
     return 1;
 }
 
@@ -138,16 +143,10 @@ public:
     void OnSignal(MouseEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -159,6 +158,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseEventReceived_Finalizer(duk_con
 
 static duk_ret_t SignalWrapper_InputContext_MouseEventReceived_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseEventReceived* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseEventReceived>(ctx, SignalWrapper_InputContext_MouseEventReceived_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -176,6 +176,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseEventReceived_Connect(duk_conte
 
 static duk_ret_t SignalWrapper_InputContext_MouseEventReceived_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseEventReceived* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseEventReceived>(ctx, SignalWrapper_InputContext_MouseEventReceived_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -184,6 +185,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseEventReceived_Disconnect(duk_co
 
 static duk_ret_t SignalWrapper_InputContext_MouseEventReceived_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseEventReceived* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseEventReceived>(ctx, SignalWrapper_InputContext_MouseEventReceived_ID);
     if (!wrapper->owner_) return 0;
     MouseEvent* param0 = GetWeakObject<MouseEvent>(ctx, 0);
@@ -194,7 +196,8 @@ static duk_ret_t SignalWrapper_InputContext_MouseEventReceived_Emit(duk_context*
 static duk_ret_t InputContext_Get_MouseEventReceived(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_MouseEventReceived* wrapper = new SignalWrapper_InputContext_MouseEventReceived(thisObj, &thisObj->MouseEventReceived);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMouseEventReceived")) return 1;
+    SignalWrapper_InputContext_MouseEventReceived* wrapper = new (ctx) SignalWrapper_InputContext_MouseEventReceived(thisObj, &thisObj->MouseEventReceived);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_MouseEventReceived_ID, SignalWrapper_InputContext_MouseEventReceived_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseEventReceived_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -204,8 +207,15 @@ static duk_ret_t InputContext_Get_MouseEventReceived(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseEventReceived_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseEventReceived_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseEventReceived_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseEventReceived_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMouseEventReceived");
     return 1;
 }
 
@@ -230,16 +240,10 @@ public:
     void OnSignal(KeyEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -251,6 +255,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyPressed_Finalizer(duk_context* ct
 
 static duk_ret_t SignalWrapper_InputContext_KeyPressed_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyPressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyPressed>(ctx, SignalWrapper_InputContext_KeyPressed_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -268,6 +273,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyPressed_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_InputContext_KeyPressed_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyPressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyPressed>(ctx, SignalWrapper_InputContext_KeyPressed_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -276,6 +282,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyPressed_Disconnect(duk_context* c
 
 static duk_ret_t SignalWrapper_InputContext_KeyPressed_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyPressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyPressed>(ctx, SignalWrapper_InputContext_KeyPressed_ID);
     if (!wrapper->owner_) return 0;
     KeyEvent* param0 = GetWeakObject<KeyEvent>(ctx, 0);
@@ -286,7 +293,8 @@ static duk_ret_t SignalWrapper_InputContext_KeyPressed_Emit(duk_context* ctx)
 static duk_ret_t InputContext_Get_KeyPressed(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_KeyPressed* wrapper = new SignalWrapper_InputContext_KeyPressed(thisObj, &thisObj->KeyPressed);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalKeyPressed")) return 1;
+    SignalWrapper_InputContext_KeyPressed* wrapper = new (ctx) SignalWrapper_InputContext_KeyPressed(thisObj, &thisObj->KeyPressed);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_KeyPressed_ID, SignalWrapper_InputContext_KeyPressed_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyPressed_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -296,8 +304,15 @@ static duk_ret_t InputContext_Get_KeyPressed(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyPressed_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_KeyPressed_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_KeyPressed_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyPressed_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalKeyPressed");
     return 1;
 }
 
@@ -322,16 +337,10 @@ public:
     void OnSignal(KeyEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -343,6 +352,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyDown_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_InputContext_KeyDown_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyDown* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyDown>(ctx, SignalWrapper_InputContext_KeyDown_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -360,6 +370,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyDown_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_InputContext_KeyDown_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyDown* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyDown>(ctx, SignalWrapper_InputContext_KeyDown_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -368,6 +379,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyDown_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_InputContext_KeyDown_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyDown* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyDown>(ctx, SignalWrapper_InputContext_KeyDown_ID);
     if (!wrapper->owner_) return 0;
     KeyEvent* param0 = GetWeakObject<KeyEvent>(ctx, 0);
@@ -378,7 +390,8 @@ static duk_ret_t SignalWrapper_InputContext_KeyDown_Emit(duk_context* ctx)
 static duk_ret_t InputContext_Get_KeyDown(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_KeyDown* wrapper = new SignalWrapper_InputContext_KeyDown(thisObj, &thisObj->KeyDown);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalKeyDown")) return 1;
+    SignalWrapper_InputContext_KeyDown* wrapper = new (ctx) SignalWrapper_InputContext_KeyDown(thisObj, &thisObj->KeyDown);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_KeyDown_ID, SignalWrapper_InputContext_KeyDown_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyDown_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -388,8 +401,15 @@ static duk_ret_t InputContext_Get_KeyDown(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyDown_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_KeyDown_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_KeyDown_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyDown_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalKeyDown");
     return 1;
 }
 
@@ -414,16 +434,10 @@ public:
     void OnSignal(KeyEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -435,6 +449,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyReleased_Finalizer(duk_context* c
 
 static duk_ret_t SignalWrapper_InputContext_KeyReleased_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyReleased>(ctx, SignalWrapper_InputContext_KeyReleased_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -452,6 +467,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyReleased_Connect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_InputContext_KeyReleased_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyReleased>(ctx, SignalWrapper_InputContext_KeyReleased_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -460,6 +476,7 @@ static duk_ret_t SignalWrapper_InputContext_KeyReleased_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_InputContext_KeyReleased_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_KeyReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_KeyReleased>(ctx, SignalWrapper_InputContext_KeyReleased_ID);
     if (!wrapper->owner_) return 0;
     KeyEvent* param0 = GetWeakObject<KeyEvent>(ctx, 0);
@@ -470,7 +487,8 @@ static duk_ret_t SignalWrapper_InputContext_KeyReleased_Emit(duk_context* ctx)
 static duk_ret_t InputContext_Get_KeyReleased(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_KeyReleased* wrapper = new SignalWrapper_InputContext_KeyReleased(thisObj, &thisObj->KeyReleased);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalKeyReleased")) return 1;
+    SignalWrapper_InputContext_KeyReleased* wrapper = new (ctx) SignalWrapper_InputContext_KeyReleased(thisObj, &thisObj->KeyReleased);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_KeyReleased_ID, SignalWrapper_InputContext_KeyReleased_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyReleased_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -480,8 +498,15 @@ static duk_ret_t InputContext_Get_KeyReleased(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyReleased_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_KeyReleased_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_KeyReleased_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_KeyReleased_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalKeyReleased");
     return 1;
 }
 
@@ -506,16 +531,10 @@ public:
     void OnSignal(MouseEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -527,6 +546,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseMove_Finalizer(duk_context* ctx
 
 static duk_ret_t SignalWrapper_InputContext_MouseMove_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseMove* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseMove>(ctx, SignalWrapper_InputContext_MouseMove_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -544,6 +564,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseMove_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_InputContext_MouseMove_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseMove* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseMove>(ctx, SignalWrapper_InputContext_MouseMove_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -552,6 +573,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseMove_Disconnect(duk_context* ct
 
 static duk_ret_t SignalWrapper_InputContext_MouseMove_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseMove* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseMove>(ctx, SignalWrapper_InputContext_MouseMove_ID);
     if (!wrapper->owner_) return 0;
     MouseEvent* param0 = GetWeakObject<MouseEvent>(ctx, 0);
@@ -562,7 +584,8 @@ static duk_ret_t SignalWrapper_InputContext_MouseMove_Emit(duk_context* ctx)
 static duk_ret_t InputContext_Get_MouseMove(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_MouseMove* wrapper = new SignalWrapper_InputContext_MouseMove(thisObj, &thisObj->MouseMove);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMouseMove")) return 1;
+    SignalWrapper_InputContext_MouseMove* wrapper = new (ctx) SignalWrapper_InputContext_MouseMove(thisObj, &thisObj->MouseMove);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_MouseMove_ID, SignalWrapper_InputContext_MouseMove_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMove_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -572,8 +595,15 @@ static duk_ret_t InputContext_Get_MouseMove(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMove_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMove_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMove_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMove_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMouseMove");
     return 1;
 }
 
@@ -598,16 +628,10 @@ public:
     void OnSignal(MouseEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -619,6 +643,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseScroll_Finalizer(duk_context* c
 
 static duk_ret_t SignalWrapper_InputContext_MouseScroll_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseScroll* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseScroll>(ctx, SignalWrapper_InputContext_MouseScroll_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -636,6 +661,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseScroll_Connect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_InputContext_MouseScroll_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseScroll* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseScroll>(ctx, SignalWrapper_InputContext_MouseScroll_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -644,6 +670,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseScroll_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_InputContext_MouseScroll_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseScroll* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseScroll>(ctx, SignalWrapper_InputContext_MouseScroll_ID);
     if (!wrapper->owner_) return 0;
     MouseEvent* param0 = GetWeakObject<MouseEvent>(ctx, 0);
@@ -654,7 +681,8 @@ static duk_ret_t SignalWrapper_InputContext_MouseScroll_Emit(duk_context* ctx)
 static duk_ret_t InputContext_Get_MouseScroll(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_MouseScroll* wrapper = new SignalWrapper_InputContext_MouseScroll(thisObj, &thisObj->MouseScroll);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMouseScroll")) return 1;
+    SignalWrapper_InputContext_MouseScroll* wrapper = new (ctx) SignalWrapper_InputContext_MouseScroll(thisObj, &thisObj->MouseScroll);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_MouseScroll_ID, SignalWrapper_InputContext_MouseScroll_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseScroll_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -664,8 +692,15 @@ static duk_ret_t InputContext_Get_MouseScroll(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseScroll_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseScroll_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseScroll_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseScroll_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMouseScroll");
     return 1;
 }
 
@@ -690,16 +725,10 @@ public:
     void OnSignal(MouseEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -711,6 +740,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseDoubleClicked_Finalizer(duk_con
 
 static duk_ret_t SignalWrapper_InputContext_MouseDoubleClicked_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseDoubleClicked* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseDoubleClicked>(ctx, SignalWrapper_InputContext_MouseDoubleClicked_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -728,6 +758,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseDoubleClicked_Connect(duk_conte
 
 static duk_ret_t SignalWrapper_InputContext_MouseDoubleClicked_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseDoubleClicked* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseDoubleClicked>(ctx, SignalWrapper_InputContext_MouseDoubleClicked_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -736,6 +767,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseDoubleClicked_Disconnect(duk_co
 
 static duk_ret_t SignalWrapper_InputContext_MouseDoubleClicked_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseDoubleClicked* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseDoubleClicked>(ctx, SignalWrapper_InputContext_MouseDoubleClicked_ID);
     if (!wrapper->owner_) return 0;
     MouseEvent* param0 = GetWeakObject<MouseEvent>(ctx, 0);
@@ -746,7 +778,8 @@ static duk_ret_t SignalWrapper_InputContext_MouseDoubleClicked_Emit(duk_context*
 static duk_ret_t InputContext_Get_MouseDoubleClicked(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_MouseDoubleClicked* wrapper = new SignalWrapper_InputContext_MouseDoubleClicked(thisObj, &thisObj->MouseDoubleClicked);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMouseDoubleClicked")) return 1;
+    SignalWrapper_InputContext_MouseDoubleClicked* wrapper = new (ctx) SignalWrapper_InputContext_MouseDoubleClicked(thisObj, &thisObj->MouseDoubleClicked);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_MouseDoubleClicked_ID, SignalWrapper_InputContext_MouseDoubleClicked_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseDoubleClicked_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -756,8 +789,15 @@ static duk_ret_t InputContext_Get_MouseDoubleClicked(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseDoubleClicked_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseDoubleClicked_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseDoubleClicked_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseDoubleClicked_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMouseDoubleClicked");
     return 1;
 }
 
@@ -782,16 +822,10 @@ public:
     void OnSignal(MouseEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -803,6 +837,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseLeftPressed_Finalizer(duk_conte
 
 static duk_ret_t SignalWrapper_InputContext_MouseLeftPressed_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseLeftPressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseLeftPressed>(ctx, SignalWrapper_InputContext_MouseLeftPressed_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -820,6 +855,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseLeftPressed_Connect(duk_context
 
 static duk_ret_t SignalWrapper_InputContext_MouseLeftPressed_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseLeftPressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseLeftPressed>(ctx, SignalWrapper_InputContext_MouseLeftPressed_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -828,6 +864,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseLeftPressed_Disconnect(duk_cont
 
 static duk_ret_t SignalWrapper_InputContext_MouseLeftPressed_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseLeftPressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseLeftPressed>(ctx, SignalWrapper_InputContext_MouseLeftPressed_ID);
     if (!wrapper->owner_) return 0;
     MouseEvent* param0 = GetWeakObject<MouseEvent>(ctx, 0);
@@ -838,7 +875,8 @@ static duk_ret_t SignalWrapper_InputContext_MouseLeftPressed_Emit(duk_context* c
 static duk_ret_t InputContext_Get_MouseLeftPressed(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_MouseLeftPressed* wrapper = new SignalWrapper_InputContext_MouseLeftPressed(thisObj, &thisObj->MouseLeftPressed);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMouseLeftPressed")) return 1;
+    SignalWrapper_InputContext_MouseLeftPressed* wrapper = new (ctx) SignalWrapper_InputContext_MouseLeftPressed(thisObj, &thisObj->MouseLeftPressed);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_MouseLeftPressed_ID, SignalWrapper_InputContext_MouseLeftPressed_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseLeftPressed_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -848,8 +886,15 @@ static duk_ret_t InputContext_Get_MouseLeftPressed(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseLeftPressed_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseLeftPressed_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseLeftPressed_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseLeftPressed_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMouseLeftPressed");
     return 1;
 }
 
@@ -874,16 +919,10 @@ public:
     void OnSignal(MouseEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -895,6 +934,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseMiddlePressed_Finalizer(duk_con
 
 static duk_ret_t SignalWrapper_InputContext_MouseMiddlePressed_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseMiddlePressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseMiddlePressed>(ctx, SignalWrapper_InputContext_MouseMiddlePressed_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -912,6 +952,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseMiddlePressed_Connect(duk_conte
 
 static duk_ret_t SignalWrapper_InputContext_MouseMiddlePressed_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseMiddlePressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseMiddlePressed>(ctx, SignalWrapper_InputContext_MouseMiddlePressed_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -920,6 +961,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseMiddlePressed_Disconnect(duk_co
 
 static duk_ret_t SignalWrapper_InputContext_MouseMiddlePressed_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseMiddlePressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseMiddlePressed>(ctx, SignalWrapper_InputContext_MouseMiddlePressed_ID);
     if (!wrapper->owner_) return 0;
     MouseEvent* param0 = GetWeakObject<MouseEvent>(ctx, 0);
@@ -930,7 +972,8 @@ static duk_ret_t SignalWrapper_InputContext_MouseMiddlePressed_Emit(duk_context*
 static duk_ret_t InputContext_Get_MouseMiddlePressed(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_MouseMiddlePressed* wrapper = new SignalWrapper_InputContext_MouseMiddlePressed(thisObj, &thisObj->MouseMiddlePressed);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMouseMiddlePressed")) return 1;
+    SignalWrapper_InputContext_MouseMiddlePressed* wrapper = new (ctx) SignalWrapper_InputContext_MouseMiddlePressed(thisObj, &thisObj->MouseMiddlePressed);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_MouseMiddlePressed_ID, SignalWrapper_InputContext_MouseMiddlePressed_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMiddlePressed_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -940,8 +983,15 @@ static duk_ret_t InputContext_Get_MouseMiddlePressed(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMiddlePressed_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMiddlePressed_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMiddlePressed_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMiddlePressed_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMouseMiddlePressed");
     return 1;
 }
 
@@ -966,16 +1016,10 @@ public:
     void OnSignal(MouseEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -987,6 +1031,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseRightPressed_Finalizer(duk_cont
 
 static duk_ret_t SignalWrapper_InputContext_MouseRightPressed_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseRightPressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseRightPressed>(ctx, SignalWrapper_InputContext_MouseRightPressed_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -1004,6 +1049,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseRightPressed_Connect(duk_contex
 
 static duk_ret_t SignalWrapper_InputContext_MouseRightPressed_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseRightPressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseRightPressed>(ctx, SignalWrapper_InputContext_MouseRightPressed_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -1012,6 +1058,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseRightPressed_Disconnect(duk_con
 
 static duk_ret_t SignalWrapper_InputContext_MouseRightPressed_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseRightPressed* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseRightPressed>(ctx, SignalWrapper_InputContext_MouseRightPressed_ID);
     if (!wrapper->owner_) return 0;
     MouseEvent* param0 = GetWeakObject<MouseEvent>(ctx, 0);
@@ -1022,7 +1069,8 @@ static duk_ret_t SignalWrapper_InputContext_MouseRightPressed_Emit(duk_context*
 static duk_ret_t InputContext_Get_MouseRightPressed(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_MouseRightPressed* wrapper = new SignalWrapper_InputContext_MouseRightPressed(thisObj, &thisObj->MouseRightPressed);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMouseRightPressed")) return 1;
+    SignalWrapper_InputContext_MouseRightPressed* wrapper = new (ctx) SignalWrapper_InputContext_MouseRightPressed(thisObj, &thisObj->MouseRightPressed);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_MouseRightPressed_ID, SignalWrapper_InputContext_MouseRightPressed_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseRightPressed_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -1032,8 +1080,15 @@ static duk_ret_t InputContext_Get_MouseRightPressed(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseRightPressed_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseRightPressed_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseRightPressed_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseRightPressed_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMouseRightPressed");
     return 1;
 }
 
@@ -1058,16 +1113,10 @@ public:
     void OnSignal(MouseEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -1079,6 +1128,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseLeftReleased_Finalizer(duk_cont
 
 static duk_ret_t SignalWrapper_InputContext_MouseLeftReleased_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseLeftReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseLeftReleased>(ctx, SignalWrapper_InputContext_MouseLeftReleased_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -1096,6 +1146,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseLeftReleased_Connect(duk_contex
 
 static duk_ret_t SignalWrapper_InputContext_MouseLeftReleased_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseLeftReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseLeftReleased>(ctx, SignalWrapper_InputContext_MouseLeftReleased_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -1104,6 +1155,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseLeftReleased_Disconnect(duk_con
 
 static duk_ret_t SignalWrapper_InputContext_MouseLeftReleased_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseLeftReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseLeftReleased>(ctx, SignalWrapper_InputContext_MouseLeftReleased_ID);
     if (!wrapper->owner_) return 0;
     MouseEvent* param0 = GetWeakObject<MouseEvent>(ctx, 0);
@@ -1114,7 +1166,8 @@ static duk_ret_t SignalWrapper_InputContext_MouseLeftReleased_Emit(duk_context*
 static duk_ret_t InputContext_Get_MouseLeftReleased(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_MouseLeftReleased* wrapper = new SignalWrapper_InputContext_MouseLeftReleased(thisObj, &thisObj->MouseLeftReleased);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMouseLeftReleased")) return 1;
+    SignalWrapper_InputContext_MouseLeftReleased* wrapper = new (ctx) SignalWrapper_InputContext_MouseLeftReleased(thisObj, &thisObj->MouseLeftReleased);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_MouseLeftReleased_ID, SignalWrapper_InputContext_MouseLeftReleased_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseLeftReleased_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -1124,8 +1177,15 @@ static duk_ret_t InputContext_Get_MouseLeftReleased(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseLeftReleased_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseLeftReleased_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseLeftReleased_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseLeftReleased_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMouseLeftReleased");
     return 1;
 }
 
@@ -1150,16 +1210,10 @@ public:
     void OnSignal(MouseEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -1171,6 +1225,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseMiddleReleased_Finalizer(duk_co
 
 static duk_ret_t SignalWrapper_InputContext_MouseMiddleReleased_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseMiddleReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseMiddleReleased>(ctx, SignalWrapper_InputContext_MouseMiddleReleased_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -1188,6 +1243,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseMiddleReleased_Connect(duk_cont
 
 static duk_ret_t SignalWrapper_InputContext_MouseMiddleReleased_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseMiddleReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseMiddleReleased>(ctx, SignalWrapper_InputContext_MouseMiddleReleased_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -1196,6 +1252,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseMiddleReleased_Disconnect(duk_c
 
 static duk_ret_t SignalWrapper_InputContext_MouseMiddleReleased_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseMiddleReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseMiddleReleased>(ctx, SignalWrapper_InputContext_MouseMiddleReleased_ID);
     if (!wrapper->owner_) return 0;
     MouseEvent* param0 = GetWeakObject<MouseEvent>(ctx, 0);
@@ -1206,7 +1263,8 @@ static duk_ret_t SignalWrapper_InputContext_MouseMiddleReleased_Emit(duk_context
 static duk_ret_t InputContext_Get_MouseMiddleReleased(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_MouseMiddleReleased* wrapper = new SignalWrapper_InputContext_MouseMiddleReleased(thisObj, &thisObj->MouseMiddleReleased);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMouseMiddleReleased")) return 1;
+    SignalWrapper_InputContext_MouseMiddleReleased* wrapper = new (ctx) SignalWrapper_InputContext_MouseMiddleReleased(thisObj, &thisObj->MouseMiddleReleased);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_MouseMiddleReleased_ID, SignalWrapper_InputContext_MouseMiddleReleased_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMiddleReleased_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -1216,8 +1274,15 @@ static duk_ret_t InputContext_Get_MouseMiddleReleased(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMiddleReleased_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMiddleReleased_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMiddleReleased_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseMiddleReleased_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMouseMiddleReleased");
     return 1;
 }
 
@@ -1242,16 +1307,10 @@ public:
     void OnSignal(MouseEvent * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -1263,6 +1322,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseRightReleased_Finalizer(duk_con
 
 static duk_ret_t SignalWrapper_InputContext_MouseRightReleased_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseRightReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseRightReleased>(ctx, SignalWrapper_InputContext_MouseRightReleased_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -1280,6 +1340,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseRightReleased_Connect(duk_conte
 
 static duk_ret_t SignalWrapper_InputContext_MouseRightReleased_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseRightReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseRightReleased>(ctx, SignalWrapper_InputContext_MouseRightReleased_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -1288,6 +1349,7 @@ static duk_ret_t SignalWrapper_InputContext_MouseRightReleased_Disconnect(duk_co
 
 static duk_ret_t SignalWrapper_InputContext_MouseRightReleased_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_InputContext_MouseRightReleased* wrapper = GetThisValueObject<SignalWrapper_InputContext_MouseRightReleased>(ctx, SignalWrapper_InputContext_MouseRightReleased_ID);
     if (!wrapper->owner_) return 0;
     MouseEvent* param0 = GetWeakObject<MouseEvent>(ctx, 0);
@@ -1298,7 +1360,8 @@ static duk_ret_t SignalWrapper_InputContext_MouseRightReleased_Emit(duk_context*
 static duk_ret_t InputContext_Get_MouseRightReleased(duk_context* ctx)
 {
     InputContext* thisObj = GetThisWeakObject<InputContext>(ctx);
-    SignalWrapper_InputContext_MouseRightReleased* wrapper = new SignalWrapper_InputContext_MouseRightReleased(thisObj, &thisObj->MouseRightReleased);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMouseRightReleased")) return 1;
+    SignalWrapper_InputContext_MouseRightReleased* wrapper = new (ctx) SignalWrapper_InputContext_MouseRightReleased(thisObj, &thisObj->MouseRightReleased);
     PushValueObject(ctx, wrapper, SignalWrapper_InputContext_MouseRightReleased_ID, SignalWrapper_InputContext_MouseRightReleased_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseRightReleased_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -1308,8 +1371,15 @@ static duk_ret_t InputContext_Get_MouseRightReleased(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseRightReleased_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseRightReleased_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_InputContext_MouseRightReleased_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_InputContext_MouseRightReleased_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMouseRightReleased");
     return 1;
 }
 
@@ -47,18 +47,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -70,6 +64,7 @@ static duk_ret_t SignalWrapper_Name_ComponentNameChanged_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_Name_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Name_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Name_ComponentNameChanged>(ctx, SignalWrapper_Name_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -87,6 +82,7 @@ static duk_ret_t SignalWrapper_Name_ComponentNameChanged_Connect(duk_context* ct
 
 static duk_ret_t SignalWrapper_Name_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Name_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Name_ComponentNameChanged>(ctx, SignalWrapper_Name_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -95,6 +91,7 @@ static duk_ret_t SignalWrapper_Name_ComponentNameChanged_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_Name_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Name_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Name_ComponentNameChanged>(ctx, SignalWrapper_Name_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -106,7 +103,8 @@ static duk_ret_t SignalWrapper_Name_ComponentNameChanged_Emit(duk_context* ctx)
 static duk_ret_t Name_Get_ComponentNameChanged(duk_context* ctx)
 {
     Name* thisObj = GetThisWeakObject<Name>(ctx);
-    SignalWrapper_Name_ComponentNameChanged* wrapper = new SignalWrapper_Name_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_Name_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_Name_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Name_ComponentNameChanged_ID, SignalWrapper_Name_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Name_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -116,8 +114,15 @@ static duk_ret_t Name_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Name_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Name_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Name_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Name_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -142,14 +147,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -161,6 +160,7 @@ static duk_ret_t SignalWrapper_Name_ParentEntitySet_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Name_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Name_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Name_ParentEntitySet>(ctx, SignalWrapper_Name_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -178,6 +178,7 @@ static duk_ret_t SignalWrapper_Name_ParentEntitySet_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Name_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Name_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Name_ParentEntitySet>(ctx, SignalWrapper_Name_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -186,6 +187,7 @@ static duk_ret_t SignalWrapper_Name_ParentEntitySet_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Name_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Name_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Name_ParentEntitySet>(ctx, SignalWrapper_Name_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -195,7 +197,8 @@ static duk_ret_t SignalWrapper_Name_ParentEntitySet_Emit(duk_context* ctx)
 static duk_ret_t Name_Get_ParentEntitySet(duk_context* ctx)
 {
     Name* thisObj = GetThisWeakObject<Name>(ctx);
-    SignalWrapper_Name_ParentEntitySet* wrapper = new SignalWrapper_Name_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_Name_ParentEntitySet* wrapper = new (ctx) SignalWrapper_Name_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_Name_ParentEntitySet_ID, SignalWrapper_Name_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Name_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -205,8 +208,15 @@ static duk_ret_t Name_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Name_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Name_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Name_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Name_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -231,14 +241,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -250,6 +254,7 @@ static duk_ret_t SignalWrapper_Name_ParentEntityAboutToBeDetached_Finalizer(duk_
 
 static duk_ret_t SignalWrapper_Name_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Name_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Name_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Name_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -267,6 +272,7 @@ static duk_ret_t SignalWrapper_Name_ParentEntityAboutToBeDetached_Connect(duk_co
 
 static duk_ret_t SignalWrapper_Name_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Name_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Name_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Name_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -275,6 +281,7 @@ static duk_ret_t SignalWrapper_Name_ParentEntityAboutToBeDetached_Disconnect(duk
 
 static duk_ret_t SignalWrapper_Name_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Name_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Name_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Name_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -284,7 +291,8 @@ static duk_ret_t SignalWrapper_Name_ParentEntityAboutToBeDetached_Emit(duk_conte
 static duk_ret_t Name_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     Name* thisObj = GetThisWeakObject<Name>(ctx);
-    SignalWrapper_Name_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_Name_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_Name_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_Name_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_Name_ParentEntityAboutToBeDetached_ID, SignalWrapper_Name_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Name_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -294,8 +302,15 @@ static duk_ret_t Name_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Name_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Name_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Name_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Name_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
@@ -61,7 +61,7 @@ static duk_ret_t Point_Get_y(duk_context* ctx)
 
 static duk_ret_t Point_Ctor(duk_context* ctx)
 {
-    Point* newObj = new Point();
+    Point* newObj = new (ctx) Point();
     PushConstructorResult<Point>(ctx, newObj, Point_ID, Point_Finalizer);
     return 0;
 }
@@ -70,7 +70,7 @@ static duk_ret_t Point_Ctor_int_int(duk_context* ctx)
 {
     int nx = (int)duk_require_number(ctx, 0);
     int ny = (int)duk_require_number(ctx, 1);
-    Point* newObj = new Point(nx, ny);
+    Point* newObj = new (ctx) Point(nx, ny);
     PushConstructorResult<Point>(ctx, newObj, Point_ID, Point_Finalizer);
     return 0;
 }
@@ -182,7 +182,7 @@ static duk_ret_t RayQueryResult_Get_t(duk_context* ctx)
 
 static duk_ret_t RayQueryResult_Ctor(duk_context* ctx)
 {
-    RayQueryResult* newObj = new RayQueryResult();
+    RayQueryResult* newObj = new (ctx) RayQueryResult();
     PushConstructorResult<RayQueryResult>(ctx, newObj, RayQueryResult_ID, RayQueryResult_Finalizer);
     return 0;
 }
@@ -47,18 +47,12 @@ public:
     void OnSignal(Scene * param0, AttributeChange::Type param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -70,6 +64,7 @@ static duk_ret_t SignalWrapper_SceneAPI_SceneCreated_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_SceneAPI_SceneCreated_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneAPI_SceneCreated* wrapper = GetThisValueObject<SignalWrapper_SceneAPI_SceneCreated>(ctx, SignalWrapper_SceneAPI_SceneCreated_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -87,6 +82,7 @@ static duk_ret_t SignalWrapper_SceneAPI_SceneCreated_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_SceneAPI_SceneCreated_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneAPI_SceneCreated* wrapper = GetThisValueObject<SignalWrapper_SceneAPI_SceneCreated>(ctx, SignalWrapper_SceneAPI_SceneCreated_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -95,6 +91,7 @@ static duk_ret_t SignalWrapper_SceneAPI_SceneCreated_Disconnect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_SceneAPI_SceneCreated_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneAPI_SceneCreated* wrapper = GetThisValueObject<SignalWrapper_SceneAPI_SceneCreated>(ctx, SignalWrapper_SceneAPI_SceneCreated_ID);
     if (!wrapper->owner_) return 0;
     Scene* param0 = GetWeakObject<Scene>(ctx, 0);
@@ -106,7 +103,8 @@ static duk_ret_t SignalWrapper_SceneAPI_SceneCreated_Emit(duk_context* ctx)
 static duk_ret_t SceneAPI_Get_SceneCreated(duk_context* ctx)
 {
     SceneAPI* thisObj = GetThisWeakObject<SceneAPI>(ctx);
-    SignalWrapper_SceneAPI_SceneCreated* wrapper = new SignalWrapper_SceneAPI_SceneCreated(thisObj, &thisObj->SceneCreated);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalSceneCreated")) return 1;
+    SignalWrapper_SceneAPI_SceneCreated* wrapper = new (ctx) SignalWrapper_SceneAPI_SceneCreated(thisObj, &thisObj->SceneCreated);
     PushValueObject(ctx, wrapper, SignalWrapper_SceneAPI_SceneCreated_ID, SignalWrapper_SceneAPI_SceneCreated_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_SceneAPI_SceneCreated_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -116,8 +114,15 @@ static duk_ret_t SceneAPI_Get_SceneCreated(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_SceneAPI_SceneCreated_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_SceneAPI_SceneCreated_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_SceneAPI_SceneCreated_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_SceneAPI_SceneCreated_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalSceneCreated");
     return 1;
 }
 
@@ -142,18 +147,12 @@ public:
     void OnSignal(Scene * param0, AttributeChange::Type param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -165,6 +164,7 @@ static duk_ret_t SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Finalizer(duk_cont
 
 static duk_ret_t SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneAPI_SceneAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_SceneAPI_SceneAboutToBeRemoved>(ctx, SignalWrapper_SceneAPI_SceneAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -182,6 +182,7 @@ static duk_ret_t SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Connect(duk_contex
 
 static duk_ret_t SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneAPI_SceneAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_SceneAPI_SceneAboutToBeRemoved>(ctx, SignalWrapper_SceneAPI_SceneAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -190,6 +191,7 @@ static duk_ret_t SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Disconnect(duk_con
 
 static duk_ret_t SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneAPI_SceneAboutToBeRemoved* wrapper = GetThisValueObject<SignalWrapper_SceneAPI_SceneAboutToBeRemoved>(ctx, SignalWrapper_SceneAPI_SceneAboutToBeRemoved_ID);
     if (!wrapper->owner_) return 0;
     Scene* param0 = GetWeakObject<Scene>(ctx, 0);
@@ -201,7 +203,8 @@ static duk_ret_t SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Emit(duk_context*
 static duk_ret_t SceneAPI_Get_SceneAboutToBeRemoved(duk_context* ctx)
 {
     SceneAPI* thisObj = GetThisWeakObject<SceneAPI>(ctx);
-    SignalWrapper_SceneAPI_SceneAboutToBeRemoved* wrapper = new SignalWrapper_SceneAPI_SceneAboutToBeRemoved(thisObj, &thisObj->SceneAboutToBeRemoved);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalSceneAboutToBeRemoved")) return 1;
+    SignalWrapper_SceneAPI_SceneAboutToBeRemoved* wrapper = new (ctx) SignalWrapper_SceneAPI_SceneAboutToBeRemoved(thisObj, &thisObj->SceneAboutToBeRemoved);
     PushValueObject(ctx, wrapper, SignalWrapper_SceneAPI_SceneAboutToBeRemoved_ID, SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -211,8 +214,15 @@ static duk_ret_t SceneAPI_Get_SceneAboutToBeRemoved(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_SceneAPI_SceneAboutToBeRemoved_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalSceneAboutToBeRemoved");
     return 1;
 }
 
@@ -237,10 +247,6 @@ public:
     void OnSignal(u32 param0, const String & param1, AttributeChange::Type param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_number(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -248,9 +254,7 @@ public:
         duk_put_prop_index(ctx, -2, 1);
         duk_push_number(ctx, param2);
         duk_put_prop_index(ctx, -2, 2);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -262,6 +266,7 @@ static duk_ret_t SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Final
 
 static duk_ret_t SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered* wrapper = GetThisValueObject<SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered>(ctx, SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -279,6 +284,7 @@ static duk_ret_t SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Conne
 
 static duk_ret_t SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered* wrapper = GetThisValueObject<SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered>(ctx, SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -287,6 +293,7 @@ static duk_ret_t SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Disco
 
 static duk_ret_t SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered* wrapper = GetThisValueObject<SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered>(ctx, SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_ID);
     if (!wrapper->owner_) return 0;
     u32 param0 = (u32)duk_require_number(ctx, 0);
@@ -299,7 +306,8 @@ static duk_ret_t SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Emit(
 static duk_ret_t SceneAPI_Get_PlaceholderComponentTypeRegistered(duk_context* ctx)
 {
     SceneAPI* thisObj = GetThisWeakObject<SceneAPI>(ctx);
-    SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered* wrapper = new SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered(thisObj, &thisObj->PlaceholderComponentTypeRegistered);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalPlaceholderComponentTypeRegistered")) return 1;
+    SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered* wrapper = new (ctx) SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered(thisObj, &thisObj->PlaceholderComponentTypeRegistered);
     PushValueObject(ctx, wrapper, SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_ID, SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -309,8 +317,15 @@ static duk_ret_t SceneAPI_Get_PlaceholderComponentTypeRegistered(duk_context* ct
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_SceneAPI_PlaceholderComponentTypeRegistered_Emit, 3);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalPlaceholderComponentTypeRegistered");
     return 1;
 }
 
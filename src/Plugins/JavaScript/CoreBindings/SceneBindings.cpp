@@ -54,16 +54,10 @@ public:
     void OnSignal(IComponent * param0, IAttribute * param1, AttributeChange::Type param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -75,6 +69,7 @@ static duk_ret_t SignalWrapper_Scene_AttributeChanged_Finalizer(duk_context* ctx
 
 static duk_ret_t SignalWrapper_Scene_AttributeChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_AttributeChanged* wrapper = GetThisValueObject<SignalWrapper_Scene_AttributeChanged>(ctx, SignalWrapper_Scene_AttributeChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -92,6 +87,7 @@ static duk_ret_t SignalWrapper_Scene_AttributeChanged_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_AttributeChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_AttributeChanged* wrapper = GetThisValueObject<SignalWrapper_Scene_AttributeChanged>(ctx, SignalWrapper_Scene_AttributeChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -101,7 +97,8 @@ static duk_ret_t SignalWrapper_Scene_AttributeChanged_Disconnect(duk_context* ct
 static duk_ret_t Scene_Get_AttributeChanged(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_AttributeChanged* wrapper = new SignalWrapper_Scene_AttributeChanged(thisObj, &thisObj->AttributeChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAttributeChanged")) return 1;
+    SignalWrapper_Scene_AttributeChanged* wrapper = new (ctx) SignalWrapper_Scene_AttributeChanged(thisObj, &thisObj->AttributeChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_AttributeChanged_ID, SignalWrapper_Scene_AttributeChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_AttributeChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -111,6 +108,13 @@ static duk_ret_t Scene_Get_AttributeChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_AttributeChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_AttributeChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_AttributeChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
+    CacheSignalWrapper(ctx, "\xff""signalAttributeChanged");
     return 1;
 }
 
@@ -135,16 +139,10 @@ public:
     void OnSignal(IComponent * param0, IAttribute * param1, AttributeChange::Type param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -156,6 +154,7 @@ static duk_ret_t SignalWrapper_Scene_AttributeAdded_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_AttributeAdded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_AttributeAdded* wrapper = GetThisValueObject<SignalWrapper_Scene_AttributeAdded>(ctx, SignalWrapper_Scene_AttributeAdded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -173,6 +172,7 @@ static duk_ret_t SignalWrapper_Scene_AttributeAdded_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_AttributeAdded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_AttributeAdded* wrapper = GetThisValueObject<SignalWrapper_Scene_AttributeAdded>(ctx, SignalWrapper_Scene_AttributeAdded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -182,7 +182,8 @@ static duk_ret_t SignalWrapper_Scene_AttributeAdded_Disconnect(duk_context* ctx)
 static duk_ret_t Scene_Get_AttributeAdded(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_AttributeAdded* wrapper = new SignalWrapper_Scene_AttributeAdded(thisObj, &thisObj->AttributeAdded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAttributeAdded")) return 1;
+    SignalWrapper_Scene_AttributeAdded* wrapper = new (ctx) SignalWrapper_Scene_AttributeAdded(thisObj, &thisObj->AttributeAdded);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_AttributeAdded_ID, SignalWrapper_Scene_AttributeAdded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_AttributeAdded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -192,6 +193,13 @@ static duk_ret_t Scene_Get_AttributeAdded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_AttributeAdded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_AttributeAdded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_AttributeAdded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
+    CacheSignalWrapper(ctx, "\xff""signalAttributeAdded");
     return 1;
 }
 
@@ -216,16 +224,10 @@ public:
     void OnSignal(IComponent * param0, IAttribute * param1, AttributeChange::Type param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -237,6 +239,7 @@ static duk_ret_t SignalWrapper_Scene_AttributeRemoved_Finalizer(duk_context* ctx
 
 static duk_ret_t SignalWrapper_Scene_AttributeRemoved_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_AttributeRemoved* wrapper = GetThisValueObject<SignalWrapper_Scene_AttributeRemoved>(ctx, SignalWrapper_Scene_AttributeRemoved_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -254,6 +257,7 @@ static duk_ret_t SignalWrapper_Scene_AttributeRemoved_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_AttributeRemoved_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_AttributeRemoved* wrapper = GetThisValueObject<SignalWrapper_Scene_AttributeRemoved>(ctx, SignalWrapper_Scene_AttributeRemoved_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -263,7 +267,8 @@ static duk_ret_t SignalWrapper_Scene_AttributeRemoved_Disconnect(duk_context* ct
 static duk_ret_t Scene_Get_AttributeRemoved(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_AttributeRemoved* wrapper = new SignalWrapper_Scene_AttributeRemoved(thisObj, &thisObj->AttributeRemoved);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAttributeRemoved")) return 1;
+    SignalWrapper_Scene_AttributeRemoved* wrapper = new (ctx) SignalWrapper_Scene_AttributeRemoved(thisObj, &thisObj->AttributeRemoved);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_AttributeRemoved_ID, SignalWrapper_Scene_AttributeRemoved_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_AttributeRemoved_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -273,6 +278,13 @@ static duk_ret_t Scene_Get_AttributeRemoved(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_AttributeRemoved_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_AttributeRemoved_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_AttributeRemoved_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
+    CacheSignalWrapper(ctx, "\xff""signalAttributeRemoved");
     return 1;
 }
 
@@ -297,10 +309,6 @@ public:
     void OnSignal(Entity * param0, IComponent * param1, AttributeChange::Type param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -308,9 +316,7 @@ public:
         duk_put_prop_index(ctx, -2, 1);
         duk_push_number(ctx, param2);
         duk_put_prop_index(ctx, -2, 2);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -322,6 +328,7 @@ static duk_ret_t SignalWrapper_Scene_ComponentAdded_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_ComponentAdded_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ComponentAdded* wrapper = GetThisValueObject<SignalWrapper_Scene_ComponentAdded>(ctx, SignalWrapper_Scene_ComponentAdded_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -339,6 +346,7 @@ static duk_ret_t SignalWrapper_Scene_ComponentAdded_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_ComponentAdded_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ComponentAdded* wrapper = GetThisValueObject<SignalWrapper_Scene_ComponentAdded>(ctx, SignalWrapper_Scene_ComponentAdded_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -347,6 +355,7 @@ static duk_ret_t SignalWrapper_Scene_ComponentAdded_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_ComponentAdded_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ComponentAdded* wrapper = GetThisValueObject<SignalWrapper_Scene_ComponentAdded>(ctx, SignalWrapper_Scene_ComponentAdded_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -359,7 +368,8 @@ static duk_ret_t SignalWrapper_Scene_ComponentAdded_Emit(duk_context* ctx)
 static duk_ret_t Scene_Get_ComponentAdded(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_ComponentAdded* wrapper = new SignalWrapper_Scene_ComponentAdded(thisObj, &thisObj->ComponentAdded);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentAdded")) return 1;
+    SignalWrapper_Scene_ComponentAdded* wrapper = new (ctx) SignalWrapper_Scene_ComponentAdded(thisObj, &thisObj->ComponentAdded);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_ComponentAdded_ID, SignalWrapper_Scene_ComponentAdded_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_ComponentAdded_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -369,8 +379,15 @@ static duk_ret_t Scene_Get_ComponentAdded(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_ComponentAdded_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_ComponentAdded_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_ComponentAdded_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_ComponentAdded_Emit, 3);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentAdded");
     return 1;
 }
 
@@ -395,10 +412,6 @@ public:
     void OnSignal(Entity * param0, IComponent * param1, AttributeChange::Type param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -406,9 +419,7 @@ public:
         duk_put_prop_index(ctx, -2, 1);
         duk_push_number(ctx, param2);
         duk_put_prop_index(ctx, -2, 2);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -420,6 +431,7 @@ static duk_ret_t SignalWrapper_Scene_ComponentRemoved_Finalizer(duk_context* ctx
 
 static duk_ret_t SignalWrapper_Scene_ComponentRemoved_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ComponentRemoved* wrapper = GetThisValueObject<SignalWrapper_Scene_ComponentRemoved>(ctx, SignalWrapper_Scene_ComponentRemoved_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -437,6 +449,7 @@ static duk_ret_t SignalWrapper_Scene_ComponentRemoved_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_ComponentRemoved_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ComponentRemoved* wrapper = GetThisValueObject<SignalWrapper_Scene_ComponentRemoved>(ctx, SignalWrapper_Scene_ComponentRemoved_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -445,6 +458,7 @@ static duk_ret_t SignalWrapper_Scene_ComponentRemoved_Disconnect(duk_context* ct
 
 static duk_ret_t SignalWrapper_Scene_ComponentRemoved_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ComponentRemoved* wrapper = GetThisValueObject<SignalWrapper_Scene_ComponentRemoved>(ctx, SignalWrapper_Scene_ComponentRemoved_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -457,7 +471,8 @@ static duk_ret_t SignalWrapper_Scene_ComponentRemoved_Emit(duk_context* ctx)
 static duk_ret_t Scene_Get_ComponentRemoved(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_ComponentRemoved* wrapper = new SignalWrapper_Scene_ComponentRemoved(thisObj, &thisObj->ComponentRemoved);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentRemoved")) return 1;
+    SignalWrapper_Scene_ComponentRemoved* wrapper = new (ctx) SignalWrapper_Scene_ComponentRemoved(thisObj, &thisObj->ComponentRemoved);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_ComponentRemoved_ID, SignalWrapper_Scene_ComponentRemoved_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_ComponentRemoved_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -467,8 +482,15 @@ static duk_ret_t Scene_Get_ComponentRemoved(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_ComponentRemoved_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_ComponentRemoved_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_ComponentRemoved_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_ComponentRemoved_Emit, 3);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentRemoved");
     return 1;
 }
 
@@ -493,18 +515,12 @@ public:
     void OnSignal(Entity * param0, AttributeChange::Type param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -516,6 +532,7 @@ static duk_ret_t SignalWrapper_Scene_EntityCreated_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_EntityCreated_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityCreated* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityCreated>(ctx, SignalWrapper_Scene_EntityCreated_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -533,6 +550,7 @@ static duk_ret_t SignalWrapper_Scene_EntityCreated_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_EntityCreated_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityCreated* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityCreated>(ctx, SignalWrapper_Scene_EntityCreated_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -541,6 +559,7 @@ static duk_ret_t SignalWrapper_Scene_EntityCreated_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_EntityCreated_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityCreated* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityCreated>(ctx, SignalWrapper_Scene_EntityCreated_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -552,7 +571,8 @@ static duk_ret_t SignalWrapper_Scene_EntityCreated_Emit(duk_context* ctx)
 static duk_ret_t Scene_Get_EntityCreated(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_EntityCreated* wrapper = new SignalWrapper_Scene_EntityCreated(thisObj, &thisObj->EntityCreated);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityCreated")) return 1;
+    SignalWrapper_Scene_EntityCreated* wrapper = new (ctx) SignalWrapper_Scene_EntityCreated(thisObj, &thisObj->EntityCreated);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_EntityCreated_ID, SignalWrapper_Scene_EntityCreated_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityCreated_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -562,8 +582,15 @@ static duk_ret_t Scene_Get_EntityCreated(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityCreated_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_EntityCreated_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_EntityCreated_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityCreated_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityCreated");
     return 1;
 }
 
@@ -588,18 +615,12 @@ public:
     void OnSignal(Entity * param0, AttributeChange::Type param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -611,6 +632,7 @@ static duk_ret_t SignalWrapper_Scene_EntityRemoved_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_EntityRemoved_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityRemoved* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityRemoved>(ctx, SignalWrapper_Scene_EntityRemoved_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -628,6 +650,7 @@ static duk_ret_t SignalWrapper_Scene_EntityRemoved_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_EntityRemoved_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityRemoved* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityRemoved>(ctx, SignalWrapper_Scene_EntityRemoved_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -636,6 +659,7 @@ static duk_ret_t SignalWrapper_Scene_EntityRemoved_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_EntityRemoved_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityRemoved* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityRemoved>(ctx, SignalWrapper_Scene_EntityRemoved_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -647,7 +671,8 @@ static duk_ret_t SignalWrapper_Scene_EntityRemoved_Emit(duk_context* ctx)
 static duk_ret_t Scene_Get_EntityRemoved(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_EntityRemoved* wrapper = new SignalWrapper_Scene_EntityRemoved(thisObj, &thisObj->EntityRemoved);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityRemoved")) return 1;
+    SignalWrapper_Scene_EntityRemoved* wrapper = new (ctx) SignalWrapper_Scene_EntityRemoved(thisObj, &thisObj->EntityRemoved);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_EntityRemoved_ID, SignalWrapper_Scene_EntityRemoved_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityRemoved_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -657,8 +682,15 @@ static duk_ret_t Scene_Get_EntityRemoved(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityRemoved_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_EntityRemoved_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_EntityRemoved_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityRemoved_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityRemoved");
     return 1;
 }
 
@@ -683,18 +715,12 @@ public:
     void OnSignal(Entity * param0, entity_id_t param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -706,6 +732,7 @@ static duk_ret_t SignalWrapper_Scene_EntityAcked_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_EntityAcked_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityAcked* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityAcked>(ctx, SignalWrapper_Scene_EntityAcked_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -723,6 +750,7 @@ static duk_ret_t SignalWrapper_Scene_EntityAcked_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_EntityAcked_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityAcked* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityAcked>(ctx, SignalWrapper_Scene_EntityAcked_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -731,6 +759,7 @@ static duk_ret_t SignalWrapper_Scene_EntityAcked_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_EntityAcked_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityAcked* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityAcked>(ctx, SignalWrapper_Scene_EntityAcked_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -742,7 +771,8 @@ static duk_ret_t SignalWrapper_Scene_EntityAcked_Emit(duk_context* ctx)
 static duk_ret_t Scene_Get_EntityAcked(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_EntityAcked* wrapper = new SignalWrapper_Scene_EntityAcked(thisObj, &thisObj->EntityAcked);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityAcked")) return 1;
+    SignalWrapper_Scene_EntityAcked* wrapper = new (ctx) SignalWrapper_Scene_EntityAcked(thisObj, &thisObj->EntityAcked);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_EntityAcked_ID, SignalWrapper_Scene_EntityAcked_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityAcked_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -752,8 +782,15 @@ static duk_ret_t Scene_Get_EntityAcked(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityAcked_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_EntityAcked_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_EntityAcked_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityAcked_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityAcked");
     return 1;
 }
 
@@ -778,18 +815,12 @@ public:
     void OnSignal(Entity * param0, AttributeChange::Type param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -801,6 +832,7 @@ static duk_ret_t SignalWrapper_Scene_EntityTemporaryStateToggled_Finalizer(duk_c
 
 static duk_ret_t SignalWrapper_Scene_EntityTemporaryStateToggled_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityTemporaryStateToggled* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityTemporaryStateToggled>(ctx, SignalWrapper_Scene_EntityTemporaryStateToggled_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -818,6 +850,7 @@ static duk_ret_t SignalWrapper_Scene_EntityTemporaryStateToggled_Connect(duk_con
 
 static duk_ret_t SignalWrapper_Scene_EntityTemporaryStateToggled_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityTemporaryStateToggled* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityTemporaryStateToggled>(ctx, SignalWrapper_Scene_EntityTemporaryStateToggled_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -826,6 +859,7 @@ static duk_ret_t SignalWrapper_Scene_EntityTemporaryStateToggled_Disconnect(duk_
 
 static duk_ret_t SignalWrapper_Scene_EntityTemporaryStateToggled_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityTemporaryStateToggled* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityTemporaryStateToggled>(ctx, SignalWrapper_Scene_EntityTemporaryStateToggled_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -837,7 +871,8 @@ static duk_ret_t SignalWrapper_Scene_EntityTemporaryStateToggled_Emit(duk_contex
 static duk_ret_t Scene_Get_EntityTemporaryStateToggled(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_EntityTemporaryStateToggled* wrapper = new SignalWrapper_Scene_EntityTemporaryStateToggled(thisObj, &thisObj->EntityTemporaryStateToggled);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityTemporaryStateToggled")) return 1;
+    SignalWrapper_Scene_EntityTemporaryStateToggled* wrapper = new (ctx) SignalWrapper_Scene_EntityTemporaryStateToggled(thisObj, &thisObj->EntityTemporaryStateToggled);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_EntityTemporaryStateToggled_ID, SignalWrapper_Scene_EntityTemporaryStateToggled_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityTemporaryStateToggled_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -847,8 +882,15 @@ static duk_ret_t Scene_Get_EntityTemporaryStateToggled(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityTemporaryStateToggled_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_EntityTemporaryStateToggled_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_EntityTemporaryStateToggled_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityTemporaryStateToggled_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityTemporaryStateToggled");
     return 1;
 }
 
@@ -873,18 +915,12 @@ public:
     void OnSignal(IComponent * param0, component_id_t param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_number(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -896,6 +932,7 @@ static duk_ret_t SignalWrapper_Scene_ComponentAcked_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_ComponentAcked_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ComponentAcked* wrapper = GetThisValueObject<SignalWrapper_Scene_ComponentAcked>(ctx, SignalWrapper_Scene_ComponentAcked_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -913,6 +950,7 @@ static duk_ret_t SignalWrapper_Scene_ComponentAcked_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_ComponentAcked_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ComponentAcked* wrapper = GetThisValueObject<SignalWrapper_Scene_ComponentAcked>(ctx, SignalWrapper_Scene_ComponentAcked_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -921,6 +959,7 @@ static duk_ret_t SignalWrapper_Scene_ComponentAcked_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_ComponentAcked_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ComponentAcked* wrapper = GetThisValueObject<SignalWrapper_Scene_ComponentAcked>(ctx, SignalWrapper_Scene_ComponentAcked_ID);
     if (!wrapper->owner_) return 0;
     IComponent* param0 = GetWeakObject<IComponent>(ctx, 0);
@@ -932,7 +971,8 @@ static duk_ret_t SignalWrapper_Scene_ComponentAcked_Emit(duk_context* ctx)
 static duk_ret_t Scene_Get_ComponentAcked(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_ComponentAcked* wrapper = new SignalWrapper_Scene_ComponentAcked(thisObj, &thisObj->ComponentAcked);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentAcked")) return 1;
+    SignalWrapper_Scene_ComponentAcked* wrapper = new (ctx) SignalWrapper_Scene_ComponentAcked(thisObj, &thisObj->ComponentAcked);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_ComponentAcked_ID, SignalWrapper_Scene_ComponentAcked_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_ComponentAcked_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -942,8 +982,15 @@ static duk_ret_t Scene_Get_ComponentAcked(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_ComponentAcked_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_ComponentAcked_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_ComponentAcked_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_ComponentAcked_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentAcked");
     return 1;
 }
 
@@ -968,10 +1015,6 @@ public:
     void OnSignal(Entity * param0, const String & param1, const StringVector & param2, EntityAction::ExecTypeField param3)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -981,9 +1024,7 @@ public:
         duk_put_prop_index(ctx, -2, 2);
         duk_push_number(ctx, param3);
         duk_put_prop_index(ctx, -2, 3);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -995,6 +1036,7 @@ static duk_ret_t SignalWrapper_Scene_ActionTriggered_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_ActionTriggered_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ActionTriggered* wrapper = GetThisValueObject<SignalWrapper_Scene_ActionTriggered>(ctx, SignalWrapper_Scene_ActionTriggered_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -1012,6 +1054,7 @@ static duk_ret_t SignalWrapper_Scene_ActionTriggered_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_ActionTriggered_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ActionTriggered* wrapper = GetThisValueObject<SignalWrapper_Scene_ActionTriggered>(ctx, SignalWrapper_Scene_ActionTriggered_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -1020,6 +1063,7 @@ static duk_ret_t SignalWrapper_Scene_ActionTriggered_Disconnect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_Scene_ActionTriggered_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_ActionTriggered* wrapper = GetThisValueObject<SignalWrapper_Scene_ActionTriggered>(ctx, SignalWrapper_Scene_ActionTriggered_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -1033,7 +1077,8 @@ static duk_ret_t SignalWrapper_Scene_ActionTriggered_Emit(duk_context* ctx)
 static duk_ret_t Scene_Get_ActionTriggered(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_ActionTriggered* wrapper = new SignalWrapper_Scene_ActionTriggered(thisObj, &thisObj->ActionTriggered);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalActionTriggered")) return 1;
+    SignalWrapper_Scene_ActionTriggered* wrapper = new (ctx) SignalWrapper_Scene_ActionTriggered(thisObj, &thisObj->ActionTriggered);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_ActionTriggered_ID, SignalWrapper_Scene_ActionTriggered_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_ActionTriggered_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -1043,8 +1088,15 @@ static duk_ret_t Scene_Get_ActionTriggered(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_ActionTriggered_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_ActionTriggered_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_ActionTriggered_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_ActionTriggered_Emit, 4);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalActionTriggered");
     return 1;
 }
 
@@ -1069,16 +1121,10 @@ public:
     void OnSignal(Scene * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -1090,6 +1136,7 @@ static duk_ret_t SignalWrapper_Scene_Removed_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_Removed_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_Removed* wrapper = GetThisValueObject<SignalWrapper_Scene_Removed>(ctx, SignalWrapper_Scene_Removed_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -1107,6 +1154,7 @@ static duk_ret_t SignalWrapper_Scene_Removed_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_Removed_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_Removed* wrapper = GetThisValueObject<SignalWrapper_Scene_Removed>(ctx, SignalWrapper_Scene_Removed_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -1115,6 +1163,7 @@ static duk_ret_t SignalWrapper_Scene_Removed_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_Removed_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_Removed* wrapper = GetThisValueObject<SignalWrapper_Scene_Removed>(ctx, SignalWrapper_Scene_Removed_ID);
     if (!wrapper->owner_) return 0;
     Scene* param0 = GetWeakObject<Scene>(ctx, 0);
@@ -1125,7 +1174,8 @@ static duk_ret_t SignalWrapper_Scene_Removed_Emit(duk_context* ctx)
 static duk_ret_t Scene_Get_Removed(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_Removed* wrapper = new SignalWrapper_Scene_Removed(thisObj, &thisObj->Removed);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalRemoved")) return 1;
+    SignalWrapper_Scene_Removed* wrapper = new (ctx) SignalWrapper_Scene_Removed(thisObj, &thisObj->Removed);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_Removed_ID, SignalWrapper_Scene_Removed_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_Removed_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -1135,8 +1185,15 @@ static duk_ret_t Scene_Get_Removed(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_Removed_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_Removed_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_Removed_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_Removed_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalRemoved");
     return 1;
 }
 
@@ -1161,16 +1218,10 @@ public:
     void OnSignal(Scene * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -1182,6 +1233,7 @@ static duk_ret_t SignalWrapper_Scene_SceneCleared_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_SceneCleared_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_SceneCleared* wrapper = GetThisValueObject<SignalWrapper_Scene_SceneCleared>(ctx, SignalWrapper_Scene_SceneCleared_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -1199,6 +1251,7 @@ static duk_ret_t SignalWrapper_Scene_SceneCleared_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_SceneCleared_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_SceneCleared* wrapper = GetThisValueObject<SignalWrapper_Scene_SceneCleared>(ctx, SignalWrapper_Scene_SceneCleared_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -1207,6 +1260,7 @@ static duk_ret_t SignalWrapper_Scene_SceneCleared_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Scene_SceneCleared_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_SceneCleared* wrapper = GetThisValueObject<SignalWrapper_Scene_SceneCleared>(ctx, SignalWrapper_Scene_SceneCleared_ID);
     if (!wrapper->owner_) return 0;
     Scene* param0 = GetWeakObject<Scene>(ctx, 0);
@@ -1217,7 +1271,8 @@ static duk_ret_t SignalWrapper_Scene_SceneCleared_Emit(duk_context* ctx)
 static duk_ret_t Scene_Get_SceneCleared(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_SceneCleared* wrapper = new SignalWrapper_Scene_SceneCleared(thisObj, &thisObj->SceneCleared);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalSceneCleared")) return 1;
+    SignalWrapper_Scene_SceneCleared* wrapper = new (ctx) SignalWrapper_Scene_SceneCleared(thisObj, &thisObj->SceneCleared);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_SceneCleared_ID, SignalWrapper_Scene_SceneCleared_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_SceneCleared_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -1227,8 +1282,15 @@ static duk_ret_t Scene_Get_SceneCleared(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_SceneCleared_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_SceneCleared_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_SceneCleared_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_SceneCleared_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalSceneCleared");
     return 1;
 }
 
@@ -1253,10 +1315,6 @@ public:
     void OnSignal(Entity * param0, Entity * param1, AttributeChange::Type param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -1264,9 +1322,7 @@ public:
         duk_put_prop_index(ctx, -2, 1);
         duk_push_number(ctx, param2);
         duk_put_prop_index(ctx, -2, 2);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -1278,6 +1334,7 @@ static duk_ret_t SignalWrapper_Scene_EntityParentChanged_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_Scene_EntityParentChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityParentChanged* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityParentChanged>(ctx, SignalWrapper_Scene_EntityParentChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -1295,6 +1352,7 @@ static duk_ret_t SignalWrapper_Scene_EntityParentChanged_Connect(duk_context* ct
 
 static duk_ret_t SignalWrapper_Scene_EntityParentChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityParentChanged* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityParentChanged>(ctx, SignalWrapper_Scene_EntityParentChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -1303,6 +1361,7 @@ static duk_ret_t SignalWrapper_Scene_EntityParentChanged_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_Scene_EntityParentChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Scene_EntityParentChanged* wrapper = GetThisValueObject<SignalWrapper_Scene_EntityParentChanged>(ctx, SignalWrapper_Scene_EntityParentChanged_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -1315,7 +1374,8 @@ static duk_ret_t SignalWrapper_Scene_EntityParentChanged_Emit(duk_context* ctx)
 static duk_ret_t Scene_Get_EntityParentChanged(duk_context* ctx)
 {
     Scene* thisObj = GetThisWeakObject<Scene>(ctx);
-    SignalWrapper_Scene_EntityParentChanged* wrapper = new SignalWrapper_Scene_EntityParentChanged(thisObj, &thisObj->EntityParentChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityParentChanged")) return 1;
+    SignalWrapper_Scene_EntityParentChanged* wrapper = new (ctx) SignalWrapper_Scene_EntityParentChanged(thisObj, &thisObj->EntityParentChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Scene_EntityParentChanged_ID, SignalWrapper_Scene_EntityParentChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityParentChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -1325,8 +1385,15 @@ static duk_ret_t Scene_Get_EntityParentChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityParentChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Scene_EntityParentChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Scene_EntityParentChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Scene_EntityParentChanged_Emit, 3);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityParentChanged");
     return 1;
 }
 
@@ -47,16 +47,10 @@ public:
     void OnSignal(Script * param0, const Vector< ScriptAssetPtr > & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -68,6 +62,7 @@ static duk_ret_t SignalWrapper_Script_ScriptAssetsChanged_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_Script_ScriptAssetsChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ScriptAssetsChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ScriptAssetsChanged>(ctx, SignalWrapper_Script_ScriptAssetsChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -85,6 +80,7 @@ static duk_ret_t SignalWrapper_Script_ScriptAssetsChanged_Connect(duk_context* c
 
 static duk_ret_t SignalWrapper_Script_ScriptAssetsChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ScriptAssetsChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ScriptAssetsChanged>(ctx, SignalWrapper_Script_ScriptAssetsChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -94,7 +90,8 @@ static duk_ret_t SignalWrapper_Script_ScriptAssetsChanged_Disconnect(duk_context
 static duk_ret_t Script_Get_ScriptAssetsChanged(duk_context* ctx)
 {
     Script* thisObj = GetThisWeakObject<Script>(ctx);
-    SignalWrapper_Script_ScriptAssetsChanged* wrapper = new SignalWrapper_Script_ScriptAssetsChanged(thisObj, &thisObj->ScriptAssetsChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalScriptAssetsChanged")) return 1;
+    SignalWrapper_Script_ScriptAssetsChanged* wrapper = new (ctx) SignalWrapper_Script_ScriptAssetsChanged(thisObj, &thisObj->ScriptAssetsChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Script_ScriptAssetsChanged_ID, SignalWrapper_Script_ScriptAssetsChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Script_ScriptAssetsChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -104,6 +101,13 @@ static duk_ret_t Script_Get_ScriptAssetsChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Script_ScriptAssetsChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Script_ScriptAssetsChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Script_ScriptAssetsChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
+    CacheSignalWrapper(ctx, "\xff""signalScriptAssetsChanged");
     return 1;
 }
 
@@ -128,18 +132,12 @@ public:
     void OnSignal(Script * param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -151,6 +149,7 @@ static duk_ret_t SignalWrapper_Script_ApplicationNameChanged_Finalizer(duk_conte
 
 static duk_ret_t SignalWrapper_Script_ApplicationNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ApplicationNameChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ApplicationNameChanged>(ctx, SignalWrapper_Script_ApplicationNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -168,6 +167,7 @@ static duk_ret_t SignalWrapper_Script_ApplicationNameChanged_Connect(duk_context
 
 static duk_ret_t SignalWrapper_Script_ApplicationNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ApplicationNameChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ApplicationNameChanged>(ctx, SignalWrapper_Script_ApplicationNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -176,6 +176,7 @@ static duk_ret_t SignalWrapper_Script_ApplicationNameChanged_Disconnect(duk_cont
 
 static duk_ret_t SignalWrapper_Script_ApplicationNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ApplicationNameChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ApplicationNameChanged>(ctx, SignalWrapper_Script_ApplicationNameChanged_ID);
     if (!wrapper->owner_) return 0;
     Script* param0 = GetWeakObject<Script>(ctx, 0);
@@ -187,7 +188,8 @@ static duk_ret_t SignalWrapper_Script_ApplicationNameChanged_Emit(duk_context* c
 static duk_ret_t Script_Get_ApplicationNameChanged(duk_context* ctx)
 {
     Script* thisObj = GetThisWeakObject<Script>(ctx);
-    SignalWrapper_Script_ApplicationNameChanged* wrapper = new SignalWrapper_Script_ApplicationNameChanged(thisObj, &thisObj->ApplicationNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalApplicationNameChanged")) return 1;
+    SignalWrapper_Script_ApplicationNameChanged* wrapper = new (ctx) SignalWrapper_Script_ApplicationNameChanged(thisObj, &thisObj->ApplicationNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Script_ApplicationNameChanged_ID, SignalWrapper_Script_ApplicationNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Script_ApplicationNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -197,8 +199,15 @@ static duk_ret_t Script_Get_ApplicationNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Script_ApplicationNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Script_ApplicationNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Script_ApplicationNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Script_ApplicationNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalApplicationNameChanged");
     return 1;
 }
 
@@ -223,18 +232,12 @@ public:
     void OnSignal(Script * param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -246,6 +249,7 @@ static duk_ret_t SignalWrapper_Script_ClassNameChanged_Finalizer(duk_context* ct
 
 static duk_ret_t SignalWrapper_Script_ClassNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ClassNameChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ClassNameChanged>(ctx, SignalWrapper_Script_ClassNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -263,6 +267,7 @@ static duk_ret_t SignalWrapper_Script_ClassNameChanged_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Script_ClassNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ClassNameChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ClassNameChanged>(ctx, SignalWrapper_Script_ClassNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -271,6 +276,7 @@ static duk_ret_t SignalWrapper_Script_ClassNameChanged_Disconnect(duk_context* c
 
 static duk_ret_t SignalWrapper_Script_ClassNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ClassNameChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ClassNameChanged>(ctx, SignalWrapper_Script_ClassNameChanged_ID);
     if (!wrapper->owner_) return 0;
     Script* param0 = GetWeakObject<Script>(ctx, 0);
@@ -282,7 +288,8 @@ static duk_ret_t SignalWrapper_Script_ClassNameChanged_Emit(duk_context* ctx)
 static duk_ret_t Script_Get_ClassNameChanged(duk_context* ctx)
 {
     Script* thisObj = GetThisWeakObject<Script>(ctx);
-    SignalWrapper_Script_ClassNameChanged* wrapper = new SignalWrapper_Script_ClassNameChanged(thisObj, &thisObj->ClassNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalClassNameChanged")) return 1;
+    SignalWrapper_Script_ClassNameChanged* wrapper = new (ctx) SignalWrapper_Script_ClassNameChanged(thisObj, &thisObj->ClassNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Script_ClassNameChanged_ID, SignalWrapper_Script_ClassNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Script_ClassNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -292,8 +299,15 @@ static duk_ret_t Script_Get_ClassNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Script_ClassNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Script_ClassNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Script_ClassNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Script_ClassNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalClassNameChanged");
     return 1;
 }
 
@@ -318,18 +332,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -341,6 +349,7 @@ static duk_ret_t SignalWrapper_Script_ComponentNameChanged_Finalizer(duk_context
 
 static duk_ret_t SignalWrapper_Script_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ComponentNameChanged>(ctx, SignalWrapper_Script_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -358,6 +367,7 @@ static duk_ret_t SignalWrapper_Script_ComponentNameChanged_Connect(duk_context*
 
 static duk_ret_t SignalWrapper_Script_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ComponentNameChanged>(ctx, SignalWrapper_Script_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -366,6 +376,7 @@ static duk_ret_t SignalWrapper_Script_ComponentNameChanged_Disconnect(duk_contex
 
 static duk_ret_t SignalWrapper_Script_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Script_ComponentNameChanged>(ctx, SignalWrapper_Script_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -377,7 +388,8 @@ static duk_ret_t SignalWrapper_Script_ComponentNameChanged_Emit(duk_context* ctx
 static duk_ret_t Script_Get_ComponentNameChanged(duk_context* ctx)
 {
     Script* thisObj = GetThisWeakObject<Script>(ctx);
-    SignalWrapper_Script_ComponentNameChanged* wrapper = new SignalWrapper_Script_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_Script_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_Script_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Script_ComponentNameChanged_ID, SignalWrapper_Script_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Script_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -387,8 +399,15 @@ static duk_ret_t Script_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Script_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Script_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Script_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Script_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -413,14 +432,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -432,6 +445,7 @@ static duk_ret_t SignalWrapper_Script_ParentEntitySet_Finalizer(duk_context* ctx
 
 static duk_ret_t SignalWrapper_Script_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Script_ParentEntitySet>(ctx, SignalWrapper_Script_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -449,6 +463,7 @@ static duk_ret_t SignalWrapper_Script_ParentEntitySet_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Script_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Script_ParentEntitySet>(ctx, SignalWrapper_Script_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -457,6 +472,7 @@ static duk_ret_t SignalWrapper_Script_ParentEntitySet_Disconnect(duk_context* ct
 
 static duk_ret_t SignalWrapper_Script_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Script_ParentEntitySet>(ctx, SignalWrapper_Script_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -466,7 +482,8 @@ static duk_ret_t SignalWrapper_Script_ParentEntitySet_Emit(duk_context* ctx)
 static duk_ret_t Script_Get_ParentEntitySet(duk_context* ctx)
 {
     Script* thisObj = GetThisWeakObject<Script>(ctx);
-    SignalWrapper_Script_ParentEntitySet* wrapper = new SignalWrapper_Script_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_Script_ParentEntitySet* wrapper = new (ctx) SignalWrapper_Script_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_Script_ParentEntitySet_ID, SignalWrapper_Script_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Script_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -476,8 +493,15 @@ static duk_ret_t Script_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Script_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Script_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Script_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Script_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -502,14 +526,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -521,6 +539,7 @@ static duk_ret_t SignalWrapper_Script_ParentEntityAboutToBeDetached_Finalizer(du
 
 static duk_ret_t SignalWrapper_Script_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Script_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Script_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -538,6 +557,7 @@ static duk_ret_t SignalWrapper_Script_ParentEntityAboutToBeDetached_Connect(duk_
 
 static duk_ret_t SignalWrapper_Script_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Script_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Script_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -546,6 +566,7 @@ static duk_ret_t SignalWrapper_Script_ParentEntityAboutToBeDetached_Disconnect(d
 
 static duk_ret_t SignalWrapper_Script_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Script_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Script_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Script_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -555,7 +576,8 @@ static duk_ret_t SignalWrapper_Script_ParentEntityAboutToBeDetached_Emit(duk_con
 static duk_ret_t Script_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     Script* thisObj = GetThisWeakObject<Script>(ctx);
-    SignalWrapper_Script_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_Script_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_Script_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_Script_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_Script_ParentEntityAboutToBeDetached_ID, SignalWrapper_Script_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Script_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -565,8 +587,15 @@ static duk_ret_t Script_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Script_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Script_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Script_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Script_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
@@ -111,7 +111,7 @@ static duk_ret_t Transform_Get_scale(duk_context* ctx)
 
 static duk_ret_t Transform_Ctor(duk_context* ctx)
 {
-    Transform* newObj = new Transform();
+    Transform* newObj = new (ctx) Transform();
     PushConstructorResult<Transform>(ctx, newObj, Transform_ID, Transform_Finalizer);
     return 0;
 }
@@ -121,7 +121,7 @@ static duk_ret_t Transform_Ctor_float3_float3_float3(duk_context* ctx)
     float3& pos_ = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& rot_ = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
     float3& scale_ = *GetCheckedValueObject<float3>(ctx, 2, float3_ID);
-    Transform* newObj = new Transform(pos_, rot_, scale_);
+    Transform* newObj = new (ctx) Transform(pos_, rot_, scale_);
     PushConstructorResult<Transform>(ctx, newObj, Transform_ID, Transform_Finalizer);
     return 0;
 }
@@ -129,7 +129,7 @@ static duk_ret_t Transform_Ctor_float3_float3_float3(duk_context* ctx)
 static duk_ret_t Transform_Ctor_float3x3(duk_context* ctx)
 {
     float3x3& m = *GetCheckedValueObject<float3x3>(ctx, 0, float3x3_ID);
-    Transform* newObj = new Transform(m);
+    Transform* newObj = new (ctx) Transform(m);
     PushConstructorResult<Transform>(ctx, newObj, Transform_ID, Transform_Finalizer);
     return 0;
 }
@@ -137,7 +137,7 @@ static duk_ret_t Transform_Ctor_float3x3(duk_context* ctx)
 static duk_ret_t Transform_Ctor_float3x4(duk_context* ctx)
 {
     float3x4& m = *GetCheckedValueObject<float3x4>(ctx, 0, float3x4_ID);
-    Transform* newObj = new Transform(m);
+    Transform* newObj = new (ctx) Transform(m);
     PushConstructorResult<Transform>(ctx, newObj, Transform_ID, Transform_Finalizer);
     return 0;
 }
@@ -145,7 +145,7 @@ static duk_ret_t Transform_Ctor_float3x4(duk_context* ctx)
 static duk_ret_t Transform_Ctor_float4x4(duk_context* ctx)
 {
     float4x4& m = *GetCheckedValueObject<float4x4>(ctx, 0, float4x4_ID);
-    Transform* newObj = new Transform(m);
+    Transform* newObj = new (ctx) Transform(m);
     PushConstructorResult<Transform>(ctx, newObj, Transform_ID, Transform_Finalizer);
     return 0;
 }
@@ -5,31 +5,111 @@
 #include "Framework.h"
 #include "LoggingFunctions.h"
 #include "AssetAPI.h"
+#include "AssetCache.h"
 #include "FrameAPI.h"
 #include "ConfigAPI.h"
 #include "SceneAPI.h"
 #include "Console/ConsoleAPI.h"
+#include "Debug/DebugAPI.h"
+#include "Debug/DebugHud.h"
 #include "Input/InputAPI.h"
 #include "GenericAssetFactory.h"
 #include "Script.h"
 #include "ScriptAsset.h"
 #include "JavaScriptInstance.h"
+#include "JavaScriptHeapAllocator.h"
 #include "MathBindings/MathBindings.h"
 #include "CoreBindings/CoreBindings.h"
 #include "JavaScriptBindings/JavaScriptBindings.h"
 #include "Asset/LocalAssetProvider.h"
 #include "Asset/LocalAssetStorage.h"
 
+#include <Urho3D/Container/Sort.h>
 #include <Urho3D/Core/Profiler.h>
+#include <Urho3D/Core/WorkQueue.h>
 #include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/UI/Text.h>
+
+#include <cstdio>
+#include <cstring>
 
 using namespace JSBindings;
 
 namespace Tundra
 {
 
+namespace
+{
+    const u32 cCompiledScriptMagic = 0x4342534A; // "JSBC"
+    /// Bytecode cache file header: magic, Duktape version and content hash.
+    const uint cCompiledScriptHeaderSize = 2 * sizeof(u32) + sizeof(u64);
+    /// Kind of the compiled code in the asset cache, see AssetCache::StoreDerivedData.
+    const char *cCompiledScriptKind = "jsbc";
+
+    /// Copies the classes and services exposed to the global scope of sourceCtx, that are not yet defined in the global scope of ctx.
+    /** The contexts must share the same heap. Services get wrappers of their own, so that object identity works within the destination scope. */
+    void CopySharedGlobals(duk_context* ctx, duk_context* sourceCtx)
+    {
+        duk_push_global_object(sourceCtx);
+        duk_xcopy_top(ctx, sourceCtx, 1);
+        duk_pop(sourceCtx);
+
+        duk_push_global_object(ctx);
+        duk_enum(ctx, -2, DUK_ENUM_OWN_PROPERTIES_ONLY);
+        while (duk_next(ctx, -1, 1))
+        {
+            const char* name = duk_get_string(ctx, -2);
+            if (!duk_has_prop_string(ctx, -4, name))
+            {
+                WeakPtr<Object>* service = GetWeakPtr(ctx, -1);
+                if (service)
+                {
+                    duk_pop(ctx);
+                    PushWeakObject(ctx, service->Get());
+                }
+                duk_put_prop_string(ctx, -4, name);
+            }
+            else
+                duk_pop(ctx);
+            duk_pop(ctx); // Key
+        }
+        duk_pop_3(ctx); // Enum, global object and source global object
+    }
+
+    bool CompareLastFrameTime(JavaScriptInstance* lhs, JavaScriptInstance* rhs)
+    {
+        return lhs->ExecutionStats().lastFrameTime > rhs->ExecutionStats().lastFrameTime;
+    }
+
+    /// WorkQueue priority of the isolated frame updates. Completing it does not wait for lower priority background work.
+    const unsigned cIsolatedUpdatePriority = Urho3D::M_MAX_UNSIGNED - 1;
+
+    void RunIsolatedUpdateWork(const Urho3D::WorkItem* item, unsigned /*threadIndex*/)
+    {
+        static_cast<JavaScriptInstance*>(item->aux_)->RunIsolatedUpdate();
+    }
+
+    /// engine.QueueMainThreadCall(func) or engine.QueueMainThreadCall(obj, func), see JavaScriptInstance::SetIsolated.
+    duk_ret_t JavaScriptInstance_QueueMainThreadCall(duk_context* ctx)
+    {
+        JavaScriptInstance* instance = GetThisWeakObject<JavaScriptInstance>(ctx);
+        if (duk_get_top(ctx) < 2)
+        {
+            duk_push_null(ctx);
+            duk_insert(ctx, 0);
+        }
+        duk_set_top(ctx, 2);
+        if (!duk_is_function(ctx, 1))
+            duk_error(ctx, DUK_ERR_TYPE_ERROR, "QueueMainThreadCall: function expected");
+        instance->QueueMainThreadCall();
+        return 0;
+    }
+}
+
 JavaScript::JavaScript(Framework* owner) :
-    IModule("JavaScript", owner)
+    IModule("JavaScript", owner),
+    numSharedHeaps_(0),
+    frameBudget_(0)
 {
 }
 
@@ -45,6 +125,13 @@ void JavaScript::Load()
 
 void JavaScript::Initialize()
 {
+    StringVector sharedHeaps = framework->CommandLineParameters("--jsSharedHeaps");
+    if (!sharedHeaps.Empty())
+        numSharedHeaps_ = Urho3D::ToUInt(sharedHeaps.Front());
+    StringVector frameBudget = framework->CommandLineParameters("--jsFrameBudget");
+    if (!frameBudget.Empty())
+        frameBudget_ = static_cast<long long>(Urho3D::Max(Urho3D::ToFloat(frameBudget.Front()), 0.f) * 1000.f);
+
     framework->Console()->RegisterCommand(
         "jsExec", "Execute given code in the embedded Javascript interpreter. Usage: jsExec(mycodestring)")->ExecutedWith.Connect(
         this, &JavaScript::RunStringCommand);
@@ -56,6 +143,16 @@ void JavaScript::Initialize()
     framework->Console()->RegisterCommand(
         "jsReloadScripts", "Reloads and re-executes startup scripts.",
         this, &JavaScript::LoadStartupScripts);
+
+    framework->Console()->RegisterCommand(
+        "jsStats", "Prints the execution times and heap usage of the script instances.",
+        this, &JavaScript::PrintExecutionReport);
+
+    if (!framework->IsHeadless())
+    {
+        hudPanel_ = new JavaScriptHudPanel(framework, this);
+        framework->Debug()->Hud()->AddTab("JavaScript", Urho3D::StaticCast<DebugHudPanel>(hudPanel_));
+    }
         
     framework->Scene()->SceneCreated.Connect(this, &JavaScript::OnSceneCreated);
 
@@ -67,6 +164,8 @@ void JavaScript::Initialize()
     // Set startup scripts and --run commands to be run on the first frame.
     // This is to ensure that all loaded modules have hooked themselves up to JS instance creation before creating JS instances
     framework->Frame()->DelayedExecute(0.0f).Connect(this, &JavaScript::OnFirstFrame);
+    // Deliver the signal events batched during the frame
+    framework->Frame()->PostFrameUpdate.Connect(this, &JavaScript::OnPostFrameUpdate);
 }
 
 void JavaScript::OnFirstFrame(float /*dt*/)
@@ -83,8 +182,103 @@ void JavaScript::OnFirstFrame(float /*dt*/)
     }
 }
 
+void JavaScript::OnPostFrameUpdate(float /*dt*/)
+{
+    // Changes applied from the isolated instances are delivered to the batched connections of the same frame
+    RunIsolatedUpdates();
+    JavaScriptInstance::FlushAllSignalBatches();
+}
+
+void JavaScript::RunIsolatedUpdates()
+{
+    Vector<SharedPtr<JavaScriptInstance> > instances;
+    const HashMap<void*, JavaScriptInstance*>& instanceMap = JavaScriptInstance::Instances();
+    for (HashMap<void*, JavaScriptInstance*>::ConstIterator i = instanceMap.Begin(); i != instanceMap.End(); ++i)
+    {
+        if (i->second_->HasIsolatedUpdate())
+            instances.Push(SharedPtr<JavaScriptInstance>(i->second_));
+    }
+    if (instances.Empty())
+        return;
+
+    URHO3D_PROFILE(JavaScript_RunIsolatedUpdates);
+
+    // The bindings refuse to modify the scene until all updates have finished, and the assignments are queued instead
+    JavaScriptInstance::SetIsolatedUpdatesRunning(true);
+    Urho3D::WorkQueue* queue = GetSubsystem<Urho3D::WorkQueue>();
+    for (uint i = 0; i < instances.Size(); ++i)
+    {
+        if (!queue)
+        {
+            instances[i]->RunIsolatedUpdate();
+            continue;
+        }
+        SharedPtr<Urho3D::WorkItem> item(new Urho3D::WorkItem());
+        item->workFunction_ = RunIsolatedUpdateWork;
+        item->aux_ = instances[i].Get();
+        item->priority_ = cIsolatedUpdatePriority;
+        queue->AddWorkItem(item);
+    }
+    // Sync point: the main thread takes part in the work, and nothing else touches the scene until all updates have finished
+    if (queue)
+        queue->Complete(cIsolatedUpdatePriority);
+    JavaScriptInstance::SetIsolatedUpdatesRunning(false);
+
+    for (uint i = 0; i < instances.Size(); ++i)
+        instances[i]->ApplyQueuedChanges();
+}
+
 void JavaScript::Uninitialize()
 {
+    // Instances still running in the heaps keep them alive until destroyed
+    sharedHeaps_.Clear();
+    hudPanel_.Reset();
+}
+
+void JavaScript::Update(float /*frametime*/)
+{
+    // Modules are updated before FrameAPI::Updated, so this starts the frame of the execution time accounting
+    const HashMap<void*, JavaScriptInstance*>& instances = JavaScriptInstance::Instances();
+    for (HashMap<void*, JavaScriptInstance*>::ConstIterator i = instances.Begin(); i != instances.End(); ++i)
+        i->second_->EndFrame();
+
+    for (uint i = 0; i < sharedHeaps_.Size(); ++i)
+        sharedHeaps_[i]->CollectReleasedThreads();
+}
+
+String JavaScript::ExecutionReport() const
+{
+    const HashMap<void*, JavaScriptInstance*>& instanceMap = JavaScriptInstance::Instances();
+    PODVector<JavaScriptInstance*> instances;
+    for (HashMap<void*, JavaScriptInstance*>::ConstIterator i = instanceMap.Begin(); i != instanceMap.End(); ++i)
+        instances.Push(i->second_);
+    Urho3D::Sort(instances.Begin(), instances.End(), CompareLastFrameTime);
+
+    char line[256];
+    sprintf(line, "%-48s %8s %8s %8s %8s %8s %10s\n", "Script", "Last ms", "Peak ms", "Avg ms", "Calls", "Overruns", "Heap KB");
+    String report(line);
+    for (uint i = 0; i < instances.Size(); ++i)
+    {
+        const JavaScriptExecutionStats& stats = instances[i]->ExecutionStats();
+        JavaScriptHeapAllocator* allocator = instances[i]->HeapAllocator();
+        sprintf(line, "%-48s %8.3f %8.3f %8.3f %8u %8u %9u%s\n", instances[i]->DebugName().Substring(0, 48).CString(),
+            stats.lastFrameTime / 1000.0, stats.peakFrameTime / 1000.0, (stats.numFrames ? stats.totalTime / 1000.0 / stats.numFrames : 0.0),
+            stats.numCalls, stats.numTimeouts, (allocator ? static_cast<uint>(allocator->AllocatedBytes() / 1024) : 0),
+            (instances[i]->SharedHeap() ? "*" : " "));
+        report += line;
+    }
+    if (frameBudget_)
+    {
+        sprintf(line, "Frame budget %.3f ms. ", frameBudget_ / 1000.0);
+        report += line;
+    }
+    report += "Heap sizes marked with * are totals of a shared heap.";
+    return report;
+}
+
+void JavaScript::PrintExecutionReport()
+{
+    LogInfo(ExecutionReport());
 }
 
 void JavaScript::OnSceneCreated(Scene *scene, AttributeChange::Type /*change*/)
@@ -169,6 +363,19 @@ void JavaScript::PrepareScriptInstance(JavaScriptInstance* instance, Script* scr
 
     duk_context* ctx = instance->Context();
 
+    if (instance->SharedHeap())
+    {
+        CopySharedGlobals(ctx, instance->SharedHeap()->Context());
+
+        instance->RegisterService("engine", instance);
+        if (scriptComp)
+        {
+            instance->RegisterService("me", scriptComp->ParentEntity());
+            instance->RegisterService("scene", scriptComp->ParentScene());
+        }
+        return;
+    }
+
     {
         URHO3D_PROFILE(ExposeMathClasses);
         ExposeMathClasses(ctx);
@@ -180,6 +387,13 @@ void JavaScript::PrepareScriptInstance(JavaScriptInstance* instance, Script* scr
     {
         URHO3D_PROFILE(ExposeJavaScriptClasses);
         ExposeJavaScriptClasses(ctx);
+
+        // The bindings generator does not handle function parameters, so QueueMainThreadCall is added by hand
+        duk_get_global_string(ctx, "JavaScriptInstance");
+        duk_get_prop_string(ctx, -1, "prototype");
+        duk_push_c_function(ctx, JavaScriptInstance_QueueMainThreadCall, DUK_VARARGS);
+        duk_put_prop_string(ctx, -2, "QueueMainThreadCall");
+        duk_pop_2(ctx);
     }
 
     instance->RegisterService("framework", framework);
@@ -198,6 +412,76 @@ void JavaScript::PrepareScriptInstance(JavaScriptInstance* instance, Script* scr
     }
 }
 
+SharedPtr<JavaScriptInstance> JavaScript::AcquireSharedHeap()
+{
+    if (!numSharedHeaps_)
+        return SharedPtr<JavaScriptInstance>();
+
+    // Prefer the heap with the least instances, the warm instances are referred to by the instances in their heap
+    JavaScriptInstance* heap = 0;
+    for (uint i = 0; i < sharedHeaps_.Size(); ++i)
+        if (!heap || sharedHeaps_[i]->Refs() < heap->Refs())
+            heap = sharedHeaps_[i];
+
+    // Create heaps up to the limit before sharing one that is in use
+    if (!heap || (heap->Refs() > 1 && sharedHeaps_.Size() < numSharedHeaps_))
+    {
+        URHO3D_PROFILE(JavaScript_CreateSharedHeap);
+        heap = new JavaScriptInstance(this);
+        sharedHeaps_.Push(SharedPtr<JavaScriptInstance>(heap));
+    }
+    return SharedPtr<JavaScriptInstance>(heap);
+}
+
+bool JavaScript::LoadCompiledScript(ScriptAsset* asset)
+{
+    URHO3D_PROFILE(JavaScript_LoadCompiledScript);
+
+    AssetCache *cache = framework->Asset()->Cache();
+    String path = (cache ? cache->FindDerivedData(asset->Name(), cCompiledScriptKind) : String());
+    Vector<u8> data;
+    if (path.Empty() || !LoadFileToVector(path, data))
+        return false;
+
+    // Duktape does not validate bytecode, so only accept files written by this Duktape version for the same content
+    u32 magic = 0, version = 0;
+    u64 contentHash = 0;
+    if (data.Size() > cCompiledScriptHeaderSize)
+    {
+        memcpy(&magic, &data[0], sizeof(u32));
+        memcpy(&version, &data[sizeof(u32)], sizeof(u32));
+        memcpy(&contentHash, &data[2 * sizeof(u32)], sizeof(u64));
+    }
+    if (magic != cCompiledScriptMagic || version != DUK_VERSION || contentHash != asset->contentHash)
+    {
+        LogDebug("JavaScript::LoadCompiledScript: Ignoring outdated compiled code of " + asset->Name());
+        return false;
+    }
+
+    asset->compiledCode.Resize(data.Size() - cCompiledScriptHeaderSize);
+    memcpy(&asset->compiledCode[0], &data[cCompiledScriptHeaderSize], asset->compiledCode.Size());
+    return true;
+}
+
+void JavaScript::StoreCompiledScript(ScriptAsset* asset)
+{
+    URHO3D_PROFILE(JavaScript_StoreCompiledScript);
+
+    AssetCache *cache = framework->Asset()->Cache();
+    if (!cache || asset->compiledCode.Empty())
+        return;
+
+    const u32 version = DUK_VERSION;
+    Vector<u8> data(cCompiledScriptHeaderSize + asset->compiledCode.Size());
+    memcpy(&data[0], &cCompiledScriptMagic, sizeof(u32));
+    memcpy(&data[sizeof(u32)], &version, sizeof(u32));
+    memcpy(&data[2 * sizeof(u32)], &asset->contentHash, sizeof(u64));
+    memcpy(&data[cCompiledScriptHeaderSize], &asset->compiledCode[0], asset->compiledCode.Size());
+    // Stored along with the asset in the cache, so that it is evicted with it and counts towards the cache size
+    if (cache->StoreDerivedData(asset->Name(), cCompiledScriptKind, &data[0], data.Size()).Empty())
+        LogWarning("JavaScript::StoreCompiledScript: Failed to write compiled code of " + asset->Name() + " to the asset cache");
+}
+
 void JavaScript::OnScriptClassNameChanged(Script* scriptComp, const String& /*newClassName*/)
 {
     // Check runmode for the object
@@ -287,6 +571,7 @@ void JavaScript::CreateScriptObject(Script* app, Script* instance, const String&
     
     const String& appAndClassName = instance->className.Get();
 
+    AutoExecutionBlock block(jsInstance);
     duk_context* ctx = jsInstance->Context();
     duk_push_global_object(ctx);
     duk_get_prop_string(ctx, -1, className.CString());
@@ -336,6 +621,7 @@ void JavaScript::RemoveScriptObject(Script* instance)
     JavaScriptInstance* jsInstance = dynamic_cast<JavaScriptInstance*>(app->ScriptInstance());
     if (jsInstance)
     {
+        AutoExecutionBlock block(jsInstance);
         duk_context* ctx = jsInstance->Context();
         duk_push_global_object(ctx);
         duk_get_prop_string(ctx, -1, "_RemoveScriptObject");
@@ -489,6 +775,32 @@ void JavaScript::RunScriptCommand(const StringVector& params)
         RunScript(params[0]);
 }
 
+/// @cond PRIVATE
+
+JavaScriptHudPanel::JavaScriptHudPanel(Framework *framework, JavaScript *module) :
+    DebugHudPanel(framework),
+    module_(module),
+    limiter_(1.f/5.f)
+{
+}
+
+SharedPtr<Urho3D::UIElement> JavaScriptHudPanel::CreateImpl()
+{
+    return SharedPtr<Urho3D::UIElement>(new Urho3D::Text(framework_->GetContext()));
+}
+
+void JavaScriptHudPanel::UpdatePanel(float frametime, const SharedPtr<Urho3D::UIElement> &widget)
+{
+    if (!limiter_.ShouldUpdate(frametime))
+        return;
+
+    Urho3D::Text *text = dynamic_cast<Urho3D::Text*>(widget.Get());
+    if (text)
+        text->SetText(module_->ExecutionReport());
+}
+
+/// @endcond
+
 }
 
 extern "C"
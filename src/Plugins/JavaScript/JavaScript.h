@@ -7,14 +7,35 @@
 #include "JavaScriptFwd.h"
 #include "Signals.h"
 #include "Scene.h"
+#include "CoreTimeUtils.h"
+#include "Debug/DebugHudPanel.h"
 
 namespace Tundra
 {
 
 class JavaScriptInstance;
+class JavaScriptHudPanel;
 class Script;
 
 /// JavaScript scripting module using the Duktape VM
+/** By default every script instance has a Duktape heap of its own. With '--jsSharedHeaps [num]' the script instances
+    of Script components are instead spread over at most num shared heaps. Each of them runs in a Duktape thread with
+    a global scope of its own, initialized by copying the bindings from a warm instance that was prepared once per heap,
+    which avoids re-exposing every class for each script. Note that the pooled scripts of a heap share the binding
+    constructors and prototypes, so modifying them from one script affects the others.
+
+    Script signal wrappers are created once per object and signal. Besides Connect(), they have ConnectBatched() for
+    high-frequency signals such as Scene::AttributeChanged: the handler is called once per frame on FrameAPI::PostFrameUpdate,
+    with an array holding the parameter array of each emit, eg. scene.AttributeChanged.ConnectBatched(function(events) {...}).
+
+    The execution time of every call from C++ into a script instance is measured, see AutoExecutionBlock. With
+    '--jsFrameBudget [msec]' an instance running longer than the budget during a frame is interrupted with a RangeError.
+    The times and heap usage are shown in the "JavaScript" tab of the debug HUD and printed by the jsStats console command.
+
+    A script instance with a heap of its own can be isolated with engine.SetIsolated(true), so that its FrameAPI::Updated
+    handlers run on the worker threads of the Urho3D WorkQueue in parallel with the other isolated instances. The attributes
+    they assign and the calls they queue with engine.QueueMainThreadCall are applied on the main thread on FrameAPI::PostFrameUpdate,
+    see JavaScriptInstance::SetIsolated. */
 class JAVASCRIPT_API JavaScript : public IModule
 {
     URHO3D_OBJECT(JavaScript, IModule);
@@ -24,11 +45,32 @@ public:
     ~JavaScript();
 
     /// Emitted when a new JavaScript engine instance has been created. Use this to expose more classes to the instance.
+    /** Not emitted for instances in a shared heap, they inherit the classes and services exposed to the warm instance of the heap. */
     Signal1<JavaScriptInstance*> ScriptInstanceCreated;
 
     /// Prepare a script engine by registering the API and service objects.
     void PrepareScriptInstance(JavaScriptInstance* instance, Script* scriptComp);
 
+    /// Return the warm instance of the least used shared heap, creating it if needed, or null if heaps are not shared.
+    SharedPtr<JavaScriptInstance> AcquireSharedHeap();
+
+    /// Set the maximum number of shared heaps, zero to give every instance a heap of its own. Set by '--jsSharedHeaps' on startup.
+    /** Existing instances keep their heaps. */
+    void SetNumSharedHeaps(uint num) { numSharedHeaps_ = num; }
+
+    /// Read the compiled code of a script asset from the asset cache.
+    /** @return True if compiled code matching the asset content was found. */
+    bool LoadCompiledScript(ScriptAsset* asset);
+
+    /// Write the compiled code of a script asset to the asset cache, so that later runs can skip compiling it.
+    void StoreCompiledScript(ScriptAsset* asset);
+
+    /// Return the execution time allowed for a script instance per frame in microseconds, zero if unlimited.
+    long long FrameBudget() const { return frameBudget_; }
+
+    /// Return the execution times and heap usage of the script instances as a table, the slowest instance first.
+    String ExecutionReport() const;
+
     /// Executes JS file.
     void RunScript(const String& scriptFilename);
 
@@ -39,8 +81,12 @@ private:
     void Load() override;
     void Initialize() override;
     void Uninitialize() override;
+    void Update(float frametime) override;
 
     void OnFirstFrame(float dt);
+    void OnPostFrameUpdate(float dt);
+    /// Runs the frame updates deferred by isolated script instances on the WorkQueue, and applies their attribute changes.
+    void RunIsolatedUpdates();
     void OnSceneCreated(Scene *scene, AttributeChange::Type);
     void OnComponentAdded(Entity* entity, IComponent* comp, AttributeChange::Type change);
     void OnComponentRemoved(Entity* entity, IComponent* comp, AttributeChange::Type change);
@@ -69,6 +115,9 @@ private:
     /// (Re)loads and executes startup scripts.
     void LoadStartupScripts();
 
+    /// Executes "print script execution stats" console command
+    void PrintExecutionReport();
+
     /// Stops and deletes startup scripts.
     void UnloadStartupScripts();
 
@@ -77,6 +126,37 @@ private:
 
     /// Engines for executing startup (possibly persistent) scripts.
     Vector<SharedPtr<JavaScriptInstance> > startupScripts_;
+
+    /// Maximum number of shared heaps, zero if every instance has a heap of its own.
+    uint numSharedHeaps_;
+
+    /// Warm instances owning the shared heaps.
+    Vector<SharedPtr<JavaScriptInstance> > sharedHeaps_;
+
+    /// Execution time allowed for a script instance per frame in microseconds, zero if unlimited.
+    long long frameBudget_;
+
+    SharedPtr<JavaScriptHudPanel> hudPanel_;
+};
+
+/// @cond PRIVATE
+class JavaScriptHudPanel : public DebugHudPanel
+{
+public:
+    JavaScriptHudPanel(Framework *framework, JavaScript *module);
+
+    /// DebugHudPanel override.
+    void UpdatePanel(float frametime, const SharedPtr<Urho3D::UIElement> &widget) override;
+
+protected:
+    /// DebugHudPanel override.
+    SharedPtr<Urho3D::UIElement> CreateImpl() override;
+
+private:
+    JavaScript *module_;
+
+    FrameLimiter limiter_;
 };
+/// @endcond
 
 }
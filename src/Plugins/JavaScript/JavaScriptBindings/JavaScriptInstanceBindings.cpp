@@ -44,16 +44,10 @@ public:
     void OnSignal(JavaScriptInstance * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -65,6 +59,7 @@ static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptEvaluated_Finalizer(duk_
 
 static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptEvaluated_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_JavaScriptInstance_ScriptEvaluated* wrapper = GetThisValueObject<SignalWrapper_JavaScriptInstance_ScriptEvaluated>(ctx, SignalWrapper_JavaScriptInstance_ScriptEvaluated_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -82,6 +77,7 @@ static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptEvaluated_Connect(duk_co
 
 static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptEvaluated_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_JavaScriptInstance_ScriptEvaluated* wrapper = GetThisValueObject<SignalWrapper_JavaScriptInstance_ScriptEvaluated>(ctx, SignalWrapper_JavaScriptInstance_ScriptEvaluated_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -90,6 +86,7 @@ static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptEvaluated_Disconnect(duk
 
 static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptEvaluated_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_JavaScriptInstance_ScriptEvaluated* wrapper = GetThisValueObject<SignalWrapper_JavaScriptInstance_ScriptEvaluated>(ctx, SignalWrapper_JavaScriptInstance_ScriptEvaluated_ID);
     if (!wrapper->owner_) return 0;
     JavaScriptInstance* param0 = GetWeakObject<JavaScriptInstance>(ctx, 0);
@@ -100,7 +97,8 @@ static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptEvaluated_Emit(duk_conte
 static duk_ret_t JavaScriptInstance_Get_ScriptEvaluated(duk_context* ctx)
 {
     JavaScriptInstance* thisObj = GetThisWeakObject<JavaScriptInstance>(ctx);
-    SignalWrapper_JavaScriptInstance_ScriptEvaluated* wrapper = new SignalWrapper_JavaScriptInstance_ScriptEvaluated(thisObj, &thisObj->ScriptEvaluated);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalScriptEvaluated")) return 1;
+    SignalWrapper_JavaScriptInstance_ScriptEvaluated* wrapper = new (ctx) SignalWrapper_JavaScriptInstance_ScriptEvaluated(thisObj, &thisObj->ScriptEvaluated);
     PushValueObject(ctx, wrapper, SignalWrapper_JavaScriptInstance_ScriptEvaluated_ID, SignalWrapper_JavaScriptInstance_ScriptEvaluated_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_JavaScriptInstance_ScriptEvaluated_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -110,8 +108,15 @@ static duk_ret_t JavaScriptInstance_Get_ScriptEvaluated(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_JavaScriptInstance_ScriptEvaluated_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_JavaScriptInstance_ScriptEvaluated_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_JavaScriptInstance_ScriptEvaluated_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_JavaScriptInstance_ScriptEvaluated_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalScriptEvaluated");
     return 1;
 }
 
@@ -136,16 +141,10 @@ public:
     void OnSignal(JavaScriptInstance * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -157,6 +156,7 @@ static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptUnloading_Finalizer(duk_
 
 static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptUnloading_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_JavaScriptInstance_ScriptUnloading* wrapper = GetThisValueObject<SignalWrapper_JavaScriptInstance_ScriptUnloading>(ctx, SignalWrapper_JavaScriptInstance_ScriptUnloading_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -174,6 +174,7 @@ static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptUnloading_Connect(duk_co
 
 static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptUnloading_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_JavaScriptInstance_ScriptUnloading* wrapper = GetThisValueObject<SignalWrapper_JavaScriptInstance_ScriptUnloading>(ctx, SignalWrapper_JavaScriptInstance_ScriptUnloading_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -182,6 +183,7 @@ static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptUnloading_Disconnect(duk
 
 static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptUnloading_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_JavaScriptInstance_ScriptUnloading* wrapper = GetThisValueObject<SignalWrapper_JavaScriptInstance_ScriptUnloading>(ctx, SignalWrapper_JavaScriptInstance_ScriptUnloading_ID);
     if (!wrapper->owner_) return 0;
     JavaScriptInstance* param0 = GetWeakObject<JavaScriptInstance>(ctx, 0);
@@ -192,7 +194,8 @@ static duk_ret_t SignalWrapper_JavaScriptInstance_ScriptUnloading_Emit(duk_conte
 static duk_ret_t JavaScriptInstance_Get_ScriptUnloading(duk_context* ctx)
 {
     JavaScriptInstance* thisObj = GetThisWeakObject<JavaScriptInstance>(ctx);
-    SignalWrapper_JavaScriptInstance_ScriptUnloading* wrapper = new SignalWrapper_JavaScriptInstance_ScriptUnloading(thisObj, &thisObj->ScriptUnloading);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalScriptUnloading")) return 1;
+    SignalWrapper_JavaScriptInstance_ScriptUnloading* wrapper = new (ctx) SignalWrapper_JavaScriptInstance_ScriptUnloading(thisObj, &thisObj->ScriptUnloading);
     PushValueObject(ctx, wrapper, SignalWrapper_JavaScriptInstance_ScriptUnloading_ID, SignalWrapper_JavaScriptInstance_ScriptUnloading_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_JavaScriptInstance_ScriptUnloading_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -202,8 +205,15 @@ static duk_ret_t JavaScriptInstance_Get_ScriptUnloading(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_JavaScriptInstance_ScriptUnloading_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_JavaScriptInstance_ScriptUnloading_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_JavaScriptInstance_ScriptUnloading_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_JavaScriptInstance_ScriptUnloading_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalScriptUnloading");
     return 1;
 }
 
@@ -234,10 +244,28 @@ static duk_ret_t JavaScriptInstance_IsEvaluated(duk_context* ctx)
     return 1;
 }
 
+static duk_ret_t JavaScriptInstance_SetIsolated_bool(duk_context* ctx)
+{
+    JavaScriptInstance* thisObj = GetThisWeakObject<JavaScriptInstance>(ctx);
+    bool isolated = duk_require_boolean(ctx, 0);
+    thisObj->SetIsolated(isolated);
+    return 0;
+}
+
+static duk_ret_t JavaScriptInstance_IsIsolated(duk_context* ctx)
+{
+    JavaScriptInstance* thisObj = GetThisWeakObject<JavaScriptInstance>(ctx);
+    bool ret = thisObj->IsIsolated();
+    duk_push_boolean(ctx, ret);
+    return 1;
+}
+
 static const duk_function_list_entry JavaScriptInstance_Functions[] = {
     {"Execute", JavaScriptInstance_Execute_String_bool, DUK_VARARGS}
     ,{"IncludeFile", JavaScriptInstance_IncludeFile_String, 1}
     ,{"IsEvaluated", JavaScriptInstance_IsEvaluated, 0}
+    ,{"SetIsolated", JavaScriptInstance_SetIsolated_bool, 1}
+    ,{"IsIsolated", JavaScriptInstance_IsIsolated, 0}
     ,{nullptr, nullptr, 0}
 };
 
@@ -0,0 +1,187 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "StableHeaders.h"
+#include "JavaScriptHeapAllocator.h"
+
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/Math/MathDefs.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace Tundra
+{
+
+static void* AllocateFunc(void* udata, duk_size_t size)
+{
+    return static_cast<JavaScriptHeapAllocator*>(udata)->Allocate(size);
+}
+
+static void* ReallocateFunc(void* udata, void* ptr, duk_size_t size)
+{
+    return static_cast<JavaScriptHeapAllocator*>(udata)->Reallocate(ptr, size);
+}
+
+static void FreeFunc(void* udata, void* ptr)
+{
+    static_cast<JavaScriptHeapAllocator*>(udata)->Free(ptr);
+}
+
+}
+
+/// Duktape exec timeout check, see duk_config.h. Heaps not created by JavaScriptHeapAllocator have no user data and no limit.
+extern "C" int TundraDukExecTimeoutCheck(void* udata)
+{
+    return udata && static_cast<Tundra::JavaScriptHeapAllocator*>(udata)->ExecutionLimitExceeded() ? 1 : 0;
+}
+
+namespace Tundra
+{
+
+JavaScriptHeapAllocator::JavaScriptHeapAllocator() :
+    chunkPos_(0),
+    chunkEnd_(0),
+    allocatedBytes_(0),
+    reservedBytes_(0),
+    peakAllocatedBytes_(0),
+    executionTimer_(0),
+    executionBudget_(0)
+{
+    memset(freeLists_, 0, sizeof(freeLists_));
+}
+
+JavaScriptHeapAllocator::~JavaScriptHeapAllocator()
+{
+    for (uint i = 0; i < chunks_.Size(); ++i)
+        free(chunks_[i]);
+}
+
+duk_context* JavaScriptHeapAllocator::CreateHeap()
+{
+    return duk_create_heap(AllocateFunc, ReallocateFunc, FreeFunc, this, 0);
+}
+
+void JavaScriptHeapAllocator::SetExecutionLimit(Urho3D::HiresTimer* timer, long long budgetUSec)
+{
+    executionTimer_ = timer;
+    executionBudget_ = budgetUSec;
+}
+
+bool JavaScriptHeapAllocator::ExecutionLimitExceeded() const
+{
+    return executionTimer_ && executionTimer_->GetUSec(false) > executionBudget_;
+}
+
+JavaScriptHeapAllocator::Header* JavaScriptHeapAllocator::AllocateBlock(size_t sizeClass)
+{
+    const size_t blockSize = sizeof(Header) + sizeClass * cGranularity;
+    if (chunkPos_ + blockSize > chunkEnd_)
+    {
+        // The remainder of the previous chunk is left unused
+        u8* chunk = static_cast<u8*>(malloc(cChunkSize));
+        if (!chunk)
+            return 0;
+        chunks_.Push(chunk);
+        reservedBytes_ += cChunkSize;
+        chunkPos_ = chunk;
+        chunkEnd_ = chunk + cChunkSize;
+    }
+    Header* header = reinterpret_cast<Header*>(chunkPos_);
+    chunkPos_ += blockSize;
+    return header;
+}
+
+void* JavaScriptHeapAllocator::Allocate(size_t size)
+{
+    if (!size)
+        return 0;
+
+    Header* header = 0;
+    if (size <= cMaxPooledSize)
+    {
+        const size_t sizeClass = SizeClass(size);
+        if (freeLists_[sizeClass])
+        {
+            header = reinterpret_cast<Header*>(freeLists_[sizeClass]);
+            freeLists_[sizeClass] = freeLists_[sizeClass]->next;
+        }
+        else
+            header = AllocateBlock(sizeClass);
+    }
+    else
+    {
+        header = static_cast<Header*>(malloc(sizeof(Header) + size));
+        if (header)
+            reservedBytes_ += sizeof(Header) + size;
+    }
+    if (!header)
+        return 0;
+
+    header->size = size;
+    allocatedBytes_ += size;
+    peakAllocatedBytes_ = Urho3D::Max(peakAllocatedBytes_, allocatedBytes_);
+    return header + 1;
+}
+
+void* JavaScriptHeapAllocator::Reallocate(void* ptr, size_t size)
+{
+    if (!ptr)
+        return Allocate(size);
+    if (!size)
+    {
+        Free(ptr);
+        return 0;
+    }
+
+    Header* header = static_cast<Header*>(ptr) - 1;
+    const size_t oldSize = header->size;
+    if (oldSize > cMaxPooledSize && size > cMaxPooledSize)
+    {
+        Header* newHeader = static_cast<Header*>(realloc(header, sizeof(Header) + size));
+        if (!newHeader)
+            return 0;
+        newHeader->size = size;
+        reservedBytes_ += size - oldSize;
+        allocatedBytes_ += size - oldSize;
+        peakAllocatedBytes_ = Urho3D::Max(peakAllocatedBytes_, allocatedBytes_);
+        return newHeader + 1;
+    }
+    if (oldSize <= cMaxPooledSize && size <= cMaxPooledSize && SizeClass(oldSize) == SizeClass(size))
+    {
+        header->size = size;
+        allocatedBytes_ += size - oldSize;
+        peakAllocatedBytes_ = Urho3D::Max(peakAllocatedBytes_, allocatedBytes_);
+        return ptr;
+    }
+
+    void* newPtr = Allocate(size);
+    if (!newPtr)
+        return 0;
+    memcpy(newPtr, ptr, Urho3D::Min(oldSize, size));
+    Free(ptr);
+    return newPtr;
+}
+
+void JavaScriptHeapAllocator::Free(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    Header* header = static_cast<Header*>(ptr) - 1;
+    const size_t size = header->size;
+    allocatedBytes_ -= size;
+    if (size <= cMaxPooledSize)
+    {
+        const size_t sizeClass = SizeClass(size);
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(header);
+        block->next = freeLists_[sizeClass];
+        freeLists_[sizeClass] = block;
+    }
+    else
+    {
+        reservedBytes_ -= sizeof(Header) + size;
+        free(header);
+    }
+}
+
+}
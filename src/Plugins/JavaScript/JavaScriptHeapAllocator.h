@@ -0,0 +1,103 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "JavaScriptApi.h"
+#include "duktape.h"
+
+#include <Urho3D/Container/Vector.h>
+
+namespace Urho3D
+{
+    class HiresTimer;
+}
+
+namespace Tundra
+{
+
+/// Pooling memory allocator for a Duktape heap.
+/** Small allocations, which include the JS objects and the value objects of the bindings (see BindingsHelpers.h),
+    are served from size class free lists carved from larger chunks, so that script temporaries do not hit malloc once the
+    pool has warmed up. Larger allocations go to malloc. Pooled memory is released only when the allocator is destroyed.
+    Not thread safe, a heap must be used from one thread at a time.
+
+    The allocator is the user data of the heap, so it also carries the execution limit checked by Duktape's exec timeout
+    hook, see SetExecutionLimit(). */
+class JAVASCRIPT_API JavaScriptHeapAllocator
+{
+public:
+    JavaScriptHeapAllocator();
+    ~JavaScriptHeapAllocator();
+
+    /// Create a Duktape heap that uses this allocator. The allocator must outlive the heap.
+    duk_context* CreateHeap();
+
+    void* Allocate(size_t size);
+    void* Reallocate(void* ptr, size_t size);
+    void Free(void* ptr);
+
+    /// Return bytes currently allocated by the heap, excluding the allocator overhead.
+    size_t AllocatedBytes() const { return allocatedBytes_; }
+
+    /// Return bytes reserved from the system, including the free lists.
+    size_t ReservedBytes() const { return reservedBytes_; }
+
+    /// Return the highest number of bytes allocated at once.
+    size_t PeakAllocatedBytes() const { return peakAllocatedBytes_; }
+
+    /// Limit the execution of the heap to budgetUSec microseconds as measured by timer. Null timer removes the limit.
+    /** Duktape checks the limit every 256k bytecode instructions, and keeps throwing a RangeError from the running script
+        until it has returned to C++. The timer must outlive the limit. */
+    void SetExecutionLimit(Urho3D::HiresTimer* timer, long long budgetUSec);
+
+    /// Return the timer of the execution limit, or null if there is no limit.
+    Urho3D::HiresTimer* ExecutionTimer() const { return executionTimer_; }
+
+    /// Return the execution budget in microseconds.
+    long long ExecutionBudget() const { return executionBudget_; }
+
+    /// Return whether the execution limit has been exceeded.
+    bool ExecutionLimitExceeded() const;
+
+    /// Size class granularity in bytes.
+    static const size_t cGranularity = 16;
+    /// Largest allocation served from the free lists.
+    static const size_t cMaxPooledSize = 256;
+    /// Size of the chunks the free lists are carved from.
+    static const size_t cChunkSize = 64 * 1024;
+
+private:
+    /// Header preceding each allocation. Padded to keep the allocations 16-byte aligned for SIMD math types.
+    struct Header
+    {
+        size_t size;
+        size_t padding;
+    };
+
+    /// Free list entry stored in the memory of a free block.
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    static const size_t cNumSizeClasses = cMaxPooledSize / cGranularity;
+
+    /// Return the size class of a pooled allocation size, 1-based.
+    static size_t SizeClass(size_t size) { return (size + cGranularity - 1) / cGranularity; }
+
+    /// Carve a new block of size class from the current chunk.
+    Header* AllocateBlock(size_t sizeClass);
+
+    FreeBlock* freeLists_[cNumSizeClasses + 1];
+    PODVector<u8*> chunks_;
+    u8* chunkPos_;
+    u8* chunkEnd_;
+    size_t allocatedBytes_;
+    size_t reservedBytes_;
+    size_t peakAllocatedBytes_;
+    Urho3D::HiresTimer* executionTimer_;
+    long long executionBudget_;
+};
+
+}
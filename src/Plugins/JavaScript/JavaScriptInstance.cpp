@@ -8,42 +8,76 @@
 #include "LoggingFunctions.h"
 #include "AssetAPI.h"
 #include "Script.h"
+#include "Entity.h"
+#include "FrameAPI.h"
 #include "BindingsHelpers.h"
+#include "JavaScriptHeapAllocator.h"
 
 #include <Urho3D/Core/Profiler.h>
+#include <Urho3D/Core/Thread.h>
 #include <Urho3D/IO/FileSystem.h>
 #include <Urho3D/IO/File.h>
 
+#include <cstring>
+
 using namespace JSBindings;
 
 namespace Tundra
 {
 
+static duk_ret_t LoadFunction(duk_context* ctx)
+{
+    duk_load_function(ctx);
+    return 1;
+}
+
 #define JS_PROFILE(name) Urho3D::AutoProfileBlock profile_ ## name (module_->GetSubsystem<Urho3D::Profiler>(), #name)
 
 HashMap<void*, JavaScriptInstance*> JavaScriptInstance::instanceMap;
+bool JavaScriptInstance::isolatedUpdatesRunning = false;
+
+static const char* signalBatchesKey = "\xff""signalBatches";
+static const char* isolatedUpdateParamsKey = "\xff""isolatedUpdate";
+static const char* mainThreadCallsKey = "\xff""mainThreadCalls";
 
+/// The connection arrays are replaced instead of modified, so that a dispatch in progress iterates the connections it started with.
+/// Disconnected connections are flagged, so that they are not called once the dispatch reaches them.
 static const String signalSupportCode =
     "_connections = {};\n"
-    "function _ConnectSignal(key, obj, func) {\n"
-    "if (!_connections.hasOwnProperty(key)) _connections[key] = [];\n"
-    "var connections = _connections[key];\n"
+    "_batchedConnections = {};\n"
+    "function _ConnectSignal(key, batched, obj, func) {\n"
+    "var all = batched ? _batchedConnections : _connections;\n"
+    "if (!all.hasOwnProperty(key)) all[key] = [];\n"
+    "var connections = all[key];\n"
     "if (!func) { func = obj; obj = null; }\n"
-    "if (!func || typeof func != 'function') return;\n"
-    "for (var i = 0; i < connections.length; ++i) { if (connections[i].obj == obj && connections[i].func == func) return; }\n" // Check duplicate
-    "connections.push({ 'obj' : obj, 'func' : func });\n"
+    "if (!func || typeof func != 'function') return connections.length;\n"
+    "for (var i = 0; i < connections.length; ++i) { if (connections[i].obj == obj && connections[i].func == func) return connections.length; }\n" // Check duplicate
+    "all[key] = connections.concat([{ 'obj' : obj, 'func' : func }]);\n"
+    "return connections.length + 1;\n"
     "}\n"
-    "function _DisconnectSignal(key, obj, func) {\n"
-    "if (!_connections.hasOwnProperty(key)) return;\n"
-    "var connections = _connections[key];\n"
+    "function _DisconnectSignal(key, batched, obj, func) {\n"
+    "var all = batched ? _batchedConnections : _connections;\n"
+    "if (!all.hasOwnProperty(key)) return 0;\n"
+    "var connections = all[key];\n"
     "if (!func) { func = obj; obj = null; }\n"
-    "for (var i = 0; i < connections.length; ++i) { if (connections[i].obj == obj && connections[i].func == func) { connections.splice(i, 1); return; } }\n"
-    "return connections.length == 0;\n" // Return true if all connections removed, in which case the C++ wrapper can be removed
+    "for (var i = 0; i < connections.length; ++i) {\n"
+    "if (connections[i].obj == obj && connections[i].func == func) {\n"
+    "connections[i].removed = true;\n"
+    "all[key] = connections.slice(0, i).concat(connections.slice(i + 1));\n"
+    "return connections.length - 1;\n"
+    "}\n"
+    "}\n"
+    "return connections.length;\n" // The C++ receiver is removed when neither kind of connections remain
     "}\n"
     "function _OnSignal(key, params) {\n"
     "if (!_connections.hasOwnProperty(key)) return\n"
     "var connections = _connections[key]\n"
-    "for (var i = 0; i < connections.length; ++i) { connections[i].func.apply(connections[i].obj, params); }\n"
+    "for (var i = 0; i < connections.length; ++i) { if (!connections[i].removed) connections[i].func.apply(connections[i].obj, params); }\n"
+    "}\n"
+    "function _OnSignalBatch(key, events) {\n"
+    "if (!_batchedConnections.hasOwnProperty(key)) return\n"
+    "var connections = _batchedConnections[key]\n"
+    "for (var i = 0; i < connections.length; ++i) { if (!connections[i].removed) connections[i].func.call(connections[i].obj, events); }\n"
     "}\n"
     "_scriptObjects = {};\n"
     "function _StoreScriptObject(key, obj) {\n"
@@ -69,9 +103,16 @@ static const String signalSupportCode =
 JavaScriptInstance::JavaScriptInstance(JavaScript *module, Script* owner) :
     IScriptInstance(module->GetContext()),
     ctx_(0),
+    allocator_(0),
     module_(module),
     owner_(owner),
-    evaluated_(false)
+    evaluated_(false),
+    executionDepth_(0),
+    isolated_(false),
+    isolatedUpdateKey_(0),
+    isolatedEntity_(0),
+    numQueuedCalls_(0),
+    threadsReleased_(false)
 {
     assert(module);
     CreateEngine();
@@ -80,10 +121,17 @@ JavaScriptInstance::JavaScriptInstance(JavaScript *module, Script* owner) :
 JavaScriptInstance::JavaScriptInstance(const String &fileName, JavaScript *module, Script* owner) :
     IScriptInstance(module->GetContext()),
     ctx_(0),
+    allocator_(0),
     sourceFile_(fileName),
     module_(module),
     owner_(owner),
-    evaluated_(false)
+    evaluated_(false),
+    executionDepth_(0),
+    isolated_(false),
+    isolatedUpdateKey_(0),
+    isolatedEntity_(0),
+    numQueuedCalls_(0),
+    threadsReleased_(false)
 {
     assert(module);
     CreateEngine();
@@ -93,9 +141,16 @@ JavaScriptInstance::JavaScriptInstance(const String &fileName, JavaScript *modul
 JavaScriptInstance::JavaScriptInstance(ScriptAssetPtr scriptRef, JavaScript *module, Script* owner) :
     IScriptInstance(module->GetContext()),
     ctx_(0),
+    allocator_(0),
     module_(module),
     owner_(owner),
-    evaluated_(false)
+    evaluated_(false),
+    executionDepth_(0),
+    isolated_(false),
+    isolatedUpdateKey_(0),
+    isolatedEntity_(0),
+    numQueuedCalls_(0),
+    threadsReleased_(false)
 {
     assert(module);
     // Make sure we do not push null or empty script assets as sources
@@ -109,9 +164,16 @@ JavaScriptInstance::JavaScriptInstance(ScriptAssetPtr scriptRef, JavaScript *mod
 JavaScriptInstance::JavaScriptInstance(const Vector<ScriptAssetPtr>& scriptRefs, JavaScript *module, Script* owner) :
     IScriptInstance(module->GetContext()),
     ctx_(0),
+    allocator_(0),
     module_(module),
     owner_(owner),
-    evaluated_(false)
+    evaluated_(false),
+    executionDepth_(0),
+    isolated_(false),
+    isolatedUpdateKey_(0),
+    isolatedEntity_(0),
+    numQueuedCalls_(0),
+    threadsReleased_(false)
 {
     assert(module);
     // Make sure we do not push null or empty script assets as sources
@@ -124,14 +186,35 @@ JavaScriptInstance::JavaScriptInstance(const Vector<ScriptAssetPtr>& scriptRefs,
 
 void JavaScriptInstance::CreateEngine()
 {
-    ctx_ = duk_create_heap_default();
+    // Script component instances may run in a thread of a shared heap, with a global scope of their own
+    if (owner_)
+        sharedHeap_ = module_->AcquireSharedHeap();
+
+    if (sharedHeap_)
+    {
+        duk_context* heapCtx = sharedHeap_->Context();
+        // Keep the thread alive in the heap stash until the engine is deleted
+        duk_push_heap_stash(heapCtx);
+        ctx_ = duk_get_context(heapCtx, duk_push_thread_new_globalenv(heapCtx));
+        duk_push_pointer(heapCtx, ctx_);
+        duk_insert(heapCtx, -2);
+        duk_put_prop(heapCtx, -3);
+        duk_pop(heapCtx);
+    }
+    else
+    {
+        allocator_ = new JavaScriptHeapAllocator();
+        ctx_ = allocator_->CreateHeap();
+    }
+
     instanceMap[ctx_] = this;
     Evaluate(signalSupportCode, "JSInstanceInternal");
 
     Script *ec = dynamic_cast<Script*>(owner_.Get());
     module_->PrepareScriptInstance(this, ec);
 
-    module_->ScriptInstanceCreated.Emit(this);
+    if (!sharedHeap_)
+        module_->ScriptInstanceCreated.Emit(this);
 }
 
 void JavaScriptInstance::DeleteEngine()
@@ -146,12 +229,47 @@ void JavaScriptInstance::DeleteEngine()
         // or when the system is unloading.
         Execute("OnScriptDestroyed", false);
 
+        // The receivers refer to the context, which is about to be deleted
+        signalReceivers_.Clear();
+        batchedSignals_.Clear();
+        isolatedUpdateKey_ = 0;
+        for (uint i = 0; i < queuedChanges_.Size(); ++i)
+            delete queuedChanges_[i].value;
+        queuedChanges_.Clear();
+        numQueuedCalls_ = 0;
         instanceMap.Erase(ctx_);
-        duk_destroy_heap(ctx_);
+
+        if (sharedHeap_)
+        {
+            // Release the thread. Its global scope is garbage collected along with it on the next collection of the heap,
+            // which JavaScript runs at most once per frame, see CollectReleasedThreads
+            duk_context* heapCtx = sharedHeap_->Context();
+            duk_push_heap_stash(heapCtx);
+            duk_push_pointer(heapCtx, ctx_);
+            duk_del_prop(heapCtx, -2);
+            duk_pop(heapCtx);
+            sharedHeap_->threadsReleased_ = true;
+            sharedHeap_.Reset();
+        }
+        else
+        {
+            duk_destroy_heap(ctx_);
+            SAFE_DELETE(allocator_);
+        }
         ctx_ = 0;
     }
 }
 
+void JavaScriptInstance::CollectReleasedThreads()
+{
+    if (!threadsReleased_ || !ctx_)
+        return;
+
+    JS_PROFILE(JavaScriptInstance_CollectReleasedThreads);
+    threadsReleased_ = false;
+    duk_gc(ctx_, 0);
+}
+
 JavaScriptInstance::~JavaScriptInstance()
 {
     DeleteEngine();
@@ -295,10 +413,8 @@ void JavaScriptInstance::Run()
     for (size_t i = 0; i < numScripts; ++i)
     {
         JS_PROFILE(JSInstance_Evaluate);
-        String scriptSourceFilename = (useAssets ? scriptRefs_[i]->Name() : sourceFile_);
-        const String &scriptContent = (useAssets ? scriptRefs_[i]->scriptContent : program_);
-
-        if (!Evaluate(scriptContent, scriptSourceFilename))
+        bool success = (useAssets ? Evaluate(scriptRefs_[i]) : Evaluate(program_, sourceFile_));
+        if (!success)
             break;
     }
 
@@ -314,6 +430,7 @@ bool JavaScriptInstance::Evaluate(const String& script, const String& fileName)
         return false;
     }
 
+    AutoExecutionBlock block(this, false);
     duk_push_string(ctx_, script.CString());
     duk_push_string(ctx_, fileName.CString());
     bool success = duk_eval_raw(ctx_, NULL, 0, DUK_COMPILE_EVAL | DUK_COMPILE_SAFE) == 0;
@@ -324,6 +441,69 @@ bool JavaScriptInstance::Evaluate(const String& script, const String& fileName)
     return success;
 }
 
+bool JavaScriptInstance::Evaluate(ScriptAsset* asset)
+{
+    if (!ctx_)
+    {
+        LogError("[Javascript] Cannot evaluate, script engine not created.");
+        return false;
+    }
+
+    AutoExecutionBlock block(this, false);
+    if (asset->compiledCode.Empty())
+        module_->LoadCompiledScript(asset);
+
+    bool loaded = false;
+    if (!asset->compiledCode.Empty())
+    {
+        JS_PROFILE(JSInstance_LoadFunction);
+        void* buffer = duk_push_fixed_buffer(ctx_, asset->compiledCode.Size());
+        memcpy(buffer, &asset->compiledCode[0], asset->compiledCode.Size());
+        loaded = duk_safe_call(ctx_, LoadFunction, 1, 1) == DUK_EXEC_SUCCESS;
+        if (!loaded)
+        {
+            LogWarning("[JavaScript] Evaluate: Discarding invalid compiled code of " + asset->Name() + ": " + GetErrorString(ctx_));
+            duk_pop(ctx_); // Pop error
+            asset->compiledCode.Clear();
+        }
+    }
+
+    if (!loaded)
+    {
+        JS_PROFILE(JSInstance_Compile);
+        duk_push_string(ctx_, asset->scriptContent.CString());
+        duk_push_string(ctx_, asset->Name().CString());
+        // Compile as eval code like Evaluate(String) does, so that a script behaves the same whether it is run from source
+        // or from the cache: its global declarations stay configurable. The flag is stored in the bytecode.
+        if (duk_pcompile(ctx_, DUK_COMPILE_EVAL) != 0)
+        {
+            LogError("[JavaScript] Evaluate: " + GetErrorString(ctx_));
+            duk_pop(ctx_); // Pop error
+            return false;
+        }
+
+        // Dump before running, so that the bytecode is that of the unmodified program
+        duk_dup_top(ctx_);
+        duk_dump_function(ctx_);
+        duk_size_t size = 0;
+        const void* data = duk_get_buffer(ctx_, -1, &size);
+        asset->compiledCode.Resize(static_cast<uint>(size));
+        if (size)
+            memcpy(&asset->compiledCode[0], data, size);
+        duk_pop(ctx_); // Pop bytecode
+        module_->StoreCompiledScript(asset);
+    }
+
+    // Eval code runs with the global object as 'this', as in duk_eval
+    duk_push_global_object(ctx_);
+    bool success = duk_pcall_method(ctx_, 0) == 0;
+    if (!success)
+        LogError("[JavaScript] Evaluate: " + GetErrorString(ctx_));
+
+    duk_pop(ctx_); // Pop result/error
+    return success;
+}
+
 bool JavaScriptInstance::Execute(const String& functionName, bool logError)
 {
     if (!ctx_)
@@ -332,6 +512,7 @@ bool JavaScriptInstance::Execute(const String& functionName, bool logError)
         return false;
     }
 
+    AutoExecutionBlock block(this);
     duk_push_global_object(ctx_);
     duk_get_prop_string(ctx_, -1, functionName.CString());
     duk_remove(ctx_, -2); // Remove global object
@@ -352,14 +533,17 @@ void JavaScriptInstance::IncludeFile(const String &path)
             return;
         }
 
-    String script = LoadScript(path);
-
     /*
     context->setActivationObject(context->parentContext()->activationObject());
     context->setThisObject(context->parentContext()->thisObject());
     */
 
-    Evaluate(script, path);
+    // Included assets can use their compiled code
+    ScriptAssetPtr asset = Urho3D::DynamicCast<ScriptAsset>(module_->GetFramework()->Asset()->FindAsset(path));
+    if (asset && !asset->scriptContent.Empty())
+        Evaluate(asset);
+    else
+        Evaluate(LoadScript(path), path);
     includedFiles_.Push(path);
 }
 
@@ -382,4 +566,314 @@ JavaScriptInstance* JavaScriptInstance::InstanceFromContext(duk_context* ctx)
     return i != instanceMap.End() ? i->second_ : nullptr;
 }
 
+void JavaScriptInstance::EndFrame()
+{
+    JavaScriptExecutionStats& stats = executionStats_;
+    stats.lastFrameTime = stats.frameTime;
+    stats.peakFrameTime = Urho3D::Max(stats.peakFrameTime, stats.frameTime);
+    stats.frameTime = 0;
+    ++stats.numFrames;
+}
+
+String JavaScriptInstance::DebugName() const
+{
+    String name;
+    for (uint i = 0; i < scriptRefs_.Size(); ++i)
+        name += (i > 0 ? ", " : "") + scriptRefs_[i]->Name();
+    if (name.Empty())
+        name = !sourceFile_.Empty() ? sourceFile_ : String("(no script)");
+
+    Script* script = dynamic_cast<Script*>(owner_.Get());
+    if (script && script->ParentEntity())
+        name += " in " + script->ParentEntity()->ToString();
+    return name;
+}
+
+void JavaScriptInstance::QueueSignalEvent(void* key)
+{
+    duk_context* ctx = ctx_;
+
+    // The events are kept in the global stash as arrays keyed by the signal, in the order the signals were first emitted
+    duk_push_global_stash(ctx);
+    if (!duk_get_prop_string(ctx, -1, signalBatchesKey))
+    {
+        duk_pop(ctx);
+        duk_push_object(ctx);
+        duk_dup(ctx, -1);
+        duk_put_prop_string(ctx, -3, signalBatchesKey);
+    }
+    duk_push_number(ctx, (size_t)key);
+    if (!duk_get_prop(ctx, -2))
+    {
+        duk_pop(ctx);
+        duk_push_array(ctx);
+        duk_push_number(ctx, (size_t)key);
+        duk_dup(ctx, -2);
+        duk_put_prop(ctx, -4);
+        batchedSignals_.Push(key);
+    }
+    duk_dup(ctx, -4); // Parameter array
+    duk_put_prop_index(ctx, -2, (duk_uarridx_t)duk_get_length(ctx, -2));
+    duk_pop_3(ctx);
+}
+
+void JavaScriptInstance::FlushSignalBatches()
+{
+    if (!ctx_ || batchedSignals_.Empty())
+        return;
+
+    JS_PROFILE(JSInstance_FlushSignalBatches);
+
+    // Events emitted by the handlers go to the next batch
+    PODVector<void*> keys;
+    keys.Swap(batchedSignals_);
+    duk_context* ctx = ctx_;
+    duk_push_global_stash(ctx);
+    duk_get_prop_string(ctx, -1, signalBatchesKey);
+    duk_push_object(ctx);
+    duk_put_prop_string(ctx, -3, signalBatchesKey);
+
+    // A handler may delete the script engine, keep this alive for checking it
+    SharedPtr<JavaScriptInstance> keepAlive(this);
+    AutoExecutionBlock block(this);
+    for (uint i = 0; i < keys.Size(); ++i)
+    {
+        duk_push_global_object(ctx);
+        duk_get_prop_string(ctx, -1, "_OnSignalBatch");
+        duk_remove(ctx, -2); // Global object
+        duk_push_number(ctx, (size_t)keys[i]);
+        duk_push_number(ctx, (size_t)keys[i]);
+        duk_get_prop(ctx, -4); // Event array
+        bool success = duk_pcall(ctx, 2) == 0;
+        if (!success) LogError("[JavaScript] OnSignalBatch: " + GetErrorString(ctx));
+        duk_pop(ctx); // Result
+        if (ctx_ != ctx)
+            return;
+    }
+    duk_pop_2(ctx);
+}
+
+void JavaScriptInstance::FlushAllSignalBatches()
+{
+    Vector<SharedPtr<JavaScriptInstance> > instances;
+    for (HashMap<void*, JavaScriptInstance*>::ConstIterator i = instanceMap.Begin(); i != instanceMap.End(); ++i)
+    {
+        if (!i->second_->batchedSignals_.Empty())
+            instances.Push(SharedPtr<JavaScriptInstance>(i->second_));
+    }
+    for (uint i = 0; i < instances.Size(); ++i)
+        instances[i]->FlushSignalBatches();
+}
+
+void JavaScriptInstance::SetIsolated(bool isolated)
+{
+    if (isolated && !allocator_)
+    {
+        LogWarning("[JavaScript] SetIsolated: " + DebugName() + " runs in a shared heap and can not be isolated.");
+        return;
+    }
+    isolated_ = isolated;
+}
+
+bool JavaScriptInstance::QueueIsolatedUpdate(void* key)
+{
+    if (!isolated_ || !ctx_ || key != &module_->GetFramework()->Frame()->Updated || !Urho3D::Thread::IsMainThread())
+        return false;
+
+    duk_context* ctx = ctx_;
+    duk_push_global_stash(ctx);
+    duk_dup(ctx, -2); // Parameter array
+    duk_put_prop_string(ctx, -2, isolatedUpdateParamsKey);
+    duk_pop(ctx);
+    isolatedUpdateKey_ = key;
+    return true;
+}
+
+void JavaScriptInstance::RunIsolatedUpdate()
+{
+    void* key = isolatedUpdateKey_;
+    isolatedUpdateKey_ = 0;
+    if (!ctx_ || !key)
+        return;
+
+    // The scene is not modified until all isolated updates have finished, so the entity stays valid during the update
+    IComponent* owner = owner_.Get();
+    isolatedEntity_ = owner ? owner->ParentEntity() : 0;
+
+    duk_context* ctx = ctx_;
+    {
+        AutoExecutionBlock block(this);
+        duk_push_global_object(ctx);
+        duk_get_prop_string(ctx, -1, "_OnSignal");
+        duk_remove(ctx, -2); // Global object
+        duk_push_number(ctx, (size_t)key);
+        duk_push_global_stash(ctx);
+        duk_get_prop_string(ctx, -1, isolatedUpdateParamsKey);
+        duk_remove(ctx, -2); // Global stash
+        bool success = duk_pcall(ctx, 2) == 0;
+        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
+        duk_pop(ctx); // Result
+    }
+    isolatedEntity_ = 0;
+}
+
+void JavaScriptInstance::QueueAttributeChange(IAttribute* attribute, IAttribute* value, AttributeChange::Type change)
+{
+    QueuedChange queued;
+    {
+        AutoIsolatedLock lock; // The components of the entity may be shared with the other isolated instances
+        queued.component = attribute->Owner();
+    }
+    queued.attributeId = attribute->Id();
+    queued.value = value;
+    queued.change = change;
+    queuedChanges_.Push(queued);
+}
+
+void JavaScriptInstance::QueueMainThreadCall()
+{
+    duk_context* ctx = ctx_;
+    if (!ctx)
+        return;
+
+    if (!isolatedUpdatesRunning)
+    {
+        AutoExecutionBlock block(this);
+        duk_dup(ctx, 1); // Function
+        duk_dup(ctx, 0); // This object
+        bool success = duk_pcall_method(ctx, 0) == 0;
+        if (!success) LogError("[JavaScript] QueueMainThreadCall: " + GetErrorString(ctx));
+        duk_pop(ctx); // Result
+        return;
+    }
+
+    // The calls are stored as [this, function] pairs in the order they were queued
+    duk_push_global_stash(ctx);
+    if (!duk_get_prop_string(ctx, -1, mainThreadCallsKey))
+    {
+        duk_pop(ctx);
+        duk_push_array(ctx);
+        duk_dup(ctx, -1);
+        duk_put_prop_string(ctx, -3, mainThreadCallsKey);
+    }
+    duk_push_array(ctx);
+    duk_dup(ctx, 0);
+    duk_put_prop_index(ctx, -2, 0);
+    duk_dup(ctx, 1);
+    duk_put_prop_index(ctx, -2, 1);
+    duk_put_prop_index(ctx, -2, numQueuedCalls_++);
+    duk_pop_2(ctx); // Calls array and global stash
+
+    QueuedChange queued;
+    queued.value = 0;
+    queued.change = AttributeChange::Default;
+    queuedChanges_.Push(queued);
+}
+
+void JavaScriptInstance::ApplyQueuedChanges()
+{
+    if (queuedChanges_.Empty())
+        return;
+
+    JS_PROFILE(JSInstance_ApplyQueuedChanges);
+
+    // The change signals and the calls may reach this instance, eg. to delete its engine
+    Vector<QueuedChange> changes;
+    changes.Swap(queuedChanges_);
+    numQueuedCalls_ = 0;
+    duk_context* ctx = ctx_;
+    uint callIndex = 0;
+    for (uint i = 0; i < changes.Size(); ++i)
+    {
+        if (!changes[i].value)
+        {
+            // Skip the call if the engine has been deleted or recreated meanwhile
+            if (ctx_ != ctx || !ctx)
+                continue;
+            AutoExecutionBlock block(this);
+            duk_push_global_stash(ctx);
+            duk_get_prop_string(ctx, -1, mainThreadCallsKey);
+            duk_get_prop_index(ctx, -1, callIndex++);
+            duk_get_prop_index(ctx, -1, 1); // Function
+            duk_get_prop_index(ctx, -2, 0); // This object
+            bool success = duk_pcall_method(ctx, 0) == 0;
+            if (!success) LogError("[JavaScript] QueueMainThreadCall: " + GetErrorString(ctx));
+            duk_pop_n(ctx, 4); // Result, call, calls array and global stash
+            continue;
+        }
+
+        IComponent* component = changes[i].component.Get();
+        IAttribute* attribute = component ? component->AttributeById(changes[i].attributeId) : 0;
+        if (attribute && attribute->TypeId() == changes[i].value->TypeId())
+            attribute->CopyValue(changes[i].value, changes[i].change);
+        delete changes[i].value;
+    }
+
+    if (callIndex && ctx_ == ctx)
+    {
+        duk_push_global_stash(ctx);
+        duk_del_prop_string(ctx, -1, mainThreadCallsKey);
+        duk_pop(ctx);
+    }
+}
+
+void JavaScriptInstance::SetIsolatedUpdatesRunning(bool running)
+{
+    isolatedUpdatesRunning = running;
+}
+
+AutoExecutionBlock::AutoExecutionBlock(JavaScriptInstance* instance, bool limited) :
+    instance_(instance),
+    previousTimer_(0),
+    previousBudget_(0),
+    outermost_(false)
+{
+    if (!instance || instance->executionDepth_++ > 0)
+        return;
+    outermost_ = true;
+
+    const long long frameBudget = instance->module_->FrameBudget();
+    JavaScriptHeapAllocator* allocator = instance->HeapAllocator();
+    if (!frameBudget || !allocator || !limited)
+        return;
+
+    heapOwner_ = instance->SharedHeap() ? instance->SharedHeap() : instance;
+    previousTimer_ = allocator->ExecutionTimer();
+    previousBudget_ = allocator->ExecutionBudget();
+    long long budget = Urho3D::Max(frameBudget - instance->executionStats_.frameTime, 0LL);
+    // A call into another instance of the same heap can not extend the limit of the enclosing call
+    if (previousTimer_)
+        budget = Urho3D::Min(budget, Urho3D::Max(previousBudget_ - previousTimer_->GetUSec(false), 0LL));
+    allocator->SetExecutionLimit(&timer_, budget);
+}
+
+AutoExecutionBlock::~AutoExecutionBlock()
+{
+    // Restore the limit of the enclosing call, unless the heap was deleted during the call
+    JavaScriptInstance* heapOwner = heapOwner_.Get();
+    JavaScriptHeapAllocator* allocator = heapOwner ? heapOwner->HeapAllocator() : 0;
+    bool exceeded = false;
+    if (allocator && allocator->ExecutionTimer() == &timer_)
+    {
+        exceeded = allocator->ExecutionLimitExceeded();
+        allocator->SetExecutionLimit(previousTimer_, previousBudget_);
+    }
+
+    JavaScriptInstance* instance = instance_.Get();
+    if (!instance)
+        return;
+    --instance->executionDepth_;
+    if (!outermost_)
+        return;
+
+    JavaScriptExecutionStats& stats = instance->executionStats_;
+    const long long elapsed = timer_.GetUSec(false);
+    stats.frameTime += elapsed;
+    stats.totalTime += elapsed;
+    ++stats.numCalls;
+    if (exceeded && ++stats.numTimeouts == 1)
+        LogWarning("[JavaScript] " + instance->DebugName() + " exceeded the frame budget of " + String(instance->module_->FrameBudget() / 1000.0) +
+            " ms and was interrupted. Further overruns are counted in jsStats.");
+}
+
 }
@@ -13,11 +13,43 @@
 #include "BindingsHelpers.h"
 
 #include <Urho3D/Container/RefCounted.h>
+#include <Urho3D/Core/Timer.h>
 
 namespace Tundra
 {
 
 class Script;
+class JavaScriptHeapAllocator;
+
+/// Execution time accounting of a JavaScriptInstance, see AutoExecutionBlock. Times are in microseconds.
+struct JAVASCRIPT_API JavaScriptExecutionStats
+{
+    JavaScriptExecutionStats() :
+        frameTime(0),
+        lastFrameTime(0),
+        peakFrameTime(0),
+        totalTime(0),
+        numFrames(0),
+        numCalls(0),
+        numTimeouts(0)
+    {
+    }
+
+    /// Time spent during the current frame.
+    long long frameTime;
+    /// Time spent during the previous frame.
+    long long lastFrameTime;
+    /// Highest time spent during a frame.
+    long long peakFrameTime;
+    /// Time spent since the instance was created.
+    long long totalTime;
+    /// Number of frames measured.
+    uint numFrames;
+    /// Number of calls from C++ into the instance.
+    uint numCalls;
+    /// Number of calls that exceeded the frame budget, and were interrupted if still running.
+    uint numTimeouts;
+};
 
 /// Javascript script instance used with Script component.
 class JAVASCRIPT_API JavaScriptInstance : public IScriptInstance
@@ -58,6 +90,10 @@ public:
     /// Evaluate JavaScript in the instance. [noscript]
     bool Evaluate(const String& script, const String& fileName);
 
+    /// Evaluate a script asset in the instance. [noscript]
+    /** The script is compiled only if the asset has no compiled code yet, in memory or in the asset cache. */
+    bool Evaluate(ScriptAsset* asset);
+
     /// Call a global function. \todo Parameter passing & return value
     bool Execute(const String& functionName, bool logError = true);
 
@@ -67,6 +103,25 @@ public:
     /// Return owner component
     ComponentWeakPtr Owner() const { return owner_; }
 
+    /// Return the warm instance whose heap this instance runs in, or null if the instance has a heap of its own.
+    JavaScriptInstance* SharedHeap() const { return sharedHeap_; }
+
+    /// Garbage collect the global scopes of the pooled instances deleted from the shared heap owned by this instance, if any. [noscript]
+    /** Called by JavaScript once per frame, so that deleting many pooled instances costs one collection. */
+    void CollectReleasedThreads();
+
+    /// Return the allocator of the Duktape heap this instance runs in.
+    JavaScriptHeapAllocator* HeapAllocator() const { return sharedHeap_ ? sharedHeap_->allocator_ : allocator_; }
+
+    /// Return the execution time accounting of the instance. [noscript]
+    const JavaScriptExecutionStats& ExecutionStats() const { return executionStats_; }
+
+    /// Start a new frame of the execution time accounting. Called by JavaScript at the start of each frame. [noscript]
+    void EndFrame();
+
+    /// Return the script asset names or file of the instance and its owner entity, for debug output. [noscript]
+    String DebugName() const;
+
     /// Loads a given script in engine. This function can be used to create a property as you could include js-files.
     /** Multiple inclusion of same file is prevented. (by using simple string compare)
     @param path is relative path from bin/ to file. Example jsmodules/apitest/myscript.js */
@@ -94,10 +149,75 @@ public:
     /// Return the instance's signal receiver map.
     HashMap<void*, SharedPtr<JSBindings::SignalReceiver> >& SignalReceivers() { return signalReceivers_; }
 
+    /// Queue the signal parameter array at stack top as an event to the batched connections of the signal. [noscript]
+    void QueueSignalEvent(void* key);
+
+    /// Call the batched signal connections with the events queued since the last flush, once per signal. [noscript]
+    void FlushSignalBatches();
+
+    /// Flush the batched signal connections of all instances. Called by JavaScript once per frame. [noscript]
+    static void FlushAllSignalBatches();
+
+    /// Set whether the frame update handlers of the instance run on a worker thread.
+    /** The handlers of FrameAPI::Updated in an isolated instance are called at FrameAPI::PostFrameUpdate, on a worker thread
+        of the Urho3D WorkQueue and in parallel with the other isolated instances. The handlers may read and assign the attributes
+        of the script entity through its component properties, eg. me.placeable.transform, and call the functions of engine.
+        Other bindings raise an error. Any other change to the scene is queued as a call with engine.QueueMainThreadCall(obj, func).
+        The assignments and calls are applied on the main thread in the order they were made once all isolated instances have
+        finished, so until then the handlers read the previous values. Other signal handlers of the instance are called
+        on the main thread as usual. Only an instance with a heap of its own can be isolated. */
+    void SetIsolated(bool isolated);
+
+    /// Return whether the frame update handlers of the instance run on a worker thread.
+    bool IsIsolated() const { return isolated_; }
+
+    /// Defer an emit of FrameAPI::Updated to a worker thread if the instance is isolated. The signal parameter array must be at stack top. [noscript]
+    /** @return True if deferred. The parameter array is stored for RunIsolatedUpdate, and is left on the stack. */
+    bool QueueIsolatedUpdate(void* key);
+
+    /// Return whether a frame update deferred by QueueIsolatedUpdate is waiting to be run. [noscript]
+    bool HasIsolatedUpdate() const { return isolatedUpdateKey_ != 0; }
+
+    /// Call the frame update handlers deferred by QueueIsolatedUpdate. Called by JavaScript on a worker thread. [noscript]
+    void RunIsolatedUpdate();
+
+    /// Return the entity of the script while its isolated frame update is running, otherwise null. [noscript]
+    Entity* IsolatedEntity() const { return isolatedEntity_; }
+
+    /// Queue an attribute assignment made during the isolated update. Takes ownership of value, which holds the assigned value. [noscript]
+    void QueueAttributeChange(IAttribute* attribute, IAttribute* value, AttributeChange::Type change);
+
+    /// Call a function on the main thread. The this object and the function must be at stack indices 0 and 1. [noscript]
+    /** During the isolated update the call is queued, otherwise it is made immediately. Implements engine.QueueMainThreadCall. */
+    void QueueMainThreadCall();
+
+    /// Apply the attribute assignments and calls queued during the isolated update. Called by JavaScript on the main thread. [noscript]
+    void ApplyQueuedChanges();
+
+    /// Return whether JavaScript is running the isolated frame updates, during which the scene may not be modified. [noscript]
+    static bool IsolatedUpdatesRunning() { return isolatedUpdatesRunning; }
+
+    /// Set whether the isolated frame updates are running. Called by JavaScript on the main thread. [noscript]
+    static void SetIsolatedUpdatesRunning(bool running);
+
+    /// Return all instances keyed by their context. [noscript]
+    static const HashMap<void*, JavaScriptInstance*>& Instances() { return instanceMap; }
+
     /// Read a script file and return it as string. [noscript]
     String LoadScript(const String &fileName);
 
 private:
+    friend class AutoExecutionBlock;
+
+    /// Attribute assignment or call queued during the isolated update. A null value marks the next queued call.
+    struct QueuedChange
+    {
+        ComponentWeakPtr component;
+        String attributeId;
+        IAttribute* value;
+        AttributeChange::Type change;
+    };
+
     /// Creates new script context/engine.
     void CreateEngine();
 
@@ -122,7 +242,18 @@ private:
     ComponentWeakPtr owner_; ///< Owner (Script) component, if existing.
     JavaScript *module_; ///< Javascript module.
     duk_context* ctx_; ///< DukTape context.
+    JavaScriptHeapAllocator* allocator_; ///< Allocator of the heap, if the instance owns its heap.
     bool evaluated_; ///< Has the script program been evaluated.
+    int executionDepth_; ///< Number of nested AutoExecutionBlocks of the instance.
+    bool isolated_; ///< Do the frame update handlers run on a worker thread.
+    void* isolatedUpdateKey_; ///< FrameAPI::Updated if a frame update has been deferred to a worker thread.
+    Entity* isolatedEntity_; ///< Entity of the script while the isolated update is running.
+    uint numQueuedCalls_; ///< Number of calls queued during the isolated update.
+    bool threadsReleased_; ///< Have pooled instances released their threads in the heap of this instance since the last collection.
+    JavaScriptExecutionStats executionStats_; ///< Execution time accounting.
+
+    /// Warm instance owning the shared heap this instance runs in, if any.
+    SharedPtr<JavaScriptInstance> sharedHeap_;
 
     /// Already included files for preventing multi-inclusion
     Vector<String> includedFiles_;
@@ -130,8 +261,40 @@ private:
     /// Registered JavaScript signal receivers. The key is the signal pointer.
     HashMap<void*, SharedPtr<JSBindings::SignalReceiver> > signalReceivers_;
 
+    /// Signals with events queued to batched connections, in the order of their first event.
+    PODVector<void*> batchedSignals_;
+
+    /// Attribute assignments and calls made by the isolated frame update handlers, in the order they were made.
+    Vector<QueuedChange> queuedChanges_;
+
     /// Context to instance map.
     static HashMap<void*, JavaScriptInstance*> instanceMap;
+
+    /// Are the isolated frame updates running.
+    static bool isolatedUpdatesRunning;
+};
+
+/// Measures a call from C++ into the script engine of an instance, and limits it to the frame budget of JavaScript.
+/** Place on the stack around each entry into the script engine, eg. evaluating scripts and calling signal handlers.
+    Only the outermost block of an instance is measured. The budget left for the frame is set as the execution limit
+    of the heap, so that a script running past it is interrupted, see JavaScriptHeapAllocator::SetExecutionLimit.
+    Loading and including scripts is measured but not limited, as it is not part of the per-frame work of the script. */
+class JAVASCRIPT_API AutoExecutionBlock
+{
+public:
+    /// @param limited Whether to limit the call to the frame budget. A block nested in a limited call stays limited.
+    explicit AutoExecutionBlock(JavaScriptInstance* instance, bool limited = true);
+    ~AutoExecutionBlock();
+
+private:
+    WeakPtr<JavaScriptInstance> instance_;
+    /// Instance owning the heap, which is the instance itself unless it runs in a shared heap.
+    WeakPtr<JavaScriptInstance> heapOwner_;
+    Urho3D::HiresTimer timer_;
+    /// Execution limit of an enclosing call into the same heap.
+    Urho3D::HiresTimer* previousTimer_;
+    long long previousBudget_;
+    bool outermost_;
 };
 
 }
@@ -119,7 +119,7 @@ static duk_ret_t AABB_Get_maxPoint(duk_context* ctx)
 
 static duk_ret_t AABB_Ctor(duk_context* ctx)
 {
-    AABB* newObj = new AABB();
+    AABB* newObj = new (ctx) AABB();
     PushConstructorResult<AABB>(ctx, newObj, AABB_ID, AABB_Finalizer);
     return 0;
 }
@@ -128,7 +128,7 @@ static duk_ret_t AABB_Ctor_float3_float3(duk_context* ctx)
 {
     float3& minPoint = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& maxPoint = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    AABB* newObj = new AABB(minPoint, maxPoint);
+    AABB* newObj = new (ctx) AABB(minPoint, maxPoint);
     PushConstructorResult<AABB>(ctx, newObj, AABB_ID, AABB_Finalizer);
     return 0;
 }
@@ -136,7 +136,7 @@ static duk_ret_t AABB_Ctor_float3_float3(duk_context* ctx)
 static duk_ret_t AABB_Ctor_OBB(duk_context* ctx)
 {
     OBB& obb = *GetCheckedValueObject<OBB>(ctx, 0, OBB_ID);
-    AABB* newObj = new AABB(obb);
+    AABB* newObj = new (ctx) AABB(obb);
     PushConstructorResult<AABB>(ctx, newObj, AABB_ID, AABB_Finalizer);
     return 0;
 }
@@ -144,7 +144,7 @@ static duk_ret_t AABB_Ctor_OBB(duk_context* ctx)
 static duk_ret_t AABB_Ctor_Sphere(duk_context* ctx)
 {
     Sphere& s = *GetCheckedValueObject<Sphere>(ctx, 0, Sphere_ID);
-    AABB* newObj = new AABB(s);
+    AABB* newObj = new (ctx) AABB(s);
     PushConstructorResult<AABB>(ctx, newObj, AABB_ID, AABB_Finalizer);
     return 0;
 }
@@ -127,7 +127,7 @@ static duk_ret_t Capsule_Get_r(duk_context* ctx)
 
 static duk_ret_t Capsule_Ctor(duk_context* ctx)
 {
-    Capsule* newObj = new Capsule();
+    Capsule* newObj = new (ctx) Capsule();
     PushConstructorResult<Capsule>(ctx, newObj, Capsule_ID, Capsule_Finalizer);
     return 0;
 }
@@ -136,7 +136,7 @@ static duk_ret_t Capsule_Ctor_LineSegment_float(duk_context* ctx)
 {
     LineSegment& endPoints = *GetCheckedValueObject<LineSegment>(ctx, 0, LineSegment_ID);
     float radius = (float)duk_require_number(ctx, 1);
-    Capsule* newObj = new Capsule(endPoints, radius);
+    Capsule* newObj = new (ctx) Capsule(endPoints, radius);
     PushConstructorResult<Capsule>(ctx, newObj, Capsule_ID, Capsule_Finalizer);
     return 0;
 }
@@ -146,7 +146,7 @@ static duk_ret_t Capsule_Ctor_float3_float3_float(duk_context* ctx)
     float3& bottomPoint = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& topPoint = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
     float radius = (float)duk_require_number(ctx, 2);
-    Capsule* newObj = new Capsule(bottomPoint, topPoint, radius);
+    Capsule* newObj = new (ctx) Capsule(bottomPoint, topPoint, radius);
     PushConstructorResult<Capsule>(ctx, newObj, Capsule_ID, Capsule_Finalizer);
     return 0;
 }
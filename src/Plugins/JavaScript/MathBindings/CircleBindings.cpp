@@ -108,7 +108,7 @@ static duk_ret_t Circle_Get_r(duk_context* ctx)
 
 static duk_ret_t Circle_Ctor(duk_context* ctx)
 {
-    Circle* newObj = new Circle();
+    Circle* newObj = new (ctx) Circle();
     PushConstructorResult<Circle>(ctx, newObj, Circle_ID, Circle_Finalizer);
     return 0;
 }
@@ -118,7 +118,7 @@ static duk_ret_t Circle_Ctor_float3_float3_float(duk_context* ctx)
     float3& center = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& normal = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
     float radius = (float)duk_require_number(ctx, 2);
-    Circle* newObj = new Circle(center, normal, radius);
+    Circle* newObj = new (ctx) Circle(center, normal, radius);
     PushConstructorResult<Circle>(ctx, newObj, Circle_ID, Circle_Finalizer);
     return 0;
 }
@@ -115,7 +115,7 @@ static duk_ret_t Frustum_Finalizer(duk_context* ctx)
 
 static duk_ret_t Frustum_Ctor(duk_context* ctx)
 {
-    Frustum* newObj = new Frustum();
+    Frustum* newObj = new (ctx) Frustum();
     PushConstructorResult<Frustum>(ctx, newObj, Frustum_ID, Frustum_Finalizer);
     return 0;
 }
@@ -89,7 +89,7 @@ static duk_ret_t LCG_Get_lastNumber(duk_context* ctx)
 
 static duk_ret_t LCG_Ctor(duk_context* ctx)
 {
-    LCG* newObj = new LCG();
+    LCG* newObj = new (ctx) LCG();
     PushConstructorResult<LCG>(ctx, newObj, LCG_ID, LCG_Finalizer);
     return 0;
 }
@@ -101,7 +101,7 @@ static duk_ret_t LCG_Ctor_u32_u32_u32_u32(duk_context* ctx)
     u32 multiplier = numArgs > 1 ? (u32)duk_require_number(ctx, 1) : 69621;
     u32 increment = numArgs > 2 ? (u32)duk_require_number(ctx, 2) : 0;
     u32 modulus = numArgs > 3 ? (u32)duk_require_number(ctx, 3) : 0x7FFFFFFF;
-    LCG* newObj = new LCG(seed, multiplier, increment, modulus);
+    LCG* newObj = new (ctx) LCG(seed, multiplier, increment, modulus);
     PushConstructorResult<LCG>(ctx, newObj, LCG_ID, LCG_Finalizer);
     return 0;
 }
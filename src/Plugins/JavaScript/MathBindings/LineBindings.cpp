@@ -107,7 +107,7 @@ static duk_ret_t Line_Get_dir(duk_context* ctx)
 
 static duk_ret_t Line_Ctor(duk_context* ctx)
 {
-    Line* newObj = new Line();
+    Line* newObj = new (ctx) Line();
     PushConstructorResult<Line>(ctx, newObj, Line_ID, Line_Finalizer);
     return 0;
 }
@@ -116,7 +116,7 @@ static duk_ret_t Line_Ctor_float3_float3(duk_context* ctx)
 {
     float3& pos = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& dir = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    Line* newObj = new Line(pos, dir);
+    Line* newObj = new (ctx) Line(pos, dir);
     PushConstructorResult<Line>(ctx, newObj, Line_ID, Line_Finalizer);
     return 0;
 }
@@ -124,7 +124,7 @@ static duk_ret_t Line_Ctor_float3_float3(duk_context* ctx)
 static duk_ret_t Line_Ctor_Ray(duk_context* ctx)
 {
     Ray& ray = *GetCheckedValueObject<Ray>(ctx, 0, Ray_ID);
-    Line* newObj = new Line(ray);
+    Line* newObj = new (ctx) Line(ray);
     PushConstructorResult<Line>(ctx, newObj, Line_ID, Line_Finalizer);
     return 0;
 }
@@ -132,7 +132,7 @@ static duk_ret_t Line_Ctor_Ray(duk_context* ctx)
 static duk_ret_t Line_Ctor_LineSegment(duk_context* ctx)
 {
     LineSegment& lineSegment = *GetCheckedValueObject<LineSegment>(ctx, 0, LineSegment_ID);
-    Line* newObj = new Line(lineSegment);
+    Line* newObj = new (ctx) Line(lineSegment);
     PushConstructorResult<Line>(ctx, newObj, Line_ID, Line_Finalizer);
     return 0;
 }
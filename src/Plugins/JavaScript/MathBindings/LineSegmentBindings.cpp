@@ -105,7 +105,7 @@ static duk_ret_t LineSegment_Get_b(duk_context* ctx)
 
 static duk_ret_t LineSegment_Ctor(duk_context* ctx)
 {
-    LineSegment* newObj = new LineSegment();
+    LineSegment* newObj = new (ctx) LineSegment();
     PushConstructorResult<LineSegment>(ctx, newObj, LineSegment_ID, LineSegment_Finalizer);
     return 0;
 }
@@ -114,7 +114,7 @@ static duk_ret_t LineSegment_Ctor_float3_float3(duk_context* ctx)
 {
     float3& a = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& b = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    LineSegment* newObj = new LineSegment(a, b);
+    LineSegment* newObj = new (ctx) LineSegment(a, b);
     PushConstructorResult<LineSegment>(ctx, newObj, LineSegment_ID, LineSegment_Finalizer);
     return 0;
 }
@@ -123,7 +123,7 @@ static duk_ret_t LineSegment_Ctor_Ray_float(duk_context* ctx)
 {
     Ray& ray = *GetCheckedValueObject<Ray>(ctx, 0, Ray_ID);
     float d = (float)duk_require_number(ctx, 1);
-    LineSegment* newObj = new LineSegment(ray, d);
+    LineSegment* newObj = new (ctx) LineSegment(ray, d);
     PushConstructorResult<LineSegment>(ctx, newObj, LineSegment_ID, LineSegment_Finalizer);
     return 0;
 }
@@ -132,7 +132,7 @@ static duk_ret_t LineSegment_Ctor_Line_float(duk_context* ctx)
 {
     Line& line = *GetCheckedValueObject<Line>(ctx, 0, Line_ID);
     float d = (float)duk_require_number(ctx, 1);
-    LineSegment* newObj = new LineSegment(line, d);
+    LineSegment* newObj = new (ctx) LineSegment(line, d);
     PushConstructorResult<LineSegment>(ctx, newObj, LineSegment_ID, LineSegment_Finalizer);
     return 0;
 }
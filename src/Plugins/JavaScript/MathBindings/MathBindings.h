@@ -3,10 +3,11 @@
 #pragma once
 
 #include "duktape.h"
+#include "JavaScriptApi.h"
 
 namespace JSBindings
 {
 
-void ExposeMathClasses(duk_context* ctx);
+JAVASCRIPT_API void ExposeMathClasses(duk_context* ctx);
 
 }
\ No newline at end of file
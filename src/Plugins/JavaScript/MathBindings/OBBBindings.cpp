@@ -125,7 +125,7 @@ static duk_ret_t OBB_Get_r(duk_context* ctx)
 
 static duk_ret_t OBB_Ctor(duk_context* ctx)
 {
-    OBB* newObj = new OBB();
+    OBB* newObj = new (ctx) OBB();
     PushConstructorResult<OBB>(ctx, newObj, OBB_ID, OBB_Finalizer);
     return 0;
 }
@@ -137,7 +137,7 @@ static duk_ret_t OBB_Ctor_float3_float3_float3_float3_float3(duk_context* ctx)
     float3& axis0 = *GetCheckedValueObject<float3>(ctx, 2, float3_ID);
     float3& axis1 = *GetCheckedValueObject<float3>(ctx, 3, float3_ID);
     float3& axis2 = *GetCheckedValueObject<float3>(ctx, 4, float3_ID);
-    OBB* newObj = new OBB(pos, r, axis0, axis1, axis2);
+    OBB* newObj = new (ctx) OBB(pos, r, axis0, axis1, axis2);
     PushConstructorResult<OBB>(ctx, newObj, OBB_ID, OBB_Finalizer);
     return 0;
 }
@@ -145,7 +145,7 @@ static duk_ret_t OBB_Ctor_float3_float3_float3_float3_float3(duk_context* ctx)
 static duk_ret_t OBB_Ctor_AABB(duk_context* ctx)
 {
     AABB& aabb = *GetCheckedValueObject<AABB>(ctx, 0, AABB_ID);
-    OBB* newObj = new OBB(aabb);
+    OBB* newObj = new (ctx) OBB(aabb);
     PushConstructorResult<OBB>(ctx, newObj, OBB_ID, OBB_Finalizer);
     return 0;
 }
@@ -121,7 +121,7 @@ static duk_ret_t Plane_Get_d(duk_context* ctx)
 
 static duk_ret_t Plane_Ctor(duk_context* ctx)
 {
-    Plane* newObj = new Plane();
+    Plane* newObj = new (ctx) Plane();
     PushConstructorResult<Plane>(ctx, newObj, Plane_ID, Plane_Finalizer);
     return 0;
 }
@@ -130,7 +130,7 @@ static duk_ret_t Plane_Ctor_float3_float(duk_context* ctx)
 {
     float3& normal = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float d = (float)duk_require_number(ctx, 1);
-    Plane* newObj = new Plane(normal, d);
+    Plane* newObj = new (ctx) Plane(normal, d);
     PushConstructorResult<Plane>(ctx, newObj, Plane_ID, Plane_Finalizer);
     return 0;
 }
@@ -140,7 +140,7 @@ static duk_ret_t Plane_Ctor_float3_float3_float3(duk_context* ctx)
     float3& v1 = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& v2 = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
     float3& v3 = *GetCheckedValueObject<float3>(ctx, 2, float3_ID);
-    Plane* newObj = new Plane(v1, v2, v3);
+    Plane* newObj = new (ctx) Plane(v1, v2, v3);
     PushConstructorResult<Plane>(ctx, newObj, Plane_ID, Plane_Finalizer);
     return 0;
 }
@@ -149,7 +149,7 @@ static duk_ret_t Plane_Ctor_float3_float3(duk_context* ctx)
 {
     float3& point = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& normal = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    Plane* newObj = new Plane(point, normal);
+    Plane* newObj = new (ctx) Plane(point, normal);
     PushConstructorResult<Plane>(ctx, newObj, Plane_ID, Plane_Finalizer);
     return 0;
 }
@@ -158,7 +158,7 @@ static duk_ret_t Plane_Ctor_Ray_float3(duk_context* ctx)
 {
     Ray& line = *GetCheckedValueObject<Ray>(ctx, 0, Ray_ID);
     float3& normal = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    Plane* newObj = new Plane(line, normal);
+    Plane* newObj = new (ctx) Plane(line, normal);
     PushConstructorResult<Plane>(ctx, newObj, Plane_ID, Plane_Finalizer);
     return 0;
 }
@@ -167,7 +167,7 @@ static duk_ret_t Plane_Ctor_Line_float3(duk_context* ctx)
 {
     Line& line = *GetCheckedValueObject<Line>(ctx, 0, Line_ID);
     float3& normal = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    Plane* newObj = new Plane(line, normal);
+    Plane* newObj = new (ctx) Plane(line, normal);
     PushConstructorResult<Plane>(ctx, newObj, Plane_ID, Plane_Finalizer);
     return 0;
 }
@@ -176,7 +176,7 @@ static duk_ret_t Plane_Ctor_LineSegment_float3(duk_context* ctx)
 {
     LineSegment& line = *GetCheckedValueObject<LineSegment>(ctx, 0, LineSegment_ID);
     float3& normal = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    Plane* newObj = new Plane(line, normal);
+    Plane* newObj = new (ctx) Plane(line, normal);
     PushConstructorResult<Plane>(ctx, newObj, Plane_ID, Plane_Finalizer);
     return 0;
 }
@@ -131,7 +131,7 @@ static duk_ret_t Quat_Get_w(duk_context* ctx)
 
 static duk_ret_t Quat_Ctor(duk_context* ctx)
 {
-    Quat* newObj = new Quat();
+    Quat* newObj = new (ctx) Quat();
     PushConstructorResult<Quat>(ctx, newObj, Quat_ID, Quat_Finalizer);
     return 0;
 }
@@ -139,7 +139,7 @@ static duk_ret_t Quat_Ctor(duk_context* ctx)
 static duk_ret_t Quat_Ctor_Quat(duk_context* ctx)
 {
     Quat& rhs = *GetCheckedValueObject<Quat>(ctx, 0, Quat_ID);
-    Quat* newObj = new Quat(rhs);
+    Quat* newObj = new (ctx) Quat(rhs);
     PushConstructorResult<Quat>(ctx, newObj, Quat_ID, Quat_Finalizer);
     return 0;
 }
@@ -147,7 +147,7 @@ static duk_ret_t Quat_Ctor_Quat(duk_context* ctx)
 static duk_ret_t Quat_Ctor_float3x3(duk_context* ctx)
 {
     float3x3& rotationMatrix = *GetCheckedValueObject<float3x3>(ctx, 0, float3x3_ID);
-    Quat* newObj = new Quat(rotationMatrix);
+    Quat* newObj = new (ctx) Quat(rotationMatrix);
     PushConstructorResult<Quat>(ctx, newObj, Quat_ID, Quat_Finalizer);
     return 0;
 }
@@ -155,7 +155,7 @@ static duk_ret_t Quat_Ctor_float3x3(duk_context* ctx)
 static duk_ret_t Quat_Ctor_float3x4(duk_context* ctx)
 {
     float3x4& rotationMatrix = *GetCheckedValueObject<float3x4>(ctx, 0, float3x4_ID);
-    Quat* newObj = new Quat(rotationMatrix);
+    Quat* newObj = new (ctx) Quat(rotationMatrix);
     PushConstructorResult<Quat>(ctx, newObj, Quat_ID, Quat_Finalizer);
     return 0;
 }
@@ -163,7 +163,7 @@ static duk_ret_t Quat_Ctor_float3x4(duk_context* ctx)
 static duk_ret_t Quat_Ctor_float4x4(duk_context* ctx)
 {
     float4x4& rotationMatrix = *GetCheckedValueObject<float4x4>(ctx, 0, float4x4_ID);
-    Quat* newObj = new Quat(rotationMatrix);
+    Quat* newObj = new (ctx) Quat(rotationMatrix);
     PushConstructorResult<Quat>(ctx, newObj, Quat_ID, Quat_Finalizer);
     return 0;
 }
@@ -174,7 +174,7 @@ static duk_ret_t Quat_Ctor_float_float_float_float(duk_context* ctx)
     float y = (float)duk_require_number(ctx, 1);
     float z = (float)duk_require_number(ctx, 2);
     float w = (float)duk_require_number(ctx, 3);
-    Quat* newObj = new Quat(x, y, z, w);
+    Quat* newObj = new (ctx) Quat(x, y, z, w);
     PushConstructorResult<Quat>(ctx, newObj, Quat_ID, Quat_Finalizer);
     return 0;
 }
@@ -183,7 +183,7 @@ static duk_ret_t Quat_Ctor_float3_float(duk_context* ctx)
 {
     float3& rotationAxis = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float rotationAngleRadians = (float)duk_require_number(ctx, 1);
-    Quat* newObj = new Quat(rotationAxis, rotationAngleRadians);
+    Quat* newObj = new (ctx) Quat(rotationAxis, rotationAngleRadians);
     PushConstructorResult<Quat>(ctx, newObj, Quat_ID, Quat_Finalizer);
     return 0;
 }
@@ -192,7 +192,7 @@ static duk_ret_t Quat_Ctor_float4_float(duk_context* ctx)
 {
     float4& rotationAxis = *GetCheckedValueObject<float4>(ctx, 0, float4_ID);
     float rotationAngleRadians = (float)duk_require_number(ctx, 1);
-    Quat* newObj = new Quat(rotationAxis, rotationAngleRadians);
+    Quat* newObj = new (ctx) Quat(rotationAxis, rotationAngleRadians);
     PushConstructorResult<Quat>(ctx, newObj, Quat_ID, Quat_Finalizer);
     return 0;
 }
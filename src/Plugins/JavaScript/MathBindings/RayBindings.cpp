@@ -107,7 +107,7 @@ static duk_ret_t Ray_Get_dir(duk_context* ctx)
 
 static duk_ret_t Ray_Ctor(duk_context* ctx)
 {
-    Ray* newObj = new Ray();
+    Ray* newObj = new (ctx) Ray();
     PushConstructorResult<Ray>(ctx, newObj, Ray_ID, Ray_Finalizer);
     return 0;
 }
@@ -116,7 +116,7 @@ static duk_ret_t Ray_Ctor_float3_float3(duk_context* ctx)
 {
     float3& pos = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& dir = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    Ray* newObj = new Ray(pos, dir);
+    Ray* newObj = new (ctx) Ray(pos, dir);
     PushConstructorResult<Ray>(ctx, newObj, Ray_ID, Ray_Finalizer);
     return 0;
 }
@@ -124,7 +124,7 @@ static duk_ret_t Ray_Ctor_float3_float3(duk_context* ctx)
 static duk_ret_t Ray_Ctor_Line(duk_context* ctx)
 {
     Line& line = *GetCheckedValueObject<Line>(ctx, 0, Line_ID);
-    Ray* newObj = new Ray(line);
+    Ray* newObj = new (ctx) Ray(line);
     PushConstructorResult<Ray>(ctx, newObj, Ray_ID, Ray_Finalizer);
     return 0;
 }
@@ -132,7 +132,7 @@ static duk_ret_t Ray_Ctor_Line(duk_context* ctx)
 static duk_ret_t Ray_Ctor_LineSegment(duk_context* ctx)
 {
     LineSegment& lineSegment = *GetCheckedValueObject<LineSegment>(ctx, 0, LineSegment_ID);
-    Ray* newObj = new Ray(lineSegment);
+    Ray* newObj = new (ctx) Ray(lineSegment);
     PushConstructorResult<Ray>(ctx, newObj, Ray_ID, Ray_Finalizer);
     return 0;
 }
@@ -109,7 +109,7 @@ static duk_ret_t Sphere_Get_r(duk_context* ctx)
 
 static duk_ret_t Sphere_Ctor(duk_context* ctx)
 {
-    Sphere* newObj = new Sphere();
+    Sphere* newObj = new (ctx) Sphere();
     PushConstructorResult<Sphere>(ctx, newObj, Sphere_ID, Sphere_Finalizer);
     return 0;
 }
@@ -118,7 +118,7 @@ static duk_ret_t Sphere_Ctor_float3_float(duk_context* ctx)
 {
     float3& center = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float radius = (float)duk_require_number(ctx, 1);
-    Sphere* newObj = new Sphere(center, radius);
+    Sphere* newObj = new (ctx) Sphere(center, radius);
     PushConstructorResult<Sphere>(ctx, newObj, Sphere_ID, Sphere_Finalizer);
     return 0;
 }
@@ -127,7 +127,7 @@ static duk_ret_t Sphere_Ctor_float3_float3(duk_context* ctx)
 {
     float3& pointA = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& pointB = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    Sphere* newObj = new Sphere(pointA, pointB);
+    Sphere* newObj = new (ctx) Sphere(pointA, pointB);
     PushConstructorResult<Sphere>(ctx, newObj, Sphere_ID, Sphere_Finalizer);
     return 0;
 }
@@ -137,7 +137,7 @@ static duk_ret_t Sphere_Ctor_float3_float3_float3(duk_context* ctx)
     float3& pointA = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& pointB = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
     float3& pointC = *GetCheckedValueObject<float3>(ctx, 2, float3_ID);
-    Sphere* newObj = new Sphere(pointA, pointB, pointC);
+    Sphere* newObj = new (ctx) Sphere(pointA, pointB, pointC);
     PushConstructorResult<Sphere>(ctx, newObj, Sphere_ID, Sphere_Finalizer);
     return 0;
 }
@@ -148,7 +148,7 @@ static duk_ret_t Sphere_Ctor_float3_float3_float3_float3(duk_context* ctx)
     float3& pointB = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
     float3& pointC = *GetCheckedValueObject<float3>(ctx, 2, float3_ID);
     float3& pointD = *GetCheckedValueObject<float3>(ctx, 3, float3_ID);
-    Sphere* newObj = new Sphere(pointA, pointB, pointC, pointD);
+    Sphere* newObj = new (ctx) Sphere(pointA, pointB, pointC, pointD);
     PushConstructorResult<Sphere>(ctx, newObj, Sphere_ID, Sphere_Finalizer);
     return 0;
 }
@@ -132,7 +132,7 @@ static duk_ret_t Triangle_Get_c(duk_context* ctx)
 
 static duk_ret_t Triangle_Ctor(duk_context* ctx)
 {
-    Triangle* newObj = new Triangle();
+    Triangle* newObj = new (ctx) Triangle();
     PushConstructorResult<Triangle>(ctx, newObj, Triangle_ID, Triangle_Finalizer);
     return 0;
 }
@@ -142,7 +142,7 @@ static duk_ret_t Triangle_Ctor_float3_float3_float3(duk_context* ctx)
     float3& a = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& b = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
     float3& c = *GetCheckedValueObject<float3>(ctx, 2, float3_ID);
-    Triangle* newObj = new Triangle(a, b, c);
+    Triangle* newObj = new (ctx) Triangle(a, b, c);
     PushConstructorResult<Triangle>(ctx, newObj, Triangle_ID, Triangle_Finalizer);
     return 0;
 }
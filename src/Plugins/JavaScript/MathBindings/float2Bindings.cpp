@@ -77,7 +77,7 @@ static duk_ret_t float2_Get_y(duk_context* ctx)
 
 static duk_ret_t float2_Ctor(duk_context* ctx)
 {
-    float2* newObj = new float2();
+    float2* newObj = new (ctx) float2();
     PushConstructorResult<float2>(ctx, newObj, float2_ID, float2_Finalizer);
     return 0;
 }
@@ -85,7 +85,7 @@ static duk_ret_t float2_Ctor(duk_context* ctx)
 static duk_ret_t float2_Ctor_float2(duk_context* ctx)
 {
     float2& rhs = *GetCheckedValueObject<float2>(ctx, 0, float2_ID);
-    float2* newObj = new float2(rhs);
+    float2* newObj = new (ctx) float2(rhs);
     PushConstructorResult<float2>(ctx, newObj, float2_ID, float2_Finalizer);
     return 0;
 }
@@ -94,7 +94,7 @@ static duk_ret_t float2_Ctor_float_float(duk_context* ctx)
 {
     float x = (float)duk_require_number(ctx, 0);
     float y = (float)duk_require_number(ctx, 1);
-    float2* newObj = new float2(x, y);
+    float2* newObj = new (ctx) float2(x, y);
     PushConstructorResult<float2>(ctx, newObj, float2_ID, float2_Finalizer);
     return 0;
 }
@@ -102,7 +102,7 @@ static duk_ret_t float2_Ctor_float_float(duk_context* ctx)
 static duk_ret_t float2_Ctor_float(duk_context* ctx)
 {
     float scalar = (float)duk_require_number(ctx, 0);
-    float2* newObj = new float2(scalar);
+    float2* newObj = new (ctx) float2(scalar);
     PushConstructorResult<float2>(ctx, newObj, float2_ID, float2_Finalizer);
     return 0;
 }
@@ -118,7 +118,7 @@ static duk_ret_t float3_Get_z(duk_context* ctx)
 
 static duk_ret_t float3_Ctor(duk_context* ctx)
 {
-    float3* newObj = new float3();
+    float3* newObj = new (ctx) float3();
     PushConstructorResult<float3>(ctx, newObj, float3_ID, float3_Finalizer);
     return 0;
 }
@@ -126,7 +126,7 @@ static duk_ret_t float3_Ctor(duk_context* ctx)
 static duk_ret_t float3_Ctor_float3(duk_context* ctx)
 {
     float3& rhs = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
-    float3* newObj = new float3(rhs);
+    float3* newObj = new (ctx) float3(rhs);
     PushConstructorResult<float3>(ctx, newObj, float3_ID, float3_Finalizer);
     return 0;
 }
@@ -136,7 +136,7 @@ static duk_ret_t float3_Ctor_float_float_float(duk_context* ctx)
     float x = (float)duk_require_number(ctx, 0);
     float y = (float)duk_require_number(ctx, 1);
     float z = (float)duk_require_number(ctx, 2);
-    float3* newObj = new float3(x, y, z);
+    float3* newObj = new (ctx) float3(x, y, z);
     PushConstructorResult<float3>(ctx, newObj, float3_ID, float3_Finalizer);
     return 0;
 }
@@ -144,7 +144,7 @@ static duk_ret_t float3_Ctor_float_float_float(duk_context* ctx)
 static duk_ret_t float3_Ctor_float(duk_context* ctx)
 {
     float scalar = (float)duk_require_number(ctx, 0);
-    float3* newObj = new float3(scalar);
+    float3* newObj = new (ctx) float3(scalar);
     PushConstructorResult<float3>(ctx, newObj, float3_ID, float3_Finalizer);
     return 0;
 }
@@ -153,7 +153,7 @@ static duk_ret_t float3_Ctor_float2_float(duk_context* ctx)
 {
     float2& xy = *GetCheckedValueObject<float2>(ctx, 0, float2_ID);
     float z = (float)duk_require_number(ctx, 1);
-    float3* newObj = new float3(xy, z);
+    float3* newObj = new (ctx) float3(xy, z);
     PushConstructorResult<float3>(ctx, newObj, float3_ID, float3_Finalizer);
     return 0;
 }
@@ -73,7 +73,7 @@ static duk_ret_t float3x3_Finalizer(duk_context* ctx)
 
 static duk_ret_t float3x3_Ctor(duk_context* ctx)
 {
-    float3x3* newObj = new float3x3();
+    float3x3* newObj = new (ctx) float3x3();
     PushConstructorResult<float3x3>(ctx, newObj, float3x3_ID, float3x3_Finalizer);
     return 0;
 }
@@ -81,7 +81,7 @@ static duk_ret_t float3x3_Ctor(duk_context* ctx)
 static duk_ret_t float3x3_Ctor_float3x3(duk_context* ctx)
 {
     float3x3& rhs = *GetCheckedValueObject<float3x3>(ctx, 0, float3x3_ID);
-    float3x3* newObj = new float3x3(rhs);
+    float3x3* newObj = new (ctx) float3x3(rhs);
     PushConstructorResult<float3x3>(ctx, newObj, float3x3_ID, float3x3_Finalizer);
     return 0;
 }
@@ -97,7 +97,7 @@ static duk_ret_t float3x3_Ctor_float_float_float_float_float_float_float_float_f
     float _20 = (float)duk_require_number(ctx, 6);
     float _21 = (float)duk_require_number(ctx, 7);
     float _22 = (float)duk_require_number(ctx, 8);
-    float3x3* newObj = new float3x3(_00, _01, _02, _10, _11, _12, _20, _21, _22);
+    float3x3* newObj = new (ctx) float3x3(_00, _01, _02, _10, _11, _12, _20, _21, _22);
     PushConstructorResult<float3x3>(ctx, newObj, float3x3_ID, float3x3_Finalizer);
     return 0;
 }
@@ -107,7 +107,7 @@ static duk_ret_t float3x3_Ctor_float3_float3_float3(duk_context* ctx)
     float3& col0 = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float3& col1 = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
     float3& col2 = *GetCheckedValueObject<float3>(ctx, 2, float3_ID);
-    float3x3* newObj = new float3x3(col0, col1, col2);
+    float3x3* newObj = new (ctx) float3x3(col0, col1, col2);
     PushConstructorResult<float3x3>(ctx, newObj, float3x3_ID, float3x3_Finalizer);
     return 0;
 }
@@ -115,7 +115,7 @@ static duk_ret_t float3x3_Ctor_float3_float3_float3(duk_context* ctx)
 static duk_ret_t float3x3_Ctor_Quat(duk_context* ctx)
 {
     Quat& orientation = *GetCheckedValueObject<Quat>(ctx, 0, Quat_ID);
-    float3x3* newObj = new float3x3(orientation);
+    float3x3* newObj = new (ctx) float3x3(orientation);
     PushConstructorResult<float3x3>(ctx, newObj, float3x3_ID, float3x3_Finalizer);
     return 0;
 }
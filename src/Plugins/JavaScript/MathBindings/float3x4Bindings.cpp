@@ -67,7 +67,7 @@ static duk_ret_t float3x4_Finalizer(duk_context* ctx)
 
 static duk_ret_t float3x4_Ctor(duk_context* ctx)
 {
-    float3x4* newObj = new float3x4();
+    float3x4* newObj = new (ctx) float3x4();
     PushConstructorResult<float3x4>(ctx, newObj, float3x4_ID, float3x4_Finalizer);
     return 0;
 }
@@ -75,7 +75,7 @@ static duk_ret_t float3x4_Ctor(duk_context* ctx)
 static duk_ret_t float3x4_Ctor_float3x4(duk_context* ctx)
 {
     float3x4& rhs = *GetCheckedValueObject<float3x4>(ctx, 0, float3x4_ID);
-    float3x4* newObj = new float3x4(rhs);
+    float3x4* newObj = new (ctx) float3x4(rhs);
     PushConstructorResult<float3x4>(ctx, newObj, float3x4_ID, float3x4_Finalizer);
     return 0;
 }
@@ -94,7 +94,7 @@ static duk_ret_t float3x4_Ctor_float_float_float_float_float_float_float_float_f
     float _21 = (float)duk_require_number(ctx, 9);
     float _22 = (float)duk_require_number(ctx, 10);
     float _23 = (float)duk_require_number(ctx, 11);
-    float3x4* newObj = new float3x4(_00, _01, _02, _03, _10, _11, _12, _13, _20, _21, _22, _23);
+    float3x4* newObj = new (ctx) float3x4(_00, _01, _02, _03, _10, _11, _12, _13, _20, _21, _22, _23);
     PushConstructorResult<float3x4>(ctx, newObj, float3x4_ID, float3x4_Finalizer);
     return 0;
 }
@@ -102,7 +102,7 @@ static duk_ret_t float3x4_Ctor_float_float_float_float_float_float_float_float_f
 static duk_ret_t float3x4_Ctor_float3x3(duk_context* ctx)
 {
     float3x3& other = *GetCheckedValueObject<float3x3>(ctx, 0, float3x3_ID);
-    float3x4* newObj = new float3x4(other);
+    float3x4* newObj = new (ctx) float3x4(other);
     PushConstructorResult<float3x4>(ctx, newObj, float3x4_ID, float3x4_Finalizer);
     return 0;
 }
@@ -111,7 +111,7 @@ static duk_ret_t float3x4_Ctor_float3x3_float3(duk_context* ctx)
 {
     float3x3& other = *GetCheckedValueObject<float3x3>(ctx, 0, float3x3_ID);
     float3& translate = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    float3x4* newObj = new float3x4(other, translate);
+    float3x4* newObj = new (ctx) float3x4(other, translate);
     PushConstructorResult<float3x4>(ctx, newObj, float3x4_ID, float3x4_Finalizer);
     return 0;
 }
@@ -122,7 +122,7 @@ static duk_ret_t float3x4_Ctor_float3_float3_float3_float3(duk_context* ctx)
     float3& col1 = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
     float3& col2 = *GetCheckedValueObject<float3>(ctx, 2, float3_ID);
     float3& col3 = *GetCheckedValueObject<float3>(ctx, 3, float3_ID);
-    float3x4* newObj = new float3x4(col0, col1, col2, col3);
+    float3x4* newObj = new (ctx) float3x4(col0, col1, col2, col3);
     PushConstructorResult<float3x4>(ctx, newObj, float3x4_ID, float3x4_Finalizer);
     return 0;
 }
@@ -130,7 +130,7 @@ static duk_ret_t float3x4_Ctor_float3_float3_float3_float3(duk_context* ctx)
 static duk_ret_t float3x4_Ctor_Quat(duk_context* ctx)
 {
     Quat& orientation = *GetCheckedValueObject<Quat>(ctx, 0, Quat_ID);
-    float3x4* newObj = new float3x4(orientation);
+    float3x4* newObj = new (ctx) float3x4(orientation);
     PushConstructorResult<float3x4>(ctx, newObj, float3x4_ID, float3x4_Finalizer);
     return 0;
 }
@@ -139,7 +139,7 @@ static duk_ret_t float3x4_Ctor_Quat_float3(duk_context* ctx)
 {
     Quat& orientation = *GetCheckedValueObject<Quat>(ctx, 0, Quat_ID);
     float3& translation = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    float3x4* newObj = new float3x4(orientation, translation);
+    float3x4* newObj = new (ctx) float3x4(orientation, translation);
     PushConstructorResult<float3x4>(ctx, newObj, float3x4_ID, float3x4_Finalizer);
     return 0;
 }
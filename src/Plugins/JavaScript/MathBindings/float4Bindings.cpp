@@ -115,7 +115,7 @@ static duk_ret_t float4_Get_w(duk_context* ctx)
 
 static duk_ret_t float4_Ctor(duk_context* ctx)
 {
-    float4* newObj = new float4();
+    float4* newObj = new (ctx) float4();
     PushConstructorResult<float4>(ctx, newObj, float4_ID, float4_Finalizer);
     return 0;
 }
@@ -123,7 +123,7 @@ static duk_ret_t float4_Ctor(duk_context* ctx)
 static duk_ret_t float4_Ctor_float4(duk_context* ctx)
 {
     float4& rhs = *GetCheckedValueObject<float4>(ctx, 0, float4_ID);
-    float4* newObj = new float4(rhs);
+    float4* newObj = new (ctx) float4(rhs);
     PushConstructorResult<float4>(ctx, newObj, float4_ID, float4_Finalizer);
     return 0;
 }
@@ -134,7 +134,7 @@ static duk_ret_t float4_Ctor_float_float_float_float(duk_context* ctx)
     float y = (float)duk_require_number(ctx, 1);
     float z = (float)duk_require_number(ctx, 2);
     float w = (float)duk_require_number(ctx, 3);
-    float4* newObj = new float4(x, y, z, w);
+    float4* newObj = new (ctx) float4(x, y, z, w);
     PushConstructorResult<float4>(ctx, newObj, float4_ID, float4_Finalizer);
     return 0;
 }
@@ -143,7 +143,7 @@ static duk_ret_t float4_Ctor_float3_float(duk_context* ctx)
 {
     float3& xyz = *GetCheckedValueObject<float3>(ctx, 0, float3_ID);
     float w = (float)duk_require_number(ctx, 1);
-    float4* newObj = new float4(xyz, w);
+    float4* newObj = new (ctx) float4(xyz, w);
     PushConstructorResult<float4>(ctx, newObj, float4_ID, float4_Finalizer);
     return 0;
 }
@@ -153,7 +153,7 @@ static duk_ret_t float4_Ctor_float_float_float2(duk_context* ctx)
     float x = (float)duk_require_number(ctx, 0);
     float y = (float)duk_require_number(ctx, 1);
     float2& zw = *GetCheckedValueObject<float2>(ctx, 2, float2_ID);
-    float4* newObj = new float4(x, y, zw);
+    float4* newObj = new (ctx) float4(x, y, zw);
     PushConstructorResult<float4>(ctx, newObj, float4_ID, float4_Finalizer);
     return 0;
 }
@@ -163,7 +163,7 @@ static duk_ret_t float4_Ctor_float_float2_float(duk_context* ctx)
     float x = (float)duk_require_number(ctx, 0);
     float2& yz = *GetCheckedValueObject<float2>(ctx, 1, float2_ID);
     float w = (float)duk_require_number(ctx, 2);
-    float4* newObj = new float4(x, yz, w);
+    float4* newObj = new (ctx) float4(x, yz, w);
     PushConstructorResult<float4>(ctx, newObj, float4_ID, float4_Finalizer);
     return 0;
 }
@@ -172,7 +172,7 @@ static duk_ret_t float4_Ctor_float_float3(duk_context* ctx)
 {
     float x = (float)duk_require_number(ctx, 0);
     float3& yzw = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    float4* newObj = new float4(x, yzw);
+    float4* newObj = new (ctx) float4(x, yzw);
     PushConstructorResult<float4>(ctx, newObj, float4_ID, float4_Finalizer);
     return 0;
 }
@@ -181,7 +181,7 @@ static duk_ret_t float4_Ctor_float2_float2(duk_context* ctx)
 {
     float2& xy = *GetCheckedValueObject<float2>(ctx, 0, float2_ID);
     float2& zw = *GetCheckedValueObject<float2>(ctx, 1, float2_ID);
-    float4* newObj = new float4(xy, zw);
+    float4* newObj = new (ctx) float4(xy, zw);
     PushConstructorResult<float4>(ctx, newObj, float4_ID, float4_Finalizer);
     return 0;
 }
@@ -191,7 +191,7 @@ static duk_ret_t float4_Ctor_float2_float_float(duk_context* ctx)
     float2& xy = *GetCheckedValueObject<float2>(ctx, 0, float2_ID);
     float z = (float)duk_require_number(ctx, 1);
     float w = (float)duk_require_number(ctx, 2);
-    float4* newObj = new float4(xy, z, w);
+    float4* newObj = new (ctx) float4(xy, z, w);
     PushConstructorResult<float4>(ctx, newObj, float4_ID, float4_Finalizer);
     return 0;
 }
@@ -67,7 +67,7 @@ static duk_ret_t float4x4_Finalizer(duk_context* ctx)
 
 static duk_ret_t float4x4_Ctor(duk_context* ctx)
 {
-    float4x4* newObj = new float4x4();
+    float4x4* newObj = new (ctx) float4x4();
     PushConstructorResult<float4x4>(ctx, newObj, float4x4_ID, float4x4_Finalizer);
     return 0;
 }
@@ -75,7 +75,7 @@ static duk_ret_t float4x4_Ctor(duk_context* ctx)
 static duk_ret_t float4x4_Ctor_float4x4(duk_context* ctx)
 {
     float4x4& rhs = *GetCheckedValueObject<float4x4>(ctx, 0, float4x4_ID);
-    float4x4* newObj = new float4x4(rhs);
+    float4x4* newObj = new (ctx) float4x4(rhs);
     PushConstructorResult<float4x4>(ctx, newObj, float4x4_ID, float4x4_Finalizer);
     return 0;
 }
@@ -98,7 +98,7 @@ static duk_ret_t float4x4_Ctor_float_float_float_float_float_float_float_float_f
     float _31 = (float)duk_require_number(ctx, 13);
     float _32 = (float)duk_require_number(ctx, 14);
     float _33 = (float)duk_require_number(ctx, 15);
-    float4x4* newObj = new float4x4(_00, _01, _02, _03, _10, _11, _12, _13, _20, _21, _22, _23, _30, _31, _32, _33);
+    float4x4* newObj = new (ctx) float4x4(_00, _01, _02, _03, _10, _11, _12, _13, _20, _21, _22, _23, _30, _31, _32, _33);
     PushConstructorResult<float4x4>(ctx, newObj, float4x4_ID, float4x4_Finalizer);
     return 0;
 }
@@ -106,7 +106,7 @@ static duk_ret_t float4x4_Ctor_float_float_float_float_float_float_float_float_f
 static duk_ret_t float4x4_Ctor_float3x3(duk_context* ctx)
 {
     float3x3& other = *GetCheckedValueObject<float3x3>(ctx, 0, float3x3_ID);
-    float4x4* newObj = new float4x4(other);
+    float4x4* newObj = new (ctx) float4x4(other);
     PushConstructorResult<float4x4>(ctx, newObj, float4x4_ID, float4x4_Finalizer);
     return 0;
 }
@@ -114,7 +114,7 @@ static duk_ret_t float4x4_Ctor_float3x3(duk_context* ctx)
 static duk_ret_t float4x4_Ctor_float3x4(duk_context* ctx)
 {
     float3x4& other = *GetCheckedValueObject<float3x4>(ctx, 0, float3x4_ID);
-    float4x4* newObj = new float4x4(other);
+    float4x4* newObj = new (ctx) float4x4(other);
     PushConstructorResult<float4x4>(ctx, newObj, float4x4_ID, float4x4_Finalizer);
     return 0;
 }
@@ -125,7 +125,7 @@ static duk_ret_t float4x4_Ctor_float4_float4_float4_float4(duk_context* ctx)
     float4& col1 = *GetCheckedValueObject<float4>(ctx, 1, float4_ID);
     float4& col2 = *GetCheckedValueObject<float4>(ctx, 2, float4_ID);
     float4& col3 = *GetCheckedValueObject<float4>(ctx, 3, float4_ID);
-    float4x4* newObj = new float4x4(col0, col1, col2, col3);
+    float4x4* newObj = new (ctx) float4x4(col0, col1, col2, col3);
     PushConstructorResult<float4x4>(ctx, newObj, float4x4_ID, float4x4_Finalizer);
     return 0;
 }
@@ -133,7 +133,7 @@ static duk_ret_t float4x4_Ctor_float4_float4_float4_float4(duk_context* ctx)
 static duk_ret_t float4x4_Ctor_Quat(duk_context* ctx)
 {
     Quat& orientation = *GetCheckedValueObject<Quat>(ctx, 0, Quat_ID);
-    float4x4* newObj = new float4x4(orientation);
+    float4x4* newObj = new (ctx) float4x4(orientation);
     PushConstructorResult<float4x4>(ctx, newObj, float4x4_ID, float4x4_Finalizer);
     return 0;
 }
@@ -142,7 +142,7 @@ static duk_ret_t float4x4_Ctor_Quat_float3(duk_context* ctx)
 {
     Quat& orientation = *GetCheckedValueObject<Quat>(ctx, 0, Quat_ID);
     float3& translation = *GetCheckedValueObject<float3>(ctx, 1, float3_ID);
-    float4x4* newObj = new float4x4(orientation, translation);
+    float4x4* newObj = new (ctx) float4x4(orientation, translation);
     PushConstructorResult<float4x4>(ctx, newObj, float4x4_ID, float4x4_Finalizer);
     return 0;
 }
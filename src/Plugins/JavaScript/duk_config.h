@@ -45,6 +45,14 @@
 // Tundra-Urho3D: compile JavaScript plugin (duktape included) as DLL
 #define DUK_OPT_DLL_BUILD
 
+// Tundra-Urho3D: interrupt scripts that exceed their execution budget, see JavaScriptHeapAllocator::SetExecutionLimit
+#define DUK_OPT_INTERRUPT_COUNTER
+#define DUK_OPT_EXEC_TIMEOUT_CHECK(udata) TundraDukExecTimeoutCheck(udata)
+#ifdef __cplusplus
+extern "C"
+#endif
+int TundraDukExecTimeoutCheck(void *udata);
+
 
 /*
  *  Compiler features
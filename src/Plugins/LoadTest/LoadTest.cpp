@@ -0,0 +1,226 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "StableHeaders.h"
+#include "LoadTest.h"
+#include "LoadTestRunner.h"
+
+#include "Framework.h"
+#include "CoreDefines.h"
+#include "LoggingFunctions.h"
+#include "TundraLogic.h"
+#include "Server.h"
+#include "SyncManager.h"
+
+#include <kNet/Types.h>
+
+#include <Urho3D/Container/Sort.h>
+
+#include <cstdarg>
+#include <cstdio>
+
+namespace Tundra
+{
+
+namespace
+{
+    /// Formats with printf rules, Urho3D::ToString does not support precision.
+    String Format(const char *format, ...)
+    {
+        char buffer[1024];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        return String(buffer);
+    }
+
+    /// Returns the @c percentile (0-100) of sorted @c values.
+    float Percentile(const PODVector<float> &values, float percentile)
+    {
+        if (values.Empty())
+            return 0.f;
+        uint index = static_cast<uint>(percentile / 100.f * (values.Size() - 1) + 0.5f);
+        return values[Urho3D::Min(index, values.Size() - 1)];
+    }
+
+    /// Reads an unsigned number parameter, or returns @c defaultValue if not given.
+    float NumberParameter(Framework *framework, const String &name, float defaultValue)
+    {
+        StringList param = framework->CommandLineParameters(name);
+        if (param.Empty())
+            return defaultValue;
+        float value = Urho3D::ToFloat(param.Front());
+        if (value < 0.f)
+        {
+            LogWarning("[LoadTest]: " + name + " can not be negative, using " + String(defaultValue) + ".");
+            return defaultValue;
+        }
+        return value;
+    }
+}
+
+LoadTest::LoadTest(Framework *owner) :
+    IModule("LoadTest", owner),
+    numKNetClients_(0),
+    numWebSocketClients_(0),
+    editRate_(2.f),
+    reportInterval_(5.f),
+    duration_(0.f),
+    started_(false),
+    runner_(0)
+{
+}
+
+LoadTest::~LoadTest()
+{
+    Stop();
+}
+
+void LoadTest::Initialize()
+{
+    numKNetClients_ = static_cast<uint>(NumberParameter(framework, "--loadTestClients", 0.f));
+    numWebSocketClients_ = static_cast<uint>(NumberParameter(framework, "--loadTestWebSocketClients", 0.f));
+    editRate_ = NumberParameter(framework, "--loadTestEditRate", editRate_);
+    reportInterval_ = Urho3D::Max(NumberParameter(framework, "--loadTestReportInterval", reportInterval_), 0.1f);
+    duration_ = NumberParameter(framework, "--loadTestDuration", duration_);
+
+    if (numKNetClients_ + numWebSocketClients_ > 0 && !framework->HasCommandLineParameter("--server"))
+        LogWarning("[LoadTest]: The load test requires --server, no clients will be started.");
+}
+
+void LoadTest::Uninitialize()
+{
+    Stop();
+}
+
+void LoadTest::Update(float /*frametime*/)
+{
+    if (!started_)
+    {
+        Start();
+        return;
+    }
+    if (!runner_)
+        return;
+
+    const bool finished = (duration_ > 0.f && runTimer_.GetMSec(false) >= static_cast<uint>(duration_ * 1000.f));
+    if (finished || reportTimer_.GetMSec(false) >= static_cast<uint>(reportInterval_ * 1000.f))
+    {
+        const float seconds = reportTimer_.GetMSec(true) / 1000.f;
+        runner_->TakeStats(stats_);
+        Report(stats_, tickMsec_, seconds, "LoadTest");
+
+        const uint connected = stats_.connected;
+        const uint loggedIn = stats_.loggedIn;
+        totalStats_.Merge(stats_);
+        totalStats_.connected = connected;
+        totalStats_.loggedIn = loggedIn;
+        totalTickMsec_.Push(tickMsec_);
+        stats_.Reset();
+        tickMsec_.Clear();
+    }
+
+    if (finished)
+    {
+        Report(totalStats_, totalTickMsec_, runTimer_.GetMSec(false) / 1000.f, "LoadTest summary");
+        Stop();
+        framework->Exit();
+    }
+}
+
+void LoadTest::Start()
+{
+    if (numKNetClients_ + numWebSocketClients_ == 0)
+    {
+        started_ = true;
+        return;
+    }
+
+    TundraLogic *tundraLogic = framework->Module<TundraLogic>();
+    if (!tundraLogic || !tundraLogic->IsServer() || !tundraLogic->Server() || tundraLogic->Server()->Port() <= 0)
+        return;
+    started_ = true;
+
+    ServerPtr server = tundraLogic->Server();
+    const kNet::SocketTransportLayer transport = kNet::StringToSocketTransportLayer(server->Protocol().CString());
+    if (numKNetClients_ > 0 && transport == kNet::InvalidTransportLayer)
+    {
+        LogError("[LoadTest]: Unknown server protocol " + server->Protocol() + ", can not start the load test.");
+        return;
+    }
+
+    syncManager_ = tundraLogic->SyncManager();
+    if (syncManager_)
+        syncManager_->TickProcessed.Connect(this, &LoadTest::OnTickProcessed);
+
+    LogInfo(Format("[LoadTest]: Starting %u kNet (%s) and %u WebSocket clients to port %d, %.1f edits per second per client.",
+        numKNetClients_, server->Protocol().CString(), numWebSocketClients_, server->Port(), editRate_));
+
+    runner_ = new LoadTestRunner("127.0.0.1", static_cast<unsigned short>(server->Port()), transport,
+        numKNetClients_, numWebSocketClients_, editRate_);
+    runner_->Run();
+    reportTimer_.Reset();
+    runTimer_.Reset();
+}
+
+void LoadTest::Stop()
+{
+    if (syncManager_)
+        syncManager_->TickProcessed.Disconnect(this, &LoadTest::OnTickProcessed);
+    syncManager_.Reset();
+
+    if (runner_)
+    {
+        runner_->Stop();
+        SAFE_DELETE(runner_);
+    }
+}
+
+void LoadTest::OnTickProcessed(float seconds)
+{
+    tickMsec_.Push(seconds * 1000.f);
+}
+
+void LoadTest::Report(const LoadTestStats &stats, const PODVector<float> &tickMsec, float seconds, const String &title)
+{
+    seconds = Urho3D::Max(seconds, 0.001f);
+    const uint numClients = numKNetClients_ + numWebSocketClients_;
+
+    PODVector<float> ticks(tickMsec);
+    Urho3D::Sort(ticks.Begin(), ticks.End());
+    float tickTotal = 0.f;
+    for (uint i = 0; i < ticks.Size(); ++i)
+        tickTotal += ticks[i];
+
+    PODVector<float> latencies(stats.latencies);
+    Urho3D::Sort(latencies.Begin(), latencies.End());
+
+    LogInfo(Format("[%s]: %.1f s, %u/%u clients connected, %u logged in", title.CString(), seconds, stats.connected, numClients, stats.loggedIn));
+    LogInfo(Format("[%s]: Server tick avg %.3f p99 %.3f max %.3f ms over %u ticks", title.CString(),
+        (ticks.Empty() ? 0.f : tickTotal / ticks.Size()), Percentile(ticks, 99.f), (ticks.Empty() ? 0.f : ticks.Back()), ticks.Size()));
+    LogInfo(Format("[%s]: Per client in %.2f KB/s out %.2f KB/s, messages in %.1f/s out %.1f/s", title.CString(),
+        stats.bytesIn / 1024.f / seconds / Urho3D::Max(numClients, 1U), stats.bytesOut / 1024.f / seconds / Urho3D::Max(numClients, 1U),
+        stats.messagesIn / seconds / Urho3D::Max(numClients, 1U), stats.messagesOut / seconds / Urho3D::Max(numClients, 1U)));
+
+    String messages;
+    for (HashMap<u16, uint>::ConstIterator iter = stats.messagesInById.Begin(); iter != stats.messagesInById.End(); ++iter)
+        messages += " " + String(static_cast<uint>(iter->first_)) + ":" + String(iter->second_);
+    LogInfo(Format("[%s]: Messages in %u out %u, received by ID%s", title.CString(),
+        static_cast<uint>(stats.messagesIn), static_cast<uint>(stats.messagesOut), messages.CString()));
+
+    LogInfo(Format("[%s]: Attribute latency p50 %.2f p90 %.2f p99 %.2f max %.2f ms over %u samples", title.CString(),
+        Percentile(latencies, 50.f), Percentile(latencies, 90.f), Percentile(latencies, 99.f),
+        (latencies.Empty() ? 0.f : latencies.Back()), latencies.Size()));
+}
+
+}
+
+extern "C"
+{
+
+DLLEXPORT void TundraPluginMain(Tundra::Framework *fw)
+{
+    fw->RegisterModule(new Tundra::LoadTest(fw));
+}
+
+}
@@ -0,0 +1,84 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#pragma once
+
+#include "IModule.h"
+#include "CoreTypes.h"
+#include "TundraLogicFwd.h"
+#include "LoadTestClient.h"
+
+#include <Urho3D/Core/Timer.h>
+
+namespace Tundra
+{
+
+class LoadTestRunner;
+
+/// Server load test harness.
+/** Spawns simulated clients that connect to the server of the same process over loopback, and reports how the
+    server scales. Requires no external services, run for example with
+    'Tundra --config tundra-loadtest.json --server --headless --loadTestClients 100 --loadTestWebSocketClients 100'.
+
+    Each client logs in with MsgLogin, sends its observer position, creates an entity and edits its name.
+    See LoadTestClient. The clients run in a LoadTestRunner thread so that the measured server is not slowed down by them.
+
+    The report is logged every '--loadTestReportInterval' seconds (default 5):
+    <ul>
+    <li>Server tick time: time SyncManager spent on its network update ticks, average and maximum.
+    <li>Bytes per client: received and sent bytes per second, averaged over the clients.
+    <li>Message counts: received and sent messages, and the received messages by ID.
+    <li>Latency percentiles: time from a client editing an attribute until another client receives the edit.
+    </ul>
+
+    Command line parameters:
+    <ul>
+    <li>--loadTestClients [num]: Number of kNet clients.
+    <li>--loadTestWebSocketClients [num]: Number of WebSocket clients.
+    <li>--loadTestEditRate [hz]: Attribute edits per second per client, default 2.
+    <li>--loadTestReportInterval [seconds]: Report interval, default 5.
+    <li>--loadTestDuration [seconds]: Exits after logging a summary of the whole run. Runs until closed if omitted.
+    </ul> */
+class LoadTest : public IModule
+{
+    URHO3D_OBJECT(LoadTest, IModule);
+
+public:
+    explicit LoadTest(Framework *owner);
+    ~LoadTest();
+
+    void Initialize() override;
+    void Uninitialize() override;
+    void Update(float frametime) override;
+
+private:
+    /// Starts the clients once the server is running.
+    void Start();
+    void Stop();
+
+    void OnTickProcessed(float seconds);
+
+    /// Logs the traffic of @c stats collected during @c seconds, and the server ticks in @c tickMsec.
+    void Report(const LoadTestStats &stats, const PODVector<float> &tickMsec, float seconds, const String &title);
+
+    uint numKNetClients_;
+    uint numWebSocketClients_;
+    float editRate_;
+    float reportInterval_;
+    float duration_;
+    bool started_;
+
+    LoadTestRunner *runner_;
+    WeakPtr<SyncManager> syncManager_;
+
+    /// Traffic and server ticks since the last report.
+    LoadTestStats stats_;
+    PODVector<float> tickMsec_;
+    Urho3D::Timer reportTimer_;
+
+    /// Traffic and server ticks of the whole run.
+    LoadTestStats totalStats_;
+    PODVector<float> totalTickMsec_;
+    Urho3D::Timer runTimer_;
+};
+
+}
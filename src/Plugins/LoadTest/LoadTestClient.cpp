@@ -0,0 +1,447 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "StableHeaders.h"
+#include "LoadTestClient.h"
+
+#include "TundraMessages.h"
+#include "WebSocketCompression.h"
+#include "CoreStringUtils.h"
+#include "LoggingFunctions.h"
+#include "Name.h"
+#include "Math/float3.h"
+
+#include <kNet/MessageConnection.h>
+#include <kNet/DataSerializer.h>
+#include <kNet/DataDeserializer.h>
+
+#include <boost/bind.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+namespace Tundra
+{
+
+const char * const LoadTestClient::cLatencyPrefix = "loadtest:";
+const float LoadTestClient::cObserverRate = 10.f;
+
+// LoadTestStats
+
+void LoadTestStats::Reset()
+{
+    connected = 0;
+    loggedIn = 0;
+    bytesIn = 0;
+    bytesOut = 0;
+    messagesIn = 0;
+    messagesOut = 0;
+    messagesInById.Clear();
+    latencies.Clear();
+}
+
+void LoadTestStats::Merge(const LoadTestStats &other)
+{
+    connected += other.connected;
+    loggedIn += other.loggedIn;
+    bytesIn += other.bytesIn;
+    bytesOut += other.bytesOut;
+    messagesIn += other.messagesIn;
+    messagesOut += other.messagesOut;
+    for (HashMap<u16, uint>::ConstIterator iter = other.messagesInById.Begin(); iter != other.messagesInById.End(); ++iter)
+        messagesInById[iter->first_] += iter->second_;
+    latencies.Push(other.latencies);
+}
+
+// LoadTestClient
+
+LoadTestClient::LoadTestClient(uint index, float editRate) :
+    index_(index),
+    editInterval_(editRate > 0.f ? 1.f / editRate : 0.f),
+    loginSent_(false),
+    loggedIn_(false),
+    createSent_(false),
+    entityId_(0),
+    componentId_(0),
+    startTime_(kNet::Clock::Tick()),
+    lastObserverSend_(0),
+    lastEdit_(0)
+{
+}
+
+void LoadTestClient::Update(kNet::tick_t now)
+{
+    if (!IsConnected())
+        return;
+
+    if (!loginSent_)
+    {
+        SendLogin();
+        loginSent_ = true;
+        return;
+    }
+    if (!loggedIn_)
+        return;
+
+    if (!createSent_)
+    {
+        SendCreateEntity();
+        createSent_ = true;
+    }
+
+    if (kNet::Clock::TicksToSecondsF(kNet::Clock::TicksInBetween(now, lastObserverSend_)) >= 1.f / cObserverRate)
+    {
+        SendObserverPosition(kNet::Clock::TicksToSecondsF(kNet::Clock::TicksInBetween(now, startTime_)));
+        lastObserverSend_ = now;
+    }
+
+    if (entityId_ && editInterval_ > 0.f && kNet::Clock::TicksToSecondsF(kNet::Clock::TicksInBetween(now, lastEdit_)) >= editInterval_)
+    {
+        SendEdit(now);
+        lastEdit_ = now;
+    }
+}
+
+void LoadTestClient::TakeStats(LoadTestStats &dest)
+{
+    stats_.connected = (IsConnected() ? 1 : 0);
+    stats_.loggedIn = (loggedIn_ ? 1 : 0);
+    dest.Merge(stats_);
+    stats_.Reset();
+}
+
+void LoadTestClient::SendLogin()
+{
+    String loginData = LoginData();
+    char buffer[1024];
+    kNet::DataSerializer ds(buffer, sizeof(buffer));
+    WriteUtf8String(ds, loginData);
+    ds.AddVLE<kNet::VLE8_16_32>(cHighestSupportedProtocolVersion);
+    SendMessage(cLoginMessage, true, ds.GetData(), ds.BytesFilled());
+}
+
+void LoadTestClient::SendCreateEntity()
+{
+    // Name component with the name, description and group attributes
+    char attrBuffer[256];
+    kNet::DataSerializer attrDs(attrBuffer, sizeof(attrBuffer));
+    WriteUtf8String(attrDs, "LoadTest" + String(index_));
+    WriteUtf8String(attrDs, "");
+    WriteUtf8String(attrDs, "LoadTest");
+
+    // The server replies with its own IDs, the sender IDs need only be unique per connection.
+    char buffer[512];
+    kNet::DataSerializer ds(buffer, sizeof(buffer));
+    ds.AddVLE<kNet::VLE8_16_32>(0); // Scene ID
+    ds.AddVLE<kNet::VLE8_16_32>(1); // Sender entity ID
+    ds.Add<u8>(0); // Not temporary
+    ds.Add<u32>(0); // No parent
+    ds.AddVLE<kNet::VLE8_16_32>(1); // Number of components
+    ds.AddVLE<kNet::VLE8_16_32>(1); // Sender component ID
+    ds.AddVLE<kNet::VLE8_16_32>(Name::ComponentTypeId);
+    ds.AddString("");
+    ds.AddVLE<kNet::VLE8_16_32>((u32)attrDs.BytesFilled());
+    ds.AddArray<u8>((const u8*)attrBuffer, (u32)attrDs.BytesFilled());
+    SendMessage(cCreateEntityMessage, true, ds.GetData(), ds.BytesFilled());
+}
+
+void LoadTestClient::SendObserverPosition(float time)
+{
+    // Walk a circle of its own so that the observers are spread around the scene
+    const float radius = 10.f + (index_ % 50);
+    const float angle = time * 0.5f + index_;
+    const float3 pos(cos(angle) * radius, 0.f, sin(angle) * radius);
+    const float3 forward(-sin(angle), 0.f, cos(angle));
+
+    char buffer[32];
+    kNet::DataSerializer ds(buffer, sizeof(buffer));
+    ds.AddVLE<kNet::VLE8_16_32>(0); // Scene ID
+    // Full precision position and 1 DOF orientation, see WriteOptimizedPosAndRot in SyncManager
+    ds.AddArithmeticEncoded(8, 2, 3, 1, 4);
+    ds.Add<float>(pos.x);
+    ds.Add<float>(pos.y);
+    ds.Add<float>(pos.z);
+    ds.AddNormalizedVector2D(forward.x, forward.z, 8);
+    SendMessage(cObserverPositionMessage, false, ds.GetData(), ds.BytesFilled());
+}
+
+void LoadTestClient::SendEdit(kNet::tick_t now)
+{
+    char attrBuffer[64];
+    kNet::DataSerializer attrDs(attrBuffer, sizeof(attrBuffer));
+    attrDs.Add<kNet::bit>(0); // Indexed attributes
+    attrDs.Add<u8>(1);
+    attrDs.Add<u8>(0); // Name::name
+    WriteUtf8String(attrDs, String(cLatencyPrefix) + String(static_cast<unsigned long long>(now)));
+
+    char buffer[128];
+    kNet::DataSerializer ds(buffer, sizeof(buffer));
+    ds.AddVLE<kNet::VLE8_16_32>(0); // Scene ID
+    ds.AddVLE<kNet::VLE8_16_32>(entityId_);
+    ds.AddVLE<kNet::VLE8_16_32>(componentId_);
+    ds.AddVLE<kNet::VLE8_16_32>((u32)attrDs.BytesFilled());
+    ds.AddArray<u8>((const u8*)attrBuffer, (u32)attrDs.BytesFilled());
+    SendMessage(cEditAttributesMessage, true, ds.GetData(), ds.BytesFilled());
+}
+
+void LoadTestClient::HandleServerMessage(u16 id, const char *data, size_t numBytes)
+{
+    ++stats_.messagesIn;
+    ++stats_.messagesInById[id];
+
+    try
+    {
+        switch(id)
+        {
+        case cLoginReplyMessage:
+        {
+            kNet::DataDeserializer dd(data, numBytes);
+            loggedIn_ = (dd.Read<u8>() != 0);
+            if (!loggedIn_)
+                LogWarning("[LoadTest]: Client " + String(index_) + " login refused");
+            break;
+        }
+        case cCreateEntityReplyMessage:
+            HandleCreateEntityReply(data, numBytes);
+            break;
+        case cEditAttributesMessage:
+            HandleEditAttributes(data, numBytes, kNet::Clock::Tick());
+            break;
+        }
+    }
+    catch(kNet::NetException &e)
+    {
+        LogError("[LoadTest]: Client " + String(index_) + " failed to read message " + String(id) + ": " + e.what());
+    }
+}
+
+void LoadTestClient::HandleCreateEntityReply(const char *data, size_t numBytes)
+{
+    kNet::DataDeserializer dd(data, numBytes);
+    dd.ReadVLE<kNet::VLE8_16_32>(); // Scene ID
+    dd.ReadVLE<kNet::VLE8_16_32>(); // Sender entity ID
+    u32 entityId = dd.ReadVLE<kNet::VLE8_16_32>();
+    u32 numComponents = dd.ReadVLE<kNet::VLE8_16_32>();
+    if (!numComponents)
+        return;
+    dd.ReadVLE<kNet::VLE8_16_32>(); // Sender component ID
+    componentId_ = dd.ReadVLE<kNet::VLE8_16_32>();
+    entityId_ = entityId;
+}
+
+void LoadTestClient::HandleEditAttributes(const char *data, size_t numBytes, kNet::tick_t now)
+{
+    kNet::DataDeserializer dd(data, numBytes);
+    dd.ReadVLE<kNet::VLE8_16_32>(); // Scene ID
+    dd.ReadVLE<kNet::VLE8_16_32>(); // Entity ID
+    while (dd.BitsLeft() >= 8)
+    {
+        dd.ReadVLE<kNet::VLE8_16_32>(); // Component ID
+        u32 attrDataSize = dd.ReadVLE<kNet::VLE8_16_32>();
+        if (attrDataSize > dd.BytesLeft())
+            return;
+        const char *attrData = data + dd.BytePos();
+        dd.SkipBytes(attrDataSize);
+
+        // Only the first attribute is of interest, it is the name in edits of the other clients
+        kNet::DataDeserializer attrDs(attrData, attrDataSize);
+        if (attrDs.Read<kNet::bit>() == 0)
+        {
+            // Indices
+            if (attrDs.Read<u8>() == 0 || attrDs.Read<u8>() != 0)
+                continue;
+        }
+        else if (attrDs.Read<kNet::bit>() == 0)
+        {
+            // Bitmask
+            continue;
+        }
+
+        if (attrDs.BitsLeft() < 16)
+            continue;
+        String name = ReadUtf8String(attrDs);
+        if (!name.StartsWith(cLatencyPrefix))
+            continue;
+        kNet::tick_t sent = strtoull(name.CString() + strlen(cLatencyPrefix), 0, 10);
+        if (sent && sent <= now)
+            stats_.latencies.Push(static_cast<float>(kNet::Clock::TicksToMillisecondsD(kNet::Clock::TicksInBetween(now, sent))));
+    }
+}
+
+// KNetLoadTestClient
+
+KNetLoadTestClient::KNetLoadTestClient(uint index, float editRate, kNet::Network *network, kNet::SocketTransportLayer transport) :
+    LoadTestClient(index, editRate),
+    network_(network),
+    transport_(transport)
+{
+}
+
+KNetLoadTestClient::~KNetLoadTestClient()
+{
+    if (connection_)
+    {
+        connection_->Disconnect(0);
+        connection_->Close(0);
+    }
+}
+
+bool KNetLoadTestClient::Connect(const String &host, unsigned short port)
+{
+    connection_ = network_->Connect(host.CString(), port, transport_, this);
+    if (!connection_)
+        return false;
+    if (connection_->GetSocket() && connection_->GetSocket()->TransportLayer() == kNet::SocketOverTCP)
+        connection_->GetSocket()->SetNaglesAlgorithmEnabled(false);
+    return true;
+}
+
+void KNetLoadTestClient::Process()
+{
+    if (connection_)
+        connection_->Process();
+}
+
+bool KNetLoadTestClient::IsConnected() const
+{
+    return connection_ && connection_->GetConnectionState() == kNet::ConnectionOK;
+}
+
+void KNetLoadTestClient::HandleMessage(kNet::MessageConnection * /*source*/, kNet::packet_id_t /*packetId*/, kNet::message_id_t id, const char *data, size_t numBytes)
+{
+    stats_.bytesIn += numBytes + sizeof(u16);
+    HandleServerMessage(static_cast<u16>(id), data, numBytes);
+}
+
+void KNetLoadTestClient::SendMessage(u16 id, bool reliable, const char *data, size_t numBytes)
+{
+    if (!connection_)
+        return;
+    connection_->SendMessage(id, reliable, reliable, 100, 0, data, numBytes);
+    stats_.bytesOut += numBytes + sizeof(u16);
+    ++stats_.messagesOut;
+}
+
+String KNetLoadTestClient::LoginData() const
+{
+    return Urho3D::ToString("<login><username value=\"LoadTest%u\" /></login>", index_);
+}
+
+// WebSocketLoadTestClient
+
+WebSocketLoadTestClient::WebSocketLoadTestClient(uint index, float editRate, LoadTestEndpoint *endpoint) :
+    LoadTestClient(index, editRate),
+    endpoint_(endpoint),
+    open_(false),
+    inflater_(0)
+{
+}
+
+WebSocketLoadTestClient::~WebSocketLoadTestClient()
+{
+    if (open_)
+    {
+        websocketpp::lib::error_code ec;
+        endpoint_->close(connection_, websocketpp::close::status::going_away, "", ec);
+    }
+    SAFE_DELETE(inflater_);
+}
+
+bool WebSocketLoadTestClient::Connect(const String &host, unsigned short port)
+{
+    websocketpp::lib::error_code ec;
+    LoadTestEndpoint::connection_ptr connection = endpoint_->get_connection(Urho3D::ToString("ws://%s:%u", host.CString(), port).CString(), ec);
+    if (ec)
+    {
+        LogError("[LoadTest]: Client " + String(index_) + " failed to create WebSocket connection: " + String(ec.message().c_str()));
+        return false;
+    }
+    connection->set_open_handler(boost::bind(&WebSocketLoadTestClient::OnOpen, this, ::_1));
+    connection->set_close_handler(boost::bind(&WebSocketLoadTestClient::OnClose, this, ::_1));
+    connection->set_fail_handler(boost::bind(&WebSocketLoadTestClient::OnClose, this, ::_1));
+    connection->set_message_handler(boost::bind(&WebSocketLoadTestClient::OnMessage, this, ::_1, ::_2));
+    connection_ = connection->get_handle();
+    endpoint_->connect(connection);
+    return true;
+}
+
+void WebSocketLoadTestClient::OnOpen(websocketpp::connection_hdl /*connection*/)
+{
+    open_ = true;
+}
+
+void WebSocketLoadTestClient::OnClose(websocketpp::connection_hdl /*connection*/)
+{
+    open_ = false;
+}
+
+void WebSocketLoadTestClient::OnMessage(websocketpp::connection_hdl /*connection*/, LoadTestEndpoint::message_ptr message)
+{
+    const std::string &payload = message->get_payload();
+    stats_.bytesIn += payload.size();
+    if (payload.empty())
+        return;
+
+    // Logged in with the highest protocol version, each frame starts with the encoding byte followed by batched messages
+    const char encoding = payload[0];
+    if (encoding == WebSocket::FrameRaw)
+        HandleFrame(payload.data() + 1, payload.size() - 1);
+    else if (encoding == WebSocket::FrameDeflate)
+    {
+        if (!inflater_)
+            inflater_ = new WebSocket::Inflater();
+        inflated_.clear();
+        if (inflater_->Decompress(payload.data() + 1, payload.size() - 1, inflated_))
+            HandleFrame(inflated_.data(), inflated_.size());
+        else
+            LogError("[LoadTest]: Client " + String(index_) + " failed to decompress a frame");
+    }
+}
+
+void WebSocketLoadTestClient::HandleFrame(const char *data, size_t numBytes)
+{
+    kNet::DataDeserializer dd(data, numBytes);
+    try
+    {
+        while (dd.BytesLeft() > sizeof(u16))
+        {
+            u32 size = dd.ReadVLE<kNet::VLE8_16_32>();
+            u16 id = dd.Read<u16>();
+            if (size > dd.BytesLeft())
+                return;
+            HandleServerMessage(id, data + dd.BytePos(), size);
+            dd.SkipBytes(size);
+        }
+    }
+    catch(kNet::NetException &e)
+    {
+        LogError("[LoadTest]: Client " + String(index_) + " received a malformed frame: " + e.what());
+    }
+}
+
+void WebSocketLoadTestClient::SendMessage(u16 id, bool /*reliable*/, const char *data, size_t numBytes)
+{
+    if (!open_)
+        return;
+
+    char buffer[1024 + sizeof(u16)];
+    if (numBytes > sizeof(buffer) - sizeof(u16))
+        return;
+    kNet::DataSerializer ds(buffer, sizeof(buffer));
+    ds.Add<u16>(id);
+    ds.AddArray<u8>((const u8*)data, (u32)numBytes);
+
+    websocketpp::lib::error_code ec;
+    endpoint_->send(connection_, buffer, ds.BytesFilled(), websocketpp::frame::opcode::binary, ec);
+    if (ec)
+        return;
+    stats_.bytesOut += ds.BytesFilled();
+    ++stats_.messagesOut;
+}
+
+String WebSocketLoadTestClient::LoginData() const
+{
+    return Urho3D::ToString("{\"username\":\"LoadTest%u\"}", index_);
+}
+
+}
@@ -0,0 +1,177 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "UserConnection.h"
+
+#include <kNet/IMessageHandler.h>
+#include <kNet/Network.h>
+#include <kNet/Clock.h>
+
+#include <boost/system/error_code.hpp>
+#ifdef BOOST_SYSTEM_NOEXCEPT
+#define _WEBSOCKETPP_NOEXCEPT_TOKEN_ BOOST_SYSTEM_NOEXCEPT
+#endif
+
+#include <websocketpp/config/asio_no_tls_client.hpp>
+#include <websocketpp/client.hpp>
+
+namespace WebSocket
+{
+    class Inflater;
+}
+
+namespace Tundra
+{
+
+typedef websocketpp::client<websocketpp::config::asio_client> LoadTestEndpoint;
+
+/// Traffic of simulated clients since the stats were last taken.
+struct LoadTestStats
+{
+    LoadTestStats() { Reset(); }
+
+    void Reset();
+    /// Adds the counters and latency samples of @c other to this.
+    void Merge(const LoadTestStats &other);
+
+    /// Number of clients that are connected and logged in at the time the stats were taken.
+    uint connected;
+    uint loggedIn;
+
+    u64 bytesIn;
+    u64 bytesOut;
+    u64 messagesIn;
+    u64 messagesOut;
+    /// Received messages by message ID.
+    HashMap<u16, uint> messagesInById;
+
+    /// Time from a client editing an attribute to another client receiving the edit, in milliseconds.
+    PODVector<float> latencies;
+};
+
+/// Simulated Tundra client used by LoadTest.
+/** Logs in with the highest supported protocol version and then acts like a moving avatar: sends its observer position
+    and once logged in, creates an entity with a Name component and edits the name at a fixed rate. The name carries
+    the time of the edit, which the other clients use to measure the end-to-end attribute latency through the server.
+
+    The messages are crafted directly, there is no client side scene. All functions are called from the LoadTestRunner thread. */
+class LoadTestClient
+{
+public:
+    /// @param index Unique index of the client, used for the login name and the observer path.
+    LoadTestClient(uint index, float editRate);
+    virtual ~LoadTestClient() {}
+
+    /// Starts connecting to the server.
+    virtual bool Connect(const String &host, unsigned short port) = 0;
+    /// Processes received messages.
+    virtual void Process() = 0;
+    /// Returns if the connection is open.
+    virtual bool IsConnected() const = 0;
+
+    /// Logs in once connected and sends the observer position and attribute edits when due.
+    void Update(kNet::tick_t now);
+
+    bool IsLoggedIn() const { return loggedIn_; }
+
+    /// Adds the traffic since the last call to @c dest and resets it.
+    void TakeStats(LoadTestStats &dest);
+
+    /// Prefix of the names written by the clients. Only names with this prefix are used for latency.
+    static const char * const cLatencyPrefix;
+    /// Observer position send rate in Hz.
+    static const float cObserverRate;
+
+protected:
+    /// Sends a message to the server.
+    virtual void SendMessage(u16 id, bool reliable, const char *data, size_t numBytes) = 0;
+    /// Returns the login data for the transport.
+    virtual String LoginData() const = 0;
+
+    /// Handles a message received from the server.
+    void HandleServerMessage(u16 id, const char *data, size_t numBytes);
+
+    uint index_;
+    LoadTestStats stats_;
+
+private:
+    void SendLogin();
+    void SendCreateEntity();
+    void SendObserverPosition(float time);
+    void SendEdit(kNet::tick_t now);
+
+    void HandleCreateEntityReply(const char *data, size_t numBytes);
+    void HandleEditAttributes(const char *data, size_t numBytes, kNet::tick_t now);
+
+    float editInterval_;
+    bool loginSent_;
+    bool loggedIn_;
+    bool createSent_;
+    /// Server assigned IDs of the edited entity and its Name component, zero until the create is acknowledged.
+    u32 entityId_;
+    u32 componentId_;
+    kNet::tick_t startTime_;
+    kNet::tick_t lastObserverSend_;
+    kNet::tick_t lastEdit_;
+};
+
+/// Simulated client connecting over kNet.
+class KNetLoadTestClient : public LoadTestClient, public kNet::IMessageHandler
+{
+public:
+    KNetLoadTestClient(uint index, float editRate, kNet::Network *network, kNet::SocketTransportLayer transport);
+    ~KNetLoadTestClient();
+
+    bool Connect(const String &host, unsigned short port) override;
+    void Process() override;
+    bool IsConnected() const override;
+
+    /// kNet::IMessageHandler override.
+    void HandleMessage(kNet::MessageConnection *source, kNet::packet_id_t packetId, kNet::message_id_t id, const char *data, size_t numBytes) override;
+
+protected:
+    void SendMessage(u16 id, bool reliable, const char *data, size_t numBytes) override;
+    String LoginData() const override;
+
+private:
+    kNet::Network *network_;
+    kNet::SocketTransportLayer transport_;
+    Ptr(kNet::MessageConnection) connection_;
+};
+
+/// Simulated client connecting over WebSocket.
+/** Reads batched and compressed frames according to the negotiated protocol version, see WebSocket::UserConnection. */
+class WebSocketLoadTestClient : public LoadTestClient
+{
+public:
+    WebSocketLoadTestClient(uint index, float editRate, LoadTestEndpoint *endpoint);
+    ~WebSocketLoadTestClient();
+
+    bool Connect(const String &host, unsigned short port) override;
+    /// Received frames are handled by the endpoint, the LoadTestRunner polls it.
+    void Process() override {}
+    bool IsConnected() const override { return open_; }
+
+protected:
+    void SendMessage(u16 id, bool reliable, const char *data, size_t numBytes) override;
+    String LoginData() const override;
+
+private:
+    void OnOpen(websocketpp::connection_hdl connection);
+    void OnClose(websocketpp::connection_hdl connection);
+    void OnMessage(websocketpp::connection_hdl connection, LoadTestEndpoint::message_ptr message);
+
+    /// Handles all messages of a received frame.
+    void HandleFrame(const char *data, size_t numBytes);
+
+    LoadTestEndpoint *endpoint_;
+    websocketpp::connection_hdl connection_;
+    bool open_;
+    /// Created on the first compressed frame.
+    WebSocket::Inflater *inflater_;
+    std::string inflated_;
+};
+
+}
@@ -0,0 +1,103 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "StableHeaders.h"
+#include "LoadTestRunner.h"
+
+#include "LoggingFunctions.h"
+
+#include <Urho3D/Core/Timer.h>
+
+namespace Tundra
+{
+
+LoadTestRunner::LoadTestRunner(const String &host, unsigned short port, kNet::SocketTransportLayer transport,
+    uint numKNetClients, uint numWebSocketClients, float editRate) :
+    host_(host),
+    port_(port),
+    transport_(transport),
+    numKNetClients_(numKNetClients),
+    numWebSocketClients_(numWebSocketClients),
+    editRate_(editRate)
+{
+    endpoint_.clear_access_channels(websocketpp::log::alevel::all);
+    endpoint_.clear_error_channels(websocketpp::log::elevel::all);
+    endpoint_.init_asio();
+    // Keep the io_service running while there are no connections
+    endpoint_.start_perpetual();
+}
+
+LoadTestRunner::~LoadTestRunner()
+{
+    Stop();
+}
+
+void LoadTestRunner::ThreadFunction()
+{
+    while (shouldRun_)
+    {
+        ConnectClients();
+
+        try
+        {
+            endpoint_.poll();
+        }
+        catch(std::exception &e)
+        {
+            LogError("[LoadTest]: WebSocket client error: " + String(e.what()));
+        }
+
+        kNet::tick_t now = kNet::Clock::Tick();
+        for (uint i = 0; i < clients_.Size(); ++i)
+        {
+            clients_[i]->Process();
+            clients_[i]->Update(now);
+        }
+
+        PublishStats();
+        Urho3D::Time::Sleep(cPassIntervalMsec);
+    }
+
+    // Close the connections from the thread that owns them
+    for (uint i = 0; i < clients_.Size(); ++i)
+        delete clients_[i];
+    clients_.Clear();
+    endpoint_.stop_perpetual();
+    endpoint_.poll();
+}
+
+void LoadTestRunner::ConnectClients()
+{
+    const uint numClients = numKNetClients_ + numWebSocketClients_;
+    for (uint n = 0; n < cConnectsPerPass && clients_.Size() < numClients; ++n)
+    {
+        const uint index = clients_.Size();
+        LoadTestClient *client = 0;
+        if (index < numKNetClients_)
+            client = new KNetLoadTestClient(index, editRate_, &network_, transport_);
+        else
+            client = new WebSocketLoadTestClient(index, editRate_, &endpoint_);
+
+        if (!client->Connect(host_, port_))
+            LogError("[LoadTest]: Client " + String(index) + " failed to connect to " + host_ + ":" + String(port_));
+        clients_.Push(client);
+    }
+}
+
+void LoadTestRunner::PublishStats()
+{
+    Urho3D::MutexLock lock(mutexStats_);
+    // The gauges are recomputed on every pass, the counters accumulate until taken
+    stats_.connected = 0;
+    stats_.loggedIn = 0;
+    for (uint i = 0; i < clients_.Size(); ++i)
+        clients_[i]->TakeStats(stats_);
+}
+
+void LoadTestRunner::TakeStats(LoadTestStats &dest)
+{
+    Urho3D::MutexLock lock(mutexStats_);
+    dest = stats_;
+    stats_.Reset();
+}
+
+}
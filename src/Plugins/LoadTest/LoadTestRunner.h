@@ -0,0 +1,59 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#pragma once
+
+#include "LoadTestClient.h"
+
+#include <Urho3D/Core/Mutex.h>
+#include <Urho3D/Core/Thread.h>
+
+namespace Tundra
+{
+
+/// Runs the simulated clients of LoadTest in a thread of their own.
+/** The clients are connected gradually, at most cConnectsPerPass at a time, so that the server is not flooded by
+    simultaneous handshakes. Every pass processes all connections, updates the clients and publishes their traffic,
+    which the main thread picks up with TakeStats(). */
+class LoadTestRunner : public Urho3D::Thread
+{
+public:
+    /// @param transport Transport of the kNet clients, must match the server.
+    LoadTestRunner(const String &host, unsigned short port, kNet::SocketTransportLayer transport,
+        uint numKNetClients, uint numWebSocketClients, float editRate);
+    ~LoadTestRunner();
+
+    /// Urho3D::Thread override.
+    void ThreadFunction() override;
+
+    /// Adds the traffic since the last call to @c dest and resets it. Can be called from any thread.
+    void TakeStats(LoadTestStats &dest);
+
+    /// Number of clients connected per pass.
+    static const uint cConnectsPerPass = 10;
+    /// Sleep between passes in milliseconds.
+    static const uint cPassIntervalMsec = 5;
+
+private:
+    /// Creates and connects the next clients that have not been started yet.
+    void ConnectClients();
+    /// Moves the traffic of all clients to stats_.
+    void PublishStats();
+
+    String host_;
+    unsigned short port_;
+    kNet::SocketTransportLayer transport_;
+    uint numKNetClients_;
+    uint numWebSocketClients_;
+    float editRate_;
+
+    /// Owned and accessed only by the thread.
+    kNet::Network network_;
+    LoadTestEndpoint endpoint_;
+    Vector<LoadTestClient*> clients_;
+
+    /// Published traffic, protected by mutexStats_.
+    LoadTestStats stats_;
+    Urho3D::Mutex mutexStats_;
+};
+
+}
@@ -0,0 +1,11 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#pragma once
+
+// If PCH is disabled, leave the contents of this whole file empty to avoid any compilation unit getting any unnecessary headers.
+#ifdef PCH_ENABLED
+#include "CoreTypes.h"
+#include "CoreDefines.h"
+/// @todo More essential Urho #includes
+#include <Urho3D/Container/Str.h>
+#endif
\ No newline at end of file
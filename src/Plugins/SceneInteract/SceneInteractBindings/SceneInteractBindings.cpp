@@ -59,10 +59,6 @@ public:
     void OnSignal(Entity * param0, int param1, RayQueryResult * param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -70,9 +66,7 @@ public:
         duk_put_prop_index(ctx, -2, 1);
         PushValueObjectCopy<RayQueryResult>(ctx, *param2, RayQueryResult_ID, RayQueryResult_Finalizer);
         duk_put_prop_index(ctx, -2, 2);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + String(duk_safe_to_string(ctx, -1)));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -84,6 +78,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityMouseMove_Finalizer(duk_conte
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityMouseMove_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityMouseMove* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityMouseMove>(ctx, SignalWrapper_SceneInteract_EntityMouseMove_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -101,6 +96,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityMouseMove_Connect(duk_context
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityMouseMove_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityMouseMove* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityMouseMove>(ctx, SignalWrapper_SceneInteract_EntityMouseMove_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -109,6 +105,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityMouseMove_Disconnect(duk_cont
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityMouseMove_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityMouseMove* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityMouseMove>(ctx, SignalWrapper_SceneInteract_EntityMouseMove_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -121,14 +118,22 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityMouseMove_Emit(duk_context* c
 static duk_ret_t SceneInteract_Get_EntityMouseMove(duk_context* ctx)
 {
     SceneInteract* thisObj = GetThisWeakObject<SceneInteract>(ctx);
-    SignalWrapper_SceneInteract_EntityMouseMove* wrapper = new SignalWrapper_SceneInteract_EntityMouseMove(thisObj, &thisObj->EntityMouseMove);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityMouseMove")) return 1;
+    SignalWrapper_SceneInteract_EntityMouseMove* wrapper = new (ctx) SignalWrapper_SceneInteract_EntityMouseMove(thisObj, &thisObj->EntityMouseMove);
     PushValueObject(ctx, wrapper, SignalWrapper_SceneInteract_EntityMouseMove_ID, SignalWrapper_SceneInteract_EntityMouseMove_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityMouseMove_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityMouseMove_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Disconnect");
+    duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityMouseMove_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityMouseMove_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityMouseMove_Emit, 3);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityMouseMove");
     return 1;
 }
 
@@ -153,10 +158,6 @@ public:
     void OnSignal(Entity * param0, int param1, RayQueryResult * param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -164,9 +165,7 @@ public:
         duk_put_prop_index(ctx, -2, 1);
         PushValueObjectCopy<RayQueryResult>(ctx, *param2, RayQueryResult_ID, RayQueryResult_Finalizer);
         duk_put_prop_index(ctx, -2, 2);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + String(duk_safe_to_string(ctx, -1)));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -178,6 +177,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityMouseScroll_Finalizer(duk_con
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityMouseScroll_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityMouseScroll* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityMouseScroll>(ctx, SignalWrapper_SceneInteract_EntityMouseScroll_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -195,6 +195,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityMouseScroll_Connect(duk_conte
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityMouseScroll_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityMouseScroll* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityMouseScroll>(ctx, SignalWrapper_SceneInteract_EntityMouseScroll_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -203,6 +204,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityMouseScroll_Disconnect(duk_co
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityMouseScroll_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityMouseScroll* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityMouseScroll>(ctx, SignalWrapper_SceneInteract_EntityMouseScroll_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -215,14 +217,22 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityMouseScroll_Emit(duk_context*
 static duk_ret_t SceneInteract_Get_EntityMouseScroll(duk_context* ctx)
 {
     SceneInteract* thisObj = GetThisWeakObject<SceneInteract>(ctx);
-    SignalWrapper_SceneInteract_EntityMouseScroll* wrapper = new SignalWrapper_SceneInteract_EntityMouseScroll(thisObj, &thisObj->EntityMouseScroll);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityMouseScroll")) return 1;
+    SignalWrapper_SceneInteract_EntityMouseScroll* wrapper = new (ctx) SignalWrapper_SceneInteract_EntityMouseScroll(thisObj, &thisObj->EntityMouseScroll);
     PushValueObject(ctx, wrapper, SignalWrapper_SceneInteract_EntityMouseScroll_ID, SignalWrapper_SceneInteract_EntityMouseScroll_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityMouseScroll_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityMouseScroll_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Disconnect");
+    duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityMouseScroll_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityMouseScroll_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityMouseScroll_Emit, 3);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityMouseScroll");
     return 1;
 }
 
@@ -247,10 +257,6 @@ public:
     void OnSignal(Entity * param0, int param1, RayQueryResult * param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -258,9 +264,7 @@ public:
         duk_put_prop_index(ctx, -2, 1);
         PushValueObjectCopy<RayQueryResult>(ctx, *param2, RayQueryResult_ID, RayQueryResult_Finalizer);
         duk_put_prop_index(ctx, -2, 2);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + String(duk_safe_to_string(ctx, -1)));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -272,6 +276,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityClicked_Finalizer(duk_context
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityClicked_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityClicked* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityClicked>(ctx, SignalWrapper_SceneInteract_EntityClicked_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -289,6 +294,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityClicked_Connect(duk_context*
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityClicked_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityClicked* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityClicked>(ctx, SignalWrapper_SceneInteract_EntityClicked_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -297,6 +303,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityClicked_Disconnect(duk_contex
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityClicked_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityClicked* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityClicked>(ctx, SignalWrapper_SceneInteract_EntityClicked_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -309,14 +316,22 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityClicked_Emit(duk_context* ctx
 static duk_ret_t SceneInteract_Get_EntityClicked(duk_context* ctx)
 {
     SceneInteract* thisObj = GetThisWeakObject<SceneInteract>(ctx);
-    SignalWrapper_SceneInteract_EntityClicked* wrapper = new SignalWrapper_SceneInteract_EntityClicked(thisObj, &thisObj->EntityClicked);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityClicked")) return 1;
+    SignalWrapper_SceneInteract_EntityClicked* wrapper = new (ctx) SignalWrapper_SceneInteract_EntityClicked(thisObj, &thisObj->EntityClicked);
     PushValueObject(ctx, wrapper, SignalWrapper_SceneInteract_EntityClicked_ID, SignalWrapper_SceneInteract_EntityClicked_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityClicked_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityClicked_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Disconnect");
+    duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityClicked_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityClicked_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityClicked_Emit, 3);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityClicked");
     return 1;
 }
 
@@ -341,10 +356,6 @@ public:
     void OnSignal(Entity * param0, int param1, RayQueryResult * param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -352,9 +363,7 @@ public:
         duk_put_prop_index(ctx, -2, 1);
         PushValueObjectCopy<RayQueryResult>(ctx, *param2, RayQueryResult_ID, RayQueryResult_Finalizer);
         duk_put_prop_index(ctx, -2, 2);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + String(duk_safe_to_string(ctx, -1)));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -366,6 +375,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityClickReleased_Finalizer(duk_c
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityClickReleased_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityClickReleased* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityClickReleased>(ctx, SignalWrapper_SceneInteract_EntityClickReleased_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -383,6 +393,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityClickReleased_Connect(duk_con
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityClickReleased_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityClickReleased* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityClickReleased>(ctx, SignalWrapper_SceneInteract_EntityClickReleased_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -391,6 +402,7 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityClickReleased_Disconnect(duk_
 
 static duk_ret_t SignalWrapper_SceneInteract_EntityClickReleased_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SceneInteract_EntityClickReleased* wrapper = GetThisValueObject<SignalWrapper_SceneInteract_EntityClickReleased>(ctx, SignalWrapper_SceneInteract_EntityClickReleased_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -403,14 +415,22 @@ static duk_ret_t SignalWrapper_SceneInteract_EntityClickReleased_Emit(duk_contex
 static duk_ret_t SceneInteract_Get_EntityClickReleased(duk_context* ctx)
 {
     SceneInteract* thisObj = GetThisWeakObject<SceneInteract>(ctx);
-    SignalWrapper_SceneInteract_EntityClickReleased* wrapper = new SignalWrapper_SceneInteract_EntityClickReleased(thisObj, &thisObj->EntityClickReleased);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityClickReleased")) return 1;
+    SignalWrapper_SceneInteract_EntityClickReleased* wrapper = new (ctx) SignalWrapper_SceneInteract_EntityClickReleased(thisObj, &thisObj->EntityClickReleased);
     PushValueObject(ctx, wrapper, SignalWrapper_SceneInteract_EntityClickReleased_ID, SignalWrapper_SceneInteract_EntityClickReleased_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityClickReleased_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityClickReleased_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Disconnect");
+    duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityClickReleased_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityClickReleased_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_SceneInteract_EntityClickReleased_Emit, 3);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityClickReleased");
     return 1;
 }
 
@@ -21,6 +21,7 @@
 #include "LoggingFunctions.h"
 #include "Placeable.h"
 #include "RigidBody.h"
+#include "PhysicsWorld.h"
 
 #include <kNet.h>
 
@@ -342,6 +343,9 @@ void SyncManager::RegisterToScene(ScenePtr scene)
         previous->EntityTemporaryStateToggled.Disconnect(this, &SyncManager::OnEntityPropertiesChanged);
         previous->EntityParentChanged.Disconnect(this, &SyncManager::OnEntityParentChanged);
     }
+    if (physicsWorld_)
+        physicsWorld_->BodiesMoved.Disconnect(this, &SyncManager::OnBodiesMoved);
+    physicsWorld_.Reset();
     
     serverConnection_->syncState->Clear();
     serverConnection_->syncState->SetParentScene(SceneWeakPtr(scene));
@@ -366,6 +370,10 @@ void SyncManager::RegisterToScene(ScenePtr scene)
     sceneptr->ActionTriggered.Connect(this, &SyncManager::OnActionTriggered);
     sceneptr->EntityTemporaryStateToggled.Connect(this, &SyncManager::OnEntityPropertiesChanged);
     sceneptr->EntityParentChanged.Connect(this, &SyncManager::OnEntityParentChanged);
+
+    physicsWorld_ = sceneptr->Subsystem<PhysicsWorld>();
+    if (physicsWorld_)
+        physicsWorld_->BodiesMoved.Connect(this, &SyncManager::OnBodiesMoved);
 }
 
 void SyncManager::HandleNetworkMessage(UserConnection* user, kNet::packet_id_t packetId, kNet::message_id_t messageId, const char* data, size_t numBytes)
@@ -518,6 +526,48 @@ void SyncManager::OnAttributeChanged(IComponent* comp, IAttribute* attr, Attribu
     }
 }
 
+void SyncManager::OnBodiesMoved(const PODVector<RigidBody*> &bodies)
+{
+    // Clients simulate replicated bodies only locally, and never send their motion to the server
+    if (!owner_->IsServer())
+        return;
+
+    UserConnectionList& users = owner_->Server()->UserConnections();
+    if (users.Empty())
+        return;
+
+    URHO3D_PROFILE(SyncManager_OnBodiesMoved);
+
+    for(uint i = 0; i < bodies.Size(); ++i)
+    {
+        RigidBody* rigidBody = bodies[i];
+        Entity* entity = rigidBody->ParentEntity();
+        if (!entity || entity->IsLocal())
+            continue;
+        const entity_id_t entityId = entity->Id();
+
+        // Apply the update modes of the components, as attribute changes with the Default change type would
+        Placeable* placeable = entity->Component<Placeable>().Get();
+        const bool replicateTransform = placeable && !placeable->IsLocal() && placeable->UpdateMode() == AttributeChange::Replicate;
+        const bool replicateVelocity = !rigidBody->IsLocal() && rigidBody->UpdateMode() == AttributeChange::Replicate;
+        const bool linearVelocityMoved = replicateVelocity && rigidBody->LinearVelocityMoved();
+        const bool angularVelocityMoved = replicateVelocity && rigidBody->AngularVelocityMoved();
+
+        for(auto u = users.Begin(); u != users.End(); ++u)
+        {
+            SceneSyncState* state = (*u)->syncState.Get();
+            if (!state)
+                continue;
+            if (replicateTransform)
+                state->MarkAttributeDirty(entityId, placeable->Id(), placeable->transform.Index());
+            if (linearVelocityMoved)
+                state->MarkAttributeDirty(entityId, rigidBody->Id(), rigidBody->linearVelocity.Index());
+            if (angularVelocityMoved)
+                state->MarkAttributeDirty(entityId, rigidBody->Id(), rigidBody->angularVelocity.Index());
+        }
+    }
+}
+
 void SyncManager::OnAttributeAdded(IComponent* comp, IAttribute* attr, AttributeChange::Type /*change*/)
 {
     assert(comp && attr);
@@ -1005,6 +1055,8 @@ void SyncManager::Update(float frametime)
     
     if (owner_->IsServer())
     {
+        kNet::tick_t tickStart = kNet::Clock::Tick();
+
         // If we are server, process all authenticated users
         // SyncState is not added to the user before it's authenticated, so using UserConnections() instead of
         // AuthenticatedUsers() and checking for SyncState's existence does the same thing in a little more efficient fashion.
@@ -1012,7 +1064,8 @@ void SyncManager::Update(float frametime)
         for(auto i = users.Begin(); i != users.End(); ++i)
         {
             SceneSyncState *syncState = (*i)->syncState.Get();
-            if (syncState)
+            // Let a slow client drain its send queue, the dirty state is sent on a later tick
+            if (syncState && !(*i)->IsSendQueueFull())
             {
                 // First sort the dirty queue according to priority if IM enabled
                 if (prioritizer_) /**< @todo Move all code in this block behind EntityPrioritizer? */
@@ -1039,6 +1092,8 @@ void SyncManager::Update(float frametime)
                 ProcessSyncState((*i).Get());
             }
         }
+
+        TickProcessed.Emit(kNet::Clock::SecondsSinceF(tickStart));
     }
     else
     {
@@ -12,6 +12,7 @@
 
 #include "SyncState.h"
 #include "SceneFwd.h"
+#include "BulletPhysicsFwd.h"
 #include "AttributeChangeType.h"
 #include "EntityAction.h"
 #include "EntityPrioritizer.h"
@@ -85,6 +86,9 @@ public:
     /// This signal is emitted when a new user connects and a new SceneSyncState is created for the connection.
     /// @note See signals of the SceneSyncState object to build prioritization logic how the sync state is filled.
     Signal2<UserConnection* ARG(user), SceneSyncState* ARG(state)> SceneStateCreated;
+
+    /// This signal is emitted on the server after each network update tick, with the time it took to process all users in seconds. [noscript]
+    Signal1<float ARG(seconds)> TickProcessed;
     
 private:
     /// Network message received from an user connection
@@ -162,6 +166,10 @@ private:
     
     void ReplicateRigidBodyChanges(UserConnection* user);
 
+    /// Mark the transforms and changed velocities of the bodies moved by the physics simulation dirty for all users.
+    /** The physics world signals these attributes only locally, so that the sync states are accessed once per frame. */
+    void OnBodiesMoved(const PODVector<RigidBody*> &bodies);
+
     void InterpolateRigidBodies(float frametime, SceneSyncState* state);
 
     void ReplicateComponentType(u32 typeId, UserConnection* connection = 0);
@@ -200,6 +208,9 @@ private:
     
     /// Scene pointer
     SceneWeakPtr scene_;
+
+    /// Physics world of the scene, signals the moved bodies
+    PhysicsWorldWeakPtr physicsWorld_;
     
     /// Time period for update, default 1/30th of a second
     float updatePeriod_;
@@ -44,14 +44,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -63,6 +57,7 @@ static duk_ret_t SignalWrapper_Client_AboutToConnect_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Client_AboutToConnect_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Client_AboutToConnect* wrapper = GetThisValueObject<SignalWrapper_Client_AboutToConnect>(ctx, SignalWrapper_Client_AboutToConnect_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -80,6 +75,7 @@ static duk_ret_t SignalWrapper_Client_AboutToConnect_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Client_AboutToConnect_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Client_AboutToConnect* wrapper = GetThisValueObject<SignalWrapper_Client_AboutToConnect>(ctx, SignalWrapper_Client_AboutToConnect_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -88,6 +84,7 @@ static duk_ret_t SignalWrapper_Client_AboutToConnect_Disconnect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_Client_AboutToConnect_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Client_AboutToConnect* wrapper = GetThisValueObject<SignalWrapper_Client_AboutToConnect>(ctx, SignalWrapper_Client_AboutToConnect_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -97,7 +94,8 @@ static duk_ret_t SignalWrapper_Client_AboutToConnect_Emit(duk_context* ctx)
 static duk_ret_t Client_Get_AboutToConnect(duk_context* ctx)
 {
     Client* thisObj = GetThisWeakObject<Client>(ctx);
-    SignalWrapper_Client_AboutToConnect* wrapper = new SignalWrapper_Client_AboutToConnect(thisObj, &thisObj->AboutToConnect);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAboutToConnect")) return 1;
+    SignalWrapper_Client_AboutToConnect* wrapper = new (ctx) SignalWrapper_Client_AboutToConnect(thisObj, &thisObj->AboutToConnect);
     PushValueObject(ctx, wrapper, SignalWrapper_Client_AboutToConnect_ID, SignalWrapper_Client_AboutToConnect_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Client_AboutToConnect_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -107,8 +105,15 @@ static duk_ret_t Client_Get_AboutToConnect(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Client_AboutToConnect_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Client_AboutToConnect_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Client_AboutToConnect_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Client_AboutToConnect_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAboutToConnect");
     return 1;
 }
 
@@ -133,14 +138,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -152,6 +151,7 @@ static duk_ret_t SignalWrapper_Client_Disconnected_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Client_Disconnected_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Client_Disconnected* wrapper = GetThisValueObject<SignalWrapper_Client_Disconnected>(ctx, SignalWrapper_Client_Disconnected_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -169,6 +169,7 @@ static duk_ret_t SignalWrapper_Client_Disconnected_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Client_Disconnected_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Client_Disconnected* wrapper = GetThisValueObject<SignalWrapper_Client_Disconnected>(ctx, SignalWrapper_Client_Disconnected_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -177,6 +178,7 @@ static duk_ret_t SignalWrapper_Client_Disconnected_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Client_Disconnected_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Client_Disconnected* wrapper = GetThisValueObject<SignalWrapper_Client_Disconnected>(ctx, SignalWrapper_Client_Disconnected_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -186,7 +188,8 @@ static duk_ret_t SignalWrapper_Client_Disconnected_Emit(duk_context* ctx)
 static duk_ret_t Client_Get_Disconnected(duk_context* ctx)
 {
     Client* thisObj = GetThisWeakObject<Client>(ctx);
-    SignalWrapper_Client_Disconnected* wrapper = new SignalWrapper_Client_Disconnected(thisObj, &thisObj->Disconnected);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalDisconnected")) return 1;
+    SignalWrapper_Client_Disconnected* wrapper = new (ctx) SignalWrapper_Client_Disconnected(thisObj, &thisObj->Disconnected);
     PushValueObject(ctx, wrapper, SignalWrapper_Client_Disconnected_ID, SignalWrapper_Client_Disconnected_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Client_Disconnected_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -196,8 +199,15 @@ static duk_ret_t Client_Get_Disconnected(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Client_Disconnected_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Client_Disconnected_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Client_Disconnected_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Client_Disconnected_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalDisconnected");
     return 1;
 }
 
@@ -222,16 +232,10 @@ public:
     void OnSignal(const String & param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -243,6 +247,7 @@ static duk_ret_t SignalWrapper_Client_LoginFailed_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Client_LoginFailed_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Client_LoginFailed* wrapper = GetThisValueObject<SignalWrapper_Client_LoginFailed>(ctx, SignalWrapper_Client_LoginFailed_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -260,6 +265,7 @@ static duk_ret_t SignalWrapper_Client_LoginFailed_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Client_LoginFailed_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Client_LoginFailed* wrapper = GetThisValueObject<SignalWrapper_Client_LoginFailed>(ctx, SignalWrapper_Client_LoginFailed_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -268,6 +274,7 @@ static duk_ret_t SignalWrapper_Client_LoginFailed_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Client_LoginFailed_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Client_LoginFailed* wrapper = GetThisValueObject<SignalWrapper_Client_LoginFailed>(ctx, SignalWrapper_Client_LoginFailed_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -278,7 +285,8 @@ static duk_ret_t SignalWrapper_Client_LoginFailed_Emit(duk_context* ctx)
 static duk_ret_t Client_Get_LoginFailed(duk_context* ctx)
 {
     Client* thisObj = GetThisWeakObject<Client>(ctx);
-    SignalWrapper_Client_LoginFailed* wrapper = new SignalWrapper_Client_LoginFailed(thisObj, &thisObj->LoginFailed);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalLoginFailed")) return 1;
+    SignalWrapper_Client_LoginFailed* wrapper = new (ctx) SignalWrapper_Client_LoginFailed(thisObj, &thisObj->LoginFailed);
     PushValueObject(ctx, wrapper, SignalWrapper_Client_LoginFailed_ID, SignalWrapper_Client_LoginFailed_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Client_LoginFailed_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -288,8 +296,15 @@ static duk_ret_t Client_Get_LoginFailed(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Client_LoginFailed_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Client_LoginFailed_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Client_LoginFailed_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Client_LoginFailed_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalLoginFailed");
     return 1;
 }
 
@@ -45,18 +45,12 @@ public:
     void OnSignal(u32 param0, UserConnection * param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_number(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         PushWeakObject(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -68,6 +62,7 @@ static duk_ret_t SignalWrapper_Server_UserAboutToConnect_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_Server_UserAboutToConnect_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_UserAboutToConnect* wrapper = GetThisValueObject<SignalWrapper_Server_UserAboutToConnect>(ctx, SignalWrapper_Server_UserAboutToConnect_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -85,6 +80,7 @@ static duk_ret_t SignalWrapper_Server_UserAboutToConnect_Connect(duk_context* ct
 
 static duk_ret_t SignalWrapper_Server_UserAboutToConnect_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_UserAboutToConnect* wrapper = GetThisValueObject<SignalWrapper_Server_UserAboutToConnect>(ctx, SignalWrapper_Server_UserAboutToConnect_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -93,6 +89,7 @@ static duk_ret_t SignalWrapper_Server_UserAboutToConnect_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_Server_UserAboutToConnect_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_UserAboutToConnect* wrapper = GetThisValueObject<SignalWrapper_Server_UserAboutToConnect>(ctx, SignalWrapper_Server_UserAboutToConnect_ID);
     if (!wrapper->owner_) return 0;
     u32 param0 = (u32)duk_require_number(ctx, 0);
@@ -104,7 +101,8 @@ static duk_ret_t SignalWrapper_Server_UserAboutToConnect_Emit(duk_context* ctx)
 static duk_ret_t Server_Get_UserAboutToConnect(duk_context* ctx)
 {
     Server* thisObj = GetThisWeakObject<Server>(ctx);
-    SignalWrapper_Server_UserAboutToConnect* wrapper = new SignalWrapper_Server_UserAboutToConnect(thisObj, &thisObj->UserAboutToConnect);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalUserAboutToConnect")) return 1;
+    SignalWrapper_Server_UserAboutToConnect* wrapper = new (ctx) SignalWrapper_Server_UserAboutToConnect(thisObj, &thisObj->UserAboutToConnect);
     PushValueObject(ctx, wrapper, SignalWrapper_Server_UserAboutToConnect_ID, SignalWrapper_Server_UserAboutToConnect_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Server_UserAboutToConnect_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -114,8 +112,15 @@ static duk_ret_t Server_Get_UserAboutToConnect(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Server_UserAboutToConnect_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Server_UserAboutToConnect_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Server_UserAboutToConnect_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Server_UserAboutToConnect_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalUserAboutToConnect");
     return 1;
 }
 
@@ -140,18 +145,12 @@ public:
     void OnSignal(u32 param0, UserConnection * param1, UserConnectedResponseData * param2)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_number(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         PushWeakObject(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -163,6 +162,7 @@ static duk_ret_t SignalWrapper_Server_UserConnected_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Server_UserConnected_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_UserConnected* wrapper = GetThisValueObject<SignalWrapper_Server_UserConnected>(ctx, SignalWrapper_Server_UserConnected_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -180,6 +180,7 @@ static duk_ret_t SignalWrapper_Server_UserConnected_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Server_UserConnected_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_UserConnected* wrapper = GetThisValueObject<SignalWrapper_Server_UserConnected>(ctx, SignalWrapper_Server_UserConnected_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -189,7 +190,8 @@ static duk_ret_t SignalWrapper_Server_UserConnected_Disconnect(duk_context* ctx)
 static duk_ret_t Server_Get_UserConnected(duk_context* ctx)
 {
     Server* thisObj = GetThisWeakObject<Server>(ctx);
-    SignalWrapper_Server_UserConnected* wrapper = new SignalWrapper_Server_UserConnected(thisObj, &thisObj->UserConnected);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalUserConnected")) return 1;
+    SignalWrapper_Server_UserConnected* wrapper = new (ctx) SignalWrapper_Server_UserConnected(thisObj, &thisObj->UserConnected);
     PushValueObject(ctx, wrapper, SignalWrapper_Server_UserConnected_ID, SignalWrapper_Server_UserConnected_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Server_UserConnected_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -199,6 +201,13 @@ static duk_ret_t Server_Get_UserConnected(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Server_UserConnected_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Server_UserConnected_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Server_UserConnected_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
+    CacheSignalWrapper(ctx, "\xff""signalUserConnected");
     return 1;
 }
 
@@ -223,16 +232,10 @@ public:
     void OnSignal(UserConnection * param0, kNet::packet_id_t param1, kNet::message_id_t param2, const char * param3, size_t param4)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -244,6 +247,7 @@ static duk_ret_t SignalWrapper_Server_MessageReceived_Finalizer(duk_context* ctx
 
 static duk_ret_t SignalWrapper_Server_MessageReceived_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_MessageReceived* wrapper = GetThisValueObject<SignalWrapper_Server_MessageReceived>(ctx, SignalWrapper_Server_MessageReceived_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -261,6 +265,7 @@ static duk_ret_t SignalWrapper_Server_MessageReceived_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Server_MessageReceived_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_MessageReceived* wrapper = GetThisValueObject<SignalWrapper_Server_MessageReceived>(ctx, SignalWrapper_Server_MessageReceived_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -270,7 +275,8 @@ static duk_ret_t SignalWrapper_Server_MessageReceived_Disconnect(duk_context* ct
 static duk_ret_t Server_Get_MessageReceived(duk_context* ctx)
 {
     Server* thisObj = GetThisWeakObject<Server>(ctx);
-    SignalWrapper_Server_MessageReceived* wrapper = new SignalWrapper_Server_MessageReceived(thisObj, &thisObj->MessageReceived);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMessageReceived")) return 1;
+    SignalWrapper_Server_MessageReceived* wrapper = new (ctx) SignalWrapper_Server_MessageReceived(thisObj, &thisObj->MessageReceived);
     PushValueObject(ctx, wrapper, SignalWrapper_Server_MessageReceived_ID, SignalWrapper_Server_MessageReceived_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Server_MessageReceived_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -280,6 +286,13 @@ static duk_ret_t Server_Get_MessageReceived(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Server_MessageReceived_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Server_MessageReceived_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Server_MessageReceived_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
+    CacheSignalWrapper(ctx, "\xff""signalMessageReceived");
     return 1;
 }
 
@@ -304,18 +317,12 @@ public:
     void OnSignal(u32 param0, UserConnection * param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_number(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         PushWeakObject(ctx, param1);
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -327,6 +334,7 @@ static duk_ret_t SignalWrapper_Server_UserDisconnected_Finalizer(duk_context* ct
 
 static duk_ret_t SignalWrapper_Server_UserDisconnected_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_UserDisconnected* wrapper = GetThisValueObject<SignalWrapper_Server_UserDisconnected>(ctx, SignalWrapper_Server_UserDisconnected_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -344,6 +352,7 @@ static duk_ret_t SignalWrapper_Server_UserDisconnected_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Server_UserDisconnected_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_UserDisconnected* wrapper = GetThisValueObject<SignalWrapper_Server_UserDisconnected>(ctx, SignalWrapper_Server_UserDisconnected_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -352,6 +361,7 @@ static duk_ret_t SignalWrapper_Server_UserDisconnected_Disconnect(duk_context* c
 
 static duk_ret_t SignalWrapper_Server_UserDisconnected_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_UserDisconnected* wrapper = GetThisValueObject<SignalWrapper_Server_UserDisconnected>(ctx, SignalWrapper_Server_UserDisconnected_ID);
     if (!wrapper->owner_) return 0;
     u32 param0 = (u32)duk_require_number(ctx, 0);
@@ -363,7 +373,8 @@ static duk_ret_t SignalWrapper_Server_UserDisconnected_Emit(duk_context* ctx)
 static duk_ret_t Server_Get_UserDisconnected(duk_context* ctx)
 {
     Server* thisObj = GetThisWeakObject<Server>(ctx);
-    SignalWrapper_Server_UserDisconnected* wrapper = new SignalWrapper_Server_UserDisconnected(thisObj, &thisObj->UserDisconnected);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalUserDisconnected")) return 1;
+    SignalWrapper_Server_UserDisconnected* wrapper = new (ctx) SignalWrapper_Server_UserDisconnected(thisObj, &thisObj->UserDisconnected);
     PushValueObject(ctx, wrapper, SignalWrapper_Server_UserDisconnected_ID, SignalWrapper_Server_UserDisconnected_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Server_UserDisconnected_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -373,8 +384,15 @@ static duk_ret_t Server_Get_UserDisconnected(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Server_UserDisconnected_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Server_UserDisconnected_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Server_UserDisconnected_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Server_UserDisconnected_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalUserDisconnected");
     return 1;
 }
 
@@ -399,14 +417,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -418,6 +430,7 @@ static duk_ret_t SignalWrapper_Server_ServerStarted_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Server_ServerStarted_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_ServerStarted* wrapper = GetThisValueObject<SignalWrapper_Server_ServerStarted>(ctx, SignalWrapper_Server_ServerStarted_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -435,6 +448,7 @@ static duk_ret_t SignalWrapper_Server_ServerStarted_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Server_ServerStarted_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_ServerStarted* wrapper = GetThisValueObject<SignalWrapper_Server_ServerStarted>(ctx, SignalWrapper_Server_ServerStarted_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -443,6 +457,7 @@ static duk_ret_t SignalWrapper_Server_ServerStarted_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Server_ServerStarted_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_ServerStarted* wrapper = GetThisValueObject<SignalWrapper_Server_ServerStarted>(ctx, SignalWrapper_Server_ServerStarted_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -452,7 +467,8 @@ static duk_ret_t SignalWrapper_Server_ServerStarted_Emit(duk_context* ctx)
 static duk_ret_t Server_Get_ServerStarted(duk_context* ctx)
 {
     Server* thisObj = GetThisWeakObject<Server>(ctx);
-    SignalWrapper_Server_ServerStarted* wrapper = new SignalWrapper_Server_ServerStarted(thisObj, &thisObj->ServerStarted);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalServerStarted")) return 1;
+    SignalWrapper_Server_ServerStarted* wrapper = new (ctx) SignalWrapper_Server_ServerStarted(thisObj, &thisObj->ServerStarted);
     PushValueObject(ctx, wrapper, SignalWrapper_Server_ServerStarted_ID, SignalWrapper_Server_ServerStarted_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Server_ServerStarted_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -462,8 +478,15 @@ static duk_ret_t Server_Get_ServerStarted(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Server_ServerStarted_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Server_ServerStarted_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Server_ServerStarted_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Server_ServerStarted_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalServerStarted");
     return 1;
 }
 
@@ -488,14 +511,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -507,6 +524,7 @@ static duk_ret_t SignalWrapper_Server_ServerStopped_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Server_ServerStopped_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_ServerStopped* wrapper = GetThisValueObject<SignalWrapper_Server_ServerStopped>(ctx, SignalWrapper_Server_ServerStopped_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -524,6 +542,7 @@ static duk_ret_t SignalWrapper_Server_ServerStopped_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Server_ServerStopped_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_ServerStopped* wrapper = GetThisValueObject<SignalWrapper_Server_ServerStopped>(ctx, SignalWrapper_Server_ServerStopped_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -532,6 +551,7 @@ static duk_ret_t SignalWrapper_Server_ServerStopped_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Server_ServerStopped_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Server_ServerStopped* wrapper = GetThisValueObject<SignalWrapper_Server_ServerStopped>(ctx, SignalWrapper_Server_ServerStopped_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -541,7 +561,8 @@ static duk_ret_t SignalWrapper_Server_ServerStopped_Emit(duk_context* ctx)
 static duk_ret_t Server_Get_ServerStopped(duk_context* ctx)
 {
     Server* thisObj = GetThisWeakObject<Server>(ctx);
-    SignalWrapper_Server_ServerStopped* wrapper = new SignalWrapper_Server_ServerStopped(thisObj, &thisObj->ServerStopped);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalServerStopped")) return 1;
+    SignalWrapper_Server_ServerStopped* wrapper = new (ctx) SignalWrapper_Server_ServerStopped(thisObj, &thisObj->ServerStopped);
     PushValueObject(ctx, wrapper, SignalWrapper_Server_ServerStopped_ID, SignalWrapper_Server_ServerStopped_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Server_ServerStopped_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -551,8 +572,15 @@ static duk_ret_t Server_Get_ServerStopped(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Server_ServerStopped_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Server_ServerStopped_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Server_ServerStopped_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Server_ServerStopped_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalServerStopped");
     return 1;
 }
 
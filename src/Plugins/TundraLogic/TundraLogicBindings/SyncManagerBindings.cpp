@@ -46,16 +46,10 @@ public:
     void OnSignal(UserConnection * param0, SceneSyncState * param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -67,6 +61,7 @@ static duk_ret_t SignalWrapper_SyncManager_SceneStateCreated_Finalizer(duk_conte
 
 static duk_ret_t SignalWrapper_SyncManager_SceneStateCreated_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SyncManager_SceneStateCreated* wrapper = GetThisValueObject<SignalWrapper_SyncManager_SceneStateCreated>(ctx, SignalWrapper_SyncManager_SceneStateCreated_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -84,6 +79,7 @@ static duk_ret_t SignalWrapper_SyncManager_SceneStateCreated_Connect(duk_context
 
 static duk_ret_t SignalWrapper_SyncManager_SceneStateCreated_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_SyncManager_SceneStateCreated* wrapper = GetThisValueObject<SignalWrapper_SyncManager_SceneStateCreated>(ctx, SignalWrapper_SyncManager_SceneStateCreated_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -93,7 +89,8 @@ static duk_ret_t SignalWrapper_SyncManager_SceneStateCreated_Disconnect(duk_cont
 static duk_ret_t SyncManager_Get_SceneStateCreated(duk_context* ctx)
 {
     SyncManager* thisObj = GetThisWeakObject<SyncManager>(ctx);
-    SignalWrapper_SyncManager_SceneStateCreated* wrapper = new SignalWrapper_SyncManager_SceneStateCreated(thisObj, &thisObj->SceneStateCreated);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalSceneStateCreated")) return 1;
+    SignalWrapper_SyncManager_SceneStateCreated* wrapper = new (ctx) SignalWrapper_SyncManager_SceneStateCreated(thisObj, &thisObj->SceneStateCreated);
     PushValueObject(ctx, wrapper, SignalWrapper_SyncManager_SceneStateCreated_ID, SignalWrapper_SyncManager_SceneStateCreated_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_SyncManager_SceneStateCreated_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -103,6 +100,13 @@ static duk_ret_t SyncManager_Get_SceneStateCreated(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_SyncManager_SceneStateCreated_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_SyncManager_SceneStateCreated_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_SyncManager_SceneStateCreated_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
+    CacheSignalWrapper(ctx, "\xff""signalSceneStateCreated");
     return 1;
 }
 
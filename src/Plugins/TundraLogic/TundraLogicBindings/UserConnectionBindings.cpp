@@ -75,10 +75,6 @@ public:
     void OnSignal(UserConnection * param0, Entity * param1, const String & param2, const StringVector & param3)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
@@ -88,9 +84,7 @@ public:
         duk_put_prop_index(ctx, -2, 2);
         PushStringVector(ctx, param3);
         duk_put_prop_index(ctx, -2, 3);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -102,6 +96,7 @@ static duk_ret_t SignalWrapper_UserConnection_ActionTriggered_Finalizer(duk_cont
 
 static duk_ret_t SignalWrapper_UserConnection_ActionTriggered_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_UserConnection_ActionTriggered* wrapper = GetThisValueObject<SignalWrapper_UserConnection_ActionTriggered>(ctx, SignalWrapper_UserConnection_ActionTriggered_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -119,6 +114,7 @@ static duk_ret_t SignalWrapper_UserConnection_ActionTriggered_Connect(duk_contex
 
 static duk_ret_t SignalWrapper_UserConnection_ActionTriggered_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_UserConnection_ActionTriggered* wrapper = GetThisValueObject<SignalWrapper_UserConnection_ActionTriggered>(ctx, SignalWrapper_UserConnection_ActionTriggered_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -127,6 +123,7 @@ static duk_ret_t SignalWrapper_UserConnection_ActionTriggered_Disconnect(duk_con
 
 static duk_ret_t SignalWrapper_UserConnection_ActionTriggered_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_UserConnection_ActionTriggered* wrapper = GetThisValueObject<SignalWrapper_UserConnection_ActionTriggered>(ctx, SignalWrapper_UserConnection_ActionTriggered_ID);
     if (!wrapper->owner_) return 0;
     UserConnection* param0 = GetWeakObject<UserConnection>(ctx, 0);
@@ -140,7 +137,8 @@ static duk_ret_t SignalWrapper_UserConnection_ActionTriggered_Emit(duk_context*
 static duk_ret_t UserConnection_Get_ActionTriggered(duk_context* ctx)
 {
     UserConnection* thisObj = GetThisWeakObject<UserConnection>(ctx);
-    SignalWrapper_UserConnection_ActionTriggered* wrapper = new SignalWrapper_UserConnection_ActionTriggered(thisObj, &thisObj->ActionTriggered);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalActionTriggered")) return 1;
+    SignalWrapper_UserConnection_ActionTriggered* wrapper = new (ctx) SignalWrapper_UserConnection_ActionTriggered(thisObj, &thisObj->ActionTriggered);
     PushValueObject(ctx, wrapper, SignalWrapper_UserConnection_ActionTriggered_ID, SignalWrapper_UserConnection_ActionTriggered_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_UserConnection_ActionTriggered_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -150,8 +148,15 @@ static duk_ret_t UserConnection_Get_ActionTriggered(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_UserConnection_ActionTriggered_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_UserConnection_ActionTriggered_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_UserConnection_ActionTriggered_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_UserConnection_ActionTriggered_Emit, 4);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalActionTriggered");
     return 1;
 }
 
@@ -176,16 +181,10 @@ public:
     void OnSignal(UserConnection * param0, kNet::packet_id_t param1, kNet::message_id_t param2, const char * param3, size_t param4)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -197,6 +196,7 @@ static duk_ret_t SignalWrapper_UserConnection_NetworkMessageReceived_Finalizer(d
 
 static duk_ret_t SignalWrapper_UserConnection_NetworkMessageReceived_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_UserConnection_NetworkMessageReceived* wrapper = GetThisValueObject<SignalWrapper_UserConnection_NetworkMessageReceived>(ctx, SignalWrapper_UserConnection_NetworkMessageReceived_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -214,6 +214,7 @@ static duk_ret_t SignalWrapper_UserConnection_NetworkMessageReceived_Connect(duk
 
 static duk_ret_t SignalWrapper_UserConnection_NetworkMessageReceived_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_UserConnection_NetworkMessageReceived* wrapper = GetThisValueObject<SignalWrapper_UserConnection_NetworkMessageReceived>(ctx, SignalWrapper_UserConnection_NetworkMessageReceived_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -223,7 +224,8 @@ static duk_ret_t SignalWrapper_UserConnection_NetworkMessageReceived_Disconnect(
 static duk_ret_t UserConnection_Get_NetworkMessageReceived(duk_context* ctx)
 {
     UserConnection* thisObj = GetThisWeakObject<UserConnection>(ctx);
-    SignalWrapper_UserConnection_NetworkMessageReceived* wrapper = new SignalWrapper_UserConnection_NetworkMessageReceived(thisObj, &thisObj->NetworkMessageReceived);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalNetworkMessageReceived")) return 1;
+    SignalWrapper_UserConnection_NetworkMessageReceived* wrapper = new (ctx) SignalWrapper_UserConnection_NetworkMessageReceived(thisObj, &thisObj->NetworkMessageReceived);
     PushValueObject(ctx, wrapper, SignalWrapper_UserConnection_NetworkMessageReceived_ID, SignalWrapper_UserConnection_NetworkMessageReceived_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_UserConnection_NetworkMessageReceived_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -233,6 +235,13 @@ static duk_ret_t UserConnection_Get_NetworkMessageReceived(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_UserConnection_NetworkMessageReceived_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_UserConnection_NetworkMessageReceived_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_UserConnection_NetworkMessageReceived_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
+    CacheSignalWrapper(ctx, "\xff""signalNetworkMessageReceived");
     return 1;
 }
 
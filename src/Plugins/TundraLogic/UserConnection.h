@@ -24,11 +24,13 @@ enum NetworkProtocolVersion
     ProtocolOriginal = 0x1,         // Original
     ProtocolCustomComponents = 0x2, // Adds support for transmitting new static-structured component types without actual C++ implementation, using EC_PlaceholderComponent
     ProtocolHierarchicScene = 0x3,  // Adds support for hierarchic scene, ie. entities having child entities
-    ProtocolWebClientRigidBodyMessage = 0x4 // WebSocket client that supports the rigid body optimization message
+    ProtocolWebClientRigidBodyMessage = 0x4, // WebSocket client that supports the rigid body optimization message
+    ProtocolWebSocketBatchedMessages = 0x5, // WebSocket client that unpacks multiple messages coalesced to a single frame
+    ProtocolWebSocketCompression = 0x6 // WebSocket client that reads the encoding byte of batched frames and inflates compressed frames
 };
 
 /// Highest supported protocol version in the build. Update this when a new protocol version is added
-const NetworkProtocolVersion cHighestSupportedProtocolVersion = ProtocolWebClientRigidBodyMessage;
+const NetworkProtocolVersion cHighestSupportedProtocolVersion = ProtocolWebSocketCompression;
 
 /// Represents a client connection on the server side. Subclassed by networking implementations.
 class TUNDRALOGIC_API UserConnection : public Object
@@ -64,6 +66,11 @@ public:
     /// Queue a network message to be sent to the client, with the data to be sent in a DataSerializer. All implementations may not use the reliable, inOrder, priority and contentID parameters.
     void Send(kNet::message_id_t id, bool reliable, bool inOrder, kNet::DataSerializer& ds, unsigned long priority = 100, unsigned long contentID = 0);
 
+    /// Returns true if more data is queued for sending to the client than the networking implementation allows.
+    /** The SyncManager holds back scene sync to the client while this is true. Changes keep accumulating
+        to the sync state meanwhile and only the latest state is sent once the connection has caught up. */
+    virtual bool IsSendQueueFull() const { return false; }
+
     /// Queue a typed network message to be sent to the client.
     template<typename SerializableMessage> void Send(const SerializableMessage &data)
     {
@@ -7,7 +7,9 @@
 #include "LoggingFunctions.h"
 #include "IMeshAsset.h"
 
+#include <Urho3D/Graphics/IndexBuffer.h>
 #include <Urho3D/Graphics/Model.h>
+#include <Urho3D/Graphics/VertexBuffer.h>
 
 namespace Tundra
 {
@@ -38,6 +40,30 @@ bool IMeshAsset::IsLoaded() const
     return model != nullptr;
 }
 
+static uint BufferMemoryUsage(Urho3D::Model *model, bool shadowedOnly)
+{
+    uint size = 0;
+    const Vector<SharedPtr<Urho3D::VertexBuffer> >& vertexBuffers = model->GetVertexBuffers();
+    for (uint i = 0; i < vertexBuffers.Size(); ++i)
+        if (vertexBuffers[i] && (!shadowedOnly || vertexBuffers[i]->IsShadowed()))
+            size += vertexBuffers[i]->GetVertexCount() * vertexBuffers[i]->GetVertexSize();
+    const Vector<SharedPtr<Urho3D::IndexBuffer> >& indexBuffers = model->GetIndexBuffers();
+    for (uint i = 0; i < indexBuffers.Size(); ++i)
+        if (indexBuffers[i] && (!shadowedOnly || indexBuffers[i]->IsShadowed()))
+            size += indexBuffers[i]->GetIndexCount() * indexBuffers[i]->GetIndexSize();
+    return size;
+}
+
+uint IMeshAsset::CpuMemoryUsage() const
+{
+    return model ? BufferMemoryUsage(model, true) : 0;
+}
+
+uint IMeshAsset::GpuMemoryUsage() const
+{
+    return model ? BufferMemoryUsage(model, false) : 0;
+}
+
 Urho3D::Model* IMeshAsset::UrhoModel() const
 {
     return model;
@@ -26,6 +26,12 @@ public:
     /// IAsset override.
     bool IsLoaded() const override;
 
+    /// Returns the size of the CPU-side shadow copies of the vertex and index buffers. IAsset override.
+    uint CpuMemoryUsage() const override;
+
+    /// Returns the size of the vertex and index buffers. IAsset override.
+    uint GpuMemoryUsage() const override;
+
     /// Returns submesh count.
     uint NumSubmeshes() const;
 
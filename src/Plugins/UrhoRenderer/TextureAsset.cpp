@@ -193,6 +193,17 @@ bool TextureAsset::IsLoaded() const
     return texture != nullptr;
 }
 
+uint TextureAsset::GpuMemoryUsage() const
+{
+    if (!IsLoaded())
+        return 0;
+
+    uint size = 0;
+    for(uint level = 0; level < texture->GetLevels(); ++level)
+        size += texture->GetDataSize(texture->GetLevelWidth(level), texture->GetLevelHeight(level));
+    return size;
+}
+
 Urho3D::Texture2D* TextureAsset::UrhoTexture() const
 {
     return texture;
@@ -25,6 +25,9 @@ public:
     /// IAsset override.
     bool IsLoaded() const override;
 
+    /// Returns the size of all mip levels of the texture. IAsset override.
+    uint GpuMemoryUsage() const override;
+
     /// Returns Urho3D texture
     Urho3D::Texture2D* UrhoTexture() const;
 
@@ -45,16 +45,10 @@ public:
     void OnSignal(const String & param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -66,6 +60,7 @@ static duk_ret_t SignalWrapper_AnimationController_AnimationFinished_Finalizer(d
 
 static duk_ret_t SignalWrapper_AnimationController_AnimationFinished_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_AnimationFinished* wrapper = GetThisValueObject<SignalWrapper_AnimationController_AnimationFinished>(ctx, SignalWrapper_AnimationController_AnimationFinished_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -83,6 +78,7 @@ static duk_ret_t SignalWrapper_AnimationController_AnimationFinished_Connect(duk
 
 static duk_ret_t SignalWrapper_AnimationController_AnimationFinished_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_AnimationFinished* wrapper = GetThisValueObject<SignalWrapper_AnimationController_AnimationFinished>(ctx, SignalWrapper_AnimationController_AnimationFinished_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -91,6 +87,7 @@ static duk_ret_t SignalWrapper_AnimationController_AnimationFinished_Disconnect(
 
 static duk_ret_t SignalWrapper_AnimationController_AnimationFinished_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_AnimationFinished* wrapper = GetThisValueObject<SignalWrapper_AnimationController_AnimationFinished>(ctx, SignalWrapper_AnimationController_AnimationFinished_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -101,7 +98,8 @@ static duk_ret_t SignalWrapper_AnimationController_AnimationFinished_Emit(duk_co
 static duk_ret_t AnimationController_Get_AnimationFinished(duk_context* ctx)
 {
     AnimationController* thisObj = GetThisWeakObject<AnimationController>(ctx);
-    SignalWrapper_AnimationController_AnimationFinished* wrapper = new SignalWrapper_AnimationController_AnimationFinished(thisObj, &thisObj->AnimationFinished);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAnimationFinished")) return 1;
+    SignalWrapper_AnimationController_AnimationFinished* wrapper = new (ctx) SignalWrapper_AnimationController_AnimationFinished(thisObj, &thisObj->AnimationFinished);
     PushValueObject(ctx, wrapper, SignalWrapper_AnimationController_AnimationFinished_ID, SignalWrapper_AnimationController_AnimationFinished_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AnimationController_AnimationFinished_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -111,8 +109,15 @@ static duk_ret_t AnimationController_Get_AnimationFinished(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AnimationController_AnimationFinished_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AnimationController_AnimationFinished_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AnimationController_AnimationFinished_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AnimationController_AnimationFinished_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAnimationFinished");
     return 1;
 }
 
@@ -137,16 +142,10 @@ public:
     void OnSignal(const String & param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -158,6 +157,7 @@ static duk_ret_t SignalWrapper_AnimationController_AnimationCycled_Finalizer(duk
 
 static duk_ret_t SignalWrapper_AnimationController_AnimationCycled_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_AnimationCycled* wrapper = GetThisValueObject<SignalWrapper_AnimationController_AnimationCycled>(ctx, SignalWrapper_AnimationController_AnimationCycled_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -175,6 +175,7 @@ static duk_ret_t SignalWrapper_AnimationController_AnimationCycled_Connect(duk_c
 
 static duk_ret_t SignalWrapper_AnimationController_AnimationCycled_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_AnimationCycled* wrapper = GetThisValueObject<SignalWrapper_AnimationController_AnimationCycled>(ctx, SignalWrapper_AnimationController_AnimationCycled_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -183,6 +184,7 @@ static duk_ret_t SignalWrapper_AnimationController_AnimationCycled_Disconnect(du
 
 static duk_ret_t SignalWrapper_AnimationController_AnimationCycled_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_AnimationCycled* wrapper = GetThisValueObject<SignalWrapper_AnimationController_AnimationCycled>(ctx, SignalWrapper_AnimationController_AnimationCycled_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -193,7 +195,8 @@ static duk_ret_t SignalWrapper_AnimationController_AnimationCycled_Emit(duk_cont
 static duk_ret_t AnimationController_Get_AnimationCycled(duk_context* ctx)
 {
     AnimationController* thisObj = GetThisWeakObject<AnimationController>(ctx);
-    SignalWrapper_AnimationController_AnimationCycled* wrapper = new SignalWrapper_AnimationController_AnimationCycled(thisObj, &thisObj->AnimationCycled);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAnimationCycled")) return 1;
+    SignalWrapper_AnimationController_AnimationCycled* wrapper = new (ctx) SignalWrapper_AnimationController_AnimationCycled(thisObj, &thisObj->AnimationCycled);
     PushValueObject(ctx, wrapper, SignalWrapper_AnimationController_AnimationCycled_ID, SignalWrapper_AnimationController_AnimationCycled_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AnimationController_AnimationCycled_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -203,8 +206,15 @@ static duk_ret_t AnimationController_Get_AnimationCycled(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AnimationController_AnimationCycled_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AnimationController_AnimationCycled_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AnimationController_AnimationCycled_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AnimationController_AnimationCycled_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAnimationCycled");
     return 1;
 }
 
@@ -229,18 +239,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -252,6 +256,7 @@ static duk_ret_t SignalWrapper_AnimationController_ComponentNameChanged_Finalize
 
 static duk_ret_t SignalWrapper_AnimationController_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_AnimationController_ComponentNameChanged>(ctx, SignalWrapper_AnimationController_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -269,6 +274,7 @@ static duk_ret_t SignalWrapper_AnimationController_ComponentNameChanged_Connect(
 
 static duk_ret_t SignalWrapper_AnimationController_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_AnimationController_ComponentNameChanged>(ctx, SignalWrapper_AnimationController_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -277,6 +283,7 @@ static duk_ret_t SignalWrapper_AnimationController_ComponentNameChanged_Disconne
 
 static duk_ret_t SignalWrapper_AnimationController_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_AnimationController_ComponentNameChanged>(ctx, SignalWrapper_AnimationController_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -288,7 +295,8 @@ static duk_ret_t SignalWrapper_AnimationController_ComponentNameChanged_Emit(duk
 static duk_ret_t AnimationController_Get_ComponentNameChanged(duk_context* ctx)
 {
     AnimationController* thisObj = GetThisWeakObject<AnimationController>(ctx);
-    SignalWrapper_AnimationController_ComponentNameChanged* wrapper = new SignalWrapper_AnimationController_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_AnimationController_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_AnimationController_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_AnimationController_ComponentNameChanged_ID, SignalWrapper_AnimationController_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AnimationController_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -298,8 +306,15 @@ static duk_ret_t AnimationController_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AnimationController_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AnimationController_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AnimationController_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AnimationController_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -324,14 +339,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -343,6 +352,7 @@ static duk_ret_t SignalWrapper_AnimationController_ParentEntitySet_Finalizer(duk
 
 static duk_ret_t SignalWrapper_AnimationController_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_AnimationController_ParentEntitySet>(ctx, SignalWrapper_AnimationController_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -360,6 +370,7 @@ static duk_ret_t SignalWrapper_AnimationController_ParentEntitySet_Connect(duk_c
 
 static duk_ret_t SignalWrapper_AnimationController_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_AnimationController_ParentEntitySet>(ctx, SignalWrapper_AnimationController_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -368,6 +379,7 @@ static duk_ret_t SignalWrapper_AnimationController_ParentEntitySet_Disconnect(du
 
 static duk_ret_t SignalWrapper_AnimationController_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_AnimationController_ParentEntitySet>(ctx, SignalWrapper_AnimationController_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -377,7 +389,8 @@ static duk_ret_t SignalWrapper_AnimationController_ParentEntitySet_Emit(duk_cont
 static duk_ret_t AnimationController_Get_ParentEntitySet(duk_context* ctx)
 {
     AnimationController* thisObj = GetThisWeakObject<AnimationController>(ctx);
-    SignalWrapper_AnimationController_ParentEntitySet* wrapper = new SignalWrapper_AnimationController_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_AnimationController_ParentEntitySet* wrapper = new (ctx) SignalWrapper_AnimationController_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_AnimationController_ParentEntitySet_ID, SignalWrapper_AnimationController_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AnimationController_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -387,8 +400,15 @@ static duk_ret_t AnimationController_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AnimationController_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AnimationController_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AnimationController_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AnimationController_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -413,14 +433,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -432,6 +446,7 @@ static duk_ret_t SignalWrapper_AnimationController_ParentEntityAboutToBeDetached
 
 static duk_ret_t SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_AnimationController_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -449,6 +464,7 @@ static duk_ret_t SignalWrapper_AnimationController_ParentEntityAboutToBeDetached
 
 static duk_ret_t SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_AnimationController_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -457,6 +473,7 @@ static duk_ret_t SignalWrapper_AnimationController_ParentEntityAboutToBeDetached
 
 static duk_ret_t SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_AnimationController_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_AnimationController_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -466,7 +483,8 @@ static duk_ret_t SignalWrapper_AnimationController_ParentEntityAboutToBeDetached
 static duk_ret_t AnimationController_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     AnimationController* thisObj = GetThisWeakObject<AnimationController>(ctx);
-    SignalWrapper_AnimationController_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_AnimationController_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_AnimationController_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_AnimationController_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_ID, SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -476,8 +494,15 @@ static duk_ret_t AnimationController_Get_ParentEntityAboutToBeDetached(duk_conte
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_AnimationController_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
@@ -60,18 +60,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -83,6 +77,7 @@ static duk_ret_t SignalWrapper_Camera_ComponentNameChanged_Finalizer(duk_context
 
 static duk_ret_t SignalWrapper_Camera_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Camera_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Camera_ComponentNameChanged>(ctx, SignalWrapper_Camera_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -100,6 +95,7 @@ static duk_ret_t SignalWrapper_Camera_ComponentNameChanged_Connect(duk_context*
 
 static duk_ret_t SignalWrapper_Camera_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Camera_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Camera_ComponentNameChanged>(ctx, SignalWrapper_Camera_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -108,6 +104,7 @@ static duk_ret_t SignalWrapper_Camera_ComponentNameChanged_Disconnect(duk_contex
 
 static duk_ret_t SignalWrapper_Camera_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Camera_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Camera_ComponentNameChanged>(ctx, SignalWrapper_Camera_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -119,7 +116,8 @@ static duk_ret_t SignalWrapper_Camera_ComponentNameChanged_Emit(duk_context* ctx
 static duk_ret_t Camera_Get_ComponentNameChanged(duk_context* ctx)
 {
     Camera* thisObj = GetThisWeakObject<Camera>(ctx);
-    SignalWrapper_Camera_ComponentNameChanged* wrapper = new SignalWrapper_Camera_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_Camera_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_Camera_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Camera_ComponentNameChanged_ID, SignalWrapper_Camera_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Camera_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -129,8 +127,15 @@ static duk_ret_t Camera_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Camera_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Camera_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Camera_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Camera_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -155,14 +160,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -174,6 +173,7 @@ static duk_ret_t SignalWrapper_Camera_ParentEntitySet_Finalizer(duk_context* ctx
 
 static duk_ret_t SignalWrapper_Camera_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Camera_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Camera_ParentEntitySet>(ctx, SignalWrapper_Camera_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -191,6 +191,7 @@ static duk_ret_t SignalWrapper_Camera_ParentEntitySet_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Camera_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Camera_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Camera_ParentEntitySet>(ctx, SignalWrapper_Camera_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -199,6 +200,7 @@ static duk_ret_t SignalWrapper_Camera_ParentEntitySet_Disconnect(duk_context* ct
 
 static duk_ret_t SignalWrapper_Camera_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Camera_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Camera_ParentEntitySet>(ctx, SignalWrapper_Camera_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -208,7 +210,8 @@ static duk_ret_t SignalWrapper_Camera_ParentEntitySet_Emit(duk_context* ctx)
 static duk_ret_t Camera_Get_ParentEntitySet(duk_context* ctx)
 {
     Camera* thisObj = GetThisWeakObject<Camera>(ctx);
-    SignalWrapper_Camera_ParentEntitySet* wrapper = new SignalWrapper_Camera_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_Camera_ParentEntitySet* wrapper = new (ctx) SignalWrapper_Camera_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_Camera_ParentEntitySet_ID, SignalWrapper_Camera_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Camera_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -218,8 +221,15 @@ static duk_ret_t Camera_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Camera_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Camera_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Camera_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Camera_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -244,14 +254,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -263,6 +267,7 @@ static duk_ret_t SignalWrapper_Camera_ParentEntityAboutToBeDetached_Finalizer(du
 
 static duk_ret_t SignalWrapper_Camera_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Camera_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Camera_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Camera_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -280,6 +285,7 @@ static duk_ret_t SignalWrapper_Camera_ParentEntityAboutToBeDetached_Connect(duk_
 
 static duk_ret_t SignalWrapper_Camera_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Camera_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Camera_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Camera_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -288,6 +294,7 @@ static duk_ret_t SignalWrapper_Camera_ParentEntityAboutToBeDetached_Disconnect(d
 
 static duk_ret_t SignalWrapper_Camera_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Camera_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Camera_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Camera_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -297,7 +304,8 @@ static duk_ret_t SignalWrapper_Camera_ParentEntityAboutToBeDetached_Emit(duk_con
 static duk_ret_t Camera_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     Camera* thisObj = GetThisWeakObject<Camera>(ctx);
-    SignalWrapper_Camera_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_Camera_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_Camera_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_Camera_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_Camera_ParentEntityAboutToBeDetached_ID, SignalWrapper_Camera_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Camera_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -307,8 +315,15 @@ static duk_ret_t Camera_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Camera_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Camera_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Camera_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Camera_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
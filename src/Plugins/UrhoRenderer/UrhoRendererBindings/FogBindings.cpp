@@ -45,18 +45,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -68,6 +62,7 @@ static duk_ret_t SignalWrapper_Fog_ComponentNameChanged_Finalizer(duk_context* c
 
 static duk_ret_t SignalWrapper_Fog_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Fog_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Fog_ComponentNameChanged>(ctx, SignalWrapper_Fog_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -85,6 +80,7 @@ static duk_ret_t SignalWrapper_Fog_ComponentNameChanged_Connect(duk_context* ctx
 
 static duk_ret_t SignalWrapper_Fog_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Fog_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Fog_ComponentNameChanged>(ctx, SignalWrapper_Fog_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -93,6 +89,7 @@ static duk_ret_t SignalWrapper_Fog_ComponentNameChanged_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_Fog_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Fog_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Fog_ComponentNameChanged>(ctx, SignalWrapper_Fog_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -104,7 +101,8 @@ static duk_ret_t SignalWrapper_Fog_ComponentNameChanged_Emit(duk_context* ctx)
 static duk_ret_t Fog_Get_ComponentNameChanged(duk_context* ctx)
 {
     Fog* thisObj = GetThisWeakObject<Fog>(ctx);
-    SignalWrapper_Fog_ComponentNameChanged* wrapper = new SignalWrapper_Fog_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_Fog_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_Fog_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Fog_ComponentNameChanged_ID, SignalWrapper_Fog_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Fog_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -114,8 +112,15 @@ static duk_ret_t Fog_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Fog_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Fog_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Fog_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Fog_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -140,14 +145,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -159,6 +158,7 @@ static duk_ret_t SignalWrapper_Fog_ParentEntitySet_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Fog_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Fog_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Fog_ParentEntitySet>(ctx, SignalWrapper_Fog_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -176,6 +176,7 @@ static duk_ret_t SignalWrapper_Fog_ParentEntitySet_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Fog_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Fog_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Fog_ParentEntitySet>(ctx, SignalWrapper_Fog_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -184,6 +185,7 @@ static duk_ret_t SignalWrapper_Fog_ParentEntitySet_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Fog_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Fog_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Fog_ParentEntitySet>(ctx, SignalWrapper_Fog_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -193,7 +195,8 @@ static duk_ret_t SignalWrapper_Fog_ParentEntitySet_Emit(duk_context* ctx)
 static duk_ret_t Fog_Get_ParentEntitySet(duk_context* ctx)
 {
     Fog* thisObj = GetThisWeakObject<Fog>(ctx);
-    SignalWrapper_Fog_ParentEntitySet* wrapper = new SignalWrapper_Fog_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_Fog_ParentEntitySet* wrapper = new (ctx) SignalWrapper_Fog_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_Fog_ParentEntitySet_ID, SignalWrapper_Fog_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Fog_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -203,8 +206,15 @@ static duk_ret_t Fog_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Fog_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Fog_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Fog_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Fog_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -229,14 +239,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -248,6 +252,7 @@ static duk_ret_t SignalWrapper_Fog_ParentEntityAboutToBeDetached_Finalizer(duk_c
 
 static duk_ret_t SignalWrapper_Fog_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Fog_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Fog_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Fog_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -265,6 +270,7 @@ static duk_ret_t SignalWrapper_Fog_ParentEntityAboutToBeDetached_Connect(duk_con
 
 static duk_ret_t SignalWrapper_Fog_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Fog_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Fog_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Fog_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -273,6 +279,7 @@ static duk_ret_t SignalWrapper_Fog_ParentEntityAboutToBeDetached_Disconnect(duk_
 
 static duk_ret_t SignalWrapper_Fog_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Fog_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Fog_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Fog_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -282,7 +289,8 @@ static duk_ret_t SignalWrapper_Fog_ParentEntityAboutToBeDetached_Emit(duk_contex
 static duk_ret_t Fog_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     Fog* thisObj = GetThisWeakObject<Fog>(ctx);
-    SignalWrapper_Fog_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_Fog_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_Fog_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_Fog_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_Fog_ParentEntityAboutToBeDetached_ID, SignalWrapper_Fog_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Fog_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -292,8 +300,15 @@ static duk_ret_t Fog_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Fog_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Fog_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Fog_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Fog_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
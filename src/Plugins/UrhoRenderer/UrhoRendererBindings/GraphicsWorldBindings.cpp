@@ -67,16 +67,10 @@ public:
     void OnSignal(Entity * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -88,6 +82,7 @@ static duk_ret_t SignalWrapper_GraphicsWorld_EntityEnterView_Finalizer(duk_conte
 
 static duk_ret_t SignalWrapper_GraphicsWorld_EntityEnterView_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_GraphicsWorld_EntityEnterView* wrapper = GetThisValueObject<SignalWrapper_GraphicsWorld_EntityEnterView>(ctx, SignalWrapper_GraphicsWorld_EntityEnterView_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -105,6 +100,7 @@ static duk_ret_t SignalWrapper_GraphicsWorld_EntityEnterView_Connect(duk_context
 
 static duk_ret_t SignalWrapper_GraphicsWorld_EntityEnterView_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_GraphicsWorld_EntityEnterView* wrapper = GetThisValueObject<SignalWrapper_GraphicsWorld_EntityEnterView>(ctx, SignalWrapper_GraphicsWorld_EntityEnterView_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -113,6 +109,7 @@ static duk_ret_t SignalWrapper_GraphicsWorld_EntityEnterView_Disconnect(duk_cont
 
 static duk_ret_t SignalWrapper_GraphicsWorld_EntityEnterView_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_GraphicsWorld_EntityEnterView* wrapper = GetThisValueObject<SignalWrapper_GraphicsWorld_EntityEnterView>(ctx, SignalWrapper_GraphicsWorld_EntityEnterView_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -123,7 +120,8 @@ static duk_ret_t SignalWrapper_GraphicsWorld_EntityEnterView_Emit(duk_context* c
 static duk_ret_t GraphicsWorld_Get_EntityEnterView(duk_context* ctx)
 {
     GraphicsWorld* thisObj = GetThisWeakObject<GraphicsWorld>(ctx);
-    SignalWrapper_GraphicsWorld_EntityEnterView* wrapper = new SignalWrapper_GraphicsWorld_EntityEnterView(thisObj, &thisObj->EntityEnterView);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityEnterView")) return 1;
+    SignalWrapper_GraphicsWorld_EntityEnterView* wrapper = new (ctx) SignalWrapper_GraphicsWorld_EntityEnterView(thisObj, &thisObj->EntityEnterView);
     PushValueObject(ctx, wrapper, SignalWrapper_GraphicsWorld_EntityEnterView_ID, SignalWrapper_GraphicsWorld_EntityEnterView_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_GraphicsWorld_EntityEnterView_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -133,8 +131,15 @@ static duk_ret_t GraphicsWorld_Get_EntityEnterView(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_GraphicsWorld_EntityEnterView_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_GraphicsWorld_EntityEnterView_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_GraphicsWorld_EntityEnterView_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_GraphicsWorld_EntityEnterView_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityEnterView");
     return 1;
 }
 
@@ -159,16 +164,10 @@ public:
     void OnSignal(Entity * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -180,6 +179,7 @@ static duk_ret_t SignalWrapper_GraphicsWorld_EntityLeaveView_Finalizer(duk_conte
 
 static duk_ret_t SignalWrapper_GraphicsWorld_EntityLeaveView_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_GraphicsWorld_EntityLeaveView* wrapper = GetThisValueObject<SignalWrapper_GraphicsWorld_EntityLeaveView>(ctx, SignalWrapper_GraphicsWorld_EntityLeaveView_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -197,6 +197,7 @@ static duk_ret_t SignalWrapper_GraphicsWorld_EntityLeaveView_Connect(duk_context
 
 static duk_ret_t SignalWrapper_GraphicsWorld_EntityLeaveView_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_GraphicsWorld_EntityLeaveView* wrapper = GetThisValueObject<SignalWrapper_GraphicsWorld_EntityLeaveView>(ctx, SignalWrapper_GraphicsWorld_EntityLeaveView_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -205,6 +206,7 @@ static duk_ret_t SignalWrapper_GraphicsWorld_EntityLeaveView_Disconnect(duk_cont
 
 static duk_ret_t SignalWrapper_GraphicsWorld_EntityLeaveView_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_GraphicsWorld_EntityLeaveView* wrapper = GetThisValueObject<SignalWrapper_GraphicsWorld_EntityLeaveView>(ctx, SignalWrapper_GraphicsWorld_EntityLeaveView_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -215,7 +217,8 @@ static duk_ret_t SignalWrapper_GraphicsWorld_EntityLeaveView_Emit(duk_context* c
 static duk_ret_t GraphicsWorld_Get_EntityLeaveView(duk_context* ctx)
 {
     GraphicsWorld* thisObj = GetThisWeakObject<GraphicsWorld>(ctx);
-    SignalWrapper_GraphicsWorld_EntityLeaveView* wrapper = new SignalWrapper_GraphicsWorld_EntityLeaveView(thisObj, &thisObj->EntityLeaveView);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalEntityLeaveView")) return 1;
+    SignalWrapper_GraphicsWorld_EntityLeaveView* wrapper = new (ctx) SignalWrapper_GraphicsWorld_EntityLeaveView(thisObj, &thisObj->EntityLeaveView);
     PushValueObject(ctx, wrapper, SignalWrapper_GraphicsWorld_EntityLeaveView_ID, SignalWrapper_GraphicsWorld_EntityLeaveView_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_GraphicsWorld_EntityLeaveView_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -225,8 +228,15 @@ static duk_ret_t GraphicsWorld_Get_EntityLeaveView(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_GraphicsWorld_EntityLeaveView_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_GraphicsWorld_EntityLeaveView_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_GraphicsWorld_EntityLeaveView_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_GraphicsWorld_EntityLeaveView_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalEntityLeaveView");
     return 1;
 }
 
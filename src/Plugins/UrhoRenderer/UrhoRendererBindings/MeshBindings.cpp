@@ -66,14 +66,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -85,6 +79,7 @@ static duk_ret_t SignalWrapper_Mesh_MeshAboutToBeDestroyed_Finalizer(duk_context
 
 static duk_ret_t SignalWrapper_Mesh_MeshAboutToBeDestroyed_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_MeshAboutToBeDestroyed* wrapper = GetThisValueObject<SignalWrapper_Mesh_MeshAboutToBeDestroyed>(ctx, SignalWrapper_Mesh_MeshAboutToBeDestroyed_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -102,6 +97,7 @@ static duk_ret_t SignalWrapper_Mesh_MeshAboutToBeDestroyed_Connect(duk_context*
 
 static duk_ret_t SignalWrapper_Mesh_MeshAboutToBeDestroyed_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_MeshAboutToBeDestroyed* wrapper = GetThisValueObject<SignalWrapper_Mesh_MeshAboutToBeDestroyed>(ctx, SignalWrapper_Mesh_MeshAboutToBeDestroyed_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -110,6 +106,7 @@ static duk_ret_t SignalWrapper_Mesh_MeshAboutToBeDestroyed_Disconnect(duk_contex
 
 static duk_ret_t SignalWrapper_Mesh_MeshAboutToBeDestroyed_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_MeshAboutToBeDestroyed* wrapper = GetThisValueObject<SignalWrapper_Mesh_MeshAboutToBeDestroyed>(ctx, SignalWrapper_Mesh_MeshAboutToBeDestroyed_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -119,7 +116,8 @@ static duk_ret_t SignalWrapper_Mesh_MeshAboutToBeDestroyed_Emit(duk_context* ctx
 static duk_ret_t Mesh_Get_MeshAboutToBeDestroyed(duk_context* ctx)
 {
     Mesh* thisObj = GetThisWeakObject<Mesh>(ctx);
-    SignalWrapper_Mesh_MeshAboutToBeDestroyed* wrapper = new SignalWrapper_Mesh_MeshAboutToBeDestroyed(thisObj, &thisObj->MeshAboutToBeDestroyed);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMeshAboutToBeDestroyed")) return 1;
+    SignalWrapper_Mesh_MeshAboutToBeDestroyed* wrapper = new (ctx) SignalWrapper_Mesh_MeshAboutToBeDestroyed(thisObj, &thisObj->MeshAboutToBeDestroyed);
     PushValueObject(ctx, wrapper, SignalWrapper_Mesh_MeshAboutToBeDestroyed_ID, SignalWrapper_Mesh_MeshAboutToBeDestroyed_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Mesh_MeshAboutToBeDestroyed_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -129,8 +127,15 @@ static duk_ret_t Mesh_Get_MeshAboutToBeDestroyed(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Mesh_MeshAboutToBeDestroyed_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_MeshAboutToBeDestroyed_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_MeshAboutToBeDestroyed_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Mesh_MeshAboutToBeDestroyed_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMeshAboutToBeDestroyed");
     return 1;
 }
 
@@ -155,14 +160,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -174,6 +173,7 @@ static duk_ret_t SignalWrapper_Mesh_MeshChanged_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_MeshChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_MeshChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_MeshChanged>(ctx, SignalWrapper_Mesh_MeshChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -191,6 +191,7 @@ static duk_ret_t SignalWrapper_Mesh_MeshChanged_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_MeshChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_MeshChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_MeshChanged>(ctx, SignalWrapper_Mesh_MeshChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -199,6 +200,7 @@ static duk_ret_t SignalWrapper_Mesh_MeshChanged_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_MeshChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_MeshChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_MeshChanged>(ctx, SignalWrapper_Mesh_MeshChanged_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -208,7 +210,8 @@ static duk_ret_t SignalWrapper_Mesh_MeshChanged_Emit(duk_context* ctx)
 static duk_ret_t Mesh_Get_MeshChanged(duk_context* ctx)
 {
     Mesh* thisObj = GetThisWeakObject<Mesh>(ctx);
-    SignalWrapper_Mesh_MeshChanged* wrapper = new SignalWrapper_Mesh_MeshChanged(thisObj, &thisObj->MeshChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMeshChanged")) return 1;
+    SignalWrapper_Mesh_MeshChanged* wrapper = new (ctx) SignalWrapper_Mesh_MeshChanged(thisObj, &thisObj->MeshChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Mesh_MeshChanged_ID, SignalWrapper_Mesh_MeshChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Mesh_MeshChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -218,8 +221,15 @@ static duk_ret_t Mesh_Get_MeshChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Mesh_MeshChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_MeshChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_MeshChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Mesh_MeshChanged_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMeshChanged");
     return 1;
 }
 
@@ -244,18 +254,12 @@ public:
     void OnSignal(uint param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_number(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -267,6 +271,7 @@ static duk_ret_t SignalWrapper_Mesh_MaterialChanged_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_MaterialChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_MaterialChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_MaterialChanged>(ctx, SignalWrapper_Mesh_MaterialChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -284,6 +289,7 @@ static duk_ret_t SignalWrapper_Mesh_MaterialChanged_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_MaterialChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_MaterialChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_MaterialChanged>(ctx, SignalWrapper_Mesh_MaterialChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -292,6 +298,7 @@ static duk_ret_t SignalWrapper_Mesh_MaterialChanged_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_MaterialChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_MaterialChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_MaterialChanged>(ctx, SignalWrapper_Mesh_MaterialChanged_ID);
     if (!wrapper->owner_) return 0;
     uint param0 = (uint)duk_require_number(ctx, 0);
@@ -303,7 +310,8 @@ static duk_ret_t SignalWrapper_Mesh_MaterialChanged_Emit(duk_context* ctx)
 static duk_ret_t Mesh_Get_MaterialChanged(duk_context* ctx)
 {
     Mesh* thisObj = GetThisWeakObject<Mesh>(ctx);
-    SignalWrapper_Mesh_MaterialChanged* wrapper = new SignalWrapper_Mesh_MaterialChanged(thisObj, &thisObj->MaterialChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMaterialChanged")) return 1;
+    SignalWrapper_Mesh_MaterialChanged* wrapper = new (ctx) SignalWrapper_Mesh_MaterialChanged(thisObj, &thisObj->MaterialChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Mesh_MaterialChanged_ID, SignalWrapper_Mesh_MaterialChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Mesh_MaterialChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -313,8 +321,15 @@ static duk_ret_t Mesh_Get_MaterialChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Mesh_MaterialChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_MaterialChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_MaterialChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Mesh_MaterialChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMaterialChanged");
     return 1;
 }
 
@@ -339,14 +354,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -358,6 +367,7 @@ static duk_ret_t SignalWrapper_Mesh_SkeletonChanged_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_SkeletonChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_SkeletonChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_SkeletonChanged>(ctx, SignalWrapper_Mesh_SkeletonChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -375,6 +385,7 @@ static duk_ret_t SignalWrapper_Mesh_SkeletonChanged_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_SkeletonChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_SkeletonChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_SkeletonChanged>(ctx, SignalWrapper_Mesh_SkeletonChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -383,6 +394,7 @@ static duk_ret_t SignalWrapper_Mesh_SkeletonChanged_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_SkeletonChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_SkeletonChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_SkeletonChanged>(ctx, SignalWrapper_Mesh_SkeletonChanged_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -392,7 +404,8 @@ static duk_ret_t SignalWrapper_Mesh_SkeletonChanged_Emit(duk_context* ctx)
 static duk_ret_t Mesh_Get_SkeletonChanged(duk_context* ctx)
 {
     Mesh* thisObj = GetThisWeakObject<Mesh>(ctx);
-    SignalWrapper_Mesh_SkeletonChanged* wrapper = new SignalWrapper_Mesh_SkeletonChanged(thisObj, &thisObj->SkeletonChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalSkeletonChanged")) return 1;
+    SignalWrapper_Mesh_SkeletonChanged* wrapper = new (ctx) SignalWrapper_Mesh_SkeletonChanged(thisObj, &thisObj->SkeletonChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Mesh_SkeletonChanged_ID, SignalWrapper_Mesh_SkeletonChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Mesh_SkeletonChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -402,8 +415,15 @@ static duk_ret_t Mesh_Get_SkeletonChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Mesh_SkeletonChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_SkeletonChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_SkeletonChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Mesh_SkeletonChanged_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalSkeletonChanged");
     return 1;
 }
 
@@ -428,18 +448,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -451,6 +465,7 @@ static duk_ret_t SignalWrapper_Mesh_ComponentNameChanged_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_Mesh_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_ComponentNameChanged>(ctx, SignalWrapper_Mesh_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -468,6 +483,7 @@ static duk_ret_t SignalWrapper_Mesh_ComponentNameChanged_Connect(duk_context* ct
 
 static duk_ret_t SignalWrapper_Mesh_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_ComponentNameChanged>(ctx, SignalWrapper_Mesh_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -476,6 +492,7 @@ static duk_ret_t SignalWrapper_Mesh_ComponentNameChanged_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_Mesh_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Mesh_ComponentNameChanged>(ctx, SignalWrapper_Mesh_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -487,7 +504,8 @@ static duk_ret_t SignalWrapper_Mesh_ComponentNameChanged_Emit(duk_context* ctx)
 static duk_ret_t Mesh_Get_ComponentNameChanged(duk_context* ctx)
 {
     Mesh* thisObj = GetThisWeakObject<Mesh>(ctx);
-    SignalWrapper_Mesh_ComponentNameChanged* wrapper = new SignalWrapper_Mesh_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_Mesh_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_Mesh_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Mesh_ComponentNameChanged_ID, SignalWrapper_Mesh_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Mesh_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -497,8 +515,15 @@ static duk_ret_t Mesh_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Mesh_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Mesh_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -523,14 +548,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -542,6 +561,7 @@ static duk_ret_t SignalWrapper_Mesh_ParentEntitySet_Finalizer(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Mesh_ParentEntitySet>(ctx, SignalWrapper_Mesh_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -559,6 +579,7 @@ static duk_ret_t SignalWrapper_Mesh_ParentEntitySet_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Mesh_ParentEntitySet>(ctx, SignalWrapper_Mesh_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -567,6 +588,7 @@ static duk_ret_t SignalWrapper_Mesh_ParentEntitySet_Disconnect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Mesh_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Mesh_ParentEntitySet>(ctx, SignalWrapper_Mesh_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -576,7 +598,8 @@ static duk_ret_t SignalWrapper_Mesh_ParentEntitySet_Emit(duk_context* ctx)
 static duk_ret_t Mesh_Get_ParentEntitySet(duk_context* ctx)
 {
     Mesh* thisObj = GetThisWeakObject<Mesh>(ctx);
-    SignalWrapper_Mesh_ParentEntitySet* wrapper = new SignalWrapper_Mesh_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_Mesh_ParentEntitySet* wrapper = new (ctx) SignalWrapper_Mesh_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_Mesh_ParentEntitySet_ID, SignalWrapper_Mesh_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Mesh_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -586,8 +609,15 @@ static duk_ret_t Mesh_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Mesh_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Mesh_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -612,14 +642,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -631,6 +655,7 @@ static duk_ret_t SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Finalizer(duk_
 
 static duk_ret_t SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Mesh_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Mesh_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -648,6 +673,7 @@ static duk_ret_t SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Connect(duk_co
 
 static duk_ret_t SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Mesh_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Mesh_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -656,6 +682,7 @@ static duk_ret_t SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Disconnect(duk
 
 static duk_ret_t SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Mesh_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Mesh_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Mesh_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -665,7 +692,8 @@ static duk_ret_t SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Emit(duk_conte
 static duk_ret_t Mesh_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     Mesh* thisObj = GetThisWeakObject<Mesh>(ctx);
-    SignalWrapper_Mesh_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_Mesh_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_Mesh_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_Mesh_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_Mesh_ParentEntityAboutToBeDetached_ID, SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -675,8 +703,15 @@ static duk_ret_t Mesh_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Mesh_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
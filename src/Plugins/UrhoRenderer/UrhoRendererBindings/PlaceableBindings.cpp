@@ -68,14 +68,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -87,6 +81,7 @@ static duk_ret_t SignalWrapper_Placeable_AboutToBeDestroyed_Finalizer(duk_contex
 
 static duk_ret_t SignalWrapper_Placeable_AboutToBeDestroyed_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_AboutToBeDestroyed* wrapper = GetThisValueObject<SignalWrapper_Placeable_AboutToBeDestroyed>(ctx, SignalWrapper_Placeable_AboutToBeDestroyed_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -104,6 +99,7 @@ static duk_ret_t SignalWrapper_Placeable_AboutToBeDestroyed_Connect(duk_context*
 
 static duk_ret_t SignalWrapper_Placeable_AboutToBeDestroyed_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_AboutToBeDestroyed* wrapper = GetThisValueObject<SignalWrapper_Placeable_AboutToBeDestroyed>(ctx, SignalWrapper_Placeable_AboutToBeDestroyed_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -112,6 +108,7 @@ static duk_ret_t SignalWrapper_Placeable_AboutToBeDestroyed_Disconnect(duk_conte
 
 static duk_ret_t SignalWrapper_Placeable_AboutToBeDestroyed_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_AboutToBeDestroyed* wrapper = GetThisValueObject<SignalWrapper_Placeable_AboutToBeDestroyed>(ctx, SignalWrapper_Placeable_AboutToBeDestroyed_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -121,7 +118,8 @@ static duk_ret_t SignalWrapper_Placeable_AboutToBeDestroyed_Emit(duk_context* ct
 static duk_ret_t Placeable_Get_AboutToBeDestroyed(duk_context* ctx)
 {
     Placeable* thisObj = GetThisWeakObject<Placeable>(ctx);
-    SignalWrapper_Placeable_AboutToBeDestroyed* wrapper = new SignalWrapper_Placeable_AboutToBeDestroyed(thisObj, &thisObj->AboutToBeDestroyed);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalAboutToBeDestroyed")) return 1;
+    SignalWrapper_Placeable_AboutToBeDestroyed* wrapper = new (ctx) SignalWrapper_Placeable_AboutToBeDestroyed(thisObj, &thisObj->AboutToBeDestroyed);
     PushValueObject(ctx, wrapper, SignalWrapper_Placeable_AboutToBeDestroyed_ID, SignalWrapper_Placeable_AboutToBeDestroyed_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Placeable_AboutToBeDestroyed_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -131,8 +129,15 @@ static duk_ret_t Placeable_Get_AboutToBeDestroyed(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Placeable_AboutToBeDestroyed_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Placeable_AboutToBeDestroyed_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Placeable_AboutToBeDestroyed_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Placeable_AboutToBeDestroyed_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalAboutToBeDestroyed");
     return 1;
 }
 
@@ -157,14 +162,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -176,6 +175,7 @@ static duk_ret_t SignalWrapper_Placeable_TransformChanged_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_Placeable_TransformChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_TransformChanged* wrapper = GetThisValueObject<SignalWrapper_Placeable_TransformChanged>(ctx, SignalWrapper_Placeable_TransformChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -193,6 +193,7 @@ static duk_ret_t SignalWrapper_Placeable_TransformChanged_Connect(duk_context* c
 
 static duk_ret_t SignalWrapper_Placeable_TransformChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_TransformChanged* wrapper = GetThisValueObject<SignalWrapper_Placeable_TransformChanged>(ctx, SignalWrapper_Placeable_TransformChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -201,6 +202,7 @@ static duk_ret_t SignalWrapper_Placeable_TransformChanged_Disconnect(duk_context
 
 static duk_ret_t SignalWrapper_Placeable_TransformChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_TransformChanged* wrapper = GetThisValueObject<SignalWrapper_Placeable_TransformChanged>(ctx, SignalWrapper_Placeable_TransformChanged_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -210,7 +212,8 @@ static duk_ret_t SignalWrapper_Placeable_TransformChanged_Emit(duk_context* ctx)
 static duk_ret_t Placeable_Get_TransformChanged(duk_context* ctx)
 {
     Placeable* thisObj = GetThisWeakObject<Placeable>(ctx);
-    SignalWrapper_Placeable_TransformChanged* wrapper = new SignalWrapper_Placeable_TransformChanged(thisObj, &thisObj->TransformChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalTransformChanged")) return 1;
+    SignalWrapper_Placeable_TransformChanged* wrapper = new (ctx) SignalWrapper_Placeable_TransformChanged(thisObj, &thisObj->TransformChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Placeable_TransformChanged_ID, SignalWrapper_Placeable_TransformChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Placeable_TransformChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -220,8 +223,15 @@ static duk_ret_t Placeable_Get_TransformChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Placeable_TransformChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Placeable_TransformChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Placeable_TransformChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Placeable_TransformChanged_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalTransformChanged");
     return 1;
 }
 
@@ -246,18 +256,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -269,6 +273,7 @@ static duk_ret_t SignalWrapper_Placeable_ComponentNameChanged_Finalizer(duk_cont
 
 static duk_ret_t SignalWrapper_Placeable_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Placeable_ComponentNameChanged>(ctx, SignalWrapper_Placeable_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -286,6 +291,7 @@ static duk_ret_t SignalWrapper_Placeable_ComponentNameChanged_Connect(duk_contex
 
 static duk_ret_t SignalWrapper_Placeable_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Placeable_ComponentNameChanged>(ctx, SignalWrapper_Placeable_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -294,6 +300,7 @@ static duk_ret_t SignalWrapper_Placeable_ComponentNameChanged_Disconnect(duk_con
 
 static duk_ret_t SignalWrapper_Placeable_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Placeable_ComponentNameChanged>(ctx, SignalWrapper_Placeable_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -305,7 +312,8 @@ static duk_ret_t SignalWrapper_Placeable_ComponentNameChanged_Emit(duk_context*
 static duk_ret_t Placeable_Get_ComponentNameChanged(duk_context* ctx)
 {
     Placeable* thisObj = GetThisWeakObject<Placeable>(ctx);
-    SignalWrapper_Placeable_ComponentNameChanged* wrapper = new SignalWrapper_Placeable_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_Placeable_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_Placeable_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Placeable_ComponentNameChanged_ID, SignalWrapper_Placeable_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Placeable_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -315,8 +323,15 @@ static duk_ret_t Placeable_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Placeable_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Placeable_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Placeable_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Placeable_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -341,14 +356,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -360,6 +369,7 @@ static duk_ret_t SignalWrapper_Placeable_ParentEntitySet_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_Placeable_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Placeable_ParentEntitySet>(ctx, SignalWrapper_Placeable_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -377,6 +387,7 @@ static duk_ret_t SignalWrapper_Placeable_ParentEntitySet_Connect(duk_context* ct
 
 static duk_ret_t SignalWrapper_Placeable_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Placeable_ParentEntitySet>(ctx, SignalWrapper_Placeable_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -385,6 +396,7 @@ static duk_ret_t SignalWrapper_Placeable_ParentEntitySet_Disconnect(duk_context*
 
 static duk_ret_t SignalWrapper_Placeable_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Placeable_ParentEntitySet>(ctx, SignalWrapper_Placeable_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -394,7 +406,8 @@ static duk_ret_t SignalWrapper_Placeable_ParentEntitySet_Emit(duk_context* ctx)
 static duk_ret_t Placeable_Get_ParentEntitySet(duk_context* ctx)
 {
     Placeable* thisObj = GetThisWeakObject<Placeable>(ctx);
-    SignalWrapper_Placeable_ParentEntitySet* wrapper = new SignalWrapper_Placeable_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_Placeable_ParentEntitySet* wrapper = new (ctx) SignalWrapper_Placeable_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_Placeable_ParentEntitySet_ID, SignalWrapper_Placeable_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Placeable_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -404,8 +417,15 @@ static duk_ret_t Placeable_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Placeable_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Placeable_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Placeable_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Placeable_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -430,14 +450,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -449,6 +463,7 @@ static duk_ret_t SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Finalizer
 
 static duk_ret_t SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Placeable_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Placeable_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -466,6 +481,7 @@ static duk_ret_t SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Connect(d
 
 static duk_ret_t SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Placeable_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Placeable_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -474,6 +490,7 @@ static duk_ret_t SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Disconnec
 
 static duk_ret_t SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Placeable_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Placeable_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Placeable_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -483,7 +500,8 @@ static duk_ret_t SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Emit(duk_
 static duk_ret_t Placeable_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     Placeable* thisObj = GetThisWeakObject<Placeable>(ctx);
-    SignalWrapper_Placeable_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_Placeable_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_Placeable_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_Placeable_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_Placeable_ParentEntityAboutToBeDetached_ID, SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -493,8 +511,15 @@ static duk_ret_t Placeable_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Placeable_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
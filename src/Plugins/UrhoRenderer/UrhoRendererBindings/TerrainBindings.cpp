@@ -52,14 +52,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -71,6 +65,7 @@ static duk_ret_t SignalWrapper_Terrain_TerrainRegenerated_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_Terrain_TerrainRegenerated_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_TerrainRegenerated* wrapper = GetThisValueObject<SignalWrapper_Terrain_TerrainRegenerated>(ctx, SignalWrapper_Terrain_TerrainRegenerated_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -88,6 +83,7 @@ static duk_ret_t SignalWrapper_Terrain_TerrainRegenerated_Connect(duk_context* c
 
 static duk_ret_t SignalWrapper_Terrain_TerrainRegenerated_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_TerrainRegenerated* wrapper = GetThisValueObject<SignalWrapper_Terrain_TerrainRegenerated>(ctx, SignalWrapper_Terrain_TerrainRegenerated_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -96,6 +92,7 @@ static duk_ret_t SignalWrapper_Terrain_TerrainRegenerated_Disconnect(duk_context
 
 static duk_ret_t SignalWrapper_Terrain_TerrainRegenerated_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_TerrainRegenerated* wrapper = GetThisValueObject<SignalWrapper_Terrain_TerrainRegenerated>(ctx, SignalWrapper_Terrain_TerrainRegenerated_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -105,7 +102,8 @@ static duk_ret_t SignalWrapper_Terrain_TerrainRegenerated_Emit(duk_context* ctx)
 static duk_ret_t Terrain_Get_TerrainRegenerated(duk_context* ctx)
 {
     Terrain* thisObj = GetThisWeakObject<Terrain>(ctx);
-    SignalWrapper_Terrain_TerrainRegenerated* wrapper = new SignalWrapper_Terrain_TerrainRegenerated(thisObj, &thisObj->TerrainRegenerated);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalTerrainRegenerated")) return 1;
+    SignalWrapper_Terrain_TerrainRegenerated* wrapper = new (ctx) SignalWrapper_Terrain_TerrainRegenerated(thisObj, &thisObj->TerrainRegenerated);
     PushValueObject(ctx, wrapper, SignalWrapper_Terrain_TerrainRegenerated_ID, SignalWrapper_Terrain_TerrainRegenerated_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Terrain_TerrainRegenerated_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -115,8 +113,15 @@ static duk_ret_t Terrain_Get_TerrainRegenerated(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Terrain_TerrainRegenerated_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Terrain_TerrainRegenerated_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Terrain_TerrainRegenerated_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Terrain_TerrainRegenerated_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalTerrainRegenerated");
     return 1;
 }
 
@@ -141,18 +146,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -164,6 +163,7 @@ static duk_ret_t SignalWrapper_Terrain_ComponentNameChanged_Finalizer(duk_contex
 
 static duk_ret_t SignalWrapper_Terrain_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Terrain_ComponentNameChanged>(ctx, SignalWrapper_Terrain_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -181,6 +181,7 @@ static duk_ret_t SignalWrapper_Terrain_ComponentNameChanged_Connect(duk_context*
 
 static duk_ret_t SignalWrapper_Terrain_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Terrain_ComponentNameChanged>(ctx, SignalWrapper_Terrain_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -189,6 +190,7 @@ static duk_ret_t SignalWrapper_Terrain_ComponentNameChanged_Disconnect(duk_conte
 
 static duk_ret_t SignalWrapper_Terrain_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_Terrain_ComponentNameChanged>(ctx, SignalWrapper_Terrain_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -200,7 +202,8 @@ static duk_ret_t SignalWrapper_Terrain_ComponentNameChanged_Emit(duk_context* ct
 static duk_ret_t Terrain_Get_ComponentNameChanged(duk_context* ctx)
 {
     Terrain* thisObj = GetThisWeakObject<Terrain>(ctx);
-    SignalWrapper_Terrain_ComponentNameChanged* wrapper = new SignalWrapper_Terrain_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_Terrain_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_Terrain_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_Terrain_ComponentNameChanged_ID, SignalWrapper_Terrain_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Terrain_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -210,8 +213,15 @@ static duk_ret_t Terrain_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Terrain_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Terrain_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Terrain_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Terrain_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -236,14 +246,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -255,6 +259,7 @@ static duk_ret_t SignalWrapper_Terrain_ParentEntitySet_Finalizer(duk_context* ct
 
 static duk_ret_t SignalWrapper_Terrain_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Terrain_ParentEntitySet>(ctx, SignalWrapper_Terrain_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -272,6 +277,7 @@ static duk_ret_t SignalWrapper_Terrain_ParentEntitySet_Connect(duk_context* ctx)
 
 static duk_ret_t SignalWrapper_Terrain_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Terrain_ParentEntitySet>(ctx, SignalWrapper_Terrain_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -280,6 +286,7 @@ static duk_ret_t SignalWrapper_Terrain_ParentEntitySet_Disconnect(duk_context* c
 
 static duk_ret_t SignalWrapper_Terrain_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_Terrain_ParentEntitySet>(ctx, SignalWrapper_Terrain_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -289,7 +296,8 @@ static duk_ret_t SignalWrapper_Terrain_ParentEntitySet_Emit(duk_context* ctx)
 static duk_ret_t Terrain_Get_ParentEntitySet(duk_context* ctx)
 {
     Terrain* thisObj = GetThisWeakObject<Terrain>(ctx);
-    SignalWrapper_Terrain_ParentEntitySet* wrapper = new SignalWrapper_Terrain_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_Terrain_ParentEntitySet* wrapper = new (ctx) SignalWrapper_Terrain_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_Terrain_ParentEntitySet_ID, SignalWrapper_Terrain_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Terrain_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -299,8 +307,15 @@ static duk_ret_t Terrain_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Terrain_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Terrain_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Terrain_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Terrain_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -325,14 +340,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -344,6 +353,7 @@ static duk_ret_t SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Finalizer(d
 
 static duk_ret_t SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Terrain_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Terrain_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -361,6 +371,7 @@ static duk_ret_t SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Connect(duk
 
 static duk_ret_t SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Terrain_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Terrain_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -369,6 +380,7 @@ static duk_ret_t SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Disconnect(
 
 static duk_ret_t SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_Terrain_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_Terrain_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_Terrain_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -378,7 +390,8 @@ static duk_ret_t SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Emit(duk_co
 static duk_ret_t Terrain_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     Terrain* thisObj = GetThisWeakObject<Terrain>(ctx);
-    SignalWrapper_Terrain_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_Terrain_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_Terrain_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_Terrain_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_Terrain_ParentEntityAboutToBeDetached_ID, SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -388,8 +401,15 @@ static duk_ret_t Terrain_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_Terrain_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
@@ -46,16 +46,10 @@ public:
     void OnSignal(Entity * param0)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         PushWeakObject(ctx, param0);
         duk_put_prop_index(ctx, -2, 0);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -67,6 +61,7 @@ static duk_ret_t SignalWrapper_UrhoRenderer_MainCameraChanged_Finalizer(duk_cont
 
 static duk_ret_t SignalWrapper_UrhoRenderer_MainCameraChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_UrhoRenderer_MainCameraChanged* wrapper = GetThisValueObject<SignalWrapper_UrhoRenderer_MainCameraChanged>(ctx, SignalWrapper_UrhoRenderer_MainCameraChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -84,6 +79,7 @@ static duk_ret_t SignalWrapper_UrhoRenderer_MainCameraChanged_Connect(duk_contex
 
 static duk_ret_t SignalWrapper_UrhoRenderer_MainCameraChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_UrhoRenderer_MainCameraChanged* wrapper = GetThisValueObject<SignalWrapper_UrhoRenderer_MainCameraChanged>(ctx, SignalWrapper_UrhoRenderer_MainCameraChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -92,6 +88,7 @@ static duk_ret_t SignalWrapper_UrhoRenderer_MainCameraChanged_Disconnect(duk_con
 
 static duk_ret_t SignalWrapper_UrhoRenderer_MainCameraChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_UrhoRenderer_MainCameraChanged* wrapper = GetThisValueObject<SignalWrapper_UrhoRenderer_MainCameraChanged>(ctx, SignalWrapper_UrhoRenderer_MainCameraChanged_ID);
     if (!wrapper->owner_) return 0;
     Entity* param0 = GetWeakObject<Entity>(ctx, 0);
@@ -102,7 +99,8 @@ static duk_ret_t SignalWrapper_UrhoRenderer_MainCameraChanged_Emit(duk_context*
 static duk_ret_t UrhoRenderer_Get_MainCameraChanged(duk_context* ctx)
 {
     UrhoRenderer* thisObj = GetThisWeakObject<UrhoRenderer>(ctx);
-    SignalWrapper_UrhoRenderer_MainCameraChanged* wrapper = new SignalWrapper_UrhoRenderer_MainCameraChanged(thisObj, &thisObj->MainCameraChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalMainCameraChanged")) return 1;
+    SignalWrapper_UrhoRenderer_MainCameraChanged* wrapper = new (ctx) SignalWrapper_UrhoRenderer_MainCameraChanged(thisObj, &thisObj->MainCameraChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_UrhoRenderer_MainCameraChanged_ID, SignalWrapper_UrhoRenderer_MainCameraChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_UrhoRenderer_MainCameraChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -112,8 +110,15 @@ static duk_ret_t UrhoRenderer_Get_MainCameraChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_UrhoRenderer_MainCameraChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_UrhoRenderer_MainCameraChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_UrhoRenderer_MainCameraChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_UrhoRenderer_MainCameraChanged_Emit, 1);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalMainCameraChanged");
     return 1;
 }
 
@@ -52,18 +52,12 @@ public:
     void OnSignal(const String & param0, const String & param1)
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
         duk_push_string(ctx, param0.CString());
         duk_put_prop_index(ctx, -2, 0);
         duk_push_string(ctx, param1.CString());
         duk_put_prop_index(ctx, -2, 1);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -75,6 +69,7 @@ static duk_ret_t SignalWrapper_WaterPlane_ComponentNameChanged_Finalizer(duk_con
 
 static duk_ret_t SignalWrapper_WaterPlane_ComponentNameChanged_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_WaterPlane_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_WaterPlane_ComponentNameChanged>(ctx, SignalWrapper_WaterPlane_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -92,6 +87,7 @@ static duk_ret_t SignalWrapper_WaterPlane_ComponentNameChanged_Connect(duk_conte
 
 static duk_ret_t SignalWrapper_WaterPlane_ComponentNameChanged_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_WaterPlane_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_WaterPlane_ComponentNameChanged>(ctx, SignalWrapper_WaterPlane_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -100,6 +96,7 @@ static duk_ret_t SignalWrapper_WaterPlane_ComponentNameChanged_Disconnect(duk_co
 
 static duk_ret_t SignalWrapper_WaterPlane_ComponentNameChanged_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_WaterPlane_ComponentNameChanged* wrapper = GetThisValueObject<SignalWrapper_WaterPlane_ComponentNameChanged>(ctx, SignalWrapper_WaterPlane_ComponentNameChanged_ID);
     if (!wrapper->owner_) return 0;
     String param0 = duk_require_string(ctx, 0);
@@ -111,7 +108,8 @@ static duk_ret_t SignalWrapper_WaterPlane_ComponentNameChanged_Emit(duk_context*
 static duk_ret_t WaterPlane_Get_ComponentNameChanged(duk_context* ctx)
 {
     WaterPlane* thisObj = GetThisWeakObject<WaterPlane>(ctx);
-    SignalWrapper_WaterPlane_ComponentNameChanged* wrapper = new SignalWrapper_WaterPlane_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalComponentNameChanged")) return 1;
+    SignalWrapper_WaterPlane_ComponentNameChanged* wrapper = new (ctx) SignalWrapper_WaterPlane_ComponentNameChanged(thisObj, &thisObj->ComponentNameChanged);
     PushValueObject(ctx, wrapper, SignalWrapper_WaterPlane_ComponentNameChanged_ID, SignalWrapper_WaterPlane_ComponentNameChanged_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_WaterPlane_ComponentNameChanged_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -121,8 +119,15 @@ static duk_ret_t WaterPlane_Get_ComponentNameChanged(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_WaterPlane_ComponentNameChanged_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_WaterPlane_ComponentNameChanged_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_WaterPlane_ComponentNameChanged_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_WaterPlane_ComponentNameChanged_Emit, 2);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalComponentNameChanged");
     return 1;
 }
 
@@ -147,14 +152,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -166,6 +165,7 @@ static duk_ret_t SignalWrapper_WaterPlane_ParentEntitySet_Finalizer(duk_context*
 
 static duk_ret_t SignalWrapper_WaterPlane_ParentEntitySet_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_WaterPlane_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_WaterPlane_ParentEntitySet>(ctx, SignalWrapper_WaterPlane_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -183,6 +183,7 @@ static duk_ret_t SignalWrapper_WaterPlane_ParentEntitySet_Connect(duk_context* c
 
 static duk_ret_t SignalWrapper_WaterPlane_ParentEntitySet_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_WaterPlane_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_WaterPlane_ParentEntitySet>(ctx, SignalWrapper_WaterPlane_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -191,6 +192,7 @@ static duk_ret_t SignalWrapper_WaterPlane_ParentEntitySet_Disconnect(duk_context
 
 static duk_ret_t SignalWrapper_WaterPlane_ParentEntitySet_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_WaterPlane_ParentEntitySet* wrapper = GetThisValueObject<SignalWrapper_WaterPlane_ParentEntitySet>(ctx, SignalWrapper_WaterPlane_ParentEntitySet_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -200,7 +202,8 @@ static duk_ret_t SignalWrapper_WaterPlane_ParentEntitySet_Emit(duk_context* ctx)
 static duk_ret_t WaterPlane_Get_ParentEntitySet(duk_context* ctx)
 {
     WaterPlane* thisObj = GetThisWeakObject<WaterPlane>(ctx);
-    SignalWrapper_WaterPlane_ParentEntitySet* wrapper = new SignalWrapper_WaterPlane_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntitySet")) return 1;
+    SignalWrapper_WaterPlane_ParentEntitySet* wrapper = new (ctx) SignalWrapper_WaterPlane_ParentEntitySet(thisObj, &thisObj->ParentEntitySet);
     PushValueObject(ctx, wrapper, SignalWrapper_WaterPlane_ParentEntitySet_ID, SignalWrapper_WaterPlane_ParentEntitySet_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_WaterPlane_ParentEntitySet_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -210,8 +213,15 @@ static duk_ret_t WaterPlane_Get_ParentEntitySet(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_WaterPlane_ParentEntitySet_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_WaterPlane_ParentEntitySet_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_WaterPlane_ParentEntitySet_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_WaterPlane_ParentEntitySet_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntitySet");
     return 1;
 }
 
@@ -236,14 +246,8 @@ public:
     void OnSignal()
     {
         duk_context* ctx = ctx_;
-        duk_push_global_object(ctx);
-        duk_get_prop_string(ctx, -1, "_OnSignal");
-        duk_remove(ctx, -2);
-        duk_push_number(ctx, (size_t)key_);
         duk_push_array(ctx);
-        bool success = duk_pcall(ctx, 2) == 0;
-        if (!success) LogError("[JavaScript] OnSignal: " + GetErrorString(ctx));
-        duk_pop(ctx);
+        DispatchSignal(this);
     }
 };
 
@@ -255,6 +259,7 @@ static duk_ret_t SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Finalize
 
 static duk_ret_t SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Connect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     HashMap<void*, SharedPtr<SignalReceiver> >& signalReceivers = JavaScriptInstance::InstanceFromContext(ctx)->SignalReceivers();
@@ -272,6 +277,7 @@ static duk_ret_t SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Connect(
 
 static duk_ret_t SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Disconnect(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     CallDisconnectSignal(ctx, wrapper->signal_);
@@ -280,6 +286,7 @@ static duk_ret_t SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Disconne
 
 static duk_ret_t SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Emit(duk_context* ctx)
 {
+    RequireMainThread(ctx);
     SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached* wrapper = GetThisValueObject<SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached>(ctx, SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_ID);
     if (!wrapper->owner_) return 0;
     wrapper->signal_->Emit();
@@ -289,7 +296,8 @@ static duk_ret_t SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Emit(duk
 static duk_ret_t WaterPlane_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
 {
     WaterPlane* thisObj = GetThisWeakObject<WaterPlane>(ctx);
-    SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached* wrapper = new SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
+    if (PushCachedSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached")) return 1;
+    SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached* wrapper = new (ctx) SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached(thisObj, &thisObj->ParentEntityAboutToBeDetached);
     PushValueObject(ctx, wrapper, SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_ID, SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Finalizer, false);
     duk_push_c_function(ctx, SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "Connect");
@@ -299,8 +307,15 @@ static duk_ret_t WaterPlane_Get_ParentEntityAboutToBeDetached(duk_context* ctx)
     duk_put_prop_string(ctx, -2, "Disconnect");
     duk_push_c_function(ctx, SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
     duk_put_prop_string(ctx, -2, "disconnect");
+    duk_push_c_function(ctx, SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Connect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "ConnectBatched");
+    duk_push_c_function(ctx, SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Disconnect, DUK_VARARGS);
+    duk_set_magic(ctx, -1, 1);
+    duk_put_prop_string(ctx, -2, "DisconnectBatched");
     duk_push_c_function(ctx, SignalWrapper_WaterPlane_ParentEntityAboutToBeDetached_Emit, 0);
     duk_put_prop_string(ctx, -2, "Emit");
+    CacheSignalWrapper(ctx, "\xff""signalParentEntityAboutToBeDetached");
     return 1;
 }
 
@@ -0,0 +1,170 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "WebSocketCompression.h"
+#include "LoggingFunctions.h"
+
+#include <Urho3D/Math/MathDefs.h>
+
+#include <zlib.h>
+
+namespace WebSocket
+{
+
+namespace
+{
+    /// Deflate window size, matching the permessage-deflate default.
+    const int cWindowBits = 15;
+
+    /// Output is grown in steps of this size.
+    const size_t cOutputChunk = 16 * 1024;
+
+    /// Dictionary contents. The most common strings are at the end, closest to the data.
+    const char *cDictionaryParts[] =
+    {
+        // Attribute type names
+        "Point", "Variant", "VariantList", "EntityReference", "AssetReferenceList", "Quat", "uint", "float4", "float2",
+        "Color", "bool", "int", "float3", "real", "string", "AssetReference", "Transform",
+        // Component type names and common attribute names
+        "PhysicsConstraint", "PhysicsMotor", "VolumeTrigger", "WaterPlane", "Terrain", "Sky", "Fog", "EnvironmentLight",
+        "Light", "Camera", "ParticleSystem", "AnimationController", "Avatar", "DynamicComponent", "Script",
+        "RigidBody", "Mesh", "Name", "Placeable",
+        "runOnLoad", "runMode", "applicationName", "className", "scriptRef", "materialRefs", "skeletonRef", "meshRef",
+        "collisionMeshRef", "shapeType", "mass", "linearVelocity", "angularVelocity", "visible", "parentRef", "transform",
+        "description", "name",
+        // Login JSON
+        "{\"username\":\"", "\"password\":\"", "\"protocol\":",
+        // Asset references
+        ".png", ".jpg", ".dds", ".crn", ".ogg", ".wav", ".json", ".xml", ".particle", ".skeleton", ".material",
+        ".mesh", ".js", ".txml", "https://", "http://", "local://"
+    };
+}
+
+const std::string &CompressionDictionary()
+{
+    static std::string dictionary;
+    if (dictionary.empty())
+    {
+        for (size_t i = 0; i < sizeof(cDictionaryParts) / sizeof(cDictionaryParts[0]); ++i)
+            dictionary.append(cDictionaryParts[i]);
+    }
+    return dictionary;
+}
+
+// Deflater
+
+Deflater::Deflater(int level, bool useDictionary) :
+    stream_(new z_stream())
+{
+    // Negative window bits produce a raw deflate stream without zlib header and checksum, like permessage-deflate.
+    if (deflateInit2(stream_, Urho3D::Clamp(level, 1, 9), Z_DEFLATED, -cWindowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        Tundra::LogError("[WebSocketServer]: Failed to initialize deflate stream");
+        delete stream_;
+        stream_ = 0;
+        return;
+    }
+    if (useDictionary)
+    {
+        const std::string &dictionary = CompressionDictionary();
+        deflateSetDictionary(stream_, reinterpret_cast<const Bytef*>(dictionary.data()), static_cast<uInt>(dictionary.size()));
+    }
+}
+
+Deflater::~Deflater()
+{
+    if (stream_)
+    {
+        deflateEnd(stream_);
+        delete stream_;
+    }
+}
+
+bool Deflater::Compress(const char *data, size_t numBytes, std::string &dest)
+{
+    if (!stream_)
+        return false;
+
+    stream_->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream_->avail_in = static_cast<uInt>(numBytes);
+
+    // Write straight to the destination, growing it until the flush completes.
+    size_t written = dest.size();
+    dest.resize(written + deflateBound(stream_, static_cast<uLong>(numBytes)) + 8);
+    for (;;)
+    {
+        stream_->next_out = reinterpret_cast<Bytef*>(&dest[written]);
+        stream_->avail_out = static_cast<uInt>(dest.size() - written);
+        int ret = deflate(stream_, Z_SYNC_FLUSH);
+        written = dest.size() - stream_->avail_out;
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+        {
+            dest.resize(written);
+            return false;
+        }
+        if (stream_->avail_out > 0)
+            break;
+        dest.resize(dest.size() + cOutputChunk);
+    }
+    dest.resize(written);
+    return true;
+}
+
+// Inflater
+
+Inflater::Inflater(bool useDictionary) :
+    stream_(new z_stream())
+{
+    if (inflateInit2(stream_, -cWindowBits) != Z_OK)
+    {
+        Tundra::LogError("[WebSocketServer]: Failed to initialize inflate stream");
+        delete stream_;
+        stream_ = 0;
+        return;
+    }
+    // A raw inflate stream takes the dictionary right away instead of asking for it.
+    if (useDictionary)
+    {
+        const std::string &dictionary = CompressionDictionary();
+        inflateSetDictionary(stream_, reinterpret_cast<const Bytef*>(dictionary.data()), static_cast<uInt>(dictionary.size()));
+    }
+}
+
+Inflater::~Inflater()
+{
+    if (stream_)
+    {
+        inflateEnd(stream_);
+        delete stream_;
+    }
+}
+
+bool Inflater::Decompress(const char *data, size_t numBytes, std::string &dest)
+{
+    if (!stream_)
+        return false;
+
+    stream_->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream_->avail_in = static_cast<uInt>(numBytes);
+
+    size_t written = dest.size();
+    for (;;)
+    {
+        dest.resize(written + Urho3D::Max(numBytes * 4, cOutputChunk));
+        stream_->next_out = reinterpret_cast<Bytef*>(&dest[written]);
+        stream_->avail_out = static_cast<uInt>(dest.size() - written);
+        int ret = inflate(stream_, Z_SYNC_FLUSH);
+        written = dest.size() - stream_->avail_out;
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+        {
+            dest.resize(written);
+            return false;
+        }
+        // Done once all input is consumed and the output buffer was not filled up.
+        if (stream_->avail_in == 0 && stream_->avail_out > 0)
+            break;
+    }
+    dest.resize(written);
+    return true;
+}
+
+}
@@ -0,0 +1,65 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#pragma once
+
+#include "WebSocketServerApi.h"
+#include "CoreTypes.h"
+
+#include <string>
+
+struct z_stream_s;
+
+namespace WebSocket
+{
+    /// Returns the Tundra preset dictionary for compressing sync streams.
+    /** The dictionary contains the strings that are common in Tundra sync messages: component and attribute type names,
+        asset reference schemes and extensions, and login JSON keys. The web client has to use the exact same dictionary,
+        add a new FrameEncoding if the contents are changed. */
+    WEBSOCKETSERVER_API const std::string &CompressionDictionary();
+
+    /// Encoding of a batched frame, sent as its first byte to clients with ProtocolWebSocketCompression or newer.
+    enum FrameEncoding
+    {
+        FrameRaw = 0,       ///< Uncompressed messages.
+        FrameDeflate = 1    ///< Messages compressed by the Deflater of the connection, with CompressionDictionary().
+    };
+
+    /// Compresses a stream of messages with raw deflate.
+    /** The same deflate stream is used for all data, so later frames can refer to earlier ones. Each Compress() call
+        ends with a sync flush, after which the output so far can be inflated by the peer. */
+    class WEBSOCKETSERVER_API Deflater
+    {
+    public:
+        /// @param level zlib compression level, 1 (fastest) to 9 (smallest).
+        /// @param useDictionary If true the stream is primed with CompressionDictionary().
+        explicit Deflater(int level, bool useDictionary = true);
+        ~Deflater();
+
+        /// Returns if the stream was initialized successfully.
+        bool IsValid() const { return stream_ != 0; }
+
+        /// Compresses @c numBytes of @c data and appends the result to @c dest.
+        bool Compress(const char *data, size_t numBytes, std::string &dest);
+
+    private:
+        z_stream_s *stream_;
+    };
+
+    /// Decompresses a stream produced by Deflater.
+    class WEBSOCKETSERVER_API Inflater
+    {
+    public:
+        /// @param useDictionary Must match the Deflater setting.
+        explicit Inflater(bool useDictionary = true);
+        ~Inflater();
+
+        /// Returns if the stream was initialized successfully.
+        bool IsValid() const { return stream_ != 0; }
+
+        /// Decompresses @c numBytes of @c data and appends the result to @c dest.
+        bool Decompress(const char *data, size_t numBytes, std::string &dest);
+
+    private:
+        z_stream_s *stream_;
+    };
+}
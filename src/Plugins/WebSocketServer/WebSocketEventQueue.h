@@ -0,0 +1,149 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#pragma once
+
+#include "CoreTypes.h"
+
+#include <Urho3D/Core/Mutex.h>
+
+#include <atomic>
+#include <utility>
+
+namespace WebSocket
+{
+    /// Multi-producer/single-consumer lock-free queue of pooled items.
+    /** Items are preallocated to a ring and reused. Push() and Pop() swap the contents of the given item
+        with a ring slot, so ownership of anything the item holds is transferred without copying it.
+        Push() may be called from any number of threads and Pop() from one other thread.
+
+        A producer reserves a slot by advancing the tail with a compare-and-swap, and publishes it by
+        writing the sequence number of the slot. Items are popped in the order their slots were reserved,
+        so the items pushed one after another by a thread, or by an asio strand moving between threads,
+        keep their order.
+
+        If the ring is full the producers fall back to an overflow list protected by a mutex, and keep
+        using it until the consumer has drained it. The consumer moves on to the overflow only after every
+        reserved slot has been popped. This keeps the order of the items intact without ever blocking the
+        producers on the consumer. */
+    template <typename T>
+    class EventQueue
+    {
+    public:
+        /// @param capacity Size of the ring, rounded up to a power of two.
+        explicit EventQueue(Tundra::uint capacity = 4096) :
+            head_(0),
+            tail_(0),
+            overflowing_(false),
+            overflowRead_(0)
+        {
+            Tundra::uint size = 2;
+            while (size < capacity)
+                size <<= 1;
+            slots_ = new Slot[size];
+            for (Tundra::uint i = 0; i < size; ++i)
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+            mask_ = size - 1;
+        }
+
+        ~EventQueue()
+        {
+            delete[] slots_;
+        }
+
+        /// Moves @c item to the back of the queue. @c item is left holding a reset slot. Called by the producer threads.
+        void Push(T &item)
+        {
+            if (!overflowing_.load(std::memory_order_acquire))
+            {
+                Tundra::uint tail = tail_.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    Slot &slot = slots_[tail & mask_];
+                    const int diff = static_cast<int>(slot.sequence.load(std::memory_order_acquire) - tail);
+                    if (diff == 0)
+                    {
+                        // The slot has been popped, reserve it unless another producer got it first
+                        if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+                        {
+                            std::swap(slot.item, item);
+                            slot.sequence.store(tail + 1, std::memory_order_release);
+                            return;
+                        }
+                    }
+                    else if (diff < 0)
+                        break; // The ring is full
+                    else
+                        tail = tail_.load(std::memory_order_relaxed);
+                }
+            }
+
+            Urho3D::MutexLock lock(mutexOverflow_);
+            overflow_.Resize(overflow_.Size() + 1);
+            std::swap(overflow_.Back(), item);
+            overflowing_.store(true, std::memory_order_release);
+        }
+
+        /// Moves the front of the queue to @c item. Returns false if the queue is empty. Called by the consumer thread.
+        /** The previous contents of @c item are handed back to the pool, reset @c item before if they should be released.
+            Returns false also while the front slot has been reserved but not yet published by its producer. */
+        bool Pop(T &item)
+        {
+            Slot &slot = slots_[head_ & mask_];
+            if (slot.sequence.load(std::memory_order_acquire) == head_ + 1)
+            {
+                std::swap(slot.item, item);
+                slot.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+                ++head_;
+                return true;
+            }
+            if (!overflowing_.load(std::memory_order_acquire))
+                return false;
+
+            // Everything in the ring was reserved before the overflowed items. The tail is read under the lock,
+            // so that it includes the slots reserved before the last item was added to the overflow.
+            Urho3D::MutexLock lock(mutexOverflow_);
+            if (tail_.load(std::memory_order_relaxed) != head_ || overflowRead_ >= overflow_.Size())
+                return false;
+            std::swap(overflow_[overflowRead_++], item);
+            if (overflowRead_ == overflow_.Size())
+            {
+                overflow_.Clear();
+                overflowRead_ = 0;
+                overflowing_.store(false, std::memory_order_release);
+            }
+            return true;
+        }
+
+        /// Returns the number of ring slots.
+        Tundra::uint Capacity() const { return mask_ + 1; }
+
+    private:
+        /// Ring slot. Its sequence number equals the tail position that may reserve it when free,
+        /// and the position plus one once the item has been published.
+        struct Slot
+        {
+            Slot() : sequence(0) {}
+
+            T item;
+            std::atomic<Tundra::uint> sequence;
+        };
+
+        /// Not copyable.
+        EventQueue(const EventQueue &);
+        EventQueue &operator =(const EventQueue &);
+
+        Slot *slots_;
+        Tundra::uint mask_;
+
+        /// Next slot to pop, only accessed by the consumer.
+        Tundra::uint head_;
+        /// Next slot to reserve, advanced by the producers.
+        std::atomic<Tundra::uint> tail_;
+
+        /// Set by a producer when the ring was full and cleared by the consumer once the overflow has been drained.
+        std::atomic<bool> overflowing_;
+        Urho3D::Mutex mutexOverflow_;
+        Tundra::Vector<T> overflow_;
+        Tundra::uint overflowRead_;
+    };
+}
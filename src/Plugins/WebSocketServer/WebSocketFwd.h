@@ -6,6 +6,11 @@
 
 class WebSocketServerModule;
 
+namespace Urho3D
+{
+    class File;
+}
+
 namespace WebSocket
 {
     class Server;
@@ -4,6 +4,7 @@
 #include "WebSocketUserConnection.h"
 #include "TundraLogic.h"
 #include "Framework.h"
+#include "FrameAPI.h"
 #include "CoreDefines.h"
 #include "CoreStringUtils.h"
 #include "LoggingFunctions.h"
@@ -29,12 +30,17 @@
 #include <utime.h>
 #endif
 
+#include <Urho3D/Core/Profiler.h>
+#include <Urho3D/IO/File.h>
 #include <Urho3D/Core/StringUtils.h>
 
 #ifdef _MSC_VER
 #define strcasecmp _stricmp
 #endif
 
+#define WEBSOCKET_SERVER_DEFAULT_THREADS 2
+#define WEBSOCKET_SERVER_DEFAULT_SEND_QUEUE_LIMIT (512 * 1024)
+
 using namespace Tundra;
 
 namespace WebSocket
@@ -47,21 +53,25 @@ void ServerThread::ThreadFunction()
     if (!server_)
         return;
     
-    try
-    {
-        server_->run();
-    } 
-    catch (const std::exception & e) 
-    {
-        LogError("Exception while running websocket server: " + String(e.what()));
-    } 
-    catch (websocketpp::lib::error_code e) 
-    {
-        LogError("Exception while running websocket server: " + String(e.message().c_str()));
-    } 
-    catch (...) 
+    // Keep running if a handler throws, run() only returns for good once the server is stopped.
+    while (shouldRun_ && !server_->stopped())
     {
-        LogError("Exception while running websocket server: other exception");
+        try
+        {
+            server_->run();
+        } 
+        catch (const std::exception & e) 
+        {
+            LogError("Exception while running websocket server: " + String(e.what()));
+        } 
+        catch (websocketpp::lib::error_code e) 
+        {
+            LogError("Exception while running websocket server: " + String(e.message().c_str()));
+        } 
+        catch (...) 
+        {
+            LogError("Exception while running websocket server: other exception");
+        }
     }
 }
 
@@ -71,7 +81,10 @@ Server::Server(Framework *framework) :
     Object(framework->GetContext()),
     LC("[WebSocketServer]: "),
     framework_(framework),
-    port_(2345)
+    port_(2345),
+    numThreads_(WEBSOCKET_SERVER_DEFAULT_THREADS),
+    sendQueueLimit_(WEBSOCKET_SERVER_DEFAULT_SEND_QUEUE_LIMIT),
+    compressionLevel_(0)
 {
     // Port
     StringList portParam = framework->CommandLineParameters("--port");
@@ -84,13 +97,64 @@ Server::Server(Framework *framework) :
             LogWarning(LC + "Failed to parse int from --port, using default port 2345.");
         }
     }
+
+    // I/O threads
+    StringList threadsParam = framework->CommandLineParameters("--wsThreads");
+    if (!threadsParam.Empty())
+    {
+        numThreads_ = ToUInt(threadsParam.Front());
+        if (!numThreads_)
+        {
+            numThreads_ = WEBSOCKET_SERVER_DEFAULT_THREADS;
+            LogWarning(LC + "Failed to parse int from --wsThreads, using " + String(numThreads_) + " threads.");
+        }
+    }
+
+    // Per connection send queue limit
+    StringList sendQueueParam = framework->CommandLineParameters("--wsSendQueueLimit");
+    if (!sendQueueParam.Empty())
+    {
+        sendQueueLimit_ = ToUInt(sendQueueParam.Front());
+        if (!sendQueueLimit_)
+        {
+            sendQueueLimit_ = WEBSOCKET_SERVER_DEFAULT_SEND_QUEUE_LIMIT;
+            LogWarning(LC + "Failed to parse int from --wsSendQueueLimit, using " + String(static_cast<uint>(sendQueueLimit_)) + " bytes.");
+        }
+    }
+
+    // Compression of batched frames
+    StringList compressionParam = framework->CommandLineParameters("--wsCompressionLevel");
+    if (!compressionParam.Empty())
+    {
+        compressionLevel_ = ToInt(compressionParam.Front());
+        if (compressionLevel_ < 0 || compressionLevel_ > 9)
+        {
+            compressionLevel_ = 0;
+            LogWarning(LC + "--wsCompressionLevel must be between 0 and 9, compression disabled.");
+        }
+    }
+
+    // Flush batched messages after all modules and scripts have updated
+    framework_->Frame()->PostFrameUpdate.Connect(this, &Server::OnPostFrameUpdate);
 }
 
 Server::~Server()
 {
+    framework_->Frame()->PostFrameUpdate.Disconnect(this, &Server::OnPostFrameUpdate);
     Reset();
 }
 
+void Server::OnPostFrameUpdate(float /*frametime*/)
+{
+    URHO3D_PROFILE(WebSocketServer_FlushBatches);
+
+    for (UserConnectionList::Iterator iter = connections_.Begin(); iter != connections_.End(); ++iter)
+    {
+        if (*iter)
+            (*iter)->FlushBatch();
+    }
+}
+
 void Server::Update(float frametime)
 {
     TundraLogic* tundraLogic = framework_->Module<TundraLogic>();
@@ -124,31 +188,22 @@ void Server::Update(float frametime)
         }
     }
     
-    Vector<SocketEvent*> processEvents;
-    {
-        Urho3D::MutexLock lockEvents(mutexEvents_);
-        if (events_.Size() == 0)
-            return;
-        // Make copy of current event queue for processing
-        processEvents = events_;
-        events_.Clear();
-    }
-
     Vector<UserConnectionPtr> toDisconnect;
 
-    // Process events pushed from the websocket thread(s)
-    for (uint i=0; i < processEvents.Size(); ++i)
+    // Process events pushed from the websocket thread. Events are in the order they happened,
+    // data received before a disconnect is processed before the connection is removed.
+    SocketEvent event;
+    while (events_.Pop(event))
     {
-        SocketEvent *event = processEvents[i];
-        if (!event)
-            continue;
-
         // User connected
-        if (event->type == SocketEvent::Connected)
+        if (event.type == SocketEvent::Connected)
         {
-            if (!UserConnection(event->connection))
+            if (!UserConnection(event.connection))
             {
-                WebSocket::UserConnectionPtr userConnection(new WebSocket::UserConnection(context_, event->connection));
+                WebSocket::UserConnectionPtr userConnection(new WebSocket::UserConnection(context_, event.connection));
+                userConnection->SetSendQueueLimit(sendQueueLimit_);
+                userConnection->SetCompressionLevel(compressionLevel_);
+                userConnection->SetRecordFile(recordFile_);
                 connections_.Push(userConnection);
 
                 // The connection does not yet have an ID assigned. Tundra server will assign on login
@@ -156,11 +211,11 @@ void Server::Update(float frametime)
             }
         }
         // User disconnected
-        else if (event->type == SocketEvent::Disconnected)
+        else if (event.type == SocketEvent::Disconnected)
         {
             for(UserConnectionList::Iterator iter = connections_.Begin(); iter != connections_.End(); ++iter)
             {
-                if ((*iter) && (*iter)->WebSocketConnection() == event->connection)
+                if ((*iter) && (*iter)->WebSocketConnection() == event.connection)
                 {
                     tundraServer->RemoveExternalUser(Urho3D::StaticCast<::UserConnection>(*iter));
                     if (!(*iter)->userID)
@@ -173,12 +228,17 @@ void Server::Update(float frametime)
             }
         }
         // Data message
-        else if (event->type == SocketEvent::Data && event->data.get())
+        else if (event.type == SocketEvent::Data && event.message)
         {
-            WebSocket::UserConnectionPtr userConnection = UserConnection(event->connection);
+            WebSocket::UserConnectionPtr userConnection = UserConnection(event.connection);
             if (userConnection)
             {
-                kNet::DataDeserializer dd(event->data->GetData(), event->data->BytesFilled());
+                // Read the payload in place from the received message
+                const std::string &payload = event.message->get_payload();
+                const char *data = payload.data();
+                const size_t numBytes = payload.size();
+
+                kNet::DataDeserializer dd(data, numBytes);
                 u16 messageId = dd.Read<u16>();
 
                 // LoginMessage
@@ -214,21 +274,18 @@ void Server::Update(float frametime)
                     if (userConnection->properties["authenticated"].GetBool() == true)
                     {
                         // Signal network message. As per kNet tradition the message ID is given separately in addition with the rest of the data
-                        NetworkMessageReceived.Emit(userConnection.Get(), messageId, event->data->GetData() + sizeof(u16), event->data->BytesFilled() - sizeof(u16));
+                        NetworkMessageReceived.Emit(userConnection.Get(), messageId, data + sizeof(u16), numBytes - sizeof(u16));
                         // Signal network message on the Tundra server so that it can be globally picked up
-                        tundraServer->EmitNetworkMessageReceived(userConnection.Get(), 0, messageId, event->data->GetData() + sizeof(u16), event->data->BytesFilled() - sizeof(u16));
+                        tundraServer->EmitNetworkMessageReceived(userConnection.Get(), 0, messageId, data + sizeof(u16), numBytes - sizeof(u16));
                     }
                 }
             }
             else
                 LogError(LC + "Received message from unauthorized connection, ignoring.");
-
-            event->data.reset();
         }
-        else
-            event->data.reset();
-        
-        SAFE_DELETE(event);
+
+        // Release the message, the slot is handed back to the queue on the next pop
+        event.Reset();
     }
 
     for (uint i = 0; i < toDisconnect.Size(); ++i)
@@ -286,9 +343,35 @@ bool Server::Start()
         // Start the server accept loop
         server_->start_accept();
 
-        // Start the server polling thread
-        thread_.server_ = server_;
-        thread_.Run();
+        StringList recordParam = framework_->CommandLineParameters("--wsRecordSyncStream");
+        if (!recordParam.Empty())
+        {
+            recordFile_ = new Urho3D::File(context_, recordParam.Front(), Urho3D::FILE_WRITE);
+            if (!recordFile_->IsOpen())
+            {
+                LogError(LC + "Failed to open " + recordParam.Front() + " for recording the sync stream.");
+                recordFile_.Reset();
+            }
+        }
+
+        // Start the I/O threads
+        for (uint i = 0; i < numThreads_; ++i)
+        {
+            ServerThread *thread = new ServerThread();
+            thread->server_ = server_;
+            if (thread->Run())
+                threads_.Push(thread);
+            else
+            {
+                LogError(LC + "Failed to start WebSocket server thread");
+                delete thread;
+            }
+        }
+        if (threads_.Empty())
+        {
+            server_->stop();
+            return false;
+        }
 
     } 
     catch (std::exception &e) 
@@ -297,7 +380,7 @@ bool Server::Start()
         return false;
     }
     
-    LogInfo(LC + "WebSocket server started to port " + String(port_));
+    LogInfo(LC + "WebSocket server started to port " + String(port_) + " with " + String(threads_.Size()) + " I/O threads");
 
     ServerStarted.Emit();
     
@@ -311,7 +394,12 @@ void Server::Stop()
         if (server_)
         {
             server_->stop();
-            thread_.Stop();
+            for (uint i = 0; i < threads_.Size(); ++i)
+            {
+                threads_[i]->Stop();
+                delete threads_[i];
+            }
+            threads_.Clear();
             ServerStopped.Emit();
         }
     }
@@ -328,70 +416,36 @@ void Server::Stop()
 
 void Server::Reset()
 {
+    // Release events that were not processed. The server thread is not running at this point.
+    SocketEvent event;
+    while (events_.Pop(event))
+        event.Reset();
+
     connections_.Clear();
+    recordFile_.Reset();
 
     server_.reset();
 }
 
-void Server::OnConnected(ConnectionHandle connection)
+void Server::PushEvent(SocketEvent &event)
 {
-    Urho3D::MutexLock lock(mutexEvents_);
-
-    ConnectionPtr connectionPtr = server_->get_con_from_hdl(connection);
-
-    // Find existing events and remove them if we got duplicates 
-    // that were not synced to main thread yet.
-    Vector<SocketEvent*> removeItems;
-    for (uint i = 0; i < events_.Size(); ++i)
-    {
-        // Remove any and all messages from this connection, 
-        // if there are any data messages for this connection.
-        // Which is not possible in theory.
-        SocketEvent *existing = events_[i];
-        if (existing->connection == connectionPtr)
-            removeItems.Push(existing);
-    }
-    if (!removeItems.Empty())
-    {
-        for (uint i = 0; i < removeItems.Size(); ++i)
-            events_.Remove(removeItems[i]);
-    }
+    events_.Push(event);
+}
 
-    events_.Push(new SocketEvent(connectionPtr, SocketEvent::Connected));
+void Server::OnConnected(ConnectionHandle connection)
+{
+    SocketEvent event(server_->get_con_from_hdl(connection), SocketEvent::Connected);
+    PushEvent(event);
 }
 
 void Server::OnDisconnected(ConnectionHandle connection)
 {
-    Urho3D::MutexLock lock(mutexEvents_);
-
-    ConnectionPtr connectionPtr = server_->get_con_from_hdl(connection);
-
-    // Find existing events and remove them if we got duplicates 
-    // that were not synced to main thread yet.
-    Vector<SocketEvent*> removeItems;
-    for (uint i = 0; i < events_.Size(); ++i)
-    {
-        // Remove any and all messages from this connection,
-        // as it's disconnecting
-        SocketEvent *existing = events_[i];
-        if (existing->connection == connectionPtr)
-            removeItems.Push(existing);
-    }
-    if (!removeItems.Empty())
-    {
-        for (uint i = 0; i < removeItems.Size(); ++i)
-            events_.Remove(removeItems[i]);
-    }
-
-    events_.Push(new SocketEvent(connectionPtr, SocketEvent::Disconnected));
+    SocketEvent event(server_->get_con_from_hdl(connection), SocketEvent::Disconnected);
+    PushEvent(event);
 }
 
 void Server::OnMessage(ConnectionHandle connection, MessagePtr data)
 {   
-    Urho3D::MutexLock lock(mutexEvents_);
-
-    ConnectionPtr connectionPtr = server_->get_con_from_hdl(connection);
-
     if (data->get_opcode() == websocketpp::frame::opcode::TEXT)
     {
         String textMsg(data->get_payload().c_str());
@@ -405,11 +459,10 @@ void Server::OnMessage(ConnectionHandle connection, MessagePtr data)
             LogError("[WebSocketServer]: Received 0 sized payload, ignoring");
             return;
         }
-        SocketEvent *event = new SocketEvent(connectionPtr, SocketEvent::Data);
-        event->data = DataSerializerPtr(new kNet::DataSerializer(payload.size()));
-        event->data->AddAlignedByteArray(&payload[0], payload.size());
-
-        events_.Push(event);
+        // Hand the message over to the main thread as is, the payload is not copied
+        SocketEvent event(server_->get_con_from_hdl(connection), SocketEvent::Data);
+        event.message = data;
+        PushEvent(event);
     }
 }
 
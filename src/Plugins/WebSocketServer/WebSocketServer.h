@@ -8,6 +8,7 @@
 #include "CoreDefines.h"
 #include "FrameworkFwd.h"
 #include "WebSocketFwd.h"
+#include "WebSocketEventQueue.h"
 #include "kNetFwd.h"
 #include "AssetFwd.h"
 #include "AssetReference.h"
@@ -38,9 +39,9 @@ namespace WebSocket
     typedef boost::weak_ptr<websocketpp::server<websocketpp::config::asio>::connection_type> ConnectionWeakPtr;
     typedef websocketpp::connection_hdl ConnectionHandle;
     typedef websocketpp::server<websocketpp::config::asio>::message_ptr MessagePtr;
-    typedef boost::shared_ptr<kNet::DataSerializer> DataSerializerPtr;
     
-    // WebSocket events
+    /// WebSocket event
+    /** Data events hold the received message itself, its payload is read in place by the main thread. */
     struct SocketEvent
     {
         enum EventType
@@ -52,14 +53,17 @@ namespace WebSocket
         };
 
         WebSocket::ConnectionPtr connection;
-        DataSerializerPtr data;
+        WebSocket::MessagePtr message;
         EventType type;
 
         SocketEvent() : type(None) {}
         SocketEvent(WebSocket::ConnectionPtr connection_, EventType type_) : connection(connection_), type(type_) {}
+
+        /// Releases the connection and message.
+        void Reset() { connection.reset(); message.reset(); type = None; }
     };
 
-    /// Server run thread
+    /// Server I/O thread. The server runs a pool of these on the same asio io_service.
     class ServerThread : public Urho3D::Thread
     {
     public:
@@ -70,7 +74,19 @@ namespace WebSocket
 
     /// WebSocket server. 
     /** Manages user requestedConnections and receiving/sending out data with them.
-        All signals emitted by this object will be in the main thread. */
+        All signals emitted by this object will be in the main thread.
+
+        Socket I/O, TLS and framing are run by a pool of I/O threads, the size of which is set with the '--wsThreads'
+        command line parameter (default 2). websocketpp runs the handlers of each connection in its own asio strand,
+        so the events of a connection are never handled concurrently.
+
+        Each connection has a send queue limit, set in bytes with '--wsSendQueueLimit' (default 512 KiB). A connection
+        with more data queued than that reports UserConnection::IsSendQueueFull() and the SyncManager holds back scene
+        sync to it until it has caught up. A connection that reaches 8 times the limit is closed.
+
+        Batched frames to clients that support it are compressed with deflate and the Tundra preset dictionary when
+        '--wsCompressionLevel <1-9>' is given. '--wsRecordSyncStream <file>' records all batched frames uncompressed,
+        for replaying in the compression benchmark. */
     class WEBSOCKETSERVER_API Server : public Urho3D::Object
     {
         URHO3D_OBJECT(Server, Object);
@@ -115,6 +131,12 @@ namespace WebSocket
         void OnMessage(WebSocket::ConnectionHandle connection, WebSocket::MessagePtr data);
         void OnHttpRequest(WebSocket::ConnectionHandle connection);
         void OnSocketInit(WebSocket::ConnectionHandle connection, boost::asio::ip::tcp::socket& s);
+
+        /// Sends the messages batched to each connection during the frame.
+        void OnPostFrameUpdate(float frametime);
+
+        /// Pushes @c event to the main thread. Called by the I/O threads.
+        void PushEvent(SocketEvent &event);
         
     private:
         Tundra::String LC;
@@ -127,9 +149,15 @@ namespace WebSocket
         // Websocket connections. Once login is finalized, they are also added to TundraProtocolModule's connection list
         WebSocket::UserConnectionList connections_;
 
-        ServerThread thread_;
+        Tundra::Vector<ServerThread*> threads_;
+        Tundra::uint numThreads_;
+        size_t sendQueueLimit_;
+        int compressionLevel_;
+        Tundra::SharedPtr<Urho3D::File> recordFile_;
 
-        Urho3D::Mutex mutexEvents_;
-        Tundra::Vector<SocketEvent*> events_;
+        /// Events pushed by the I/O threads, consumed in Update.
+        /** The I/O threads push without locking each other out, and the events of a connection keep their order
+            as its strand runs its handlers one after another. */
+        EventQueue<SocketEvent> events_;
     };
 }
@@ -13,28 +13,221 @@
 
 #include <websocketpp/frame.hpp>
 
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
+#include <Urho3D/IO/File.h>
+#include <Urho3D/Math/MathDefs.h>
+
 namespace WebSocket
 {
 
 UserConnection::UserConnection(Urho3D::Context* context, ConnectionPtr connection_) :
     Tundra::UserConnection(context),
-    webSocketConnection(ConnectionWeakPtr(connection_))
+    webSocketConnection(ConnectionWeakPtr(connection_)),
+    sendQueueLimit_(0),
+    sendQueueOverflow_(false),
+    sendQueue_(boost::make_shared<SendQueueCounters>()),
+    compressionLevel_(0),
+    deflater_(0)
 {
 }
 
 UserConnection::~UserConnection()
 {
+    batch_.reset();
+    SAFE_DELETE(deflater_);
     webSocketConnection.reset();
     syncState.Reset();
 }
 
 void UserConnection::Send(kNet::message_id_t id, const char* data, size_t numBytes, bool reliable, bool inOrder, unsigned long priority, unsigned long contentID)
 {
-    kNet::DataSerializer ds(numBytes + 2);
-    ds.Add<u16>(id);
+    ConnectionPtr connection = webSocketConnection.lock();
+    if (!connection || !CheckSendQueue(connection))
+        return;
+
+    // The header is serialized on the stack and written to the frame buffer along with the data.
+    char header[6];
+    kNet::DataSerializer ds(header, sizeof(header));
+
+    if (protocolVersion >= Tundra::ProtocolWebSocketBatchedMessages)
+    {
+        ds.AddVLE<kNet::VLE8_16_32>(static_cast<u32>(numBytes));
+        ds.Add<u16>(static_cast<u16>(id));
+
+        const size_t entryBytes = ds.BytesFilled() + numBytes;
+        if (batch_ && batch_->get_payload().size() + entryBytes > cMaxBatchBytes)
+            FlushBatch();
+        if (!batch_)
+        {
+            batch_ = connection->get_message(websocketpp::frame::opcode::BINARY, Urho3D::Max(entryBytes + 1, static_cast<size_t>(1024)));
+            if (!batch_)
+                return;
+            if (protocolVersion >= Tundra::ProtocolWebSocketCompression)
+            {
+                // Encoding is decided on flush
+                const char encoding = FrameRaw;
+                batch_->append_payload(&encoding, 1);
+            }
+        }
+
+        batch_->append_payload(header, ds.BytesFilled());
+        if (numBytes)
+            batch_->append_payload(data, numBytes);
+        return;
+    }
+
+    ds.Add<u16>(static_cast<u16>(id));
+    MessagePtr message = connection->get_message(websocketpp::frame::opcode::BINARY, ds.BytesFilled() + numBytes);
+    if (!message)
+        return;
+    message->append_payload(header, ds.BytesFilled());
     if (numBytes)
-        ds.AddAlignedByteArray(data, numBytes);
-    Send(ds);
+        message->append_payload(data, numBytes);
+    PostSend(connection, message);
+}
+
+void UserConnection::FlushBatch()
+{
+    if (!batch_)
+    {
+        // Nothing is sent this frame, let the strand see how much of the queued data has been written meanwhile
+        ConnectionPtr connection = webSocketConnection.lock();
+        if (connection && sendQueue_->bufferedBytes > 0 && !sendQueue_->refreshPending.exchange(true))
+            PostSend(connection, MessagePtr());
+        return;
+    }
+
+    MessagePtr batch = batch_;
+    batch_.reset();
+
+    ConnectionPtr connection = webSocketConnection.lock();
+    if (!connection || !CheckSendQueue(connection))
+        return;
+
+    const std::string &payload = batch->get_payload();
+    const size_t headerBytes = (protocolVersion >= Tundra::ProtocolWebSocketCompression ? 1 : 0);
+    if (payload.size() <= headerBytes)
+        return;
+
+    if (recordFile_)
+    {
+        recordFile_->WriteUInt(static_cast<Tundra::uint>(payload.size() - headerBytes));
+        recordFile_->Write(payload.data() + headerBytes, static_cast<Tundra::uint>(payload.size() - headerBytes));
+    }
+
+    if (headerBytes && compressionLevel_ > 0 && payload.size() >= cMinCompressBytes)
+    {
+        if (!deflater_)
+            deflater_ = new Deflater(compressionLevel_);
+
+        // Compress straight to the frame buffer after the encoding byte
+        MessagePtr compressed = connection->get_message(websocketpp::frame::opcode::BINARY, payload.size());
+        if (compressed && deflater_->IsValid())
+        {
+            std::string &compressedPayload = compressed->get_raw_payload();
+            compressedPayload.push_back(static_cast<char>(FrameDeflate));
+            if (deflater_->Compress(payload.data() + headerBytes, payload.size() - headerBytes, compressedPayload))
+                batch = compressed;
+            else
+            {
+                // Nothing of the failed frame was sent, the client stream is intact. Continue uncompressed.
+                Tundra::LogError("[WebSocketServer]: Failed to compress frame for connection ID " + Tundra::String(userID) + ", disabling compression.");
+                compressionLevel_ = 0;
+            }
+        }
+    }
+
+    PostSend(connection, batch);
+}
+
+void UserConnection::SetCompressionLevel(int level)
+{
+    compressionLevel_ = Urho3D::Clamp(level, 0, 9);
+}
+
+void UserConnection::SetRecordFile(const Tundra::SharedPtr<Urho3D::File> &file)
+{
+    recordFile_ = file;
+}
+
+void UserConnection::SetSendQueueLimit(size_t bytes)
+{
+    sendQueueLimit_ = bytes;
+}
+
+size_t UserConnection::SendQueueBytes() const
+{
+    size_t bytes = sendQueue_->postedBytes + sendQueue_->bufferedBytes;
+    if (batch_)
+        bytes += batch_->get_payload().size();
+    return bytes;
+}
+
+bool UserConnection::IsSendQueueFull() const
+{
+    return sendQueueLimit_ > 0 && SendQueueBytes() > sendQueueLimit_;
+}
+
+bool UserConnection::CheckSendQueue(const ConnectionPtr &connection)
+{
+    if (sendQueueOverflow_)
+        return false;
+    if (sendQueueLimit_ == 0 || sendQueue_->postedBytes + sendQueue_->bufferedBytes <= sendQueueLimit_ * cHardLimitFactor)
+        return true;
+
+    // Stop queuing data, the close frame is sent once the queued data has been written or the close times out.
+    Tundra::LogWarning("[WebSocketServer]: Connection ID " + Tundra::String(userID) + " send queue is over " +
+        Tundra::String(static_cast<Tundra::uint>(sendQueueLimit_ * cHardLimitFactor)) + " bytes, closing the connection.");
+    sendQueueOverflow_ = true;
+    batch_.reset();
+    PostClose(connection, websocketpp::close::status::policy_violation, "Send queue limit exceeded");
+    return false;
+}
+
+void UserConnection::PostSend(const ConnectionPtr &connection, const MessagePtr &message)
+{
+    if (message)
+        sendQueue_->postedBytes += message->get_payload().size();
+
+    websocketpp::server<websocketpp::config::asio>::connection_type::strand_ptr strand = connection->get_strand();
+    if (strand)
+        strand->post(boost::bind(&UserConnection::SendOnStrand, connection, message, sendQueue_));
+    else
+        SendOnStrand(connection, message, sendQueue_);
+}
+
+void UserConnection::PostClose(const ConnectionPtr &connection, websocketpp::close::status::value code, const std::string &reason)
+{
+    websocketpp::server<websocketpp::config::asio>::connection_type::strand_ptr strand = connection->get_strand();
+    if (strand)
+        strand->post(boost::bind(&UserConnection::CloseOnStrand, connection, code, reason));
+    else
+        CloseOnStrand(connection, code, reason);
+}
+
+void UserConnection::SendOnStrand(ConnectionPtr connection, MessagePtr message, boost::shared_ptr<SendQueueCounters> counters)
+{
+    size_t bytes = 0;
+    if (message)
+    {
+        bytes = message->get_payload().size();
+        connection->send(message);
+    }
+    else
+        counters->refreshPending = false;
+
+    // Store the buffer size before releasing the posted bytes, so that the main thread never sees the frame missing from both
+    counters->bufferedBytes = connection->get_buffered_amount();
+    counters->postedBytes -= bytes;
+}
+
+void UserConnection::CloseOnStrand(ConnectionPtr connection, websocketpp::close::status::value code, std::string reason)
+{
+    // Do not throw on the I/O thread if the connection was already closed by the client
+    websocketpp::lib::error_code ec;
+    connection->close(code, reason, ec);
 }
 
 ConnectionPtr UserConnection::WebSocketConnection() const
@@ -44,18 +237,26 @@ ConnectionPtr UserConnection::WebSocketConnection() const
 
 void UserConnection::Send(const kNet::DataSerializer &data)
 {
-    if (webSocketConnection.expired())
+    ConnectionPtr connection = webSocketConnection.lock();
+    if (!connection)
         return;
     if (data.BytesFilled() == 0)
         return;
     
-    webSocketConnection.lock()->send(static_cast<void*>(data.GetData()), static_cast<uint64_t>(data.BytesFilled()));
+    MessagePtr message = connection->get_message(websocketpp::frame::opcode::BINARY, data.BytesFilled());
+    if (!message)
+        return;
+    message->append_payload(data.GetData(), data.BytesFilled());
+    PostSend(connection, message);
 }
 
 void UserConnection::Disconnect()
 {
-    if (!webSocketConnection.expired())
-        webSocketConnection.lock()->close(websocketpp::close::status::normal, "ok");
+    // Messages sent right before disconnecting, like a login denial, should still reach the client
+    FlushBatch();
+    ConnectionPtr connection = webSocketConnection.lock();
+    if (connection)
+        PostClose(connection, websocketpp::close::status::normal, "ok");
 }
 
 void UserConnection::Close()
@@ -10,11 +10,23 @@
 #include "kNetFwd.h"
 
 #include "WebSocketServer.h"
+#include "WebSocketCompression.h"
 #include "SyncState.h"
 #include "UserConnection.h"
 
+#include <atomic>
+
 namespace WebSocket
 {
+    /// WebSocket user connection.
+    /** Each message is written to a single websocketpp message buffer, the u16 message ID header directly followed by the data.
+        
+        Clients with protocol version ProtocolWebSocketBatchedMessages or newer receive all messages sent to them during
+        a frame coalesced to as few binary frames as possible. Each message in the frame is encoded as
+        [VLE8_16_32 data size][u16 message ID][data]. The batch is sent by FlushBatch(), which the Server calls at the end of each frame.
+
+        Clients with protocol version ProtocolWebSocketCompression or newer receive a FrameEncoding byte before the messages.
+        If compression is enabled, batches of at least cMinCompressBytes are compressed with the Deflater of the connection. */
     class WEBSOCKETSERVER_API UserConnection : public Tundra::UserConnection
     {
     public:
@@ -30,10 +42,84 @@ namespace WebSocket
         /// Queue a network message to be sent to the client. All implementations may not use the reliable, inOrder, priority and contentID parameters.
         virtual void Send(kNet::message_id_t id, const char* data, size_t numBytes, bool reliable, bool inOrder, unsigned long priority = 100, unsigned long contentID = 0);
 
+        /// Sends the messages batched since the last flush as a single frame.
+        void FlushBatch();
+
+        /// Sets the send queue limit in bytes, 0 for no limit.
+        /** IsSendQueueFull() returns true once more than @c bytes is queued. If more than cHardLimitFactor times
+            @c bytes is queued the client is not keeping up at all, and the connection is closed. */
+        void SetSendQueueLimit(size_t bytes);
+
+        /// Returns the number of bytes queued for sending, including the pending batch.
+        /** The part already handed to websocketpp is as last seen by the I/O thread running the connection, which updates it on each
+            send, and once per frame while data is queued. */
+        size_t SendQueueBytes() const;
+
+        /// Tundra::UserConnection override.
+        virtual bool IsSendQueueFull() const;
+
+        /// Sets the compression level of batched frames, 1 (fastest) to 9 (smallest) or 0 to disable compression.
+        /** Has effect only if the client supports ProtocolWebSocketCompression. The level of an already started
+            deflate stream does not change. */
+        void SetCompressionLevel(int level);
+
+        /// Sets a file all batched frames to this connection are recorded to, uncompressed.
+        /** Each frame is written as [u32 size][messages]. Used to record sync streams for benchmarking compression. */
+        void SetRecordFile(const Tundra::SharedPtr<Urho3D::File> &file);
+
         ConnectionWeakPtr webSocketConnection;
 
+        /// Batched messages are flushed early if the frame would grow larger than this.
+        static const size_t cMaxBatchBytes = 64 * 1024;
+        /// Multiple of the send queue limit at which the connection is closed.
+        static const size_t cHardLimitFactor = 8;
+        /// Batches smaller than this are not compressed.
+        static const size_t cMinCompressBytes = 64;
+
     public:
         virtual void Disconnect();
         virtual void Close();
+
+    private:
+        /// Send queue size shared with the I/O threads.
+        /** websocketpp updates its send buffer size from the strand of the connection, so it is only read there.
+            All sends and closes are posted to the strand, which stores the buffer size after each. */
+        struct SendQueueCounters
+        {
+            SendQueueCounters() : postedBytes(0), bufferedBytes(0), refreshPending(false) {}
+
+            /// Bytes posted to the strand but not yet queued to websocketpp.
+            std::atomic<size_t> postedBytes;
+            /// websocketpp send buffer size after the last send or refresh.
+            std::atomic<size_t> bufferedBytes;
+            /// A refresh of bufferedBytes has been posted and not run yet.
+            std::atomic<bool> refreshPending;
+        };
+
+        /// Returns false and closes the connection if its send queue has grown past the hard limit.
+        bool CheckSendQueue(const ConnectionPtr &connection);
+
+        /// Posts @c message to be sent by the strand of the connection.
+        void PostSend(const ConnectionPtr &connection, const MessagePtr &message);
+
+        /// Posts a close of the connection to its strand, so that it is sent after the messages posted before it.
+        void PostClose(const ConnectionPtr &connection, websocketpp::close::status::value code, const std::string &reason);
+
+        /// Sends @c message, or only refreshes the send buffer size if null. Run by the strand of the connection.
+        static void SendOnStrand(ConnectionPtr connection, MessagePtr message, boost::shared_ptr<SendQueueCounters> counters);
+
+        /// Closes the connection. Run by the strand of the connection.
+        static void CloseOnStrand(ConnectionPtr connection, websocketpp::close::status::value code, std::string reason);
+
+        /// Frame the messages are batched to, null if nothing is pending.
+        MessagePtr batch_;
+        size_t sendQueueLimit_;
+        bool sendQueueOverflow_;
+        boost::shared_ptr<SendQueueCounters> sendQueue_;
+
+        int compressionLevel_;
+        /// Deflate stream of the connection, created on the first compressed frame.
+        Deflater *deflater_;
+        Tundra::SharedPtr<Urho3D::File> recordFile_;
     };
 }
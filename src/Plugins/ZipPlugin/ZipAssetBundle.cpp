@@ -12,19 +12,20 @@
 #include "AssetCache.h"
 #include "LoggingFunctions.h"
 
+#include <Urho3D/Core/Profiler.h>
 #include <Urho3D/IO/FileSystem.h>
 #include <zzip/zzip.h>
 
 namespace Tundra
 {
 
-ZipAssetBundle::ZipAssetBundle(AssetAPI *owner, const String &type, const String &name) :
+ZipAssetBundle::ZipAssetBundle(AssetAPI *owner, const String &type, const String &name, const ZipWorkerPoolPtr &pool) :
     IAssetBundle(owner, type, name),
-    worker_(0),
     archive_(0),
-    fileCount_(-1),
-    done_(false),
-    success_(false)
+    pool_(pool),
+    job_(0),
+    zipLastModified_(0),
+    fileCount_(-1)
 {
 }
 
@@ -35,8 +36,8 @@ ZipAssetBundle::~ZipAssetBundle()
 
 void ZipAssetBundle::DoUnload()
 {
+    CancelExtraction();
     Close();
-    StopThread();
 
     fileCount_ = -1;
 }
@@ -76,6 +77,7 @@ bool ZipAssetBundle::DeserializeFromDiskSource()
        zip the scene up as you already have the disk sources right there in the storage.
        The last modified query will fail if the file is open with zziplib, do it first. */
     uint zipLastModified = assetAPI_->Cache()->LastModified(Name());
+    zipLastModified_ = zipLastModified;
 
     const String diskSourceInternal = Urho3D::GetInternalPath(DiskSource());
 
@@ -99,8 +101,9 @@ bool ZipAssetBundle::DeserializeFromDiskSource()
             
             ZipArchiveFile file;
             file.relativePath = relativePath;
-            file.cachePath = Urho3D::GetInternalPath(assetAPI_->Cache()->DiskSourceByRef(subAssetRef));
+            file.cachePath = Urho3D::GetInternalPath(assetAPI_->Cache()->StagingPath(subAssetRef));
             file.lastModified = assetAPI_->Cache()->LastModified(subAssetRef);
+            file.contentHash = 0;
             file.compressedSize = archiveEntry.d_csize;
             file.uncompressedSize = archiveEntry.st_size;
             
@@ -112,13 +115,15 @@ bool ZipAssetBundle::DeserializeFromDiskSource()
             if (file.doExtract)
                 uncompressing++;
 
+            fileIndex_[relativePath.ToLower()] = files_.Size();
             files_.Push(file);
             fileCount_++;
         }
     }
     
-    // Close the zzip directory ptr
-    Close();
+    // Close the zzip directory ptr. Keep it open for reading sub assets if there are files waiting for extraction.
+    if (uncompressing == 0)
+        Close();
     
     // If the zip file was empty we don't want IsLoaded to fail on the files_ check.
     // The bundle loaded fine but there was no content, log a warning.
@@ -130,26 +135,20 @@ bool ZipAssetBundle::DeserializeFromDiskSource()
         return true;
     }
     
-    // Don't spin the worker if all sub assets are up to date in cache.
+    // Don't spin the workers if all sub assets are up to date in cache.
     if (uncompressing > 0)
-    {   
-        // Now that the file info has been read, continue in a worker thread.
-        LogDebug("ZipAssetBundle: File information read for " + Name() + ". File count: " + String(files_.Size()) + ". Starting worker thread to uncompress " + String(uncompressing) + " files.");
-        
-        // ZipWorker is a QRunnable we can pass to QThreadPool, it will handle scheduling it and deletes it when done.
-        worker_ = new ZipWorker(this, zipLastModified, diskSourceInternal, files_);   
-        if (!worker_->Run())
-        {
-            LogError("ZipAssetBundle: Failed to start worker thread for " + Name());
-            files_.Clear();
-            return false;
-        }
+    {
+        // Now that the file info has been read, continue in the shared worker pool.
+        LogDebug("ZipAssetBundle: File information read for " + Name() + ". File count: " + String(files_.Size()) + ". Queuing " + String(uncompressing) + " files for extraction.");
 
+        job_ = new ZipExtractJob(diskSourceInternal, files_);
+        pool_->Submit(job_);
         assetAPI_->GetFramework()->Frame()->Updated.Connect(this, &ZipAssetBundle::CheckDone);
     }
-    else
-        Loaded.Emit(this);
-        
+
+    /* Sub assets do not need to wait for the extraction. Entries that have not
+       been extracted yet are decompressed from the archive in GetSubAssetData. */
+    Loaded.Emit(this);
     return true;
 }
 
@@ -164,9 +163,12 @@ Vector<u8> ZipAssetBundle::GetSubAssetData(const String &subAssetName)
 {
     /* Makes no sense to keep the whole zip file contents in memory as only
        few files could be wanted from a 100mb bundle. Additionally all asset would take 2x the memory.
-       We could make this function also open the zip file and uncompress the data for every sub asset request. 
-       But that would be rather pointless, not to mention slower, as we already have the unpacked individual 
-       assets on disk. If the unpacking to disk changes we might need to rethink this. */
+       Files that are already in the cache are read from there. Files that are still waiting for
+       extraction are decompressed from the archive, so that the sub asset does not need to wait
+       for the whole archive to be written out. */
+    int index = FileIndex(subAssetName);
+    if (index >= 0 && files_[index].doExtract)
+        return ReadFromArchive(files_[index]);
 
     String filePath = GetSubAssetDiskSource(subAssetName);
     if (filePath.Empty())
@@ -178,9 +180,54 @@ Vector<u8> ZipAssetBundle::GetSubAssetData(const String &subAssetName)
 
 String ZipAssetBundle::GetSubAssetDiskSource(const String &subAssetName)
 {
+    // The cache may have an outdated version of a file that is pending extraction.
+    int index = FileIndex(subAssetName);
+    if (index >= 0 && files_[index].doExtract)
+        return "";
     return assetAPI_->Cache()->FindInCache(GetFullAssetReference(subAssetName));
 }
 
+int ZipAssetBundle::FileIndex(const String &subAssetName) const
+{
+    HashMap<String, uint>::ConstIterator iter = fileIndex_.Find(Urho3D::GetInternalPath(subAssetName).ToLower());
+    return (iter != fileIndex_.End() ? static_cast<int>(iter->second_) : -1);
+}
+
+Vector<u8> ZipAssetBundle::ReadFromArchive(const ZipArchiveFile &file)
+{
+    URHO3D_PROFILE(ZipAssetBundle_ReadFromArchive);
+
+    // The archive is kept open while there are pending files, it is closed once extraction completes.
+    if (!archive_)
+    {
+        zzip_error_t error = ZZIP_NO_ERROR;
+        archive_ = zzip_dir_open(Urho3D::GetInternalPath(DiskSource()).CString(), &error);
+        if (CheckAndLogZzipError(error) || CheckAndLogArchiveError(archive_) || !archive_)
+        {
+            archive_ = 0;
+            return Vector<u8>();
+        }
+    }
+
+    ZZIP_FILE *zzipFile = zzip_file_open(archive_, file.relativePath.CString(), ZZIP_ONLYZIP | ZZIP_CASELESS);
+    if (!zzipFile || CheckAndLogArchiveError(archive_))
+        return Vector<u8>();
+
+    Vector<u8> data(file.uncompressedSize);
+    uint numRead = 0;
+    zzip_ssize_t chunkRead = 0;
+    while(numRead < data.Size() && 0 < (chunkRead = zzip_read(zzipFile, &data[numRead], data.Size() - numRead)))
+        numRead += (uint)chunkRead;
+    zzip_file_close(zzipFile);
+
+    if (numRead != data.Size())
+    {
+        LogError("ZipAssetBundle: Failed to decompress " + file.relativePath + " from " + Name());
+        return Vector<u8>();
+    }
+    return data;
+}
+
 String ZipAssetBundle::GetFullAssetReference(const String &subAssetName)
 {
     return Name() + "#" + subAssetName;
@@ -194,35 +241,48 @@ bool ZipAssetBundle::IsLoaded() const
 void ZipAssetBundle::CheckDone(float /*frametime*/)
 {
     // Invoked in main thread context
+    if (!job_)
+        return;
+
+    URHO3D_PROFILE(ZipAssetBundle_CheckDone);
+
+    PODVector<uint> finished;
+    bool pending = job_->TakeFinished(finished);
+
+    // Move the extracted files to the cache. Stamp the same last modified as the parent zip file so that up to date files are not extracted again.
+    AssetCache *cache = assetAPI_->Cache();
+    for(uint i = 0; i < finished.Size(); ++i)
     {
-        Urho3D::MutexLock m(mutexDone_);
-        if (!done_)
-            return;
-
-        if (success_)
-            Loaded.Emit(this);
-        else
-            Failed.Emit(this);
+        const ZipArchiveFile &file = job_->files[finished[i]];
+        String subAssetRef = GetFullAssetReference(file.relativePath);
+        if (!cache->StoreFile(subAssetRef, file.cachePath, file.contentHash).Empty())
+        {
+            if (zipLastModified_ > 0)
+                cache->SetLastModified(subAssetRef, zipLastModified_);
+            files_[finished[i]].doExtract = false;
+        }
     }
-    StopThread();
 
+    if (pending)
+        return;
+
+    if (job_->HasFailed())
+        LogWarning("ZipAssetBundle: Some files could not be extracted to the asset cache from " + Name() + ", they will be read from the archive.");
+    else
+        Close(); // Everything is in the cache, no need to keep the archive open.
+
+    SAFE_DELETE(job_);
     assetAPI_->GetFramework()->Frame()->Updated.Disconnect(this, &ZipAssetBundle::CheckDone);
 }
 
-void ZipAssetBundle::WorkerDone(bool successful)
+void ZipAssetBundle::CancelExtraction()
 {
-    // Invoked in worker thread context
-    
-    Urho3D::MutexLock m(mutexDone_);
-    done_ = true;
-    success_ = successful;
-}
+    if (!job_)
+        return;
 
-void ZipAssetBundle::StopThread()
-{
-    if (worker_)
-        worker_->Stop();
-    SAFE_DELETE(worker_);
+    pool_->Cancel(job_);
+    SAFE_DELETE(job_);
+    assetAPI_->GetFramework()->Frame()->Updated.Disconnect(this, &ZipAssetBundle::CheckDone);
 }
 
 Urho3D::Context *ZipAssetBundle::Context() const
@@ -8,7 +8,7 @@
 #include "AssetAPI.h"
 #include "IAssetBundle.h"
 
-#include <Urho3D/Core/Mutex.h>
+#include <Urho3D/Container/HashMap.h>
 
 namespace Urho3D
 {
@@ -29,7 +29,7 @@ class TUNDRA_ZIP_API ZipAssetBundle : public IAssetBundle
     URHO3D_OBJECT(ZipAssetBundle, IAssetBundle);
 
 public:
-    ZipAssetBundle(AssetAPI *owner, const String &type, const String &name);
+    ZipAssetBundle(AssetAPI *owner, const String &type, const String &name, const ZipWorkerPoolPtr &pool);
     ~ZipAssetBundle();
 
     /// IAssetBundle override.
@@ -42,8 +42,9 @@ public:
     /// IAssetBundle override.
     /** Our current zziplib implementation requires disk source for processing.
         So we fail DeserializeFromData and try our best here to.
-        This function unpacks the archive content to asset cache to normal cache files
-        and provides the sub asset data via GetSubAssetData and GetSubAssetDiskSource. */
+        This function reads the archive directory and emits Loaded right away. Outdated entries are unpacked
+        to the asset cache in the shared ZipWorkerPool, until then they are decompressed from the archive
+        on demand by GetSubAssetData. */
     bool DeserializeFromDiskSource() override;
 
     /// IAssetBundle override.
@@ -63,47 +64,51 @@ public:
     String GetSubAssetDiskSource(const String &subAssetName) override;
     
 private:
-    friend class ZipWorker;
-
     /// Returns full asset reference for a sub asset.
     String GetFullAssetReference(const String &subAssetName);
-    
+
+    /// Returns the index of @c subAssetName in files_, or -1 if not found.
+    int FileIndex(const String &subAssetName) const;
+
+    /// Decompresses @c file from the archive to memory.
+    Vector<u8> ReadFromArchive(const ZipArchiveFile &file);
+
     /// IAssetBundle override.
     void DoUnload() override;
 
     /// Closes zip file.
     void Close();
 
-    /// Check if worker has completed.
+    /// Commits extracted files to the asset cache and checks if extraction has completed.
     void CheckDone(float frametime);
 
-    /// Handler for asynch loading completion.
-    /** Invoked in worker thread context. */
-    void WorkerDone(bool successful);
-
-    /// Stops and destroys thread.
+    /// Cancels and destroys the extraction job.
     /** @note Only call in main thread context. */
-    void StopThread();
+    void CancelExtraction();
 
     Urho3D::Context *Context() const;
     Urho3D::FileSystem *FileSystem() const;
 
-    /// Zziplib ptr to the zip file.
+    /// Zziplib ptr to the zip file. Open while sub assets are read from the archive.
     zzip_dir *archive_;
 
-    /// Zip sub assets.
+    /// Zip sub assets. doExtract is true while the entry has not been committed to the asset cache.
     ZipFileVector files_;
 
-    /// Worker
-    ZipWorker *worker_;
+    /// Lower case relative path to files_ index.
+    HashMap<String, uint> fileIndex_;
+
+    /// Shared extraction thread pool.
+    ZipWorkerPoolPtr pool_;
+
+    /// Ongoing extraction, null when all files are up to date in the cache.
+    ZipExtractJob *job_;
+
+    /// Last modified time of the zip file in the asset cache.
+    uint zipLastModified_;
 
     /// Count of files inside this zip.
     int fileCount_;
-
-    /// Mutex for polling completion of worker thread.
-    Urho3D::Mutex mutexDone_;
-    bool done_;
-    bool success_;
 };
 typedef SharedPtr<ZipAssetBundle> ZipAssetBundlePtr;
 
@@ -3,6 +3,7 @@
 #include "StableHeaders.h"
 #include "ZipBundleFactory.h"
 #include "ZipAssetBundle.h"
+#include "ZipWorker.h"
 
 namespace Tundra
 {
@@ -25,7 +26,11 @@ StringVector ZipBundleFactory::TypeExtensions() const
 AssetBundlePtr ZipBundleFactory::CreateEmptyAssetBundle(AssetAPI *owner, const String &name)
 {
     if (name.EndsWith(".zip", false))
-        return AssetBundlePtr(new ZipAssetBundle(owner, Type(), name));
+    {
+        if (!pool_)
+            pool_ = new ZipWorkerPool(owner->GetContext());
+        return AssetBundlePtr(new ZipAssetBundle(owner, Type(), name, pool_));
+    }
     return AssetBundlePtr();
 }
 
@@ -23,6 +23,9 @@ public:
 
 private:
     StringVector typesExtensions_;
+
+    /// Extraction threads shared by all bundles. Created on first bundle.
+    ZipWorkerPoolPtr pool_;
 };
 
 }
@@ -12,6 +12,9 @@ namespace Tundra
     class ZipBundleFactory;
     class ZipAssetBundle;
     class ZipWorker;
+    class ZipWorkerPool;
+    class ZipExtractJob;
+    typedef SharedPtr<ZipWorkerPool> ZipWorkerPoolPtr;
     
     /// @cond PRIVATE
     struct ZipArchiveFile
@@ -21,6 +24,7 @@ namespace Tundra
         uint compressedSize;
         uint uncompressedSize;
         uint lastModified;
+        u64 contentHash;
         bool doExtract;
     };
     typedef Vector<ZipArchiveFile> ZipFileVector;
@@ -4,29 +4,74 @@
 
 #include "ZipWorker.h"
 #include "ZipHelpers.h"
-#include "ZipAssetBundle.h"
 
+#include "CoreHashUtils.h"
 #include "LoggingFunctions.h"
 
+#include <Urho3D/Core/ProcessUtils.h>
 #include <Urho3D/IO/File.h>
-#include <Urho3D/IO/FileSystem.h>
-#include <Urho3D/Container/Sort.h>
+#include <Urho3D/Math/MathDefs.h>
 
 #include <zzip/zzip.h>
 
 namespace Tundra
 {
 
-bool ArchiveFileSizeCompare(const ZipArchiveFile &f1, const ZipArchiveFile &f2)
+// ZipExtractJob
+
+ZipExtractJob::ZipExtractJob(const String &diskSource_, const ZipFileVector &files_) :
+    diskSource(diskSource_),
+    files(files_),
+    next_(0),
+    cancelled_(false),
+    active_(0),
+    numProcessed_(0),
+    failed_(false)
+{
+    for(uint i = 0; i < files.Size(); ++i)
+        if (files[i].doExtract)
+            pending_.Push(i);
+
+    // Extract small files first so that as many sub assets as possible become available from the cache early.
+    for(uint i = 1; i < pending_.Size(); ++i)
+    {
+        uint index = pending_[i];
+        uint j = i;
+        for(; j > 0 && files[pending_[j-1]].uncompressedSize > files[index].uncompressedSize; --j)
+            pending_[j] = pending_[j-1];
+        pending_[j] = index;
+    }
+}
+
+bool ZipExtractJob::TakeFinished(PODVector<uint> &finished)
+{
+    Urho3D::MutexLock m(mutex_);
+    finished.Push(finished_);
+    finished_.Clear();
+    return numProcessed_ < pending_.Size();
+}
+
+bool ZipExtractJob::HasFailed()
+{
+    Urho3D::MutexLock m(mutex_);
+    return failed_;
+}
+
+void ZipExtractJob::EntryDone(uint index, bool success)
 {
-    return (f1.uncompressedSize < f2.uncompressedSize);
+    Urho3D::MutexLock m(mutex_);
+    ++numProcessed_;
+    if (success)
+        finished_.Push(index);
+    else
+        failed_ = true;
 }
 
-ZipWorker::ZipWorker(ZipAssetBundle *owner, uint zipLastModified, const String &diskSource, const ZipFileVector &files) :
-    owner_(owner),
-    zipLastModified_(zipLastModified),
-    diskSource_(diskSource),
-    files_(files),
+// ZipWorker
+
+ZipWorker::ZipWorker(ZipWorkerPool *pool, Urho3D::Context *context) :
+    pool_(pool),
+    context_(context),
     archive_(0)
 {
 }
@@ -38,98 +83,214 @@ ZipWorker::~ZipWorker()
 
 void ZipWorker::ThreadFunction()
 {
-    zzip_error_t error = ZZIP_NO_ERROR;
-    archive_ = zzip_dir_open(diskSource_.CString(), &error);
-    if (CheckAndLogZzipError(error) || CheckAndLogArchiveError(archive_) || !archive_)
+    ZipExtractJob *job = 0;
+    uint index = 0;
+    while(pool_->Next(this, job, index))
     {
-        archive_ = 0;
-        owner_->WorkerDone(false);
-        return;
+        bool success = Extract(job, index);
+        job->EntryDone(index, success && !job->cancelled_);
+        pool_->Release(job);
     }
+    Close();
+}
 
-    Urho3D::FileSystem *fs = owner_->FileSystem();
-    
-    // Sort by size so we can resize the buffer less often.
-    Urho3D::Sort(files_.Begin(), files_.End(), ArchiveFileSizeCompare);
+bool ZipWorker::Extract(ZipExtractJob *job, uint index)
+{
+    ZipArchiveFile &file = job->files[index];
 
-    // Read file contents
-    bool success = true;
-    zzip_ssize_t chunkLen = 0;
-    zzip_ssize_t chunkRead = 0;
-    Vector<u8> buffer;
+    // Reuse the open archive for consecutive entries of the same zip file.
+    if (archive_ && diskSource_ != job->diskSource)
+        Close();
+    if (!archive_)
+    {
+        zzip_error_t error = ZZIP_NO_ERROR;
+        archive_ = zzip_dir_open(job->diskSource.CString(), &error);
+        if (CheckAndLogZzipError(error) || CheckAndLogArchiveError(archive_) || !archive_)
+        {
+            archive_ = 0;
+            return false;
+        }
+        diskSource_ = job->diskSource;
+    }
+
+    // Open file from zip
+    ZZIP_FILE *zzipFile = zzip_file_open(archive_, file.relativePath.CString(), ZZIP_ONLYZIP | ZZIP_CASELESS);
+    if (!zzipFile || CheckAndLogArchiveError(archive_))
+        return false;
 
-    foreach(const ZipArchiveFile &file, files_)
+    // Create cache file
+    Urho3D::File cacheFile(context_, file.cachePath, Urho3D::FILE_WRITE);
+    if (!cacheFile.IsOpen())
     {
-        if (!file.doExtract)
-            continue;
+        LogError("ZipWorker: Failed to open cache file: " + file.cachePath + ". Cannot unzip " + file.relativePath);
+        zzip_file_close(zzipFile);
+        return false;
+    }
+
+    // Detect file size and adjust buffer (quite naive atm but is a slight speed improvement)
+    zzip_ssize_t chunkLen = 0;
+    if (file.uncompressedSize > 1000*1024)
+        chunkLen = 500*1024;
+    else if (file.uncompressedSize > 500*1024)
+        chunkLen = 250*1024;
+    else if (file.uncompressedSize > 100*1024)
+        chunkLen = 50*1024;
+    else if (file.uncompressedSize > 20*1024)
+        chunkLen = 10*1024;
+    else
+        chunkLen = 5*1024;
 
-        // Open file from zip
-        ZZIP_FILE *zzipFile = zzip_file_open(archive_, file.relativePath.CString(), ZZIP_ONLYZIP | ZZIP_CASELESS);
-        if (!zzipFile || CheckAndLogArchiveError(archive_))
+    if (buffer_.Size() < (uint)chunkLen)
+        buffer_.Resize(chunkLen);
+
+    // Read zip file content to cache file. Hash while writing so that the cache does not need to re-read the file.
+    bool success = true;
+    zzip_ssize_t chunkRead = 0;
+    file.contentHash = cHashSeed;
+    while (!job->cancelled_ && 0 < (chunkRead = zzip_read(zzipFile, &buffer_[0], chunkLen)))
+    {
+        file.contentHash = HashData(&buffer_[0], (uint)chunkRead, file.contentHash);
+        if (cacheFile.Write((void*)&buffer_[0], (uint)chunkRead) != (uint)chunkRead)
         {
+            LogError("Failed to write cache file + " + file.cachePath);
             success = false;
             break;
         }
+    }
+    if (chunkRead < 0)
+        success = false;
 
-        // Create cache file
-        Urho3D::File cacheFile(owner_->Context(), file.cachePath, Urho3D::FILE_WRITE);
-        if (!cacheFile.IsOpen())
-        {
-            LogError("ZipWorker: Failed to open cache file: " + file.cachePath + ". Cannot unzip " + file.relativePath);
-            continue;
-        }
+    // Close zip and cache file.
+    zzip_file_close(zzipFile);
+    cacheFile.Close();
+    return success;
+}
+
+void ZipWorker::Close()
+{
+    if (archive_)
+    {
+        zzip_dir_close(archive_);
+        archive_ = 0;
+    }
+    diskSource_.Clear();
+}
+
+// ZipWorkerPool
+
+ZipWorkerPool::ZipWorkerPool(Urho3D::Context *context, uint numThreads) :
+    context_(context),
+    numThreads_(numThreads),
+    cursor_(0),
+    stopping_(false)
+{
+    // Leave one core for the main thread. Extraction is mostly inflate bound, more threads than this do not help.
+    if (numThreads_ == 0)
+        numThreads_ = Urho3D::Clamp(static_cast<int>(Urho3D::GetNumPhysicalCPUs()) - 1, 1, 4);
+}
+
+ZipWorkerPool::~ZipWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        foreach(ZipExtractJob *job, queue_)
+            job->cancelled_ = true;
+        queue_.Clear();
+    }
+    workAvailable_.notify_all();
+    for(uint i = 0; i < threads_.Size(); ++i)
+    {
+        threads_[i]->Stop();
+        delete threads_[i];
+    }
+    threads_.Clear();
+}
 
-        // Detect file size and adjust buffer (quite naive atm but is a slight speed improvement)
-        if (file.uncompressedSize > 1000*1024)
-            chunkLen = 500*1024;
-        else if (file.uncompressedSize > 500*1024)
-            chunkLen = 250*1024;
-        else if (file.uncompressedSize > 100*1024)
-            chunkLen = 50*1024;
-        else if (file.uncompressedSize > 20*1024)
-            chunkLen = 10*1024;
-        else
-            chunkLen = 5*1024;
-
-        if (buffer.Size() < (uint)chunkLen)
-            buffer.Resize(chunkLen);
-
-        // Read zip file content to cache file
-        while (0 < (chunkRead = zzip_read(zzipFile, &buffer[0], chunkLen)))
+void ZipWorkerPool::Submit(ZipExtractJob *job)
+{
+    if (!job || job->pending_.Empty())
+        return;
+
+    if (threads_.Empty())
+    {
+        LogDebug("ZipWorkerPool: Starting " + String(numThreads_) + " extraction threads.");
+        for(uint i = 0; i < numThreads_; ++i)
         {
-            if (cacheFile.Write((void*)&buffer[0], (uint)chunkRead) != (uint)chunkRead)
+            ZipWorker *worker = new ZipWorker(this, context_);
+            if (worker->Run())
+                threads_.Push(worker);
+            else
             {
-                LogError("Failed to write cache file + " + file.cachePath);
-                success = false;
-                break;
+                LogError("ZipWorkerPool: Failed to start worker thread.");
+                delete worker;
             }
         }
+    }
 
-        // Close zip and cache file.
-        zzip_file_close(zzipFile);
-        cacheFile.Close();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.Push(job);
+    }
+    workAvailable_.notify_one();
+}
 
-        if (!success)
-            break;
+void ZipWorkerPool::Cancel(ZipExtractJob *job)
+{
+    if (!job)
+        return;
 
-        // Update last modified same to the parent zip file.
-        if (success && zipLastModified_ > 0)
-            fs->SetLastModifiedTime(file.cachePath, zipLastModified_);
-    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    job->cancelled_ = true;
+    queue_.Remove(job);
+    // Workers check the cancel flag between chunks, wait for them to let go of the job.
+    entryReleased_.wait(lock, [job] { return job->active_ == 0; });
+}
 
-    // Close the zzip directory ptr
-    Close();
+bool ZipWorkerPool::Next(ZipWorker *worker, ZipExtractJob *&job, uint &index)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    for(;;)
+    {
+        if (stopping_)
+            return false;
 
-    owner_->WorkerDone(success);
+        if (!queue_.Empty())
+        {
+            cursor_ = cursor_ % queue_.Size();
+            job = queue_[cursor_];
+            index = job->pending_[job->next_++];
+            ++job->active_;
+
+            // All entries handed out, the job stays alive until the bundle has taken the results.
+            if (job->next_ >= job->pending_.Size())
+                queue_.Erase(cursor_);
+            else
+                ++cursor_;
+
+            // Wake up the next idle worker if there is more work.
+            const bool moreWork = !queue_.Empty();
+            lock.unlock();
+            if (moreWork)
+                workAvailable_.notify_one();
+            return true;
+        }
+
+        // Idle: release the archive so that the zip file is not kept open, then wait for work.
+        lock.unlock();
+        worker->Close();
+        lock.lock();
+        workAvailable_.wait(lock, [this] { return stopping_ || !queue_.Empty(); });
+    }
 }
 
-void ZipWorker::Close()
+void ZipWorkerPool::Release(ZipExtractJob *job)
 {
-    if (archive_)
     {
-        zzip_dir_close(archive_);
-        archive_ = 0;
+        std::lock_guard<std::mutex> lock(mutex_);
+        --job->active_;
     }
+    entryReleased_.notify_all();
 }
 
 }
@@ -5,34 +5,135 @@
 #include "ZipPluginApi.h"
 #include "ZipPluginFwd.h"
 
+#include <Urho3D/Core/Mutex.h>
 #include <Urho3D/Core/Thread.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 /// @cond PRIVATE
 struct zzip_dir;
 /// @endcond
 
+namespace Urho3D
+{
+    class Context;
+}
+
 namespace Tundra
 {
 
-/// Worker thread that unpacks zip file contents.
+/// Extraction state of a single zip file, shared between ZipAssetBundle and the ZipWorkerPool threads.
+/** Owned by the bundle. Worker threads write extracted entries to their cachePath and report
+    them via TakeFinished, which the bundle polls in the main thread to commit the files to the asset cache. */
+class TUNDRA_ZIP_API ZipExtractJob
+{
+public:
+    ZipExtractJob(const String &diskSource, const ZipFileVector &files);
+
+    /// Moves the indexes of entries extracted since the last call to @c finished. Returns false when all entries have been processed.
+    /** @note Only call in main thread context. */
+    bool TakeFinished(PODVector<uint> &finished);
+
+    /// Returns if any entry failed to extract.
+    bool HasFailed();
+
+    /// Zip file path.
+    const String diskSource;
+
+    /// Zip entries. Worker threads fill the contentHash of the entries they extract.
+    ZipFileVector files;
+
+private:
+    friend class ZipWorker;
+    friend class ZipWorkerPool;
+
+    /// Called by worker threads when entry @c index has been processed.
+    void EntryDone(uint index, bool success);
+
+    /// Indexes of entries to extract, smallest first.
+    PODVector<uint> pending_;
+    /// Next index in pending_ to hand out. Guarded by the pool mutex.
+    uint next_;
+    /// Set when the job has been cancelled. Workers stop at the next chunk.
+    std::atomic<bool> cancelled_;
+    /// Number of workers currently extracting an entry of this job. Guarded by the pool mutex.
+    uint active_;
+
+    Urho3D::Mutex mutex_;
+    PODVector<uint> finished_;
+    uint numProcessed_;
+    bool failed_;
+};
+
+/// Worker thread of ZipWorkerPool that unpacks zip file entries.
 class TUNDRA_ZIP_API ZipWorker : public Urho3D::Thread
 {
 public:
-    ZipWorker(ZipAssetBundle *owner, uint zipLastModified, const String &diskSource, const ZipFileVector &files);
+    ZipWorker(ZipWorkerPool *pool, Urho3D::Context *context);
     ~ZipWorker();
 
     /// Urho3D::Thread override
     void ThreadFunction() override;
-    
+
 private:
+    friend class ZipWorkerPool;
+
+    /// Extracts entry @c index of @c job to its cache path.
+    bool Extract(ZipExtractJob *job, uint index);
     void Close();
 
-    ZipAssetBundle *owner_;
-    
+    ZipWorkerPool *pool_;
+    Urho3D::Context *context_;
+
+    /// Currently open archive. Kept open while consecutive entries come from the same zip file.
     String diskSource_;
-    ZipFileVector files_;
     zzip_dir *archive_;
-    uint zipLastModified_;
+    Vector<u8> buffer_;
+};
+
+/// Thread pool shared by all zip bundles for extracting entries concurrently.
+/** Entries are handed out round-robin between the queued jobs, so that a large bundle does not block smaller ones. */
+class TUNDRA_ZIP_API ZipWorkerPool : public RefCounted
+{
+public:
+    /// @param numThreads Number of worker threads. If 0, determined from the CPU count.
+    ZipWorkerPool(Urho3D::Context *context, uint numThreads = 0);
+    ~ZipWorkerPool();
+
+    /// Queues @c job for extraction. Starts the worker threads on first use.
+    void Submit(ZipExtractJob *job);
+
+    /// Removes @c job from the queue and waits until no worker uses it anymore.
+    /** @note Only call in main thread context. The job can be deleted after this returns. */
+    void Cancel(ZipExtractJob *job);
+
+private:
+    friend class ZipWorker;
+
+    /// Returns the next entry to extract, blocking while there is none. Returns false when the pool is stopping.
+    /** @param worker Calling worker, its archive is closed while idle. */
+    bool Next(ZipWorker *worker, ZipExtractJob *&job, uint &index);
+    /// Marks an entry returned by Next as processed.
+    void Release(ZipExtractJob *job);
+
+    Urho3D::Context *context_;
+    uint numThreads_;
+    Vector<ZipWorker*> threads_;
+
+    /// Guards the queue, the stop flag and the hand-out state of the jobs.
+    /** Urho3D::Condition keeps no state, so a Set() between checking the queue and waiting would be lost.
+        The condition variables are always waited on with their predicate under this mutex. */
+    std::mutex mutex_;
+    /// Signalled when a job is queued or the pool is stopping.
+    std::condition_variable workAvailable_;
+    /// Signalled when a worker lets go of an entry, for Cancel to wait on.
+    std::condition_variable entryReleased_;
+    /// Jobs with entries not yet handed out.
+    Vector<ZipExtractJob*> queue_;
+    uint cursor_;
+    bool stopping_;
 };
 
 }
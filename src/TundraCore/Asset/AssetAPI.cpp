@@ -25,6 +25,8 @@
 #include "LoggingFunctions.h"
 #include "CoreStringUtils.h"
 
+#include <Urho3D/Container/HashSet.h>
+#include <Urho3D/Container/Sort.h>
 #include <Urho3D/Core/Context.h>
 #include <Urho3D/Core/Profiler.h>
 #include <Urho3D/Core/StringUtils.h>
@@ -39,7 +41,14 @@ AssetAPI::AssetAPI(Framework *framework, bool headless) :
     Object(framework->GetContext()),
     fw(framework),
     isHeadless(headless),
-    assetCache(0)
+    assetCache(0),
+    memoryBudget(0),
+    cpuMemoryUsage(0),
+    gpuMemoryUsage(0),
+    numReferencedAssets(0),
+    numEvictedAssets(0),
+    budgetClock(0.f),
+    timeSinceBudgetUpdate(0.f)
 {
     transferPrioritizer_ = new DefaultAssetTransferPrioritizer();
 
@@ -61,6 +70,16 @@ AssetAPI::AssetAPI(Framework *framework, bool headless) :
         LogWarning("--no_async_asset_load: this format of the command-line parameter is deprecated and support for it will be removed. Use --noAsyncAssetLoad instead.");
     if (fw->HasCommandLineParameter("--clear-asset-cache"))
         LogWarning("--clear-asset-cache: this format of the command-line parameter is deprecated and support for it will be removed. Use --clearAssetCache instead.");
+
+    StringVector budgetParam = fw->CommandLineParameters("--assetMemoryBudget");
+    if (!budgetParam.Empty())
+    {
+        uint megabytes = Urho3D::ToUInt(budgetParam.Back());
+        if (megabytes > 0)
+            SetMemoryBudget(static_cast<u64>(megabytes) * 1024 * 1024);
+        else
+            LogWarning("AssetAPI: Invalid --assetMemoryBudget '" + budgetParam.Back() + "', expected size in megabytes. Asset memory is unlimited.");
+    }
 }
 
 AssetAPI::~AssetAPI()
@@ -232,12 +251,23 @@ AssetAPI::FileQueryResult AssetAPI::ResolveLocalAssetPath(String ref, String bas
         if (fileSystem->FileExists(outFilePath))
             return FileQueryLocalFileFound;
 
-        outFilePath = RecursiveFindFile(baseDirectoryContext, pathFilename);
-        if (!outFilePath.Empty())
-            return FileQueryLocalFileFound;
+        // Look up the local storage file indices before falling back to a recursive directory scan.
+        SharedPtr<LocalAssetProvider> localProvider = AssetProvider<LocalAssetProvider>();
+        bool baseDirectoryIndexed = false;
+        if (localProvider)
+        {
+            outFilePath = localProvider->FindIndexedFile(pathFilename, baseDirectoryContext, &baseDirectoryIndexed);
+            if (!outFilePath.Empty())
+                return FileQueryLocalFileFound;
+        }
 
-        ///\todo Query all local storages for the file.
-        ///\todo Can't currently query the LocalAssetProviders here directly (wrong direction for dependency chain).
+        // Only scan when the file may be outside the storages. An index without a change watcher was already re-scanned on the miss.
+        if (!baseDirectoryIndexed)
+        {
+            outFilePath = RecursiveFindFile(baseDirectoryContext, pathFilename);
+            if (!outFilePath.Empty())
+                return FileQueryLocalFileFound;
+        }
 
         outFilePath = ref;
         return FileQueryLocalFileMissing;
@@ -1542,6 +1572,122 @@ void AssetAPI::Update(float frametime)
         }
         readySubTransfers.Clear();
     }
+
+    // Persist cache index changes
+    if (assetCache)
+        assetCache->Update(frametime);
+
+    // Walking all assets is not free, the budget does not need to react faster than this.
+    budgetClock += frametime;
+    timeSinceBudgetUpdate += frametime;
+    if (timeSinceBudgetUpdate >= 1.f)
+    {
+        timeSinceBudgetUpdate = 0.f;
+        UpdateMemoryBudget();
+    }
+}
+
+void AssetAPI::SetMemoryBudget(u64 bytes)
+{
+    memoryBudget = bytes;
+    UpdateMemoryBudget();
+}
+
+void AssetAPI::UpdateMemoryBudget()
+{
+    URHO3D_PROFILE(AssetAPI_UpdateMemoryBudget);
+
+    // Assets are unloaded only after they have not been referenced for this long,
+    // so that a freshly loaded asset has time to be picked up by its users.
+    const float minIdleTime = 30.f;
+
+    // Roots are assets referenced by AssetRefListeners or held by anyone else than the AssetAPI,
+    // for example pending transfers or components holding an AssetPtr.
+    HashSet<String> referenced;
+    Vector<String> stack;
+    for(AssetMap::const_iterator iter = assets.begin(); iter != assets.end(); ++iter)
+    {
+        if (iter->second->NumListeners() > 0 || iter->second.Refs() > 1)
+        {
+            String name = iter->first.ToLower();
+            referenced.Insert(name);
+            stack.Push(name);
+        }
+    }
+
+    // Dependencies of referenced assets are referenced as well.
+    if (!stack.Empty() && !assetDependencies.Empty())
+    {
+        HashMap<String, StringVector> dependencies;
+        for(uint i = 0; i < assetDependencies.Size(); ++i)
+            dependencies[assetDependencies[i].first_.ToLower()].Push(assetDependencies[i].second_.ToLower());
+        while(!stack.Empty())
+        {
+            HashMap<String, StringVector>::ConstIterator depIter = dependencies.Find(stack.Back());
+            stack.Pop();
+            if (depIter == dependencies.End())
+                continue;
+            foreach(const String &dependee, depIter->second_)
+            {
+                if (!referenced.Contains(dependee))
+                {
+                    referenced.Insert(dependee);
+                    stack.Push(dependee);
+                }
+            }
+        }
+    }
+
+    cpuMemoryUsage = 0;
+    gpuMemoryUsage = 0;
+    numReferencedAssets = 0;
+    Vector<Pair<float, AssetPtr> > candidates;
+    for(AssetMap::const_iterator iter = assets.begin(); iter != assets.end(); ++iter)
+    {
+        IAsset *asset = iter->second.Get();
+        if (!asset->IsLoaded())
+        {
+            asset->lastReferenced = -1.f;
+            continue;
+        }
+
+        cpuMemoryUsage += asset->CpuMemoryUsage();
+        gpuMemoryUsage += asset->GpuMemoryUsage();
+
+        const bool isReferenced = referenced.Contains(iter->first.ToLower());
+        if (isReferenced)
+            ++numReferencedAssets;
+        if (isReferenced || asset->lastReferenced < 0.f)
+            asset->lastReferenced = budgetClock;
+        // Only assets that can be reloaded from where they came from are unloaded.
+        else if (budgetClock - asset->lastReferenced >= minIdleTime && !asset->IsModified() &&
+            asset->DiskSourceType() != IAsset::Programmatic && !asset->DiskSource().Empty())
+            candidates.Push(MakePair(asset->lastReferenced, iter->second));
+    }
+
+    const u64 usageBefore = cpuMemoryUsage + gpuMemoryUsage;
+    if (memoryBudget == 0 || usageBefore <= memoryBudget || candidates.Empty())
+        return;
+
+    // Least recently referenced first
+    Urho3D::Sort(candidates.Begin(), candidates.End());
+
+    uint numUnloaded = 0;
+    for(uint i = 0; i < candidates.Size() && cpuMemoryUsage + gpuMemoryUsage > memoryBudget; ++i)
+    {
+        AssetPtr asset = candidates[i].second_;
+        const uint cpu = asset->CpuMemoryUsage();
+        const uint gpu = asset->GpuMemoryUsage();
+        asset->Unload();
+        asset->lastReferenced = -1.f;
+        cpuMemoryUsage = (cpuMemoryUsage > cpu ? cpuMemoryUsage - cpu : 0);
+        gpuMemoryUsage = (gpuMemoryUsage > gpu ? gpuMemoryUsage - gpu : 0);
+        ++numUnloaded;
+    }
+    numEvictedAssets += numUnloaded;
+    LogDebug(Urho3D::ToString("AssetAPI: Unloaded %u unreferenced assets, %u KB -> %u KB (budget %u KB)", numUnloaded,
+        static_cast<uint>(usageBefore / 1024), static_cast<uint>((cpuMemoryUsage + gpuMemoryUsage) / 1024),
+        static_cast<uint>(memoryBudget / 1024)));
 }
 
 String GuaranteeTrailingSlash(const String &source)
@@ -1618,6 +1764,12 @@ AssetTransferMap::const_iterator AssetAPI::FindTransferIterator(IAssetTransfer *
     return currentTransfers.end();
 }
 
+void AssetAPI::AssetTransferReady(const AssetTransferPtr &transfer)
+{
+    if (transfer && !readyTransfers.Contains(transfer))
+        readyTransfers.Push(transfer);
+}
+
 void AssetAPI::AssetTransferCompleted(IAssetTransfer *transfer_)
 {
     URHO3D_PROFILE(AssetAPI_AssetTransferCompleted);
@@ -1662,8 +1814,8 @@ void AssetAPI::AssetTransferCompleted(IAssetTransfer *transfer_)
 
             // Cache the bundle.
             String bundleDiskSource = transfer->DiskSource(); // The asset provider may have specified an explicit filename to use as a disk source.
-            if (transfer->CachingAllowed() && transfer->rawAssetData.Size() > 0 && assetCache)
-                bundleDiskSource = assetCache->StoreAsset(&transfer->rawAssetData[0], transfer->rawAssetData.Size(), transfer->source.ref);
+            if (transfer->CachingAllowed() && transfer->RawDataSize() > 0 && assetCache)
+                bundleDiskSource = assetCache->StoreAsset(transfer->RawData(), transfer->RawDataSize(), transfer->source.ref);
             assetBundle->SetDiskSource(bundleDiskSource);
 
             // The bundle has now been downloaded and cached (if allowed by policy).
@@ -1677,10 +1829,12 @@ void AssetAPI::AssetTransferCompleted(IAssetTransfer *transfer_)
             bool success = assetBundle->DeserializeFromDiskSource();
             if (!success && !assetBundle->RequiresDiskSource())
             {
-                const u8 *bundleData = (transfer->rawAssetData.Size() > 0 ? &transfer->rawAssetData[0] : 0);
+                const u8 *bundleData = transfer->RawData();
                 if (bundleData)
-                    success = assetBundle->DeserializeFromData(bundleData, transfer->rawAssetData.Size());
+                    success = assetBundle->DeserializeFromData(bundleData, transfer->RawDataSize());
             }
+            // Bundles either processed the data or read their disk source, release the transfer data.
+            transfer->ReleaseRawData();
 
             // If all of the above returned false, this means asset could not be loaded.
             // Call AssetLoadFailed for the bundle to propagate this information to the waiting sub asset transfers. 
@@ -1721,8 +1875,8 @@ void AssetAPI::AssetTransferCompleted(IAssetTransfer *transfer_)
 
         // Save this asset to cache, and find out which file will represent a cached version of this asset.
         String assetDiskSource = transfer->DiskSource(); // The asset provider may have specified an explicit filename to use as a disk source.
-        if (transfer->CachingAllowed() && transfer->rawAssetData.Size() > 0 && assetCache)
-            assetDiskSource = assetCache->StoreAsset(&transfer->rawAssetData[0], transfer->rawAssetData.Size(), transfer->source.ref);
+        if (transfer->CachingAllowed() && transfer->RawDataSize() > 0 && assetCache)
+            assetDiskSource = assetCache->StoreAsset(transfer->RawData(), transfer->RawDataSize(), transfer->source.ref);
 
         // If disksource is still empty, forcibly look up if the asset exists in the cache now.
         if (assetDiskSource.Empty() && assetCache)
@@ -1738,12 +1892,16 @@ void AssetAPI::AssetTransferCompleted(IAssetTransfer *transfer_)
         transfer->EmitAssetDownloaded();
 
         bool success = false;
-        const u8 *data = (transfer->rawAssetData.Size() > 0 ? &transfer->rawAssetData[0] : 0);
+        const u8 *data = transfer->RawData();
         if (data)
-            success = transfer->asset->LoadFromFileInMemory(data, transfer->rawAssetData.Size());
+            success = transfer->asset->LoadFromFileInMemory(data, transfer->RawDataSize());
         else
             success = transfer->asset->LoadFromFile(transfer->asset->DiskSource());
 
+        /* Asset deserialization builds the runtime data synchronously (asynchronous loading
+           does not reference the source buffer), release the raw bytes or file mapping right away. */
+        transfer->ReleaseRawData();
+
         // If the load from either of in memory data or file data failed, update the internal state.
         // Otherwise the transfer will be left dangling in currentTransfers. For successful loads
         // we do no need to call AssetLoadCompleted because success can mean asynchronous loading,
@@ -109,6 +109,11 @@ public:
     /** Do not call this function from client code. */
     void AssetTransferCompleted(IAssetTransfer *transfer);
 
+    /// Called by an AssetProvider that can complete @c transfer without further work, eg. from its disk cache. [noscript]
+    /** The transfer is completed in Update() along with the already loaded assets that were requested again.
+        Do not call this function from client code. */
+    void AssetTransferReady(const AssetTransferPtr &transfer);
+
     /// Called by each AssetProvider to notify the Asset API that the asset transfer finished in a failure. [noscript]
     /** The Asset API will erase this transfer and also fail any transfers of assets which depended on this transfer. */
     void AssetTransferFailed(IAssetTransfer *transfer, String reason);
@@ -276,6 +281,28 @@ public:
     /// Returns the asset cache object that generates a disk source for all assets.
     AssetCache *Cache() const { return assetCache; }
 
+    /// Sets the memory budget for loaded assets in bytes. 0 means unlimited.
+    /** When the combined CPU and GPU memory usage of the loaded assets exceeds the budget, assets that are not referenced
+        by any AssetRefListener, held by other code or depended on by a referenced asset are unloaded, least recently
+        used first. Unloaded assets stay known to the AssetAPI and are reloaded from their disk source or storage when
+        requested again. The budget can also be set with the '--assetMemoryBudget <megabytes>' command line parameter. */
+    void SetMemoryBudget(u64 bytes);
+
+    /// Returns the memory budget for loaded assets in bytes. 0 means unlimited.
+    u64 MemoryBudget() const { return memoryBudget; }
+
+    /// Returns the CPU memory usage of the loaded assets in bytes, as of the last budget update.
+    u64 CpuMemoryUsage() const { return cpuMemoryUsage; }
+
+    /// Returns the GPU memory usage of the loaded assets in bytes, as of the last budget update.
+    u64 GpuMemoryUsage() const { return gpuMemoryUsage; }
+
+    /// Returns the number of loaded assets that were referenced in the last budget update.
+    uint NumReferencedAssets() const { return numReferencedAssets; }
+
+    /// Returns the number of assets unloaded by the memory budget since startup.
+    uint NumEvictedAssets() const { return numEvictedAssets; }
+
     /// Returns the asset storage of the given name.
     /// @param name The name of the storage to get. Remember that Asset Storage names are case-insensitive.
     AssetStoragePtr AssetStorageByName(const String &name) const;
@@ -511,6 +538,9 @@ private:
     /// Removes from AssetDependenciesMap all dependencies the given asset has.
     void RemoveAssetDependencies(String asset);
 
+    /// Recalculates the asset memory usage and unloads unreferenced assets when over the memory budget.
+    void UpdateMemoryBudget();
+
     /// Handle discovery of a new asset, when the storage is already known. This is used internally for optimization, so that providers don't need to be queried
     void HandleAssetDiscovery(const String &assetRef, const String &assetType, AssetStoragePtr storage);
     
@@ -587,6 +617,16 @@ private:
 
     Framework *fw;
     SharedPtr<AssetCache> assetCache;
+
+    /// Asset memory budget state.
+    u64 memoryBudget;
+    u64 cpuMemoryUsage;
+    u64 gpuMemoryUsage;
+    uint numReferencedAssets;
+    uint numEvictedAssets;
+    /// Clock for the last reference times of assets, in seconds since startup.
+    float budgetClock;
+    float timeSinceBudgetUpdate;
 };
 
 }
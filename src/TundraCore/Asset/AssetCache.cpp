@@ -7,51 +7,152 @@
 #include "IAsset.h"
 
 #include "CoreDefines.h"
+#include "CoreHashUtils.h"
+#include "CoreStringUtils.h"
 #include "Framework.h"
 #include "LoggingFunctions.h"
 
+#include <kNet/DataSerializer.h>
+#include <kNet/DataDeserializer.h>
+
+#include <Urho3D/Core/Profiler.h>
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/IO/File.h>
 #include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/Container/Sort.h>
 
 namespace Tundra
 {
 
-AssetCache::AssetCache(AssetAPI *owner, String assetCacheDirectory) : 
+namespace
+{
+    const u32 cIndexMagic = 0x31434154; // "TAC1"
+    const u32 cIndexVersion = 1;
+    const char *cIndexFile = "index.bin";
+    /// The index is written here first and then renamed over cIndexFile, so that an interrupted write never corrupts it.
+    const char *cIndexTempFile = "index.bin.tmp";
+    const char *cDataDirectory = "data/";
+    const char *cStagingDirectory = "incoming/";
+    /// Separates the source asset ref and the kind in the entry names of derived data. Not valid in URLs or file names.
+    const char *cDerivedSeparator = "|";
+    /// How often a changed index is written to disk in seconds.
+    const float cIndexSaveInterval = 5.f;
+    /// Resolution of the entry access times in seconds. Lookups within it do not change the index, which is
+    /// plenty for the least recently used eviction.
+    const uint cAccessTimeResolution = 60;
+}
+
+AssetCache::AssetCache(AssetAPI *owner, String assetCacheDirectory) :
     Object(owner->GetContext()),
     assetAPI(owner),
-    cacheDirectory(GuaranteeTrailingSlash(Urho3D::GetInternalPath(assetCacheDirectory)))
+    cacheDirectory(GuaranteeTrailingSlash(Urho3D::GetInternalPath(assetCacheDirectory))),
+    totalSize(0),
+    maxSize(0),
+    indexDirty(false),
+    timeSinceSave(0.f)
 {
     Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
     if (!Urho3D::IsAbsolutePath(cacheDirectory))
         cacheDirectory = fileSystem->GetCurrentDir() + cacheDirectory;
 
-    // Check that the main directory exists
+    // Check that the main, data and staging directories exist
     if (!fileSystem->DirExists(cacheDirectory))
         fileSystem->CreateDir(cacheDirectory);
+    if (!fileSystem->DirExists(cacheDirectory + cDataDirectory))
+        fileSystem->CreateDir(cacheDirectory + cDataDirectory);
+    if (!fileSystem->DirExists(cacheDirectory + cStagingDirectory))
+        fileSystem->CreateDir(cacheDirectory + cStagingDirectory);
+
+    Framework *fw = owner->GetFramework();
 
     // Check --clearAssetCache start param
-    if (owner->GetFramework()->HasCommandLineParameter("--clearAssetCache") ||
-        owner->GetFramework()->HasCommandLineParameter("--clear-asset-cache")) /**< @todo Remove support for the deprecated parameter version at some point. */
+    if (fw->HasCommandLineParameter("--clearAssetCache") ||
+        fw->HasCommandLineParameter("--clear-asset-cache")) /**< @todo Remove support for the deprecated parameter version at some point. */
     {
         LogInfo("AssetCache: Removing all data and metadata files from cache, found 'clearAssetCache' from the startup params!");
         ClearAssetCache();
     }
+    else if (!LoadIndex())
+        ImportLegacyFiles();
+
+    // Check --assetCacheSize start param
+    StringVector sizeParam = fw->CommandLineParameters("--assetCacheSize");
+    if (!sizeParam.Empty())
+    {
+        uint megabytes = Urho3D::ToUInt(sizeParam.Back());
+        if (megabytes > 0)
+            SetMaxSize(static_cast<u64>(megabytes) * 1024 * 1024);
+        else
+            LogWarning("AssetCache: Invalid --assetCacheSize '" + sizeParam.Back() + "', expected size in megabytes. Cache size is unlimited.");
+    }
+}
+
+AssetCache::~AssetCache()
+{
+    SaveIndex();
+}
+
+String AssetCache::BlobName(u64 contentHash)
+{
+    return Urho3D::ToStringHex(static_cast<uint>(contentHash >> 32)) + Urho3D::ToStringHex(static_cast<uint>(contentHash & 0xFFFFFFFF));
+}
+
+String AssetCache::BlobPath(const String &blob) const
+{
+    return cacheDirectory + cDataDirectory + blob;
+}
+
+String AssetCache::DerivedRef(const String &assetRef, const String &kind)
+{
+    return assetRef + cDerivedSeparator + kind;
 }
 
 String AssetCache::FindInCache(const String &assetRef)
 {
-    Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
-    String absolutePath = DiskSourceByRef(assetRef);
-    if (fileSystem->FileExists(absolutePath))
-        return absolutePath;
-    else // The file is not in cache, return an empty string to denote that.
+    EntryMap::Iterator iter = entries.Find(assetRef);
+    if (iter == entries.End()) // The file is not in cache, return an empty string to denote that.
         return "";
+
+    // The blob may have been deleted outside of the cache, drop the stale entry in that case.
+    String absolutePath = BlobPath(iter->second_.blob);
+    if (!GetSubsystem<Urho3D::FileSystem>()->FileExists(absolutePath))
+    {
+        DeleteAsset(assetRef);
+        return "";
+    }
+
+    const uint now = Urho3D::Time::GetTimeSinceEpoch();
+    uint &lastAccess = iter->second_.lastAccess;
+    if (now < lastAccess || now - lastAccess >= cAccessTimeResolution)
+    {
+        lastAccess = now;
+        indexDirty = true;
+    }
+    return absolutePath;
+}
+
+MappedFilePtr AssetCache::MapFile(const String &assetRef)
+{
+    String absolutePath = FindInCache(assetRef);
+    if (absolutePath.Empty())
+        return MappedFilePtr();
+    MappedFilePtr file(new MappedFile(absolutePath));
+    return (file->IsOpen() ? file : MappedFilePtr());
 }
 
 String AssetCache::DiskSourceByRef(const String &assetRef)
 {
-    // Return the path where the given asset ref would be stored, if it was saved in the cache
-    // (regardless of whether it now exists in the cache).
-    return cacheDirectory + AssetAPI::SanitateAssetRef(assetRef);
+    // Return the path where the given asset ref is stored, or where it can be written before storing it to the cache.
+    EntryMap::ConstIterator iter = entries.Find(assetRef);
+    if (iter != entries.End())
+        return BlobPath(iter->second_.blob);
+    return StagingPath(assetRef);
+}
+
+String AssetCache::StagingPath(const String &assetRef)
+{
+    return cacheDirectory + cStagingDirectory + AssetAPI::SanitateAssetRef(assetRef);
 }
 
 String AssetCache::CacheDirectory() const
@@ -63,44 +164,265 @@ String AssetCache::StoreAsset(AssetPtr asset)
 {
     Vector<u8> data;
     asset->SerializeTo(data);
-    return StoreAsset(&data[0], data.Size(), asset->Name());
+    return StoreAsset(data.Size() > 0 ? &data[0] : 0, data.Size(), asset->Name());
 }
 
 String AssetCache::StoreAsset(const u8 *data, uint numBytes, const String &assetName)
 {
-    String absolutePath = DiskSourceByRef(assetName);
-    bool success = SaveAssetFromMemoryToFile(data, numBytes, absolutePath);
-    if (success)
-        return absolutePath;
-    return "";
+    URHO3D_PROFILE(AssetCache_StoreAsset);
+
+    String blob = BlobName(HashData(data, numBytes));
+    String absolutePath = BlobPath(blob);
+
+    // Identical content is already stored, only write the data if this is a new blob or its file has been deleted.
+    Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
+    if (!(blobs.Contains(blob) && fileSystem->FileExists(absolutePath)) && !SaveAssetFromMemoryToFile(data, numBytes, absolutePath))
+        return "";
+
+    SetEntryBlob(assetName, blob, numBytes);
+    EvictIfNeeded(assetName);
+    return absolutePath;
 }
 
-unsigned AssetCache::LastModified(const String &assetRef)
+String AssetCache::StoreFile(const String &assetRef, const String &sourceFile, u64 contentHash)
 {
+    URHO3D_PROFILE(AssetCache_StoreFile);
+
     Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
-    String absolutePath = FindInCache(assetRef);
-    if (absolutePath.Empty())
-        return 0;
-    return fileSystem->GetLastModifiedTime(absolutePath);
+    if (!fileSystem->FileExists(sourceFile))
+    {
+        LogError("AssetCache::StoreFile: Source file '" + sourceFile + "' for '" + assetRef + "' does not exist.");
+        return "";
+    }
+    if (contentHash == 0)
+    {
+        Vector<u8> data;
+        if (!LoadFileToVector(sourceFile, data))
+            return "";
+        contentHash = HashData(data.Size() > 0 ? &data[0] : 0, data.Size());
+    }
+
+    String blob = BlobName(contentHash);
+    String absolutePath = BlobPath(blob);
+    uint size = 0;
+
+    BlobMap::ConstIterator existing = blobs.Find(blob);
+    if (existing != blobs.End() && fileSystem->FileExists(absolutePath))
+    {
+        size = existing->second_.size;
+        fileSystem->Delete(sourceFile);
+    }
+    else
+    {
+        Urho3D::SharedPtr<Urho3D::File> file(new Urho3D::File(context_, sourceFile, Urho3D::FILE_READ));
+        size = file->IsOpen() ? file->GetSize() : 0;
+        file.Reset();
+
+        if (fileSystem->FileExists(absolutePath))
+            fileSystem->Delete(absolutePath);
+        if (!fileSystem->Rename(sourceFile, absolutePath))
+        {
+            LogError("AssetCache::StoreFile: Failed to move '" + sourceFile + "' to '" + absolutePath + "'.");
+            return "";
+        }
+    }
+
+    SetEntryBlob(assetRef, blob, size);
+    EvictIfNeeded(assetRef);
+    return absolutePath;
 }
 
-bool AssetCache::SetLastModified(const String & assetRef, unsigned dateTime)
+String AssetCache::StoreDerivedData(const String &assetRef, const String &kind, const u8 *data, uint numBytes)
 {
+    URHO3D_PROFILE(AssetCache_StoreDerivedData);
+
+    String blob = BlobName(HashData(data, numBytes));
+    String absolutePath = BlobPath(blob);
     Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
-    String absolutePath = FindInCache(assetRef);
-    if (absolutePath.Empty())
-        return false;
-    return fileSystem->SetLastModifiedTime(absolutePath, dateTime);
+    if (!(blobs.Contains(blob) && fileSystem->FileExists(absolutePath)) && !SaveAssetFromMemoryToFile(data, numBytes, absolutePath))
+        return "";
+
+    // Link to the source before evicting, so that neither of them gets evicted for the other.
+    String derivedRef = DerivedRef(assetRef, kind);
+    SetEntryBlob(derivedRef, blob, numBytes);
+    entries[derivedRef].source = assetRef;
+    EntryMap::Iterator sourceIter = entries.Find(assetRef);
+    if (sourceIter != entries.End())
+        sourceIter->second_.hasDerived = true;
+    EvictIfNeeded(derivedRef);
+    return absolutePath;
 }
 
-void AssetCache::DeleteAsset(const String &assetRef)
+String AssetCache::FindDerivedData(const String &assetRef, const String &kind)
+{
+    return FindInCache(DerivedRef(assetRef, kind));
+}
+
+void AssetCache::SetEntryBlob(const String &assetRef, const String &blob, uint size)
 {
-    String absolutePath = DiskSourceByRef(assetRef);
+    Entry &entry = entries[assetRef];
+    uint now = Urho3D::Time::GetTimeSinceEpoch();
+    if (entry.blob != blob)
+    {
+        // Data derived from the previous content is stale.
+        if (entry.hasDerived)
+        {
+            entry.hasDerived = false;
+            DeleteDerived(assetRef);
+        }
+
+        if (!entry.blob.Empty())
+            ReleaseBlob(entry.blob);
+
+        Blob &b = blobs[blob];
+        if (b.refs == 0)
+        {
+            b.size = size;
+            totalSize += size;
+        }
+        ++b.refs;
+
+        // Content changed, validators of the previous content are no longer valid.
+        entry.blob = blob;
+        entry.size = size;
+        entry.lastModified = now;
+        entry.eTag.Clear();
+    }
+    entry.lastAccess = now;
+    indexDirty = true;
+}
+
+void AssetCache::ReleaseBlob(const String &blob)
+{
+    BlobMap::Iterator iter = blobs.Find(blob);
+    if (iter == blobs.End())
+        return;
+    if (iter->second_.refs > 1)
+    {
+        --iter->second_.refs;
+        return;
+    }
+
+    totalSize = (totalSize > iter->second_.size ? totalSize - iter->second_.size : 0);
+    blobs.Erase(iter);
+
     Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
+    String absolutePath = BlobPath(blob);
     if (fileSystem->FileExists(absolutePath))
         fileSystem->Delete(absolutePath);
 }
 
+void AssetCache::EvictIfNeeded(const String &keepRef)
+{
+    if (maxSize == 0 || totalSize <= maxSize)
+        return;
+
+    URHO3D_PROFILE(AssetCache_Evict);
+
+    String keepSource;
+    EntryMap::ConstIterator keepIter = entries.Find(keepRef);
+    if (keepIter != entries.End())
+        keepSource = keepIter->second_.source;
+
+    // Oldest access first
+    Vector<Pair<uint, String> > candidates;
+    candidates.Reserve(entries.Size());
+    for(EntryMap::ConstIterator iter = entries.Begin(); iter != entries.End(); ++iter)
+        candidates.Push(MakePair(iter->second_.lastAccess, iter->first_));
+    Urho3D::Sort(candidates.Begin(), candidates.End());
+
+    uint numEvicted = 0;
+    const u64 sizeBefore = totalSize;
+    for(uint i = 0; i < candidates.Size() && totalSize > maxSize; ++i)
+    {
+        const String &ref = candidates[i].second_;
+        EntryMap::ConstIterator iter = entries.Find(ref);
+        if (iter == entries.End())
+            continue; // Already deleted along with its source
+        // Keep the data of assets that are currently loaded, and data derived from them, they will likely be needed again on reload.
+        const String &owner = (iter->second_.source.Empty() ? ref : iter->second_.source);
+        if (ref == keepRef || ref == keepSource || assetAPI->FindAsset(owner) || assetAPI->FindBundle(owner))
+            continue;
+        DeleteAsset(ref);
+        ++numEvicted;
+    }
+    if (numEvicted > 0)
+        LogDebug(Urho3D::ToString("AssetCache: Evicted %u entries, %u KB -> %u KB (limit %u KB)", numEvicted,
+            static_cast<uint>(sizeBefore / 1024), static_cast<uint>(totalSize / 1024), static_cast<uint>(maxSize / 1024)));
+}
+
+unsigned AssetCache::LastModified(const String &assetRef)
+{
+    EntryMap::ConstIterator iter = entries.Find(assetRef);
+    return (iter != entries.End() ? iter->second_.lastModified : 0);
+}
+
+bool AssetCache::SetLastModified(const String & assetRef, unsigned dateTime)
+{
+    EntryMap::Iterator iter = entries.Find(assetRef);
+    if (iter == entries.End())
+        return false;
+    iter->second_.lastModified = dateTime;
+    indexDirty = true;
+    return true;
+}
+
+String AssetCache::ETag(const String &assetRef)
+{
+    EntryMap::ConstIterator iter = entries.Find(assetRef);
+    return (iter != entries.End() ? iter->second_.eTag : String::EMPTY);
+}
+
+bool AssetCache::SetETag(const String &assetRef, const String &eTag)
+{
+    EntryMap::Iterator iter = entries.Find(assetRef);
+    if (iter == entries.End())
+        return false;
+    iter->second_.eTag = eTag;
+    indexDirty = true;
+    return true;
+}
+
+unsigned AssetCache::Expires(const String &assetRef)
+{
+    EntryMap::ConstIterator iter = entries.Find(assetRef);
+    return (iter != entries.End() ? iter->second_.expires : 0);
+}
+
+bool AssetCache::SetExpires(const String &assetRef, unsigned dateTime)
+{
+    EntryMap::Iterator iter = entries.Find(assetRef);
+    if (iter == entries.End())
+        return false;
+    iter->second_.expires = dateTime;
+    indexDirty = true;
+    return true;
+}
+
+void AssetCache::DeleteAsset(const String &assetRef)
+{
+    EntryMap::Iterator iter = entries.Find(assetRef);
+    if (iter == entries.End())
+        return;
+    String blob = iter->second_.blob;
+    bool hasDerived = iter->second_.hasDerived;
+    entries.Erase(iter);
+    ReleaseBlob(blob);
+    if (hasDerived)
+        DeleteDerived(assetRef);
+    indexDirty = true;
+}
+
+void AssetCache::DeleteDerived(const String &assetRef)
+{
+    StringVector derivedRefs;
+    for(EntryMap::ConstIterator iter = entries.Begin(); iter != entries.End(); ++iter)
+        if (iter->second_.source == assetRef)
+            derivedRefs.Push(iter->first_);
+    foreach(const String &ref, derivedRefs)
+        DeleteAsset(ref);
+}
+
 void AssetCache::ClearAssetCache()
 {
     Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
@@ -108,7 +430,185 @@ void AssetCache::ClearAssetCache()
     fileSystem->ScanDir(filenames, cacheDirectory, "*.*", Urho3D::SCAN_FILES, true);
     foreach(String file, filenames)
         fileSystem->Delete(cacheDirectory + file);
+
+    entries.Clear();
+    blobs.Clear();
+    totalSize = 0;
+    indexDirty = true;
+}
+
+void AssetCache::SetMaxSize(u64 maxBytes)
+{
+    maxSize = maxBytes;
+    EvictIfNeeded();
 }
 
+void AssetCache::Update(float frametime)
+{
+    timeSinceSave += frametime;
+    if (indexDirty && timeSinceSave >= cIndexSaveInterval)
+        SaveIndex();
 }
 
+void AssetCache::SaveIndex()
+{
+    timeSinceSave = 0.f;
+    if (!indexDirty)
+        return;
+
+    URHO3D_PROFILE(AssetCache_SaveIndex);
+
+    // Calculate the exact size so that the index can be serialized with a single allocation.
+    size_t numBytes = 3 * sizeof(u32);
+    for(EntryMap::ConstIterator iter = entries.Begin(); iter != entries.End(); ++iter)
+        numBytes += 4 * sizeof(u16) + iter->first_.Length() + iter->second_.blob.Length() + iter->second_.eTag.Length() +
+            iter->second_.source.Length() + 4 * sizeof(u32);
+
+    kNet::DataSerializer ds(numBytes);
+    ds.Add<u32>(cIndexMagic);
+    ds.Add<u32>(cIndexVersion);
+    ds.Add<u32>(entries.Size());
+    for(EntryMap::ConstIterator iter = entries.Begin(); iter != entries.End(); ++iter)
+    {
+        const Entry &entry = iter->second_;
+        WriteUtf8String(ds, iter->first_);
+        WriteUtf8String(ds, entry.blob);
+        ds.Add<u32>(entry.size);
+        ds.Add<u32>(entry.lastAccess);
+        ds.Add<u32>(entry.lastModified);
+        WriteUtf8String(ds, entry.eTag);
+        ds.Add<u32>(entry.expires);
+        WriteUtf8String(ds, entry.source);
+    }
+
+    // Write the complete index to a temporary file first, so that a crash or a full disk leaves the previous index intact.
+    Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
+    const String indexFile = cacheDirectory + cIndexFile;
+    const String tempFile = cacheDirectory + cIndexTempFile;
+    bool written = false;
+    {
+        Urho3D::File file(context_, tempFile, Urho3D::FILE_WRITE);
+        written = file.IsOpen() && file.Write(ds.GetData(), static_cast<uint>(ds.BytesFilled())) == static_cast<uint>(ds.BytesFilled());
+    }
+    if (!written)
+    {
+        LogError("AssetCache: Failed to write cache index to " + tempFile);
+        fileSystem->Delete(tempFile);
+        return;
+    }
+
+    // Renaming replaces the index atomically on POSIX. Windows refuses to rename over an existing file, in which case
+    // LoadIndex picks up the temporary file if the index is missing after an interrupted replace.
+    if (!fileSystem->Rename(tempFile, indexFile))
+    {
+        fileSystem->Delete(indexFile);
+        if (!fileSystem->Rename(tempFile, indexFile))
+        {
+            LogError("AssetCache: Failed to replace cache index " + indexFile);
+            return;
+        }
+    }
+    indexDirty = false;
+}
+
+bool AssetCache::LoadIndex()
+{
+    URHO3D_PROFILE(AssetCache_LoadIndex);
+
+    Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
+    String indexFile = cacheDirectory + cIndexFile;
+    if (!fileSystem->FileExists(indexFile) && fileSystem->FileExists(cacheDirectory + cIndexTempFile))
+        indexFile = cacheDirectory + cIndexTempFile; // SaveIndex was interrupted while replacing the index
+
+    Vector<u8> data;
+    if (!fileSystem->FileExists(indexFile) || !LoadFileToVector(indexFile, data) || data.Empty())
+        return false;
+
+    entries.Clear();
+    blobs.Clear();
+    totalSize = 0;
+
+    try
+    {
+        kNet::DataDeserializer dd(reinterpret_cast<const char*>(&data[0]), data.Size());
+        const u32 magic = dd.Read<u32>();
+        const u32 version = dd.Read<u32>();
+        if (magic != cIndexMagic || version != cIndexVersion)
+        {
+            LogWarning("AssetCache: Unsupported cache index format, rebuilding the index.");
+            return false;
+        }
+        const u32 numEntries = dd.Read<u32>();
+        for(u32 i = 0; i < numEntries; ++i)
+        {
+            String ref = ReadUtf8String(dd);
+            Entry &entry = entries[ref];
+            entry.blob = ReadUtf8String(dd);
+            entry.size = dd.Read<u32>();
+            entry.lastAccess = dd.Read<u32>();
+            entry.lastModified = dd.Read<u32>();
+            entry.eTag = ReadUtf8String(dd);
+            entry.expires = dd.Read<u32>();
+            entry.source = ReadUtf8String(dd);
+
+            Blob &blob = blobs[entry.blob];
+            if (blob.refs == 0)
+            {
+                blob.size = entry.size;
+                totalSize += entry.size;
+            }
+            ++blob.refs;
+        }
+
+        for(EntryMap::ConstIterator iter = entries.Begin(); iter != entries.End(); ++iter)
+        {
+            if (iter->second_.source.Empty())
+                continue;
+            EntryMap::Iterator sourceIter = entries.Find(iter->second_.source);
+            if (sourceIter != entries.End())
+                sourceIter->second_.hasDerived = true;
+        }
+    }
+    catch(...)
+    {
+        LogWarning("AssetCache: Cache index is corrupted, rebuilding the index.");
+        entries.Clear();
+        blobs.Clear();
+        totalSize = 0;
+        return false;
+    }
+
+    indexDirty = false;
+    return true;
+}
+
+void AssetCache::ImportLegacyFiles()
+{
+    URHO3D_PROFILE(AssetCache_ImportLegacyFiles);
+
+    // Move files from the flat layout where each asset was stored with its sanitated ref as the filename.
+    Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
+    StringVector filenames;
+    fileSystem->ScanDir(filenames, cacheDirectory, "*.*", Urho3D::SCAN_FILES, false);
+    foreach(String file, filenames)
+    {
+        String absolutePath = cacheDirectory + file;
+        if (file == cIndexFile || file == cIndexTempFile)
+            continue;
+        if (file.StartsWith("temporary_"))
+        {
+            fileSystem->Delete(absolutePath);
+            continue;
+        }
+        String ref = AssetAPI::DesanitateAssetRef(file);
+        uint lastModified = fileSystem->GetLastModifiedTime(absolutePath);
+        if (!StoreFile(ref, absolutePath).Empty())
+            SetLastModified(ref, lastModified);
+    }
+    indexDirty = true;
+    SaveIndex();
+    if (!entries.Empty())
+        LogInfo(Urho3D::ToString("AssetCache: Imported %u files to the cache index.", entries.Size()));
+}
+
+}
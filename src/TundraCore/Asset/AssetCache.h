@@ -5,31 +5,51 @@
 #include "TundraCoreApi.h"
 #include "CoreTypes.h"
 #include "AssetFwd.h"
+#include "MappedFile.h"
 
 #include <Urho3D/Core/Object.h>
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Container/Str.h>
 
 namespace Tundra
 {
 
 /// Implements a disk cache for asset files to avoid re-downloading assets between runs.
+/** The cache is content-addressed: asset data is stored once per unique content hash under the 'data' sub folder,
+    and an index file maps asset references to the stored data. The index also tracks the size, last access time,
+    HTTP validators (Last-Modified and ETag) and freshness lifetime of each entry. The index is read from disk in one go at startup
+    and written back periodically from Update() and on destruction. Access times are kept with a resolution of a minute,
+    so that lookups do not cause the index to be rewritten.
+
+    The total size of the cache can be limited with SetMaxSize() or the '--assetCacheSize <megabytes>' command line
+    parameter. When the limit is exceeded the least recently used entries that are not currently loaded to AssetAPI
+    are evicted. */
 class TUNDRACORE_API AssetCache : public Object
 {
     URHO3D_OBJECT(AssetCache, Object);
 
 public:
     explicit AssetCache(AssetAPI *owner, String assetCacheDirectory);
+    ~AssetCache();
 
     /// Returns the absolute path on the local file system that contains a cached copy of the given asset ref.
     /// If the given asset file does not exist in the cache, an empty string is returned.
     /// @param assetRef The asset reference URL, which must be of type AssetRefExternalUrl.
     String FindInCache(const String &assetRef);
 
+    /// Returns a read-only memory mapping of the cached data of @c assetRef, or null if the asset is not in the cache.
+    MappedFilePtr MapFile(const String &assetRef);
+
     /// Returns the absolute path on the local file system for the cached version of the given asset ref.
-    /// This function is otherwise identical to FindInCache, except this version does not check whether the asset exists 
-    /// in the cache, but simply returns the absolute path where the asset would be stored in the cache.
+    /// If the asset is in the cache, this is identical to FindInCache. Otherwise returns the staging path
+    /// where the asset data can be written to before committing it to the cache with StoreFile.
     /// @param assetRef The asset reference URL, which must be of type AssetRefExternalUrl.
     String DiskSourceByRef(const String &assetRef);
-    
+
+    /// Returns a temporary path where external writers can write the data of @c assetRef.
+    /** The file is moved to the content-addressed store with StoreFile once completed. */
+    String StagingPath(const String &assetRef);
+
     /// Saves the given asset to cache.
     /// @return String the absolute path name to the asset cache entry. If not successful returns an empty string.
     String StoreAsset(AssetPtr asset);
@@ -38,20 +58,52 @@ public:
     /// @return String the absolute path name to the asset cache entry. If not successful returns an empty string.
     String StoreAsset(const u8 *data, uint numBytes, const String &assetName);
 
-    /// Return the last modified time for assetRefs cache file as seconds since 1.1.1970.
-    /// If cache file does not exist for assetRef return invalid QDateTime. You can check return value with QDateTime::isValid().
-    /// @param String assetRef Asset reference of which cache file last modified date and time will be returned.
-    /// @return QDateTime Last modified date and time of the cache file.
+    /// Moves an already written @c sourceFile to the cache as the data of @c assetRef.
+    /** If a cache entry with identical content already exists @c sourceFile is deleted instead.
+        @param contentHash Hash of the file data as returned by HashData. If 0 the file is read and hashed.
+        @return String the absolute path name to the asset cache entry. If not successful returns an empty string. */
+    String StoreFile(const String &assetRef, const String &sourceFile, u64 contentHash = 0);
+
+    /// Saves data derived from the asset @c assetRef, eg. compiled bytecode, to the cache as @c kind.
+    /** Derived data counts towards MaxSize like any other cache entry. It is deleted along with the cache entry of @c assetRef
+        and when that entry gets new content. Derived data of assets that are not cached, eg. local assets, is evicted
+        when it has not been used for the longest time.
+        @return String the absolute path name to the data. If not successful returns an empty string. */
+    String StoreDerivedData(const String &assetRef, const String &kind, const u8 *data, uint numBytes);
+
+    /// Returns the absolute path of the data derived from @c assetRef as @c kind, or an empty string if it is not in the cache.
+    String FindDerivedData(const String &assetRef, const String &kind);
+
+    /// Return the last modified time for assetRefs cache entry as seconds since 1.1.1970.
+    /// If cache entry does not exist for assetRef returns 0.
+    /// @param String assetRef Asset reference of which cache entry last modified date and time will be returned.
     unsigned LastModified(const String &assetRef);
 
-    /// Sets the last modified date and time for the assetRefs cache file.
-    /// @param String assetRef Asset reference thats cache file last modified date and time will be set.
-    /// @param QDateTime The date and time to set.
+    /// Sets the last modified date and time for the assetRefs cache entry.
+    /// @param String assetRef Asset reference thats cache entry last modified date and time will be set.
+    /// @param dateTime The date and time to set as seconds since 1.1.1970.
     /// @return bool Returns true if successful, false otherwise.
     bool SetLastModified(const String &assetRef, unsigned dateTime);
 
+    /// Returns the HTTP entity tag stored for assetRefs cache entry, or empty string if none.
+    String ETag(const String &assetRef);
+
+    /// Sets the HTTP entity tag for the assetRefs cache entry.
+    /// @return bool Returns true if successful, false if the entry does not exist.
+    bool SetETag(const String &assetRef, const String &eTag);
+
+    /// Returns the time until which assetRefs cache entry is fresh as seconds since 1.1.1970.
+    /** A fresh entry can be used without revalidating it with its source. Returns 0 if the entry
+        does not exist or has no freshness lifetime, eg. 'Cache-Control: max-age' was not given by an HTTP server. */
+    unsigned Expires(const String &assetRef);
+
+    /// Sets the time until which assetRefs cache entry is fresh as seconds since 1.1.1970.
+    /// @return bool Returns true if successful, false if the entry does not exist.
+    bool SetExpires(const String &assetRef, unsigned dateTime);
+
     /// Deletes the asset with the given assetRef from the cache, if it exists.
-    /// @param String asset reference.
+    /** The data file is removed once no other asset reference shares the same content. Data derived from the asset is deleted too.
+        @param String asset reference. */
     void DeleteAsset(const String &assetRef);
 
     /// Deletes all data and metadata files from the asset cache.
@@ -61,17 +113,89 @@ public:
     /// Get the cache directory. Returned path is guaranteed to have a trailing slash /.
     /// @return String absolute path to the caches data directory
     String CacheDirectory() const;
-    
+
+    /// Sets the maximum size of the cache in bytes. 0 means unlimited.
+    /** If the cache is currently larger than @c maxBytes, entries are evicted right away. */
+    void SetMaxSize(u64 maxBytes);
+
+    /// Returns the maximum size of the cache in bytes. 0 means unlimited.
+    u64 MaxSize() const { return maxSize; }
+
+    /// Returns the total size of the unique data in the cache in bytes.
+    u64 TotalSize() const { return totalSize; }
+
+    /// Returns the number of asset references in the cache.
+    uint NumEntries() const { return entries.Size(); }
+
+    /// Writes the index file to disk if it has changed.
+    /** The index is written to a temporary file that then replaces the previous index. */
+    void SaveIndex();
+
+    /// Periodically saves the index. Called by AssetAPI.
+    void Update(float frametime);
+
 private:
-#ifdef WIN32
-    /// Windows specific helper to open a file handle to absolutePath
-    void *OpenFileHandle(const String &absolutePath);
-#endif
+    /// Index entry for an asset reference.
+    struct Entry
+    {
+        Entry() : size(0), lastAccess(0), lastModified(0), expires(0), hasDerived(false) {}
+
+        String blob;
+        uint size;
+        uint lastAccess;
+        uint lastModified;
+        String eTag;
+        uint expires;
+        /// Asset ref this entry was derived from with StoreDerivedData, empty for asset data.
+        String source;
+        /// Whether entries derived from this one exist. Not stored in the index, rebuilt from the sources on load.
+        bool hasDerived;
+    };
+    typedef HashMap<String, Entry> EntryMap;
+
+    /// Data file shared by all entries with identical content.
+    struct Blob
+    {
+        Blob() : size(0), refs(0) {}
+
+        uint size;
+        uint refs;
+    };
+    typedef HashMap<String, Blob> BlobMap;
+
+    /// Returns the data file name for @c contentHash.
+    static String BlobName(u64 contentHash);
+    /// Returns the absolute path of a data file.
+    String BlobPath(const String &blob) const;
+    /// Returns the cache entry name for data derived from @c assetRef as @c kind.
+    static String DerivedRef(const String &assetRef, const String &kind);
+
+    /// Points @c assetRef to @c blob, releasing its previous data.
+    void SetEntryBlob(const String &assetRef, const String &blob, uint size);
+    /// Releases a reference to @c blob and deletes the data file once unused.
+    void ReleaseBlob(const String &blob);
+    /// Deletes the entries derived from @c assetRef.
+    void DeleteDerived(const String &assetRef);
+    /// Evicts least recently used entries until the cache fits to MaxSize. Never evicts @c keepRef or the entry it was derived from.
+    void EvictIfNeeded(const String &keepRef = String::EMPTY);
+
+    /// Reads the index file.
+    bool LoadIndex();
+    /// Imports files from the flat pre-index cache layout.
+    void ImportLegacyFiles();
+
     /// Cache directory, passed here from AssetAPI in the ctor.
     String cacheDirectory;
 
     /// AssetAPI ptr.
     AssetAPI *assetAPI;
+
+    EntryMap entries;
+    BlobMap blobs;
+    u64 totalSize;
+    u64 maxSize;
+    bool indexDirty;
+    float timeSinceSave;
 };
 
 }
@@ -24,6 +24,11 @@ AssetRefListener::AssetRefListener() :
 {
 }
 
+AssetRefListener::~AssetRefListener()
+{
+    SetAsset(AssetPtr());
+}
+
 AssetPtr AssetRefListener::Asset() const
 {
     return asset.Lock();
@@ -62,7 +67,7 @@ void AssetRefListener::HandleAssetRefChange(AssetAPI *assetApi, String assetRef,
     assetRef = assetRef.Trimmed();
     if (assetRef.Empty())
     {
-        asset = AssetPtr();
+        SetAsset(AssetPtr());
         return;
     }
     currentWaitingRef = "";
@@ -80,7 +85,7 @@ void AssetRefListener::HandleAssetRefChange(AssetAPI *assetApi, String assetRef,
             // Asset is loaded, emit Loaded with 1 msec delay to preserve the logic
             // that HandleAssetRefChange won't emit anything itself as before.
             // Otherwise existing connection can break/be too late after calling this function.
-            asset = loadedAsset;
+            SetAsset(loadedAsset);
             assetApi->GetFramework()->Frame()->DelayedExecute(0.0f).Connect(this, &AssetRefListener::EmitLoaded);
             return;
         }
@@ -111,7 +116,7 @@ void AssetRefListener::HandleAssetRefChange(AssetAPI *assetApi, String assetRef,
     // Disconnect from the old asset's load signal
     if (asset)
         asset->Loaded.Disconnect(this, &AssetRefListener::OnAssetLoaded);
-    asset = AssetPtr();
+    SetAsset(AssetPtr());
 }
 
 void AssetRefListener::OnTransferSucceeded(AssetPtr assetData)
@@ -120,7 +125,7 @@ void AssetRefListener::OnTransferSucceeded(AssetPtr assetData)
         return;
     
     // Connect to further reloads of the asset to be able to notify of them.
-    asset = assetData;
+    SetAsset(assetData);
     assetData->Loaded.Connect(this, &AssetRefListener::OnAssetLoaded);
     Loaded.Emit(assetData);
 }
@@ -151,13 +156,25 @@ void AssetRefListener::OnAssetCreated(AssetPtr assetData)
 
         // The asset we are waiting for has been created, hook to the IAsset::Loaded signal.
         currentWaitingRef = "";
-        asset = assetData;
+        SetAsset(assetData);
         assetData->Loaded.Connect(this, &AssetRefListener::OnAssetLoaded);
         if (myAssetAPI)
             myAssetAPI->AssetCreated.Disconnect(this, &AssetRefListener::OnAssetCreated);
     }
 }
 
+void AssetRefListener::SetAsset(const AssetPtr &newAsset)
+{
+    AssetPtr oldAsset = asset.Lock();
+    if (oldAsset == newAsset)
+        return;
+    if (oldAsset)
+        oldAsset->RemoveListener();
+    if (newAsset)
+        newAsset->AddListener();
+    asset = newAsset;
+}
+
 void AssetRefListener::EmitLoaded(float /*time*/)
 {
     AssetPtr currentAsset = asset.Lock();
@@ -6,6 +6,7 @@
 #include "AssetAPI.h"
 #include "IAssetStorage.h"
 #include "IAssetProvider.h"
+#include "MappedFile.h"
 #include "LoggingFunctions.h"
 
 #include <Urho3D/Core/Profiler.h>
@@ -15,7 +16,8 @@ namespace Tundra
 {
 
 IAsset::IAsset(AssetAPI *owner, const String &type_, const String &name_) :
-Object(owner->GetContext()), assetAPI(owner), type(type_), name(name_), diskSourceType(Programmatic), modified(false)
+Object(owner->GetContext()), lastReferenced(-1.f), assetAPI(owner), type(type_), name(name_), diskSourceType(Programmatic), modified(false),
+numListeners(0)
 {
     assert(assetAPI);
 }
@@ -148,6 +150,19 @@ bool IAsset::LoadFromFile(String filename)
         return false;
     }
 
+    // Map the file to memory to avoid copying the whole file before handing it to the decoder.
+    profile.Start(AssetProfile::DiskRead);
+    MappedFile mappedFile(filename);
+    profile.Done(AssetProfile::DiskRead);
+    if (mappedFile.IsOpen())
+    {
+        // Invoke the actual virtual function to load the asset.
+        // Do not allow asynchronous loading due the caller of this 
+        // expects the asset to be usable when this function returns.
+        return LoadFromFileInMemory(mappedFile.Data(), mappedFile.Size(), false);
+    }
+
+    // Fall back to reading the file to memory if mapping is not possible.
     Vector<u8> fileData;
     profile.Start(AssetProfile::DiskRead);
     bool success = LoadFileToVector(filename, fileData);
@@ -162,10 +177,6 @@ bool IAsset::LoadFromFile(String filename)
         LogDebug("LoadFromFile failed for file \"" + filename + "\", file size was 0!");
         return false;
     }
-
-    // Invoke the actual virtual function to load the asset.
-    // Do not allow asynchronous loading due the caller of this 
-    // expects the asset to be usable when this function returns.
     return LoadFromFileInMemory(&fileData[0], fileData.Size(), false);
 }
 
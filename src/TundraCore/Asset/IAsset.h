@@ -47,6 +47,8 @@ public:
 
     /// @cond PRIVATE
     AssetProfile profile;
+    /// Time on the AssetAPI memory budget clock when this asset was last referenced, or negative if not tracked yet.
+    float lastReferenced;
     /// @endcond
 
     enum SourceType
@@ -96,6 +98,23 @@ public:
     /// An asset can be in an unloaded state, to save memory. In this state the asset can be reloaded from its DiskSource() to enable using it.
     virtual bool IsLoaded() const = 0;
 
+    /// Returns the approximate amount of main memory used by the loaded asset data in bytes.
+    /** Used by the AssetAPI memory budget. The default implementation returns 0. */
+    virtual uint CpuMemoryUsage() const { return 0; }
+
+    /// Returns the approximate amount of GPU memory used by the loaded asset data in bytes.
+    /** Used by the AssetAPI memory budget. The default implementation returns 0. */
+    virtual uint GpuMemoryUsage() const { return 0; }
+
+    /// Returns the number of AssetRefListeners currently referring to this asset.
+    uint NumListeners() const { return numListeners; }
+
+    /// Adds an AssetRefListener reference to this asset. Intended to be only called internally by AssetRefListener.
+    void AddListener() { ++numListeners; }
+
+    /// Removes an AssetRefListener reference from this asset. Intended to be only called internally by AssetRefListener.
+    void RemoveListener() { if (numListeners > 0) --numListeners; }
+
     /// Returns true if the asset is empty. An empty asset is unloaded, and has an empty disk source.
     bool IsEmpty() const;
 
@@ -234,6 +253,9 @@ protected:
     
     /// Modified in memory -status of the asset.
     bool modified;
+
+    /// Number of AssetRefListeners referring to this asset.
+    uint numListeners;
 };
 
 }
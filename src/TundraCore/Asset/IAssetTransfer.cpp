@@ -62,6 +62,31 @@ bool IAssetTransfer::Abort()
     }
 }
 
+const u8 *IAssetTransfer::RawData() const
+{
+    if (!rawAssetData.Empty())
+        return &rawAssetData[0];
+    if (mappedAssetData)
+        return mappedAssetData->Data();
+    return 0;
+}
+
+uint IAssetTransfer::RawDataSize() const
+{
+    if (!rawAssetData.Empty())
+        return rawAssetData.Size();
+    if (mappedAssetData)
+        return mappedAssetData->Size();
+    return 0;
+}
+
+void IAssetTransfer::ReleaseRawData()
+{
+    rawAssetData.Clear();
+    rawAssetData.Compact();
+    mappedAssetData.Reset();
+}
+
 void IAssetTransfer::SetCachingBehavior(bool cachingAllowed, String diskSource)
 {
     this->cachingAllowed = cachingAllowed; 
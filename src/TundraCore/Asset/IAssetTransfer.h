@@ -7,6 +7,7 @@
 #include "AssetFwd.h"
 #include "AssetReference.h"
 #include "IAsset.h"
+#include "MappedFile.h"
 #include "Signals.h"
 
 #include <Urho3D/Container/RefCounted.h>
@@ -57,6 +58,18 @@ public:
     /// Stores the raw asset bytes for this asset.
     Vector<u8> rawAssetData;
 
+    /// Read-only memory mapped asset bytes. Providers that read local files set this instead of filling rawAssetData.
+    MappedFilePtr mappedAssetData;
+
+    /// Returns the raw asset bytes from either rawAssetData or mappedAssetData, or null if no data is present.
+    const u8 *RawData() const;
+
+    /// Returns the size of RawData in bytes.
+    uint RawDataSize() const;
+
+    /// Releases rawAssetData and mappedAssetData. Called by AssetAPI once the asset has been loaded from the data.
+    void ReleaseRawData();
+
     /// Aborts the transfer immediately. Override this function in a subclass implementation.
     /** @note Default IAssetTransfer implementation logs a not implemented warning and return false.
         @return True if abort was successful, false otherwise. */
@@ -9,6 +9,7 @@
 #include "IAssetTransfer.h"
 #include "AssetAPI.h"
 #include "IAsset.h"
+#include "MappedFile.h"
 
 #include "Framework.h"
 #include "LoggingFunctions.h"
@@ -166,6 +167,30 @@ String LocalAssetProvider::GetPathForAsset(const String &assetRef, LocalAssetSto
     return "";
 }
 
+String LocalAssetProvider::FindIndexedFile(const String &pathFilename, const String &baseDirectory, bool *baseDirectoryIndexed) const
+{
+    URHO3D_PROFILE(LocalAssetProvider_FindIndexedFile);
+
+    LocalAssetStoragePtr baseStorage = (!baseDirectory.Empty() ? FindStorageForPath(baseDirectory) : LocalAssetStoragePtr());
+    if (baseDirectoryIndexed)
+        *baseDirectoryIndexed = (baseStorage && baseStorage->recursive);
+    if (baseStorage && baseStorage->recursive)
+    {
+        String path = baseStorage->FindIndexedFile(pathFilename);
+        if (!path.Empty())
+            return path;
+    }
+    for(uint i = 0; i < storages.Size(); ++i)
+    {
+        if (storages[i] == baseStorage || !storages[i]->recursive)
+            continue;
+        String path = storages[i]->FindIndexedFile(pathFilename);
+        if (!path.Empty())
+            return path;
+    }
+    return "";
+}
+
 void LocalAssetProvider::Update(float /*frametime*/)
 {
     URHO3D_PROFILE(LocalAssetProvider_Update);
@@ -198,6 +223,7 @@ void LocalAssetProvider::DeleteAssetFromStorage(String assetRef)
         bool success = fileSystem->Delete(fullFilename);
         if (success)
         {
+            storage->UpdateIndex(fullFilename);
             LogInfo("LocalAssetProvider::DeleteAssetFromStorage: Deleted asset \"" + assetRef + "\", file " + fullFilename + " from disk.");
             framework->Asset()->EmitAssetDeletedFromStorage(assetRef);
         }
@@ -374,7 +400,14 @@ void LocalAssetProvider::CompletePendingFileDownloads()
             }
         }
 
-        bool success = LoadFileToVector(file, transfer->rawAssetData);
+        // Prefer a read-only memory mapping over copying the file content to rawAssetData.
+        transfer->mappedAssetData = new MappedFile(file);
+        bool success = transfer->mappedAssetData->IsOpen();
+        if (!success)
+        {
+            transfer->mappedAssetData.Reset();
+            success = LoadFileToVector(file, transfer->rawAssetData);
+        }
         if (!success)
         {
             String reason = "Failed to read asset data for asset \"" + ref + "\" from file \"" + file + "\"";
@@ -514,6 +547,7 @@ void LocalAssetProvider::CompletePendingFileUploads()
         }
         else
         {
+            storage->UpdateIndex(toFile);
             framework->Asset()->AssetUploadTransferCompleted(transfer.Get());
         }
     }
@@ -534,6 +568,7 @@ void LocalAssetProvider::CheckForPendingFileSystemChanges()
         {
             file = storage->directory + file;
             LogInfo(file);
+            storage->UpdateIndex(file);
             if (!storage->AutoDiscoverable())
             {
                 LogWarning("Received file change notification for storage of which auto-discovery is false.");
@@ -50,6 +50,11 @@ public:
     AssetStoragePtr StorageByName(const String &name) const override;
     /// IAssetProvider override.
     AssetStoragePtr StorageForAssetRef(const String &assetRef) const override;
+    /// Returns the absolute path of a file whose path ends with @c pathFilename from the storage file indices, or empty string if not found.
+    /** @param baseDirectory If non-empty, storages containing this directory are searched first.
+        @param baseDirectoryIndexed [out] Set to whether @c baseDirectory is inside a recursive storage, whose index covers all the files under it. */
+    String FindIndexedFile(const String &pathFilename, const String &baseDirectory = "", bool *baseDirectoryIndexed = 0) const;
+
     /// IAssetProvider override.
     AssetUploadTransferPtr UploadAssetFromFileInMemory(const u8 *data, uint numBytes, AssetStoragePtr destination, const String &assetName) override;
 
@@ -19,7 +19,8 @@ namespace Tundra
 LocalAssetStorage::LocalAssetStorage(Urho3D::Context* context, bool writable_, bool liveUpdate_, bool autoDiscoverable_) :
     IAssetStorage(context),
     recursive(true),
-    changeWatcher(0)
+    changeWatcher(0),
+    indexed(false)
 {
     // Override the parameters for the base class.
     writable = writable_;
@@ -32,50 +33,42 @@ LocalAssetStorage::~LocalAssetStorage()
     RemoveWatcher();
 }
 
+bool LocalAssetStorage::IsIgnoredPath(const String &path)
+{
+    return path.Contains(".git") || path.Contains(".svn") || path.Contains(".hg");
+}
+
 void LocalAssetStorage::LoadAllAssetsOfType(AssetAPI *assetAPI, const String &suffix, const String &assetType)
 {
-    Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
-    StringVector filenames;
-    fileSystem->ScanDir(filenames, directory, "*.*", Urho3D::SCAN_FILES, recursive);
-    foreach(String str, filenames)
-    {
-        if ((suffix == "" || str.EndsWith(suffix)) && !(str.Contains(".git") || str.Contains(".svn") || str.Contains(".hg")))
-        {
-            uint lastSlash = str.FindLast('/');
-            if (lastSlash != String::NPOS)
-                str = str.Substring(lastSlash + 1);
-            assetAPI->RequestAsset("local://" + str, assetType);
-        }
-    }
+    if (!indexed)
+        CacheStorageContents();
+
+    // Ambiguous basenames refer to the same asset, request each one only once.
+    for(CachedFileMap::const_iterator iter = cachedFiles.begin(); iter != cachedFiles.end(); iter = cachedFiles.upper_bound(iter->first))
+        if (suffix == "" || iter->first.EndsWith(suffix))
+            assetAPI->RequestAsset("local://" + iter->first, assetType);
 }
 
 void LocalAssetStorage::RefreshAssetRefs()
 {
-    Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
-    StringVector filenames;
-    fileSystem->ScanDir(filenames, directory, "*.*", Urho3D::SCAN_FILES, recursive);
+    // An explicit refresh rebuilds the file index from disk.
+    CacheStorageContents();
 
-    foreach(String str, filenames)
+    for(CachedFileMap::const_iterator iter = cachedFiles.begin(); iter != cachedFiles.end(); ++iter)
     {
-        if (!(str.Contains(".git") || str.Contains(".svn") || str.Contains(".hg")))
+        String assetRef = "local://" + iter->first;
+        if (!assetRefs.Contains(assetRef))
         {
-            String diskSource = directory + str;
-            uint lastSlash = str.FindLast('/');
-            if (lastSlash != String::NPOS)
-                str = str.Substring(lastSlash + 1);
-            String localName = str;
-            str = "local://" + str;
-            if (!assetRefs.Contains(str))
-            {
-                assetRefs.Push(str);
-                AssetChanged.Emit(this, localName, diskSource, IAssetStorage::AssetCreate);
-            }
+            assetRefs.Push(assetRef);
+            AssetChanged.Emit(this, iter->first, iter->second, IAssetStorage::AssetCreate);
         }
     }
 }
 
 void LocalAssetStorage::CacheStorageContents()
 {
+    URHO3D_PROFILE(LocalAssetStorage_CacheStorageContents);
+
     cachedFiles.clear();
     Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
     StringVector filenames;
@@ -83,7 +76,7 @@ void LocalAssetStorage::CacheStorageContents()
 
     foreach(String str, filenames)
     {
-        if (!(str.Contains(".git") || str.Contains(".svn") || str.Contains(".hg")))
+        if (!IsIgnoredPath(str))
         {
             String diskSource = directory + str;
             uint lastSlash = str.FindLast('/');
@@ -94,12 +87,84 @@ void LocalAssetStorage::CacheStorageContents()
 ///\todo This is an often-received error condition if the user is not aware, but also occurs naturally in built-in Ogre Media storages.
 /// Fix this check to occur somehow nicer (without additional constraints to asset load time) without a hardcoded check
 /// against the storage name.
-            if (cachedFiles.find(localName) != cachedFiles.end())
-                LogWarning("Warning: Asset Storage \"" + Name() + "\" contains ambiguous assets \"" + cachedFiles[localName] + "\" and \"" + diskSource + "\" in two different subdirectories!");
+            CachedFileMap::const_iterator existing = cachedFiles.find(localName);
+            if (existing != cachedFiles.end())
+                LogWarning("Warning: Asset Storage \"" + Name() + "\" contains ambiguous assets \"" + existing->second + "\" and \"" + diskSource + "\" in two different subdirectories!");
 
-            cachedFiles[localName] = diskSource;
+            cachedFiles.insert(std::make_pair(localName, diskSource));
         }
     }
+    indexed = true;
+}
+
+String LocalAssetStorage::FindIndexedFile(const String &pathFilename)
+{
+    String localName = pathFilename;
+    uint lastSlash = localName.FindLast('/');
+    if (lastSlash != String::NPOS)
+        localName = localName.Substring(lastSlash + 1);
+    if (localName.Empty())
+        return "";
+
+    // Without a change watcher the index can be stale, re-scan on a miss like before.
+    bool rescanned = false;
+    if (!indexed)
+    {
+        CacheStorageContents();
+        rescanned = true;
+    }
+
+    String path = FindCachedFile(localName, pathFilename);
+    if (path.Empty() && !changeWatcher && !rescanned)
+    {
+        CacheStorageContents();
+        path = FindCachedFile(localName, pathFilename);
+    }
+    return path;
+}
+
+String LocalAssetStorage::FindCachedFile(const String &localName, const String &pathFilename) const
+{
+    // All the files with the same basename are candidates, the relative path decides between them.
+    std::pair<CachedFileMap::const_iterator, CachedFileMap::const_iterator> range = cachedFiles.equal_range(localName);
+    for(CachedFileMap::const_iterator iter = range.first; iter != range.second; ++iter)
+    {
+        const String &path = iter->second;
+        if (!path.EndsWith(pathFilename, false))
+            continue;
+        // Match whole path components only, 'dir/asset.mesh' must not match '/otherdir/asset.mesh'.
+        if (path.Length() == pathFilename.Length() || pathFilename.StartsWith("/") || path[path.Length() - pathFilename.Length() - 1] == '/')
+            return path;
+    }
+    return "";
+}
+
+void LocalAssetStorage::UpdateIndex(const String &absoluteFilename)
+{
+    if (!indexed || IsIgnoredPath(absoluteFilename))
+        return;
+
+    String localName = absoluteFilename;
+    uint lastSlash = localName.FindLast('/');
+    if (lastSlash != String::NPOS)
+        localName = localName.Substring(lastSlash + 1);
+    if (localName.Empty())
+        return;
+
+    Urho3D::FileSystem* fileSystem = GetSubsystem<Urho3D::FileSystem>();
+    const bool exists = fileSystem->FileExists(absoluteFilename);
+    std::pair<CachedFileMap::iterator, CachedFileMap::iterator> range = cachedFiles.equal_range(localName);
+    for(CachedFileMap::iterator iter = range.first; iter != range.second; ++iter)
+    {
+        if (iter->second.Compare(absoluteFilename, false) == 0)
+        {
+            if (!exists)
+                cachedFiles.erase(iter);
+            return;
+        }
+    }
+    if (exists)
+        cachedFiles.insert(std::make_pair(localName, absoluteFilename));
 }
 
 String LocalAssetStorage::GetFullPathForAsset(const String &assetname, bool recursiveLookup)
@@ -108,22 +173,15 @@ String LocalAssetStorage::GetFullPathForAsset(const String &assetname, bool recu
     if (fileSystem->FileExists(directory + assetname))
         return directory;
 
-    std::map<String, String, StringCompareCaseInsensitive>::iterator iter = cachedFiles.find(assetname);
-    if (iter == cachedFiles.end())
-    {
-        if (!recursive || !recursiveLookup)
-            return "";
-        else
-            CacheStorageContents();
-    }
-
-    iter = cachedFiles.find(assetname);
-    if (iter != cachedFiles.end())
+    if (!recursive || !recursiveLookup)
     {
-        if (fileSystem->FileExists(iter->second))
-            return Urho3D::GetPath(iter->second);
+        CachedFileMap::const_iterator iter = cachedFiles.find(assetname);
+        return (iter != cachedFiles.end() && fileSystem->FileExists(iter->second) ? Urho3D::GetPath(iter->second) : "");
     }
 
+    String path = FindIndexedFile(assetname);
+    if (!path.Empty() && fileSystem->FileExists(path))
+        return Urho3D::GetPath(path);
     return "";
 }
 
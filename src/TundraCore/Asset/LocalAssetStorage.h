@@ -87,12 +87,36 @@ public:
     /// Walks through this storage on disk and creates a cached index of all the filenames inside this storage.
     void CacheStorageContents();
 
+    /// Returns if the file index has been built with CacheStorageContents.
+    bool IsIndexed() const { return indexed; }
+
+    /// Returns the absolute path of a file in this storage whose path ends with @c pathFilename, or empty string if not found.
+    /** The lookup uses the file index, which is built on first use and kept up to date by the change watcher.
+        If the storage has no change watcher a failed lookup re-scans the storage. */
+    String FindIndexedFile(const String &pathFilename);
+
+    /// Updates the file index for a created, modified or deleted file.
+    /** Called by LocalAssetProvider for file change notifications and uploads/deletes done through the provider. */
+    void UpdateIndex(const String &absoluteFilename);
+
 private:
     friend class LocalAssetProvider;
 
+    /// Returns if @c path should be left out of the storage, eg. version control meta data.
+    static bool IsIgnoredPath(const String &path);
+
+    /// Returns the path among the indexed files named @c localName that ends with @c pathFilename, or empty string if none.
+    String FindCachedFile(const String &localName, const String &pathFilename) const;
+
+    typedef std::multimap<String, String, StringCompareCaseInsensitive> CachedFileMap;
+
     /// Maps a file basename 'asset.mesh' to its full path 'c:\project\assets\asset.mesh'.
     /// Used to quickly lookup known assets by basename instead of having to do an expensive recursive directory search.
-    std::map<String, String, StringCompareCaseInsensitive> cachedFiles;
+    /// A basename maps to several paths if the storage has files of the same name in different subdirectories.
+    CachedFileMap cachedFiles;
+
+    /// True once cachedFiles has been built.
+    bool indexed;
 };
 
 }
@@ -0,0 +1,130 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "StableHeaders.h"
+#include "Win.h"
+#include "MappedFile.h"
+
+#include "LoggingFunctions.h"
+
+#include <Urho3D/IO/FileSystem.h>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace Tundra
+{
+
+MappedFile::MappedFile() :
+    data_(0),
+    size_(0)
+#ifdef WIN32
+    , fileHandle_(INVALID_HANDLE_VALUE),
+    mappingHandle_(0)
+#endif
+{
+}
+
+MappedFile::MappedFile(const String &filename) :
+    data_(0),
+    size_(0)
+#ifdef WIN32
+    , fileHandle_(INVALID_HANDLE_VALUE),
+    mappingHandle_(0)
+#endif
+{
+    Open(filename);
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const String &filename)
+{
+    Close();
+
+    filename_ = filename.Trimmed();
+    if (filename_.Empty())
+        return false;
+
+#ifdef WIN32
+    HANDLE file = CreateFileW(Urho3D::GetWideNativePath(filename_).CString(), GENERIC_READ, FILE_SHARE_READ, 0,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, 0);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0 || fileSize.HighPart != 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, 0, PAGE_READONLY, 0, 0, 0);
+    if (!mapping)
+    {
+        CloseHandle(file);
+        return false;
+    }
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    fileHandle_ = file;
+    mappingHandle_ = mapping;
+    data_ = static_cast<const u8*>(view);
+    size_ = static_cast<uint>(fileSize.LowPart);
+#else
+    int fd = open(Urho3D::GetNativePath(filename_).CString(), O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 || static_cast<u64>(st.st_size) > 0xFFFFFFFFULL)
+    {
+        close(fd);
+        return false;
+    }
+
+    void *view = mmap(0, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file, the descriptor is not needed anymore.
+    close(fd);
+    if (view == MAP_FAILED)
+        return false;
+    madvise(view, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+
+    data_ = static_cast<const u8*>(view);
+    size_ = static_cast<uint>(st.st_size);
+#endif
+    return true;
+}
+
+void MappedFile::Close()
+{
+#ifdef WIN32
+    if (data_)
+        UnmapViewOfFile(data_);
+    if (mappingHandle_)
+        CloseHandle(mappingHandle_);
+    if (fileHandle_ != INVALID_HANDLE_VALUE)
+        CloseHandle(fileHandle_);
+    mappingHandle_ = 0;
+    fileHandle_ = INVALID_HANDLE_VALUE;
+#else
+    if (data_)
+        munmap(const_cast<u8*>(data_), size_);
+#endif
+    data_ = 0;
+    size_ = 0;
+}
+
+}
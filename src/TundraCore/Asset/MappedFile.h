@@ -0,0 +1,55 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#pragma once
+
+#include "TundraCoreApi.h"
+#include "CoreTypes.h"
+
+#include <Urho3D/Container/RefCounted.h>
+#include <Urho3D/Container/Str.h>
+
+namespace Tundra
+{
+
+/// Read-only memory mapped view of a file.
+/** Used by the asset loading paths to hand decoders the file content without first copying it to a Vector<u8>.
+    The view is unmapped when the object is destroyed or Close() is called. */
+class TUNDRACORE_API MappedFile : public RefCounted
+{
+public:
+    MappedFile();
+    /// Maps @c filename. Check success with IsOpen().
+    explicit MappedFile(const String &filename);
+    ~MappedFile();
+
+    /// Maps @c filename to memory, closing any previously mapped file.
+    /** @return True if the file was mapped. Empty files cannot be mapped and return false. */
+    bool Open(const String &filename);
+
+    /// Unmaps the file.
+    void Close();
+
+    /// Returns if a file is currently mapped.
+    bool IsOpen() const { return data_ != 0; }
+
+    /// Returns the mapped file content, or null if not open.
+    const u8 *Data() const { return data_; }
+
+    /// Returns the size of the mapped file in bytes.
+    uint Size() const { return size_; }
+
+    /// Returns the mapped filename.
+    const String &Filename() const { return filename_; }
+
+private:
+    String filename_;
+    const u8 *data_;
+    uint size_;
+#ifdef WIN32
+    void *fileHandle_;
+    void *mappingHandle_;
+#endif
+};
+typedef SharedPtr<MappedFile> MappedFilePtr;
+
+}
@@ -261,6 +261,8 @@ struct AssetTypeInfo
     uint bundle;
     float spentLoading;
     float spentDiskRead;
+    u64 cpuMemory;
+    u64 gpuMemory;
 
     // IAssetBundle
     uint subassets;
@@ -270,7 +272,7 @@ struct AssetTypeInfo
 
     AssetTypeInfo() : loaded(0), unloaded(0), original(0),
         cached(0), programmatic(0), subassets(0), bundle(0),
-        spentLoading(0.f), spentDiskRead(0.f) {}
+        spentLoading(0.f), spentDiskRead(0.f), cpuMemory(0), gpuMemory(0) {}
 };
 
 void AssetHudPanel::UpdatePanel(float frametime, const SharedPtr<Urho3D::UIElement> &widget)
@@ -307,6 +309,13 @@ void AssetHudPanel::UpdatePanel(float frametime, const SharedPtr<Urho3D::UIEleme
             totals.spentLoading += spentLoading;
             info.spentDiskRead += spentDiskRead;
             totals.spentDiskRead += spentDiskRead;
+
+            uint cpuMemory = iter->second->CpuMemoryUsage();
+            uint gpuMemory = iter->second->GpuMemoryUsage();
+            info.cpuMemory += cpuMemory;
+            totals.cpuMemory += cpuMemory;
+            info.gpuMemory += gpuMemory;
+            totals.gpuMemory += gpuMemory;
         }
         else
         {
@@ -363,27 +372,30 @@ void AssetHudPanel::UpdatePanel(float frametime, const SharedPtr<Urho3D::UIEleme
         if (subAssets > 0)
             info.subassets += subAssets;
     }
-    str.AppendWithFormat("%s %s %s %s %s %s %s %s\n\n", PadString("", 13).CString(),
+    str.AppendWithFormat("%s %s %s %s %s %s %s %s %s %s\n\n", PadString("", 13).CString(),
         PadString("Loaded", 7).CString(), PadString("Unloaded", 9).CString(),
         PadString("Cached", 7).CString(), PadString("Original", 8).CString(),
         PadString("Bundle", 6).CString(), PadString("Load sec", 8).CString(),
-        PadString("Disk Read sec", 13).CString()
+        PadString("Disk Read sec", 13).CString(), PadString("CPU KB", 8).CString(),
+        PadString("GPU KB", 8).CString()
     );
-    str.AppendWithFormat("%s %s %s %s %s %s %s %s\n", PadString("Total", 13).CString(),
+    str.AppendWithFormat("%s %s %s %s %s %s %s %s %s %s\n", PadString("Total", 13).CString(),
         PadNonZero(totals.loaded, 7).CString(), PadNonZero(totals.unloaded, 9).CString(),
         PadNonZero(totals.cached, 7).CString(), PadNonZero(totals.original, 8).CString(),
         PadNonZero(totals.bundle, 6).CString(), PadDouble(totals.spentLoading, 8, 4).CString(),
-        PadDouble(totals.spentDiskRead, 13, 4).CString()
+        PadDouble(totals.spentDiskRead, 13, 4).CString(), PadNonZero(static_cast<uint>(totals.cpuMemory / 1024), 8).CString(),
+        PadNonZero(static_cast<uint>(totals.gpuMemory / 1024), 8).CString()
     );
     String binaryExts;
     foreach(const String &type, types)
     {
         AssetTypeInfo &info = typeInfos[type];
-        str.AppendWithFormat("%s %s %s %s %s %s %s %s", PadString(type, 13).CString(),
+        str.AppendWithFormat("%s %s %s %s %s %s %s %s %s %s", PadString(type, 13).CString(),
             PadNonZero(info.loaded, 7).CString(), PadNonZero(info.unloaded, 9).CString(),
             PadNonZero(info.cached, 7).CString(), PadNonZero(info.original, 8).CString(),
             PadNonZero(info.bundle, 6).CString(), PadDouble(info.spentLoading, 8, 4).CString(),
-            PadDouble(info.spentDiskRead, 13, 4).CString()
+            PadDouble(info.spentDiskRead, 13, 4).CString(), PadNonZero(static_cast<uint>(info.cpuMemory / 1024), 8).CString(),
+            PadNonZero(static_cast<uint>(info.gpuMemory / 1024), 8).CString()
         );
         if (info.subassets > 0)
             str.AppendWithFormat(" %u sub assets", info.subassets);
@@ -399,6 +411,13 @@ void AssetHudPanel::UpdatePanel(float frametime, const SharedPtr<Urho3D::UIEleme
     if (!binaryExts.Empty())
         str.AppendWithFormat("Binary Types          %s\n\n", binaryExts.Substring(0, binaryExts.Length()-2).CString());
 
+    // Memory budget
+    AssetAPI *assetAPI = framework_->Asset();
+    str.AppendWithFormat("Memory Budget         %s, %u referenced assets, %u unloaded by budget\n\n",
+        (assetAPI->MemoryBudget() > 0 ? String(static_cast<uint>((assetAPI->CpuMemoryUsage() + assetAPI->GpuMemoryUsage()) / (1024*1024))) +
+            " / " + String(static_cast<uint>(assetAPI->MemoryBudget() / (1024*1024))) + " MB" : String("unlimited")).CString(),
+        assetAPI->NumReferencedAssets(), assetAPI->NumEvictedAssets());
+
     // todo Transfers
     auto transfers = framework_->Asset()->PendingTransfers();
     str.AppendWithFormat("Asset Transfers       %u\n\n", transfers.Size());
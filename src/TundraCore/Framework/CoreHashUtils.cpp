@@ -0,0 +1,19 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "StableHeaders.h"
+#include "CoreHashUtils.h"
+
+namespace Tundra
+{
+
+u64 HashData(const u8 *data, uint numBytes, u64 hash)
+{
+    for(uint i = 0; i < numBytes; ++i)
+    {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+}
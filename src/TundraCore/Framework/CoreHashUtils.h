@@ -0,0 +1,18 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#pragma once
+
+#include "TundraCoreApi.h"
+#include "CoreTypes.h"
+
+namespace Tundra
+{
+
+/// Initial value for HashData.
+const u64 cHashSeed = 14695981039346656037ULL;
+
+/// Incremental 64-bit FNV-1a hash, used for content addressing eg. in the asset cache.
+/** Pass the previous return value as @c hash to hash data in several chunks. */
+u64 TUNDRACORE_API HashData(const u8 *data, uint numBytes, u64 hash = cHashSeed);
+
+}
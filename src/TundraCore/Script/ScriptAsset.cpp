@@ -4,6 +4,7 @@
 
 #include "ScriptAsset.h"
 #include "AssetAPI.h"
+#include "CoreHashUtils.h"
 #include "LoggingFunctions.h"
 
 #include <Urho3D/IO/MemoryBuffer.h>
@@ -21,6 +22,8 @@ ScriptAsset::~ScriptAsset()
 void ScriptAsset::DoUnload()
 {
     scriptContent = "";
+    contentHash = 0;
+    compiledCode.Clear();
     references.Clear();
 }
 
@@ -28,6 +31,8 @@ bool ScriptAsset::DeserializeFromData(const u8 *data, uint numBytes, bool /*allo
 {
     Urho3D::MemoryBuffer buffer(data, numBytes);
     scriptContent = buffer.ReadString();
+    contentHash = HashData(reinterpret_cast<const u8*>(scriptContent.CString()), scriptContent.Length());
+    compiledCode.Clear();
 
     ParseReferences();
     assetAPI->AssetLoadCompleted(Name());
@@ -16,7 +16,8 @@ class TUNDRACORE_API ScriptAsset : public IAsset
 
 public:
     ScriptAsset(AssetAPI *owner, const String &type_, const String &name_) :
-        IAsset(owner, type_, name_)
+        IAsset(owner, type_, name_),
+        contentHash(0)
     {
     }
 
@@ -38,8 +39,18 @@ public:
 
     String scriptContent;
 
+    /// Hash of scriptContent as returned by HashData, identifies the compiled forms of the script.
+    u64 contentHash;
+
+    /// Compiled form of scriptContent stored by the script engine that ran it, eg. Duktape bytecode.
+    /** Empty if the script has not been compiled yet. Cleared whenever the content changes. */
+    Vector<u8> compiledCode;
+
     bool IsLoaded() const;
 
+    /// IAsset override.
+    uint CpuMemoryUsage() const override { return scriptContent.Capacity() + compiledCode.Capacity(); }
+
 private:
     /// Unload script asset
     virtual void DoUnload();
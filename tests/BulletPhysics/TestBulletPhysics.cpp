@@ -0,0 +1,442 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "TestRunner.h"
+
+#include "BulletPhysics.h"
+#include "PhysicsWorld.h"
+#include "RigidBody.h"
+#include "VolumeTrigger.h"
+#include "Placeable.h"
+#include "Entity.h"
+#include "SceneAPI.h"
+
+#include <btBulletDynamicsCommon.h>
+
+#include <cmath>
+
+using namespace Tundra;
+using namespace Tundra::Test;
+
+static const uint cNumBodies = 1024;
+static const uint cNumSteps = 240;
+
+/// Creates a static body with a shape and transform of its own, bypassing the RigidBody attributes. Returns the entity ID.
+static entity_id_t AddQueryBody(Scene* scene, btCollisionShape* shape, const btVector3& position)
+{
+    EntityPtr entity = scene->CreateEntity();
+    SharedPtr<RigidBody> body = entity->CreateComponent<RigidBody>();
+    body->mass.Set(0.0f, AttributeChange::Default);
+    btRigidBody* bulletBody = body->BulletRigidBody();
+    if (!bulletBody)
+        return 0;
+    bulletBody->setCollisionShape(shape);
+    bulletBody->setWorldTransform(btTransform(btQuaternion::getIdentity(), position));
+    scene->Subsystem<PhysicsWorld>()->BulletWorld()->updateSingleAabb(bulletBody);
+    return entity->Id();
+}
+
+/// Records the attribute changes of a component and the moved bodies signalled by a physics world.
+struct MotionRecorder
+{
+    MotionRecorder() : numLocalChanges(0), numOtherChanges(0), numVelocityChanges(0), numBodiesMoved(0), numLinearMoved(0), numAngularMoved(0) {}
+
+    void OnAttributeChanged(IAttribute* attribute, AttributeChange::Type change)
+    {
+        if (change == AttributeChange::LocalOnly)
+            ++numLocalChanges;
+        else
+            ++numOtherChanges;
+        if (attribute->Id() == "linearVelocity" || attribute->Id() == "angularVelocity")
+            ++numVelocityChanges;
+    }
+
+    void OnBodiesMoved(const PODVector<RigidBody*>& bodies)
+    {
+        numBodiesMoved += bodies.Size();
+        for(uint i = 0; i < bodies.Size(); ++i)
+        {
+            if (bodies[i]->LinearVelocityMoved())
+                ++numLinearMoved;
+            if (bodies[i]->AngularVelocityMoved())
+                ++numAngularMoved;
+        }
+    }
+
+    int numLocalChanges;
+    int numOtherChanges;
+    int numVelocityChanges;
+    uint numBodiesMoved;
+    uint numLinearMoved;
+    uint numAngularMoved;
+};
+
+/// Counts the collision signals of a physics world or a rigid body.
+struct CollisionRecorder
+{
+    CollisionRecorder() : numCollisions(0), numNewFlags(0), numNewCollisions(0), numEntered(0) {}
+
+    void OnWorldCollision(Entity* /*entityA*/, Entity* /*entityB*/, const float3& /*position*/, const float3& /*normal*/, float /*distance*/, float /*impulse*/, bool newCollision)
+    {
+        ++numCollisions;
+        if (newCollision)
+            ++numNewFlags;
+    }
+
+    void OnWorldNewCollision(Entity* /*entityA*/, Entity* /*entityB*/, const float3& /*position*/, const float3& /*normal*/, float /*distance*/, float /*impulse*/)
+    {
+        ++numNewCollisions;
+    }
+
+    void OnBodyCollision(Entity* /*otherEntity*/, const float3& /*position*/, const float3& /*normal*/, float /*distance*/, float /*impulse*/, bool newCollision)
+    {
+        ++numCollisions;
+        if (newCollision)
+            ++numNewFlags;
+    }
+
+    void OnBodyNewCollision(Entity* /*otherEntity*/, const float3& /*position*/, const float3& /*normal*/, float /*distance*/, float /*impulse*/)
+    {
+        ++numNewCollisions;
+    }
+
+    void OnEntityEnter(Entity* /*entity*/)
+    {
+        ++numEntered;
+    }
+
+    uint numCollisions;
+    uint numNewFlags;
+    uint numNewCollisions;
+    uint numEntered;
+};
+
+/// Creates an entity with a placeable at @c position and a rigid body.
+static SharedPtr<RigidBody> AddBody(Scene* scene, const float3& position, RigidBody::ShapeType shapeType, const float3& size, float mass)
+{
+    EntityPtr entity = scene->CreateEntity();
+    SharedPtr<Placeable> placeable = entity->CreateComponent<Placeable>();
+    placeable->transform.Set(Transform(position, float3::zero, float3::one), AttributeChange::Default);
+    SharedPtr<RigidBody> body = entity->CreateComponent<RigidBody>();
+    body->shapeType.Set(shapeType, AttributeChange::Default);
+    body->size.Set(size, AttributeChange::Default);
+    body->mass.Set(mass, AttributeChange::Default);
+    return body;
+}
+
+/// Runs @c numSteps physics steps of 1/60 seconds, keeping @c body from falling asleep.
+static void SimulateSteps(PhysicsWorld* world, RigidBody* body, uint numSteps)
+{
+    for(uint i = 0; i < numSteps; ++i)
+    {
+        body->KeepActive();
+        world->Simulate(1.0f / 60.0f);
+    }
+}
+
+/// Appends a query of 6 floats to a batch input.
+static void PushQuery(PODVector<float>& input, float a, float b, float c, float d, float e, float f)
+{
+    input.Push(a); input.Push(b); input.Push(c);
+    input.Push(d); input.Push(e); input.Push(f);
+}
+
+/// Appends a sphere overlap query to a batch input.
+static void PushSphere(PODVector<float>& input, float x, float y, float z, float radius)
+{
+    input.Push(x); input.Push(y); input.Push(z);
+    input.Push(radius);
+}
+
+TEST_F(Runner, PhysicsBenchmarkDeterminism)
+{
+    PhysicsBenchmarkResult first = PhysicsWorld::RunBenchmark(false, cNumBodies, cNumSteps);
+    PhysicsBenchmarkResult second = PhysicsWorld::RunBenchmark(false, cNumBodies, cNumSteps);
+    ASSERT_EQ(first.positions.Size(), cNumBodies);
+    ASSERT_EQ(second.positions.Size(), cNumBodies);
+
+    // The same scene simulated by the single-threaded world must end up exactly the same, with the boxes at rest on the ground
+    for (uint i = 0; i < cNumBodies; ++i)
+    {
+        ASSERT_EQ(first.positions[i].x, second.positions[i].x);
+        ASSERT_EQ(first.positions[i].y, second.positions[i].y);
+        ASSERT_EQ(first.positions[i].z, second.positions[i].z);
+        ASSERT_TRUE(first.positions[i].y > 0.f);
+    }
+    Log("Single-threaded " + String(first.msec / cNumSteps) + " ms per step", 4);
+}
+
+TEST_F(Runner, PhysicsMultithreadedWorld)
+{
+    const int numThreads = PhysicsWorld::SetNumThreads(4);
+    if (numThreads == 0)
+    {
+        Log("Bullet was built without multithreading, skipping", 4);
+        return;
+    }
+
+    PhysicsBenchmarkResult single = PhysicsWorld::RunBenchmark(false, cNumBodies, cNumSteps);
+    PhysicsBenchmarkResult multi = PhysicsWorld::RunBenchmark(true, cNumBodies, cNumSteps);
+    PhysicsWorld::SetNumThreads(0);
+    ASSERT_TRUE(multi.multithreaded);
+    ASSERT_EQ(multi.positions.Size(), cNumBodies);
+
+    // The islands may be solved in a different order, but the resting boxes must end up in the same places
+    float maxDeviation = 0.f;
+    for (uint i = 0; i < cNumBodies; ++i)
+        maxDeviation = Urho3D::Max(maxDeviation, single.positions[i].Distance(multi.positions[i]));
+    EXPECT_LT(maxDeviation, 0.05f);
+
+    Log("Single-threaded " + String(single.msec / cNumSteps) + " ms per step, " + String(numThreads) + " threads " +
+        String(multi.msec / cNumSteps) + " ms per step, largest difference " + String(maxDeviation), 4);
+}
+
+TEST_F(Runner, PhysicsQueryBatches)
+{
+    framework->RegisterModule(new BulletPhysics(framework.Get()));
+    framework->ModuleByName("BulletPhysics")->Initialize();
+
+    // Box in front of the origin, two spheres in a compound shape behind it, and a triangle mesh ground plane below
+    btBoxShape box(btVector3(1.0f, 1.0f, 1.0f));
+    btSphereShape sphere(1.0f);
+    btCompoundShape compound;
+    compound.addChildShape(btTransform(btQuaternion::getIdentity(), btVector3(-3.0f, 0.0f, 0.0f)), &sphere);
+    compound.addChildShape(btTransform(btQuaternion::getIdentity(), btVector3(3.0f, 0.0f, 0.0f)), &sphere);
+    btTriangleMesh groundMesh;
+    groundMesh.addTriangle(btVector3(-20.0f, -5.0f, -20.0f), btVector3(-20.0f, -5.0f, 20.0f), btVector3(20.0f, -5.0f, 20.0f));
+    groundMesh.addTriangle(btVector3(-20.0f, -5.0f, -20.0f), btVector3(20.0f, -5.0f, 20.0f), btVector3(20.0f, -5.0f, -20.0f));
+    btBvhTriangleMeshShape ground(&groundMesh, true);
+
+    ScenePtr physicsScene = framework->Scene()->CreateScene("PhysicsQueries", false, true);
+    PhysicsWorld* world = physicsScene->Subsystem<PhysicsWorld>().Get();
+    ASSERT_TRUE(world != 0);
+    const entity_id_t boxId = AddQueryBody(physicsScene.Get(), &box, btVector3(0.0f, 0.0f, -10.0f));
+    const entity_id_t compoundId = AddQueryBody(physicsScene.Get(), &compound, btVector3(0.0f, 0.0f, 10.0f));
+    const entity_id_t groundId = AddQueryBody(physicsScene.Get(), &ground, btVector3(0.0f, 0.0f, 0.0f));
+    ASSERT_TRUE(boxId && compoundId && groundId);
+
+    // Enough rays for several work items: towards the box, into the empty sky and down to the ground
+    const uint cNumRayRepeats = 100;
+    PODVector<float> rays;
+    for (uint i = 0; i < cNumRayRepeats; ++i)
+    {
+        PushQuery(rays, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f);
+        PushQuery(rays, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+        PushQuery(rays, 8.0f, 0.0f, 2.0f, 0.0f, -2.0f, 0.0f);
+    }
+    PhysicsQueryBatchResult rayResult = world->RaycastBatch(rays, 100.0f);
+    ASSERT_EQ(rayResult.entityIds.Size(), 3 * cNumRayRepeats);
+    ASSERT_EQ(rayResult.hits.Size(), 3 * cNumRayRepeats * PhysicsQueryBatchResult::cHitStride);
+    ASSERT_TRUE(rayResult.offsets.Empty());
+    for (uint i = 0; i < cNumRayRepeats; ++i)
+    {
+        const float* boxHit = &rayResult.hits[(3 * i) * PhysicsQueryBatchResult::cHitStride];
+        ASSERT_EQ(rayResult.entityIds[3 * i], boxId);
+        EXPECT_NEAR(boxHit[0], 9.0f, 1e-3f);
+        EXPECT_NEAR(boxHit[3], -9.0f, 1e-3f);
+        EXPECT_NEAR(boxHit[6], 1.0f, 1e-3f);
+
+        const float* missHit = &rayResult.hits[(3 * i + 1) * PhysicsQueryBatchResult::cHitStride];
+        ASSERT_EQ(rayResult.entityIds[3 * i + 1], 0U);
+        for (uint j = 0; j < PhysicsQueryBatchResult::cHitStride; ++j)
+            ASSERT_EQ(missHit[j], 0.0f);
+
+        const float* groundHit = &rayResult.hits[(3 * i + 2) * PhysicsQueryBatchResult::cHitStride];
+        ASSERT_EQ(rayResult.entityIds[3 * i + 2], groundId);
+        EXPECT_NEAR(groundHit[0], 5.0f, 1e-3f);
+        EXPECT_NEAR(groundHit[2], -5.0f, 1e-3f);
+        EXPECT_NEAR(fabs(groundHit[5]), 1.0f, 1e-3f);
+    }
+
+    // The distance of a sweep is the distance travelled by the center of the sphere until the hit
+    PODVector<float> sweeps;
+    PushQuery(sweeps, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -20.0f);
+    PushQuery(sweeps, 8.0f, 0.0f, 2.0f, 8.0f, -10.0f, 2.0f);
+    PushQuery(sweeps, 0.0f, 0.0f, 0.0f, 0.0f, 10.0f, 0.0f);
+    PhysicsQueryBatchResult sweepResult = world->SphereSweepBatch(sweeps, 0.5f);
+    ASSERT_EQ(sweepResult.entityIds.Size(), 3U);
+    ASSERT_EQ(sweepResult.entityIds[0], boxId);
+    EXPECT_NEAR(sweepResult.hits[0], 8.5f, 0.1f);
+    ASSERT_EQ(sweepResult.entityIds[1], groundId);
+    EXPECT_NEAR(sweepResult.hits[PhysicsQueryBatchResult::cHitStride], 4.5f, 0.1f);
+    ASSERT_EQ(sweepResult.entityIds[2], 0U);
+
+    // Overlaps are exact against the children of the compound and the triangles of the mesh, not just their bounding boxes
+    PODVector<float> spheres;
+    PushSphere(spheres, 3.0f, 0.0f, 10.0f, 0.5f); // Compound child
+    PushSphere(spheres, 0.0f, 0.0f, 10.0f, 0.5f); // Between the compound children
+    PushSphere(spheres, 8.0f, -4.5f, 2.0f, 1.0f); // Ground
+    PushSphere(spheres, 8.0f, -3.0f, 2.0f, 1.0f); // Above the ground
+    PushSphere(spheres, 0.0f, -4.0f, -10.0f, 3.5f); // Box and ground
+    PhysicsQueryBatchResult overlapResult = world->SphereOverlapBatch(spheres);
+    ASSERT_TRUE(overlapResult.hits.Empty());
+    ASSERT_EQ(overlapResult.offsets.Size(), 6U);
+    const uint expectedOffsets[6] = { 0, 1, 1, 2, 2, 4 };
+    for (uint i = 0; i < 6; ++i)
+        ASSERT_EQ(overlapResult.offsets[i], expectedOffsets[i]);
+    ASSERT_EQ(overlapResult.entityIds.Size(), 4U);
+    ASSERT_EQ(overlapResult.entityIds[0], compoundId);
+    ASSERT_EQ(overlapResult.entityIds[1], groundId);
+    ASSERT_TRUE(overlapResult.entityIds.Contains(boxId));
+    ASSERT_NE(overlapResult.entityIds[2], overlapResult.entityIds[3]);
+
+    // The bodies refer to the shapes of the test, so destroy them first
+    physicsScene.Reset();
+    framework->Scene()->RemoveScene("PhysicsQueries");
+}
+
+TEST_F(Runner, PhysicsMovedBodies)
+{
+    framework->RegisterModule(new BulletPhysics(framework.Get()));
+    framework->ModuleByName("BulletPhysics")->Initialize();
+    // Placeable is provided by the renderer, but does not need a graphics world
+    framework->Scene()->RegisterComponentFactory(ComponentFactoryPtr(new GenericComponentFactory<Placeable>()));
+
+    ScenePtr physicsScene = framework->Scene()->CreateScene("PhysicsMotion", false, true);
+    PhysicsWorld* world = physicsScene->Subsystem<PhysicsWorld>().Get();
+    ASSERT_TRUE(world != 0);
+    world->SetGravity(float3(0.0f, 0.0f, 0.0f));
+
+    EntityPtr entity = physicsScene->CreateEntity();
+    SharedPtr<Placeable> placeable = entity->CreateComponent<Placeable>();
+    SharedPtr<RigidBody> body = entity->CreateComponent<RigidBody>();
+    body->shapeType.Set(RigidBody::Sphere, AttributeChange::Default);
+    body->mass.Set(1.0f, AttributeChange::Default);
+    body->linearVelocity.Set(float3(1.0f, 0.0f, 0.0f), AttributeChange::Default);
+    ASSERT_TRUE(body->BulletRigidBody() != 0);
+
+    MotionRecorder transformRecorder;
+    MotionRecorder bodyRecorder;
+    placeable->AttributeChanged.Connect(&transformRecorder, &MotionRecorder::OnAttributeChanged);
+    body->AttributeChanged.Connect(&bodyRecorder, &MotionRecorder::OnAttributeChanged);
+    world->BodiesMoved.Connect(&bodyRecorder, &MotionRecorder::OnBodiesMoved);
+
+    // Without gravity the body keeps its velocity: the transform is signalled every step, but the velocities never change
+    const uint cNumSteps = 30;
+    for(uint i = 0; i < cNumSteps; ++i)
+        world->Simulate(1.0f / 30.0f);
+    ASSERT_GT(bodyRecorder.numBodiesMoved, 0U);
+    EXPECT_EQ(transformRecorder.numLocalChanges, (int)bodyRecorder.numBodiesMoved);
+    EXPECT_EQ(transformRecorder.numOtherChanges, 0);
+    EXPECT_EQ(bodyRecorder.numVelocityChanges, 0);
+    EXPECT_EQ(bodyRecorder.numLinearMoved, 0U);
+    EXPECT_EQ(bodyRecorder.numAngularMoved, 0U);
+    EXPECT_GT(placeable->transform.Get().pos.x, 0.5f);
+
+    // With gravity the linear velocity changes on each step and is signalled locally, the angular velocity stays unchanged
+    world->SetGravity(float3(0.0f, -9.81f, 0.0f));
+    const uint numMovedBefore = bodyRecorder.numBodiesMoved;
+    for(uint i = 0; i < cNumSteps; ++i)
+        world->Simulate(1.0f / 30.0f);
+    const uint numMoved = bodyRecorder.numBodiesMoved - numMovedBefore;
+    ASSERT_GT(numMoved, 0U);
+    EXPECT_EQ(bodyRecorder.numLinearMoved, numMoved);
+    EXPECT_EQ(bodyRecorder.numAngularMoved, 0U);
+    EXPECT_EQ(bodyRecorder.numVelocityChanges, (int)numMoved);
+    EXPECT_EQ(bodyRecorder.numOtherChanges, 0);
+    EXPECT_EQ(transformRecorder.numOtherChanges, 0);
+    EXPECT_LT(body->linearVelocity.Get().y, -1.0f);
+    EXPECT_LT(placeable->transform.Get().pos.y, 0.0f);
+
+    // The flags are valid only during the signal
+    EXPECT_FALSE(body->LinearVelocityMoved());
+
+    world->BodiesMoved.Disconnect(&bodyRecorder, &MotionRecorder::OnBodiesMoved);
+    entity.Reset();
+    body.Reset();
+    placeable.Reset();
+    physicsScene.Reset();
+    framework->Scene()->RemoveScene("PhysicsMotion");
+}
+
+TEST_F(Runner, PhysicsCollisionSignals)
+{
+    framework->RegisterModule(new BulletPhysics(framework.Get()));
+    framework->ModuleByName("BulletPhysics")->Initialize();
+    framework->Scene()->RegisterComponentFactory(ComponentFactoryPtr(new GenericComponentFactory<Placeable>()));
+
+    ScenePtr physicsScene = framework->Scene()->CreateScene("PhysicsCollisions", false, true);
+    PhysicsWorld* world = physicsScene->Subsystem<PhysicsWorld>().Get();
+    ASSERT_TRUE(world != 0);
+
+    // A ball dropped on a static ground box lands after about half a second
+    SharedPtr<RigidBody> ground = AddBody(physicsScene.Get(), float3(0.0f, 0.0f, 0.0f), RigidBody::Box, float3(20.0f, 1.0f, 20.0f), 0.0f);
+    SharedPtr<RigidBody> ball = AddBody(physicsScene.Get(), float3(0.0f, 2.0f, 0.0f), RigidBody::Sphere, float3(1.0f, 1.0f, 1.0f), 1.0f);
+    ASSERT_TRUE(ground->BulletRigidBody() != 0 && ball->BulletRigidBody() != 0);
+
+    CollisionRecorder worldRecorder;
+    CollisionRecorder ballRecorder;
+    world->PhysicsCollision.Connect(&worldRecorder, &CollisionRecorder::OnWorldCollision);
+    world->NewPhysicsCollision.Connect(&worldRecorder, &CollisionRecorder::OnWorldNewCollision);
+    ball->PhysicsCollision.Connect(&ballRecorder, &CollisionRecorder::OnBodyCollision);
+    ball->NewPhysicsCollision.Connect(&ballRecorder, &CollisionRecorder::OnBodyNewCollision);
+
+    // The contact is new once, and keeps being signalled as an ongoing collision while the ball rests on the ground
+    SimulateSteps(world, ball, 60);
+    ASSERT_EQ(worldRecorder.numNewCollisions, 1U);
+    ASSERT_EQ(worldRecorder.numNewFlags, 1U);
+    ASSERT_GT(worldRecorder.numCollisions, 10U);
+    ASSERT_EQ(ballRecorder.numNewCollisions, 1U);
+    ASSERT_EQ(ballRecorder.numNewFlags, 1U);
+    ASSERT_GT(ballRecorder.numCollisions, 10U);
+    ASSERT_EQ(world->PreviousFrameCollisions().Size(), 1U);
+
+    // Without listeners no signals are built, but the pair is still tracked so that the collision is not new to a later listener
+    world->PhysicsCollision.Disconnect(&worldRecorder, &CollisionRecorder::OnWorldCollision);
+    world->NewPhysicsCollision.Disconnect(&worldRecorder, &CollisionRecorder::OnWorldNewCollision);
+    ball->PhysicsCollision.Disconnect(&ballRecorder, &CollisionRecorder::OnBodyCollision);
+    ball->NewPhysicsCollision.Disconnect(&ballRecorder, &CollisionRecorder::OnBodyNewCollision);
+    SimulateSteps(world, ball, 10);
+    ASSERT_EQ(world->PreviousFrameCollisions().Size(), 1U);
+
+    CollisionRecorder lateRecorder;
+    world->PhysicsCollision.Connect(&lateRecorder, &CollisionRecorder::OnWorldCollision);
+    world->NewPhysicsCollision.Connect(&lateRecorder, &CollisionRecorder::OnWorldNewCollision);
+    SimulateSteps(world, ball, 10);
+    ASSERT_GT(lateRecorder.numCollisions, 0U);
+    ASSERT_EQ(lateRecorder.numNewFlags, 0U);
+    ASSERT_EQ(lateRecorder.numNewCollisions, 0U);
+
+    // With reporting disabled on both bodies the pair is neither tracked nor signalled
+    ball->PhysicsCollision.Connect(&ballRecorder, &CollisionRecorder::OnBodyCollision);
+    ground->SetCollisionReportingEnabled(false);
+    ball->SetCollisionReportingEnabled(false);
+    const uint numWorldCollisions = lateRecorder.numCollisions;
+    const uint numBallCollisions = ballRecorder.numCollisions;
+    SimulateSteps(world, ball, 10);
+    ASSERT_EQ(lateRecorder.numCollisions, numWorldCollisions);
+    ASSERT_EQ(ballRecorder.numCollisions, numBallCollisions);
+    ASSERT_TRUE(world->PreviousFrameCollisions().Empty());
+
+    // A reporting ground brings the pair back as a new collision for the world, the ball itself still does not signal
+    ground->SetCollisionReportingEnabled(true);
+    SimulateSteps(world, ball, 10);
+    ASSERT_GT(lateRecorder.numCollisions, numWorldCollisions);
+    ASSERT_EQ(lateRecorder.numNewCollisions, 1U);
+    ASSERT_EQ(ballRecorder.numCollisions, numBallCollisions);
+    world->PhysicsCollision.Disconnect(&lateRecorder, &CollisionRecorder::OnWorldCollision);
+    world->NewPhysicsCollision.Disconnect(&lateRecorder, &CollisionRecorder::OnWorldNewCollision);
+    ball->PhysicsCollision.Disconnect(&ballRecorder, &CollisionRecorder::OnBodyCollision);
+
+    // A volume trigger listens to its own body, it still sees bodies that do not report collisions pass through it
+    SharedPtr<RigidBody> triggerBody = AddBody(physicsScene.Get(), float3(30.0f, 0.0f, 0.0f), RigidBody::Box, float3(4.0f, 4.0f, 4.0f), 0.0f);
+    triggerBody->phantom.Set(true, AttributeChange::Default);
+    SharedPtr<VolumeTrigger> trigger = triggerBody->ParentEntity()->CreateComponent<VolumeTrigger>();
+    SharedPtr<RigidBody> falling = AddBody(physicsScene.Get(), float3(30.0f, 3.0f, 0.0f), RigidBody::Sphere, float3(1.0f, 1.0f, 1.0f), 1.0f);
+    falling->SetCollisionReportingEnabled(false);
+    CollisionRecorder triggerRecorder;
+    trigger->EntityEnter.Connect(&triggerRecorder, &CollisionRecorder::OnEntityEnter);
+    SimulateSteps(world, falling, 30);
+    ASSERT_EQ(triggerRecorder.numEntered, 1U);
+    ASSERT_EQ(trigger->NumEntitiesInside(), 1U);
+
+    trigger->EntityEnter.Disconnect(&triggerRecorder, &CollisionRecorder::OnEntityEnter);
+    trigger.Reset();
+    triggerBody.Reset();
+    falling.Reset();
+    ground.Reset();
+    ball.Reset();
+    physicsScene.Reset();
+    framework->Scene()->RemoveScene("PhysicsCollisions");
+}
+
+TUNDRA_TEST_MAIN();
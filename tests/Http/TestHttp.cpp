@@ -0,0 +1,723 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "TestRunner.h"
+#include "TestBenchmark.h"
+
+#include "HttpClient.h"
+#include "HttpRequest.h"
+#include "HttpDefines.h"
+#include "HttpPlugin.h"
+#include "HttpAsset/HttpAssetProvider.h"
+#include "AssetAPI.h"
+#include "AssetCache.h"
+#include "BinaryAsset.h"
+#include "CoreHashUtils.h"
+
+#include <Urho3D/Core/Mutex.h>
+#include <Urho3D/Core/Thread.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/Math/MathDefs.h>
+
+#include <curl/curl.h>
+
+#include <atomic>
+#include <string>
+
+#ifdef _WIN32
+#include <winsock2.h>
+typedef SOCKET SocketHandle;
+#else
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+typedef int SocketHandle;
+#define INVALID_SOCKET (-1)
+#define closesocket close
+#endif
+
+using namespace Tundra;
+using namespace Tundra::Test;
+
+/// Minimal keep-alive HTTP/1.1 server on 127.0.0.1 that answers every request with the same body.
+/** If an ETag is set, requests with a matching 'If-None-Match' header are answered '304 Not Modified'.
+    Clients that open the connection with the HTTP/2 preface are answered over HTTP/2 without TLS,
+    each request stream with a 200 response that has only a 'content-length' header. */
+class LocalHttpServer : public Urho3D::Thread
+{
+public:
+    LocalHttpServer() :
+        listener_(INVALID_SOCKET),
+        port_(0),
+        numConnections(0),
+        numRequests(0),
+        numNotModified(0),
+        maxStreamId(0)
+    {
+        body_ = "Hello from a local Tundra test server";
+    }
+
+    ~LocalHttpServer()
+    {
+        Stop();
+        for (uint i = 0; i < clients_.Size(); ++i)
+            closesocket(clients_[i].socket);
+        if (listener_ != INVALID_SOCKET)
+            closesocket(listener_);
+#ifdef _WIN32
+        WSACleanup();
+#endif
+    }
+
+    bool Start()
+    {
+#ifdef _WIN32
+        WSADATA wsaData;
+        WSAStartup(MAKEWORD(2, 2), &wsaData);
+#endif
+        listener_ = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (listener_ == INVALID_SOCKET)
+            return false;
+
+        sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0; // Any free port
+        if (bind(listener_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(listener_, 64) != 0)
+            return false;
+
+        socklen_t len = sizeof(addr);
+        if (getsockname(listener_, reinterpret_cast<sockaddr*>(&addr), &len) != 0)
+            return false;
+        port_ = ntohs(addr.sin_port);
+        return Run();
+    }
+
+    String Url(const String &path) const
+    {
+        return Urho3D::ToString("http://127.0.0.1:%d", port_) + path;
+    }
+
+    const String &Body() const { return body_; }
+
+    /// Sets the response to the following requests. Empty @c eTag or @c cacheControl leaves out the header.
+    void SetResponse(const String &body, const String &eTag, const String &cacheControl)
+    {
+        Urho3D::MutexLock lock(mutex_);
+        body_ = body;
+        eTag_ = eTag;
+        cacheControl_ = cacheControl;
+    }
+
+    void ThreadFunction() override
+    {
+        while (shouldRun_)
+        {
+            fd_set readable;
+            FD_ZERO(&readable);
+            FD_SET(listener_, &readable);
+            SocketHandle maxSocket = listener_;
+            for (uint i = 0; i < clients_.Size(); ++i)
+            {
+                FD_SET(clients_[i].socket, &readable);
+                if (clients_[i].socket > maxSocket)
+                    maxSocket = clients_[i].socket;
+            }
+
+            timeval timeout;
+            timeout.tv_sec = 0;
+            timeout.tv_usec = 10000;
+            if (select(static_cast<int>(maxSocket + 1), &readable, 0, 0, &timeout) <= 0)
+                continue;
+
+            if (FD_ISSET(listener_, &readable))
+            {
+                SocketHandle client = accept(listener_, 0, 0);
+                if (client != INVALID_SOCKET)
+                {
+                    Client c;
+                    c.socket = client;
+                    c.http2 = false;
+                    clients_.Push(c);
+                    ++numConnections;
+                }
+            }
+
+            for (uint i = 0; i < clients_.Size(); ++i)
+            {
+                if (!FD_ISSET(clients_[i].socket, &readable))
+                    continue;
+                if (!Serve(clients_[i]))
+                {
+                    closesocket(clients_[i].socket);
+                    clients_.Erase(i);
+                    --i;
+                }
+            }
+        }
+    }
+
+    std::atomic<uint> numConnections;
+    std::atomic<uint> numRequests;
+    std::atomic<uint> numNotModified;
+    /// Highest HTTP/2 stream id that has been answered.
+    std::atomic<uint> maxStreamId;
+
+private:
+    struct Client
+    {
+        SocketHandle socket;
+        String received;
+        bool http2;
+        std::string frames;
+    };
+
+    enum Http2FrameType
+    {
+        FrameData = 0,
+        FrameHeaders = 1,
+        FrameSettings = 4,
+        FramePing = 6,
+        FrameContinuation = 9
+    };
+
+    enum Http2FrameFlags
+    {
+        FlagAck = 0x1,
+        FlagEndStream = 0x1,
+        FlagEndHeaders = 0x4
+    };
+
+    /// Reads from @c client and answers all complete requests. Returns false if the connection was closed.
+    bool Serve(Client &client)
+    {
+        char buffer[4096];
+        int num = recv(client.socket, buffer, sizeof(buffer), 0);
+        if (num <= 0)
+            return false;
+
+        if (client.http2)
+        {
+            client.frames.append(buffer, num);
+            return ServeHttp2(client);
+        }
+        else if (client.received.Empty())
+        {
+            // A HTTP/2 client with prior knowledge opens the connection with the preface instead of a request
+            const char *cHttp2Preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+            const size_t cHttp2PrefaceLength = 24;
+            client.frames.append(buffer, num);
+            if (memcmp(client.frames.data(), cHttp2Preface, Urho3D::Min(client.frames.size(), cHttp2PrefaceLength)) == 0)
+            {
+                if (client.frames.size() < cHttp2PrefaceLength)
+                    return true;
+                // The server connection preface is a SETTINGS frame, all settings are left to their defaults
+                client.http2 = true;
+                client.frames.erase(0, cHttp2PrefaceLength);
+                if (!SendFrame(client, FrameSettings, 0, 0, ""))
+                    return false;
+                return ServeHttp2(client);
+            }
+            client.received.Append(client.frames.data(), static_cast<uint>(client.frames.size()));
+            client.frames.clear();
+        }
+        else
+            client.received.Append(buffer, num);
+
+        uint end = 0;
+        while ((end = client.received.Find("\r\n\r\n")) != String::NPOS)
+        {
+            String response = Respond(client.received.Substring(0, end + 2));
+            client.received = client.received.Substring(end + 4);
+            if (send(client.socket, response.CString(), response.Length(), 0) != static_cast<int>(response.Length()))
+                return false;
+            ++numRequests;
+        }
+        return true;
+    }
+
+    /// Answers all complete HTTP/2 frames received from @c client. Returns false if sending failed.
+    bool ServeHttp2(Client &client)
+    {
+        while (client.frames.size() >= 9)
+        {
+            const u8 *header = reinterpret_cast<const u8*>(client.frames.data());
+            uint length = (header[0] << 16) | (header[1] << 8) | header[2];
+            if (client.frames.size() < 9 + length)
+                break;
+            u8 type = header[3];
+            u8 flags = header[4];
+            uint streamId = ((header[5] & 0x7f) << 24) | (header[6] << 16) | (header[7] << 8) | header[8];
+            std::string payload = client.frames.substr(9, length);
+            client.frames.erase(0, 9 + length);
+
+            // Request header blocks are not decoded, every request is answered with the body. WINDOW_UPDATE, PRIORITY,
+            // RST_STREAM and GOAWAY frames are ignored.
+            bool sent = true;
+            if (type == FrameSettings && !(flags & FlagAck))
+                sent = SendFrame(client, FrameSettings, FlagAck, 0, "");
+            else if (type == FramePing && !(flags & FlagAck))
+                sent = SendFrame(client, FramePing, FlagAck, 0, payload);
+            else if ((type == FrameHeaders || type == FrameContinuation) && (flags & FlagEndHeaders))
+            {
+                String body;
+                {
+                    Urho3D::MutexLock lock(mutex_);
+                    body = body_;
+                }
+                // HPACK: indexed ':status: 200' and a literal 'content-length' with the static table name index 28
+                String contentLength(body.Length());
+                std::string headers;
+                headers += static_cast<char>(0x88);
+                headers += static_cast<char>(0x0f);
+                headers += static_cast<char>(28 - 15);
+                headers += static_cast<char>(contentLength.Length());
+                headers.append(contentLength.CString(), contentLength.Length());
+                sent = SendFrame(client, FrameHeaders, FlagEndHeaders, streamId, headers) &&
+                    SendFrame(client, FrameData, FlagEndStream, streamId, std::string(body.CString(), body.Length()));
+                if (streamId > maxStreamId)
+                    maxStreamId = streamId;
+                ++numRequests;
+            }
+            if (!sent)
+                return false;
+        }
+        return true;
+    }
+
+    /// Sends a HTTP/2 frame to @c client. Returns false if sending failed.
+    bool SendFrame(Client &client, u8 type, u8 flags, uint streamId, const std::string &payload)
+    {
+        std::string frame;
+        uint length = static_cast<uint>(payload.size());
+        frame += static_cast<char>((length >> 16) & 0xff);
+        frame += static_cast<char>((length >> 8) & 0xff);
+        frame += static_cast<char>(length & 0xff);
+        frame += static_cast<char>(type);
+        frame += static_cast<char>(flags);
+        frame += static_cast<char>((streamId >> 24) & 0x7f);
+        frame += static_cast<char>((streamId >> 16) & 0xff);
+        frame += static_cast<char>((streamId >> 8) & 0xff);
+        frame += static_cast<char>(streamId & 0xff);
+        frame += payload;
+        return send(client.socket, frame.data(), static_cast<int>(frame.size()), 0) == static_cast<int>(frame.size());
+    }
+
+    /// Returns the response to a request with the header lines @c request.
+    String Respond(const String &request)
+    {
+        Urho3D::MutexLock lock(mutex_);
+        String headers;
+        if (!eTag_.Empty())
+            headers += "ETag: " + eTag_ + "\r\n";
+        if (!cacheControl_.Empty())
+            headers += "Cache-Control: " + cacheControl_ + "\r\n";
+
+        const String cIfNoneMatch = "\r\nif-none-match:";
+        uint header = request.ToLower().Find(cIfNoneMatch);
+        if (!eTag_.Empty() && header != String::NPOS)
+        {
+            uint valueStart = header + cIfNoneMatch.Length();
+            String value = request.Substring(valueStart, request.Find("\r\n", valueStart) - valueStart).Trimmed();
+            if (value == eTag_)
+            {
+                ++numNotModified;
+                return "HTTP/1.1 304 Not Modified\r\n" + headers + "Connection: keep-alive\r\n\r\n";
+            }
+        }
+        return Urho3D::ToString("HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: %u\r\n", body_.Length()) + headers +
+            "Connection: keep-alive\r\n\r\n" + body_;
+    }
+
+    SocketHandle listener_;
+    int port_;
+    Urho3D::Mutex mutex_;
+    String body_;
+    String eTag_;
+    String cacheControl_;
+    Vector<Client> clients_;
+};
+
+/// Pumps @c client until all @c requests have completed and been signaled.
+bool WaitForRequests(HttpClient *client, const HttpRequestPtrList &requests, uint timeoutMsec = 10000)
+{
+    Urho3D::Timer timer;
+    while (timer.GetMSec(false) < timeoutMsec)
+    {
+        client->Update(0.001f);
+
+        bool completed = true;
+        foreach(const HttpRequestPtr &request, requests)
+        {
+            if (!request->HasCompleted())
+            {
+                completed = false;
+                break;
+            }
+        }
+        if (completed)
+        {
+            // Completion is signaled on the next update
+            client->Update(0.001f);
+            return true;
+        }
+        Urho3D::Time::Sleep(1);
+    }
+    return false;
+}
+
+/// Returns the content of the loaded Binary asset @c assetRef, or empty string if it is not loaded.
+String LoadedAssetData(Framework *framework, const String &assetRef)
+{
+    SharedPtr<BinaryAsset> asset = framework->Asset()->FindAsset<BinaryAsset>(assetRef);
+    if (!asset || !asset->IsLoaded() || asset->data.Empty())
+        return "";
+    return String(reinterpret_cast<const char*>(&asset->data[0]), asset->data.Size());
+}
+
+/// Runs frames until the Binary asset @c assetRef is loaded with the content @c expected.
+bool WaitForAssetData(Framework *framework, const String &assetRef, const String &expected, uint timeoutMsec = 10000)
+{
+    Urho3D::Timer timer;
+    while (timer.GetMSec(false) < timeoutMsec)
+    {
+        framework->Pump();
+        if (LoadedAssetData(framework, assetRef) == expected)
+            return true;
+        Urho3D::Time::Sleep(1);
+    }
+    return false;
+}
+
+/// Runs frames until @c server has answered @c numRequests requests.
+bool WaitForServer(Framework *framework, const LocalHttpServer &server, uint numRequests, uint timeoutMsec = 10000)
+{
+    Urho3D::Timer timer;
+    while (timer.GetMSec(false) < timeoutMsec)
+    {
+        framework->Pump();
+        if (server.numRequests >= numRequests)
+            return true;
+        Urho3D::Time::Sleep(1);
+    }
+    return false;
+}
+
+/// Registers the HTTP asset provider and opens an empty asset cache for it.
+HttpAssetProvider *PrepareHttpAssets(Framework *framework)
+{
+    framework->RegisterModule(new HttpPlugin(framework));
+    framework->ModuleByName("HttpPlugin")->Initialize();
+    framework->Asset()->OpenAssetCache(framework->GetSubsystem<Urho3D::FileSystem>()->GetProgramDir() + "TestHttpAssetCache");
+    framework->Asset()->Cache()->ClearAssetCache();
+    return framework->Asset()->AssetProvider<HttpAssetProvider>().Get();
+}
+
+TEST_F(Runner, HttpSequentialRequestsReuseConnection)
+{
+    LocalHttpServer server;
+    ASSERT_TRUE(server.Start());
+
+    HttpClientPtr client(new HttpClient(framework));
+    ASSERT_TRUE(client->Stats() != nullptr);
+
+    const uint numRequests = 20;
+    for (uint i = 0; i < numRequests; ++i)
+    {
+        HttpRequestPtrList requests;
+        requests.Push(client->Get(server.Url("/sequential/" + String(i))));
+        ASSERT_TRUE(WaitForRequests(client, requests));
+
+        ASSERT_EQ(requests[0]->StatusCode(), 200);
+        ASSERT_EQ(requests[0]->ResponseBodySize(), server.Body().Length());
+    }
+
+    ASSERT_EQ(server.numRequests, numRequests);
+    ASSERT_EQ(server.numConnections, 1U);
+    ASSERT_EQ(client->Stats()->connections, 1U);
+}
+
+TEST_F(Runner, HttpConcurrentRequestsShareConnectionPool)
+{
+    LocalHttpServer server;
+    ASSERT_TRUE(server.Start());
+
+    HttpClientPtr client(new HttpClient(framework));
+
+    const uint numRequests = 200;
+    HttpRequestPtrList requests;
+    for (uint i = 0; i < numRequests; ++i)
+        requests.Push(client->Get(server.Url("/concurrent/" + String(i))));
+
+    Urho3D::Timer timer;
+    ASSERT_TRUE(WaitForRequests(client, requests));
+    Log(Urho3D::ToString("%u requests over %u connections in %u msec", numRequests, static_cast<uint>(server.numConnections), timer.GetMSec(false)), 2);
+
+    foreach(const HttpRequestPtr &request, requests)
+    {
+        ASSERT_EQ(request->StatusCode(), 200);
+        ASSERT_EQ(request->ResponseBodySize(), server.Body().Length());
+    }
+
+    // Requests to the same host are limited to a small per host connection pool
+    ASSERT_EQ(server.numRequests, numRequests);
+    ASSERT_LE(server.numConnections, 6U);
+}
+
+TEST_F(Runner, HttpHttp2MultiplexedRequests)
+{
+#if LIBCURL_VERSION_NUM >= 0x073200 // 7.50.0
+    curl_version_info_data *curlVersion = curl_version_info(CURLVERSION_NOW);
+    if (!(curlVersion->features & CURL_VERSION_HTTP2))
+    {
+        Log("Skipped, libcurl is built without HTTP/2 support", 2);
+        return;
+    }
+    // libcurl 7.88 fails every request that reuses a HTTP/2 connection without TLS with a framing layer error
+    if (curlVersion->version_num >= 0x075800 && curlVersion->version_num < 0x080000)
+    {
+        Log("Skipped, libcurl " + String(curlVersion->version) + " cannot reuse HTTP/2 connections without TLS", 2);
+        return;
+    }
+
+    LocalHttpServer server;
+    ASSERT_TRUE(server.Start());
+
+    HttpClientPtr client(new HttpClient(framework));
+
+    const uint numRequests = 50;
+    HttpRequestPtrList requests;
+    for (uint i = 0; i < numRequests; ++i)
+    {
+        requests.Push(client->Get(server.Url("/http2/" + String(i))));
+        ASSERT_TRUE(requests.Back()->SetHttp2PriorKnowledge(true));
+    }
+    ASSERT_TRUE(WaitForRequests(client, requests));
+
+    // The status line "HTTP/2 200" is parsed like any other
+    foreach(const HttpRequestPtr &request, requests)
+    {
+        ASSERT_EQ(request->StatusCode(), 200);
+        ASSERT_TRUE(request->ResponseHttpVersion() == "2.0");
+        ASSERT_EQ(request->ResponseBodySize(), server.Body().Length());
+    }
+
+    // Concurrent requests are multiplexed as streams of a single connection instead of using the connection pool
+    ASSERT_EQ(server.numRequests, numRequests);
+    ASSERT_EQ(server.numConnections, 1U);
+    ASSERT_EQ(server.maxStreamId, numRequests * 2 - 1);
+    ASSERT_EQ(client->Stats()->http2Requests, numRequests);
+#else
+    Log("Skipped, requires libcurl 7.50.0 or newer", 2);
+#endif
+}
+
+TEST_F(Runner, HttpStreamBodyToFile)
+{
+    LocalHttpServer server;
+    ASSERT_TRUE(server.Start());
+
+    HttpClientPtr client(new HttpClient(framework));
+    Urho3D::FileSystem *fileSystem = framework->GetSubsystem<Urho3D::FileSystem>();
+    String path = fileSystem->GetProgramDir() + "TestHttpStreamBody.tmp";
+    fileSystem->Delete(path);
+
+    HttpRequestPtrList requests;
+    // Requests are handed to the I/O thread on the next update, they can be configured until then
+    requests.Push(client->Get(server.Url("/stream")));
+    ASSERT_TRUE(requests[0]->SetCacheFiles("", path, ""));
+    ASSERT_TRUE(requests[0]->SetStreamBody(true));
+    ASSERT_TRUE(WaitForRequests(client, requests));
+
+    // Body is not buffered but written to the file and hashed as it arrived
+    const String &body = server.Body();
+    ASSERT_EQ(requests[0]->StatusCode(), 200);
+    ASSERT_TRUE(requests[0]->ResponseBodyStreamed());
+    ASSERT_TRUE(requests[0]->ResponseBody().Empty());
+    ASSERT_EQ(requests[0]->ResponseBodySize(), body.Length());
+    ASSERT_EQ(requests[0]->ResponseBodyHash(), HashData(reinterpret_cast<const u8*>(body.CString()), body.Length()));
+
+    {
+        Urho3D::File file(framework->GetContext(), path, Urho3D::FILE_READ);
+        ASSERT_TRUE(file.IsOpen());
+        ASSERT_EQ(file.GetSize(), body.Length());
+        String written;
+        written.Resize(file.GetSize());
+        file.Read(&written[0], file.GetSize());
+        ASSERT_TRUE(written == body);
+    }
+    fileSystem->Delete(path);
+}
+
+TEST_F(Runner, HttpCacheControlMaxAge)
+{
+    ASSERT_EQ(Http::CacheControlMaxAge(""), -1);
+    ASSERT_EQ(Http::CacheControlMaxAge("public"), -1);
+    ASSERT_EQ(Http::CacheControlMaxAge("max-age=3600"), 3600);
+    ASSERT_EQ(Http::CacheControlMaxAge("public, Max-Age=60, stale-while-revalidate=30"), 60);
+    ASSERT_EQ(Http::CacheControlMaxAge("max-age=-5"), 0);
+    ASSERT_EQ(Http::CacheControlMaxAge("max-age=3600, no-cache"), 0);
+    ASSERT_EQ(Http::CacheControlMaxAge("no-store"), 0);
+
+    ASSERT_FALSE(Http::CacheControlNoStore(""));
+    ASSERT_FALSE(Http::CacheControlNoStore("max-age=3600, no-cache"));
+    ASSERT_TRUE(Http::CacheControlNoStore("no-store"));
+    ASSERT_TRUE(Http::CacheControlNoStore("private, No-Store"));
+}
+
+TEST_F(Runner, HttpAssetCacheFileDeleted)
+{
+    LocalHttpServer server;
+    server.SetResponse("First version", "\"v1\"", "max-age=3600");
+    ASSERT_TRUE(server.Start());
+    HttpAssetProvider *provider = PrepareHttpAssets(framework);
+    ASSERT_TRUE(provider != 0);
+    AssetCache *cache = framework->Asset()->Cache();
+    const String assetRef = server.Url("/deleted.bin");
+
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "First version"));
+    String cacheFile = cache->FindInCache(assetRef);
+    ASSERT_FALSE(cacheFile.Empty());
+
+    // A cache file deleted behind the cache's back drops the entry, even a fresh copy is downloaded again unconditionally
+    ASSERT_TRUE(framework->GetSubsystem<Urho3D::FileSystem>()->Delete(cacheFile));
+    ASSERT_TRUE(cache->FindInCache(assetRef).Empty());
+    ASSERT_TRUE(cache->ETag(assetRef).Empty());
+    framework->Asset()->ForgetAsset(assetRef, false);
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "First version"));
+    ASSERT_EQ(server.numRequests, 2U);
+    ASSERT_EQ(server.numNotModified, 0U);
+    ASSERT_TRUE(cache->FindInCache(assetRef) == cacheFile);
+
+    framework->Asset()->ForgetAsset(assetRef, false);
+    cache->ClearAssetCache();
+}
+
+TEST_F(Runner, HttpAssetNoStore)
+{
+    LocalHttpServer server;
+    server.SetResponse("First version", "\"v1\"", "");
+    ASSERT_TRUE(server.Start());
+    HttpAssetProvider *provider = PrepareHttpAssets(framework);
+    ASSERT_TRUE(provider != 0);
+    AssetCache *cache = framework->Asset()->Cache();
+    const String assetRef = server.Url("/nostore.bin");
+
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "First version"));
+    ASSERT_FALSE(cache->FindInCache(assetRef).Empty());
+
+    // A 'no-store' response is loaded but neither its body nor its validators are stored, and the cached copy is dropped
+    server.SetResponse("Second version", "\"v2\"", "no-store");
+    framework->Asset()->ForgetAsset(assetRef, false);
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "Second version"));
+    ASSERT_TRUE(cache->FindInCache(assetRef).Empty());
+    ASSERT_TRUE(cache->ETag(assetRef).Empty());
+
+    // The next load is not conditional
+    framework->Asset()->ForgetAsset(assetRef, false);
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "Second version"));
+    ASSERT_EQ(server.numRequests, 3U);
+    ASSERT_EQ(server.numNotModified, 0U);
+
+    framework->Asset()->ForgetAsset(assetRef, false);
+    cache->ClearAssetCache();
+}
+
+TEST_F(Runner, HttpAssetRevalidation)
+{
+    LocalHttpServer server;
+    server.SetResponse("First version", "\"v1\"", "");
+    ASSERT_TRUE(server.Start());
+    HttpAssetProvider *provider = PrepareHttpAssets(framework);
+    ASSERT_TRUE(provider != 0);
+    AssetCache *cache = framework->Asset()->Cache();
+    const String assetRef = server.Url("/revalidate.bin");
+
+    // The first download stores the ETag with the cached copy
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "First version"));
+    ASSERT_EQ(server.numRequests, 1U);
+    ASSERT_TRUE(cache->ETag(assetRef) == "\"v1\"");
+    ASSERT_FALSE(cache->FindInCache(assetRef).Empty());
+
+    // Without max-age the copy is stale, so the next load sends a conditional request and is answered from the cache
+    framework->Asset()->ForgetAsset(assetRef, false);
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "First version"));
+    ASSERT_EQ(server.numRequests, 2U);
+    ASSERT_EQ(server.numNotModified, 1U);
+    ASSERT_EQ(framework->Asset()->FindAsset(assetRef)->DiskSourceType(), IAsset::Cached);
+
+    // A 304 response with max-age makes the copy fresh, and the next load does not contact the server
+    server.SetResponse("First version", "\"v1\"", "max-age=3600");
+    framework->Asset()->ForgetAsset(assetRef, false);
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "First version"));
+    ASSERT_EQ(server.numNotModified, 2U);
+    ASSERT_GT(cache->Expires(assetRef), Urho3D::Time::GetTimeSinceEpoch());
+    framework->Asset()->ForgetAsset(assetRef, false);
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "First version"));
+    ASSERT_EQ(server.numRequests, 3U);
+
+    // Changed content on the server replaces the stale copy
+    server.SetResponse("Second version", "\"v2\"", "");
+    cache->SetExpires(assetRef, 0);
+    framework->Asset()->ForgetAsset(assetRef, false);
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "Second version"));
+    ASSERT_EQ(server.numRequests, 4U);
+    ASSERT_EQ(server.numNotModified, 2U);
+    ASSERT_TRUE(cache->ETag(assetRef) == "\"v2\"");
+
+    framework->Asset()->ForgetAsset(assetRef, false);
+    cache->ClearAssetCache();
+}
+
+TEST_F(Runner, HttpAssetStaleWhileRevalidate)
+{
+    LocalHttpServer server;
+    server.SetResponse("First version", "\"v1\"", "");
+    ASSERT_TRUE(server.Start());
+    HttpAssetProvider *provider = PrepareHttpAssets(framework);
+    ASSERT_TRUE(provider != 0);
+    provider->SetStaleWhileRevalidate(true);
+    const String assetRef = server.Url("/stale.bin");
+
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "First version"));
+    ASSERT_EQ(server.numRequests, 1U);
+
+    // The stale copy is loaded right away and revalidated in the background, unchanged content is not reloaded
+    framework->Asset()->ForgetAsset(assetRef, false);
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "First version"));
+    ASSERT_TRUE(WaitForServer(framework, server, 2));
+    for (uint i = 0; i < 10; ++i)
+        framework->Pump();
+    ASSERT_EQ(server.numNotModified, 1U);
+    ASSERT_TRUE(LoadedAssetData(framework, assetRef) == "First version");
+
+    // Changed content is loaded from the stale copy first, and the asset is reloaded once the new content has arrived
+    server.SetResponse("Second version", "\"v2\"", "");
+    framework->Asset()->ForgetAsset(assetRef, false);
+    framework->Asset()->RequestAsset(assetRef, "Binary");
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "First version"));
+    ASSERT_TRUE(WaitForAssetData(framework, assetRef, "Second version"));
+    ASSERT_EQ(server.numRequests, 3U);
+    ASSERT_EQ(server.numNotModified, 1U);
+
+    framework->Asset()->ForgetAsset(assetRef, false);
+    framework->Asset()->Cache()->ClearAssetCache();
+}
+
+TUNDRA_TEST_MAIN();
@@ -0,0 +1,417 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "TestRunner.h"
+#include "TestBenchmark.h"
+
+#include "JavaScript.h"
+#include "JavaScriptInstance.h"
+#include "JavaScriptHeapAllocator.h"
+#include "MathBindings/MathBindings.h"
+#include "Entity.h"
+#include "DynamicComponent.h"
+#include "Script.h"
+#include "ScriptAsset.h"
+#include "AssetAPI.h"
+#include "AssetCache.h"
+
+#include <Urho3D/Core/Thread.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/IO/FileSystem.h>
+
+#include <cstring>
+
+using namespace Tundra;
+using namespace Tundra::Test;
+
+/// Vector math loop that creates several float3 and Quat temporaries per iteration.
+static const char* cVectorMathScript =
+    "var q = Quat.RotateY(0.01);\n"
+    "var v = new float3(1, 2, 3);\n"
+    "var sum = new float3(0, 0, 0);\n"
+    "for (var i = 0; i < 10000; ++i) {\n"
+    "    v = q.Transform(v);\n"
+    "    sum = sum.Add(v.Mul(0.5)).Sub(v.Cross(float3.unitY));\n"
+    "}\n"
+    "sum.Length();\n";
+
+/// Frame update of an isolated instance, which assigns an attribute of its entity, queues a call and tries to modify the scene.
+static const char* cIsolatedUpdateScript =
+    "engine.SetIsolated(true);\n"
+    "var refused = false;\n"
+    "frame.Updated.Connect(function(dt) {\n"
+    "    var dynamic = me.dynamicComponent;\n"
+    "    dynamic.speed = dynamic.speed + 1;\n"
+    "    engine.QueueMainThreadCall(function() { dynamic.speed = dynamic.speed * 10; });\n"
+    "    try { scene.CreateEntity(); } catch (e) { refused = true; }\n"
+    "});\n";
+
+/// Script whose global declarations are deletable only when it is run as eval code.
+static const char* cCompiledScript =
+    "function twice(x) { return 2 * x; }\n"
+    "var result = twice(21);\n"
+    "var thisIsGlobal = (this === Function('return this')());\n";
+
+/// Records the name changes of the entity's component, immediately and in batches, and disconnects handlers during the dispatch.
+static const char* cBatchedSignalScript =
+    "var comp = me.dynamicComponent;\n"
+    "var signal = comp.ComponentNameChanged;\n"
+    "var calls = [];\n"
+    "function OnNameChanged(newName, oldName) { calls.push(newName); }\n"
+    "function OnNameChangedBatch(events) { calls.push('[' + events.map(function(e) { return e[0]; }).join(',') + ']'); }\n"
+    "function DisconnectOnce() { calls.push('once'); signal.Disconnect(DisconnectOnce); }\n"
+    "function DisconnectOnceBatch(events) { calls.push('[once]'); signal.DisconnectBatched(DisconnectOnceBatch); }\n"
+    "signal.Connect(DisconnectOnce);\n"
+    "signal.Connect(OnNameChanged);\n"
+    "signal.ConnectBatched(DisconnectOnceBatch);\n"
+    "signal.ConnectBatched(OnNameChangedBatch);\n"
+    "signal.ConnectBatched(OnNameChangedBatch);\n";
+
+/// Returns the string value of the expression evaluated in ctx.
+static String EvalString(duk_context* ctx, const char* expression)
+{
+    duk_eval_string(ctx, expression);
+    String value = duk_safe_to_string(ctx, -1);
+    duk_pop(ctx);
+    return value;
+}
+
+/// Returns the boolean value of the expression evaluated in ctx.
+static bool EvalBoolean(duk_context* ctx, const char* expression)
+{
+    duk_eval_string(ctx, expression);
+    bool value = duk_get_boolean(ctx, -1) != 0;
+    duk_pop(ctx);
+    return value;
+}
+
+/// Records the attribute changes of a component and the threads they are made on.
+struct AttributeChangeRecorder
+{
+    AttributeChangeRecorder() : numChanges(0), numWorkerChanges(0) {}
+
+    void OnAttributeChanged(IAttribute* /*attribute*/, AttributeChange::Type /*change*/)
+    {
+        ++numChanges;
+        if (!Urho3D::Thread::IsMainThread())
+            ++numWorkerChanges;
+    }
+
+    int numChanges;
+    int numWorkerChanges;
+};
+
+/// Evaluates cVectorMathScript in ctx and returns its result.
+static double RunVectorMath(duk_context* ctx)
+{
+    duk_eval_string(ctx, cVectorMathScript);
+    double result = duk_get_number(ctx, -1);
+    duk_pop(ctx);
+    return result;
+}
+
+TEST_F(Runner, JavaScriptHeapAllocator)
+{
+    JavaScriptHeapAllocator allocator;
+
+    // Pooled sizes are reused, large ones go to malloc
+    void* small = allocator.Allocate(12);
+    ASSERT_TRUE(small != 0);
+    ASSERT_EQ(reinterpret_cast<size_t>(small) % 16, 0U);
+    allocator.Free(small);
+    ASSERT_EQ(allocator.Allocate(16), small);
+    ASSERT_EQ(allocator.AllocatedBytes(), 16U);
+
+    void* large = allocator.Allocate(JavaScriptHeapAllocator::cMaxPooledSize + 1);
+    ASSERT_TRUE(large != 0);
+    memset(large, 0xAB, JavaScriptHeapAllocator::cMaxPooledSize + 1);
+
+    // Reallocation keeps the content when moving between the pools and malloc
+    u8* grown = static_cast<u8*>(allocator.Reallocate(small, 1000));
+    ASSERT_TRUE(grown != 0);
+    memset(grown, 0xCD, 1000);
+    u8* shrunk = static_cast<u8*>(allocator.Reallocate(grown, 40));
+    for (uint i = 0; i < 40; ++i)
+        ASSERT_EQ(shrunk[i], 0xCD);
+
+    allocator.Free(shrunk);
+    allocator.Free(large);
+    ASSERT_EQ(allocator.AllocatedBytes(), 0U);
+}
+
+TEST_F(Runner, JavaScriptExecutionLimit)
+{
+    JavaScriptHeapAllocator allocator;
+    duk_context* ctx = allocator.CreateHeap();
+
+    // A runaway script is interrupted once over the budget, and catching the error does not keep it running
+    Urho3D::HiresTimer timer;
+    allocator.SetExecutionLimit(&timer, 20000);
+    ASSERT_TRUE(duk_peval_string(ctx, "while (true) { try { while (true) {} } catch (e) {} }") != 0);
+    const long long elapsed = timer.GetUSec(false);
+    ASSERT_TRUE(elapsed >= 20000);
+    ASSERT_TRUE(elapsed < 1000000);
+    ASSERT_TRUE(allocator.ExecutionLimitExceeded());
+    duk_pop(ctx);
+
+    // The heap is usable after removing the limit
+    allocator.SetExecutionLimit(0, 0);
+    ASSERT_FALSE(allocator.ExecutionLimitExceeded());
+    ASSERT_EQ(duk_peval_string(ctx, "1 + 2"), 0);
+    ASSERT_EQ(duk_get_int(ctx, -1), 3);
+    duk_pop(ctx);
+
+    duk_destroy_heap(ctx);
+}
+
+TEST_F(Runner, JavaScriptVectorMath)
+{
+    duk_context* defaultCtx = duk_create_heap_default();
+    JSBindings::ExposeMathClasses(defaultCtx);
+
+    JavaScriptHeapAllocator allocator;
+    duk_context* pooledCtx = allocator.CreateHeap();
+    JSBindings::ExposeMathClasses(pooledCtx);
+
+    // Both heaps must produce the same result
+    const double expected = RunVectorMath(defaultCtx);
+    ASSERT_EQ(RunVectorMath(pooledCtx), expected);
+    ASSERT_TRUE(expected > 0.0);
+
+    // After the warm-up run the temporaries of the pooled heap are served from its free lists
+    const size_t reserved = allocator.ReservedBytes();
+
+    Tundra::Benchmark::Iterations = 20;
+    BENCHMARK("Default heap", 16)
+    {
+        RunVectorMath(defaultCtx);
+        BENCHMARK_STEP_END;
+    }
+    BENCHMARK_END;
+
+    Tundra::Benchmark::Iterations = 20;
+    BENCHMARK("Pooled heap", 16)
+    {
+        RunVectorMath(pooledCtx);
+        BENCHMARK_STEP_END;
+    }
+    BENCHMARK_END;
+
+    Log("Pooled heap reserved " + String(static_cast<uint>(reserved / 1024)) + " KB after warm-up, " +
+        String(static_cast<uint>(allocator.ReservedBytes() / 1024)) + " KB after the benchmark", 4);
+    ASSERT_EQ(allocator.ReservedBytes(), reserved);
+
+    duk_destroy_heap(pooledCtx);
+    duk_destroy_heap(defaultCtx);
+}
+
+TEST_F(Runner, JavaScriptIsolatedUpdate)
+{
+    JavaScript* module = new JavaScript(framework.Get());
+    framework->RegisterModule(module);
+    module->Initialize();
+
+    EntityPtr entity = scene->CreateEntity();
+    Script* script = entity->CreateComponent<Script>().Get();
+    DynamicComponent* dynamic = entity->CreateComponent<DynamicComponent>().Get();
+    IAttribute* speed = dynamic->CreateAttribute("real", "speed");
+    ASSERT_TRUE(speed != 0);
+
+    AttributeChangeRecorder recorder;
+    dynamic->AttributeChanged.Connect(&recorder, &AttributeChangeRecorder::OnAttributeChanged);
+
+    SharedPtr<JavaScriptInstance> instance(new JavaScriptInstance(module, script));
+    ASSERT_TRUE(instance->Evaluate(cIsolatedUpdateScript, "IsolatedUpdate.js"));
+    ASSERT_TRUE(instance->IsIsolated());
+
+    // The assignment and then the queued call are applied on the main thread at the end of the frame
+    ProcessEvents();
+    ASSERT_EQ(static_cast<Attribute<float>*>(speed)->Get(), 10.f);
+    ASSERT_EQ(recorder.numChanges, 2);
+    ASSERT_EQ(recorder.numWorkerChanges, 0);
+
+    // The scene can not be modified directly from the worker thread
+    duk_context* ctx = instance->Context();
+    duk_get_global_string(ctx, "refused");
+    ASSERT_TRUE(duk_get_boolean(ctx, -1) != 0);
+    duk_pop(ctx);
+    ASSERT_EQ(scene->Entities().Size(), 1U);
+
+    ProcessEvents();
+    ASSERT_EQ(static_cast<Attribute<float>*>(speed)->Get(), 110.f);
+
+    instance.Reset();
+}
+
+TEST_F(Runner, JavaScriptSharedHeaps)
+{
+    JavaScript* module = new JavaScript(framework.Get());
+    framework->RegisterModule(module);
+    module->Initialize();
+
+    EntityPtr entity = scene->CreateEntity();
+    Script* script = entity->CreateComponent<Script>().Get();
+    const uint cNumInstances = 32;
+
+    // Every instance exposes all the bindings to a heap of its own
+    Vector<SharedPtr<JavaScriptInstance> > instances;
+    Urho3D::HiresTimer timer;
+    for (uint i = 0; i < cNumInstances; ++i)
+        instances.Push(SharedPtr<JavaScriptInstance>(new JavaScriptInstance(module, script)));
+    const long long ownHeapUsec = timer.GetUSec(false);
+    size_t ownHeapBytes = 0;
+    for (uint i = 0; i < cNumInstances; ++i)
+    {
+        ASSERT_TRUE(instances[i]->SharedHeap() == 0);
+        ownHeapBytes += instances[i]->HeapAllocator()->AllocatedBytes();
+    }
+    instances.Clear();
+
+    // The first pooled instance warms up the shared heap, the rest only copy the bindings to a new global scope
+    module->SetNumSharedHeaps(1);
+    SharedPtr<JavaScriptInstance> first(new JavaScriptInstance(module, script));
+    ASSERT_TRUE(first->SharedHeap() != 0);
+    JavaScriptHeapAllocator* sharedAllocator = first->HeapAllocator();
+    ProcessEvents();
+    const size_t baseBytes = sharedAllocator->AllocatedBytes();
+    timer.Reset();
+    for (uint i = 0; i < cNumInstances; ++i)
+        instances.Push(SharedPtr<JavaScriptInstance>(new JavaScriptInstance(module, script)));
+    const long long sharedHeapUsec = timer.GetUSec(false);
+    ASSERT_TRUE(instances.Back()->SharedHeap() == first->SharedHeap());
+    ASSERT_GT(sharedAllocator->AllocatedBytes(), baseBytes);
+    const size_t sharedHeapBytes = sharedAllocator->AllocatedBytes() - baseBytes;
+    EXPECT_LT(sharedHeapBytes, ownHeapBytes);
+
+    Log("Per script: own heap " + String(static_cast<uint>(ownHeapBytes / cNumInstances / 1024)) + " KB " +
+        String(static_cast<uint>(ownHeapUsec / cNumInstances)) + " us, shared heap " + String(static_cast<uint>(sharedHeapBytes / cNumInstances / 1024)) +
+        " KB " + String(static_cast<uint>(sharedHeapUsec / cNumInstances)) + " us", 4);
+
+    // Deleting the instances defers the collection of their global scopes to the next frame
+    instances.Clear();
+    ProcessEvents();
+    EXPECT_LT(sharedAllocator->AllocatedBytes(), baseBytes + sharedHeapBytes / 4);
+
+    first.Reset();
+}
+
+TEST_F(Runner, JavaScriptBatchedSignals)
+{
+    JavaScript* module = new JavaScript(framework.Get());
+    framework->RegisterModule(module);
+    module->Initialize();
+
+    EntityPtr entity = scene->CreateEntity();
+    Script* script = entity->CreateComponent<Script>().Get();
+    DynamicComponent* dynamic = entity->CreateComponent<DynamicComponent>().Get();
+
+    SharedPtr<JavaScriptInstance> instance(new JavaScriptInstance(module, script));
+    ASSERT_TRUE(instance->Evaluate(cBatchedSignalScript, "BatchedSignals.js"));
+    duk_context* ctx = instance->Context();
+
+    // The wrapper is created once per object and signal, and one C++ receiver serves both kinds of connections
+    ASSERT_TRUE(EvalBoolean(ctx, "comp.ComponentNameChanged === signal"));
+    ASSERT_TRUE(EvalBoolean(ctx, "me.dynamicComponent.ComponentNameChanged === signal"));
+    ASSERT_EQ(instance->SignalReceivers().Size(), 1U);
+
+    // Immediate connections are called on each emit, the batched ones at the end of the frame with all the emits in order.
+    // A handler that disconnects itself does not prevent the handlers after it from being called.
+    dynamic->SetName("a");
+    dynamic->SetName("b");
+    dynamic->SetName("c");
+    ASSERT_TRUE(EvalString(ctx, "calls.join(' ')") == "once a b c");
+    ProcessEvents();
+    ASSERT_TRUE(EvalString(ctx, "calls.join(' ')") == "once a b c [once] [a,b,c]");
+
+    // Each frame delivers only its own emits, and frames without emits do not call the batched handlers
+    ASSERT_TRUE(EvalBoolean(ctx, "calls = []; true"));
+    dynamic->SetName("d");
+    ProcessEvents();
+    ProcessEvents();
+    ASSERT_TRUE(EvalString(ctx, "calls.join(' ')") == "d [d]");
+
+    // Disconnecting a batched handler with emits pending drops them, and the receiver is erased with the last connection
+    dynamic->SetName("e");
+    ASSERT_TRUE(EvalBoolean(ctx, "signal.DisconnectBatched(OnNameChangedBatch); calls = []; true"));
+    ProcessEvents();
+    ASSERT_TRUE(EvalString(ctx, "calls.join(' ')") == "");
+    ASSERT_EQ(instance->SignalReceivers().Size(), 1U);
+    ASSERT_TRUE(EvalBoolean(ctx, "signal.Disconnect(OnNameChanged); true"));
+    ASSERT_EQ(instance->SignalReceivers().Size(), 0U);
+
+    // Emits queued before the object is destroyed are still delivered
+    ASSERT_TRUE(EvalBoolean(ctx, "signal.ConnectBatched(OnNameChangedBatch); calls = []; true"));
+    dynamic->SetName("f");
+    WeakPtr<DynamicComponent> weakDynamic(dynamic);
+    entity->RemoveComponent(ComponentPtr(dynamic));
+    dynamic = 0;
+    ASSERT_TRUE(weakDynamic.Expired());
+    ProcessEvents();
+    ASSERT_TRUE(EvalString(ctx, "calls.join(' ')") == "[f]");
+
+    // The cached wrapper of the destroyed object is inert, and the object no longer gives out wrappers
+    ASSERT_TRUE(EvalBoolean(ctx, "signal.Connect(OnNameChanged); signal.ConnectBatched(OnNameChanged); signal.Emit('g', 'f'); true"));
+    ASSERT_TRUE(EvalBoolean(ctx, "var threw = false; try { comp.ComponentNameChanged; } catch (e) { threw = true; } threw"));
+    ProcessEvents();
+    ASSERT_TRUE(EvalString(ctx, "calls.join(' ')") == "[f]");
+
+    instance.Reset();
+}
+
+TEST_F(Runner, JavaScriptCompiledScriptCache)
+{
+    JavaScript* module = new JavaScript(framework.Get());
+    framework->RegisterModule(module);
+    module->Initialize();
+    framework->Asset()->OpenAssetCache(framework->GetSubsystem<Urho3D::FileSystem>()->GetProgramDir() + "TestJavaScriptAssetCache");
+    AssetCache* cache = framework->Asset()->Cache();
+    cache->ClearAssetCache();
+
+    // The script is cached like a downloaded asset, so that its compiled code is tied to the cache entry
+    const String assetRef = "http://localhost/CompiledScript.js";
+    const uint scriptSize = static_cast<uint>(strlen(cCompiledScript)) + 1;
+    ASSERT_FALSE(cache->StoreAsset(reinterpret_cast<const u8*>(cCompiledScript), scriptSize, assetRef).Empty());
+    SharedPtr<ScriptAsset> asset(Urho3D::DynamicCast<ScriptAsset>(framework->Asset()->CreateNewAsset("ScriptAsset", assetRef)));
+    ASSERT_TRUE(asset.NotNull());
+    ASSERT_TRUE(asset->LoadFromFileInMemory(reinterpret_cast<const u8*>(cCompiledScript), scriptSize, false));
+
+    EntityPtr entity = scene->CreateEntity();
+    Script* script = entity->CreateComponent<Script>().Get();
+
+    // Compiling stores the bytecode in the cache, where it counts towards the cache size
+    SharedPtr<JavaScriptInstance> compiled(new JavaScriptInstance(module, script));
+    ASSERT_TRUE(asset->compiledCode.Empty());
+    ASSERT_TRUE(compiled->Evaluate(asset.Get()));
+    ASSERT_FALSE(asset->compiledCode.Empty());
+    ASSERT_EQ(cache->NumEntries(), 2U);
+    ASSERT_EQ(cache->TotalSize(), static_cast<u64>(scriptSize) + asset->compiledCode.Size() + 2 * sizeof(u32) + sizeof(u64));
+
+    // A new instance runs the bytecode loaded from the cache with the same eval semantics as the source
+    const Vector<u8> compiledCode = asset->compiledCode;
+    asset->compiledCode.Clear();
+    ASSERT_TRUE(module->LoadCompiledScript(asset.Get()));
+    ASSERT_TRUE(asset->compiledCode == compiledCode);
+    SharedPtr<JavaScriptInstance> loaded(new JavaScriptInstance(module, script));
+    ASSERT_TRUE(loaded->Evaluate(asset.Get()));
+    ASSERT_TRUE(asset->compiledCode == compiledCode);
+    JavaScriptInstance* instances[] = { compiled.Get(), loaded.Get() };
+    for (uint i = 0; i < 2; ++i)
+    {
+        duk_context* ctx = instances[i]->Context();
+        ASSERT_TRUE(EvalBoolean(ctx, "result === 42"));
+        ASSERT_TRUE(EvalBoolean(ctx, "thisIsGlobal"));
+        ASSERT_TRUE(EvalBoolean(ctx, "delete twice"));
+    }
+
+    // Deleting the script from the cache deletes its compiled code too
+    cache->DeleteAsset(assetRef);
+    ASSERT_EQ(cache->NumEntries(), 0U);
+    ASSERT_EQ(cache->TotalSize(), 0U);
+    asset->compiledCode.Clear();
+    ASSERT_FALSE(module->LoadCompiledScript(asset.Get()));
+
+    loaded.Reset();
+    compiled.Reset();
+    framework->Asset()->ForgetAsset(asset, false);
+}
+
+TUNDRA_TEST_MAIN();
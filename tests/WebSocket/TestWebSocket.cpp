@@ -0,0 +1,321 @@
+// For conditions of distribution and use, see copyright notice in LICENSE
+
+#include "TestRunner.h"
+#include "TestBenchmark.h"
+
+#include "WebSocketEventQueue.h"
+#include "WebSocketCompression.h"
+
+#include "kNet/DataSerializer.h"
+
+#include <Urho3D/Core/Thread.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/Math/Random.h>
+
+using namespace Tundra;
+using namespace Tundra::Test;
+
+/// Queue item that owns a heap payload, like SocketEvent owns the received message.
+struct TestEvent
+{
+    SharedPtr<RefCounted> payload;
+    uint sequence;
+    uint producer;
+
+    TestEvent() : sequence(0), producer(0) {}
+};
+
+/// Pushes @c count sequentially numbered events to the queue.
+class EventProducer : public Urho3D::Thread
+{
+public:
+    EventProducer(WebSocket::EventQueue<TestEvent> &queue, uint count, uint producer = 0) :
+        queue_(queue),
+        count_(count),
+        producer_(producer)
+    {
+    }
+
+    void ThreadFunction() override
+    {
+        for (uint i = 1; i <= count_ && shouldRun_; ++i)
+        {
+            TestEvent event;
+            event.payload = new RefCounted();
+            event.sequence = i;
+            event.producer = producer_;
+            queue_.Push(event);
+        }
+    }
+
+private:
+    WebSocket::EventQueue<TestEvent> &queue_;
+    uint count_;
+    uint producer_;
+};
+
+TEST_F(Runner, WebSocketEventQueueOrder)
+{
+    WebSocket::EventQueue<TestEvent> queue(6);
+    ASSERT_EQ(queue.Capacity(), 8U);
+
+    TestEvent event;
+    ASSERT_FALSE(queue.Pop(event));
+
+    // Overflow the ring, order must be kept
+    for (uint i = 1; i <= 20; ++i)
+    {
+        event.payload = new RefCounted();
+        event.sequence = i;
+        queue.Push(event);
+        ASSERT_EQ(event.sequence, 0U);
+        ASSERT_TRUE(event.payload.Null());
+    }
+    for (uint i = 1; i <= 10; ++i)
+    {
+        ASSERT_TRUE(queue.Pop(event));
+        ASSERT_EQ(event.sequence, i);
+        ASSERT_EQ(event.payload.Refs(), 1);
+        event.payload.Reset();
+        event.sequence = 0;
+    }
+
+    // Still overflowing, new items go after the remaining ones
+    event.sequence = 21;
+    queue.Push(event);
+    for (uint i = 11; i <= 21; ++i)
+    {
+        ASSERT_TRUE(queue.Pop(event));
+        ASSERT_EQ(event.sequence, i);
+        event.payload.Reset();
+        event.sequence = 0;
+    }
+    ASSERT_FALSE(queue.Pop(event));
+
+    // Drained, the ring is used again
+    event.sequence = 22;
+    queue.Push(event);
+    ASSERT_TRUE(queue.Pop(event));
+    ASSERT_EQ(event.sequence, 22U);
+}
+
+TEST_F(Runner, WebSocketEventQueueConcurrent)
+{
+    const uint count = 1000000;
+    WebSocket::EventQueue<TestEvent> queue(1024);
+    EventProducer producer(queue, count);
+
+    Urho3D::HiresTimer timer;
+    ASSERT_TRUE(producer.Run());
+
+    uint expected = 1;
+    TestEvent event;
+    Urho3D::Timer timeout;
+    while (expected <= count && timeout.GetMSec(false) < 30000)
+    {
+        if (!queue.Pop(event))
+            continue;
+        ASSERT_EQ(event.sequence, expected);
+        ASSERT_FALSE(event.payload.Null());
+        event.payload.Reset();
+        ++expected;
+    }
+    producer.Stop();
+
+    ASSERT_EQ(expected, count + 1);
+    ASSERT_FALSE(queue.Pop(event));
+    Log(Urho3D::ToString("%u events in %.2f msec", count, timer.GetUSec(false) / 1000.0), 2);
+}
+
+TEST_F(Runner, WebSocketEventQueueMultipleProducers)
+{
+    // A small ring, so that the producers also go through the overflow
+    const uint count = 250000;
+    const uint numProducers = 4;
+    WebSocket::EventQueue<TestEvent> queue(64);
+    EventProducer producer0(queue, count, 0), producer1(queue, count, 1), producer2(queue, count, 2), producer3(queue, count, 3);
+    EventProducer* producers[numProducers] = { &producer0, &producer1, &producer2, &producer3 };
+
+    Urho3D::HiresTimer timer;
+    for (uint i = 0; i < numProducers; ++i)
+        ASSERT_TRUE(producers[i]->Run());
+
+    // The events of each producer arrive in order, interleaved with the others
+    PODVector<uint> expected(numProducers);
+    for (uint i = 0; i < numProducers; ++i)
+        expected[i] = 1;
+    uint numReceived = 0;
+    TestEvent event;
+    Urho3D::Timer timeout;
+    while (numReceived < count * numProducers && timeout.GetMSec(false) < 30000)
+    {
+        if (!queue.Pop(event))
+            continue;
+        ASSERT_LT(event.producer, numProducers);
+        ASSERT_EQ(event.sequence, expected[event.producer]);
+        ASSERT_FALSE(event.payload.Null());
+        event.payload.Reset();
+        ++expected[event.producer];
+        ++numReceived;
+    }
+    for (uint i = 0; i < numProducers; ++i)
+        producers[i]->Stop();
+
+    ASSERT_EQ(numReceived, count * numProducers);
+    ASSERT_FALSE(queue.Pop(event));
+    Log(Urho3D::ToString("%u events from %u producers in %.2f msec", numReceived, numProducers, timer.GetUSec(false) / 1000.0), 2);
+}
+
+typedef Vector<std::string> FrameList;
+
+/// Generates batched frames resembling the sync of a scene to a newly logged in client, followed by transform updates.
+FrameList GenerateSyncStream(uint numEntities)
+{
+    const char *meshes[] = { "local://avatar.mesh", "local://tree.mesh", "http://assets.example.com/scenes/city/building.mesh" };
+    const char *names[] = { "Placeable", "Mesh", "Name", "RigidBody" };
+
+    FrameList frames;
+    std::string frame;
+    char buffer[1024];
+    for (uint i = 0; i < numEntities * 2; ++i)
+    {
+        const bool create = (i < numEntities);
+        kNet::DataSerializer ds(buffer + 6, sizeof(buffer) - 6);
+        ds.AddVLE<kNet::VLE8_16_32>(i % numEntities + 1); // Entity ID
+        for (uint c = 0; c < (create ? 4U : 1U); ++c)
+        {
+            ds.AddVLE<kNet::VLE8_16_32>(c + 20);
+            ds.AddString(names[c]);
+            for (uint f = 0; f < 9; ++f)
+                ds.Add<float>(static_cast<float>((i * 7 + f * 13) % 100) * (create ? 1.0f : 0.01f));
+            if (create)
+                ds.AddString(meshes[i % 3]);
+        }
+
+        // Batch entry header
+        kNet::DataSerializer header(buffer, 6);
+        header.AddVLE<kNet::VLE8_16_32>(static_cast<u32>(ds.BytesFilled()));
+        header.Add<u16>(create ? 110 : 113);
+        frame.append(buffer, header.BytesFilled());
+        frame.append(buffer + 6, ds.BytesFilled());
+
+        // Flush 20 messages per frame
+        if (i % 20 == 19)
+        {
+            frames.Push(frame);
+            frame.clear();
+        }
+    }
+    if (!frame.empty())
+        frames.Push(frame);
+    return frames;
+}
+
+/// Reads a stream recorded with the '--wsRecordSyncStream' server parameter.
+FrameList ReadSyncStream(Urho3D::Context *context, const String &path)
+{
+    FrameList frames;
+    Urho3D::File file(context, path, Urho3D::FILE_READ);
+    while (file.IsOpen() && !file.IsEof())
+    {
+        uint size = file.ReadUInt();
+        std::string frame(size, '\0');
+        if (size == 0 || file.Read(&frame[0], size) != size)
+            break;
+        frames.Push(frame);
+    }
+    return frames;
+}
+
+TEST_F(Runner, WebSocketCompressionRoundtrip)
+{
+    FrameList frames = GenerateSyncStream(200);
+    ASSERT_FALSE(frames.Empty());
+
+    for (uint d = 0; d < 2; ++d)
+    {
+        const bool useDictionary = TrueAndFalse[d];
+        WebSocket::Deflater deflater(6, useDictionary);
+        WebSocket::Inflater inflater(useDictionary);
+        ASSERT_TRUE(deflater.IsValid());
+        ASSERT_TRUE(inflater.IsValid());
+
+        size_t rawBytes = 0, compressedBytes = 0;
+        foreach(const std::string &frame, frames)
+        {
+            std::string compressed, decompressed;
+            ASSERT_TRUE(deflater.Compress(frame.data(), frame.size(), compressed));
+            ASSERT_TRUE(inflater.Decompress(compressed.data(), compressed.size(), decompressed));
+            ASSERT_TRUE(decompressed == frame);
+            rawBytes += frame.size();
+            compressedBytes += compressed.size();
+        }
+        ASSERT_LT(compressedBytes, rawBytes);
+    }
+
+    // Incompressible data larger than the output chunk
+    WebSocket::Deflater deflater(1);
+    WebSocket::Inflater inflater;
+    std::string random(256 * 1024, '\0'), compressed, decompressed;
+    for (size_t i = 0; i < random.size(); ++i)
+        random[i] = static_cast<char>(Urho3D::Rand());
+    ASSERT_TRUE(deflater.Compress(random.data(), random.size(), compressed));
+    ASSERT_TRUE(inflater.Decompress(compressed.data(), compressed.size(), decompressed));
+    ASSERT_TRUE(decompressed == random);
+}
+
+TEST_F(Runner, WebSocketCompressionReplay)
+{
+    // Replay a recorded stream if there is one in the working directory, otherwise a generated one
+    const String path = "WebSocketSyncStream.bin";
+    FrameList frames;
+    if (framework->GetSubsystem<Urho3D::FileSystem>()->FileExists(path))
+    {
+        frames = ReadSyncStream(framework->GetContext(), path);
+        Log("Replaying " + String(frames.Size()) + " recorded frames from " + path, 2);
+    }
+    else
+    {
+        frames = GenerateSyncStream(2000);
+        Log("Replaying " + String(frames.Size()) + " generated frames, record a stream to " + path + " with --wsRecordSyncStream", 2);
+    }
+    ASSERT_FALSE(frames.Empty());
+
+    size_t rawBytes = 0;
+    foreach(const std::string &frame, frames)
+        rawBytes += frame.size();
+
+    const int levels[] = { 1, 6, 9 };
+    for (uint l = 0; l < 3; ++l)
+    {
+        for (uint d = 0; d < 2; ++d)
+        {
+            const bool useDictionary = TrueAndFalse[d];
+            size_t compressedBytes = 0;
+            Tundra::Benchmark::Iterations = 10;
+
+            BENCHMARK(Urho3D::ToString("Level %d%s", levels[l], useDictionary ? " dict" : ""), 16)
+            {
+                WebSocket::Deflater deflater(levels[l], useDictionary);
+                std::string compressed;
+                compressedBytes = 0;
+                foreach(const std::string &frame, frames)
+                {
+                    compressed.clear();
+                    deflater.Compress(frame.data(), frame.size(), compressed);
+                    compressedBytes += compressed.size();
+                }
+                BENCHMARK_STEP_END;
+            }
+            BENCHMARK_END;
+
+            Log(Urho3D::ToString("%u -> %u bytes (%.1f%%)", static_cast<uint>(rawBytes), static_cast<uint>(compressedBytes),
+                100.0 * compressedBytes / rawBytes), 4);
+            ASSERT_LT(compressedBytes, rawBytes);
+        }
+    }
+}
+
+TUNDRA_TEST_MAIN();
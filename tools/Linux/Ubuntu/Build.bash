@@ -320,7 +320,7 @@ if [ $skip_deps = false ] ; then
     if ! is_cloned ; then
         git clone https://github.com/bulletphysics/bullet3 bullet
         cd bullet
-        git checkout 2.83.6
+        git checkout 2.88
     fi
 
     if ! is_built ; then
@@ -335,6 +335,7 @@ if [ $skip_deps = false ] ; then
             -DBUILD_UNIT_TESTS:BOOL=OFF \
             -DBUILD_BULLET3:BOOL=OFF \
             -DBUILD_BULLET2_DEMOS:BOOL=OFF \
+            -DBULLET2_MULTITHREADING:BOOL=ON \
             -DCMAKE_MINSIZEREL_POSTFIX= -DCMAKE_RELWITHDEBINFO_POSTFIX=
 
         make -j $num_cpu -S
@@ -514,14 +514,14 @@ IF NOT EXIST "%DEPS%\bullet\". (
     cd "%DEPS%"
     git clone https://github.com/bulletphysics/bullet3 bullet
     cd "%DEPS%/bullet"
-    git checkout 2.83.6
+    git checkout 2.88
     IF NOT EXIST "%DEPS%\bullet\.git" GOTO :ERROR
 )
 
 cd "%DEPS%\bullet\"
 cecho {0D}Running CMake for Bullet.{# #}{\n}
 cmake . -G %GENERATOR% -DBUILD_EXTRAS:BOOL=OFF -DBUILD_UNIT_TESTS:BOOL=OFF ^
-    -DBUILD_BULLET3:BOOL=OFF -DBUILD_BULLET2_DEMOS:BOOL=OFF ^
+    -DBUILD_BULLET3:BOOL=OFF -DBUILD_BULLET2_DEMOS:BOOL=OFF -DBULLET2_MULTITHREADING:BOOL=ON ^
     -DCMAKE_DEBUG_POSTFIX=_d -DUSE_MSVC_RUNTIME_LIBRARY_DLL:BOOL=ON ^
     -DCMAKE_MINSIZEREL_POSTFIX= -DCMAKE_RELWITHDEBINFO_POSTFIX=
 IF NOT %ERRORLEVEL%==0 GOTO :ERROR